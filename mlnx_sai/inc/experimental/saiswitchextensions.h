@@ -36,6 +36,22 @@ typedef enum _sai_switch_attr_extensions_t
 {
     SAI_SWITCH_ATTR_EXTENSIONS_RANGE_START = SAI_SWITCH_ATTR_END,
 
+    /**
+     * @brief Per API call counters and latencies
+     *
+     * Flat list with 10 values for every object type and operation that was called:
+     * object type, operation (0 - create, 1 - remove, 2 - set, 3 - get, 4 - bulk get,
+     * 5 - get stats), calls, errors, average, median, 99th percentile and maximal
+     * latency, average time waiting for the DB lock, average time in the SDK calls
+     * (only measured when built with --enable-sdk-trace, 0 otherwise). Times are in
+     * microseconds, the percentiles are precise to a factor of 2.
+     * Collected when the SAI_API_STATS_ENABLED profile key is set.
+     *
+     * @type sai_u32_list_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_API_LATENCY_STATS = SAI_SWITCH_ATTR_EXTENSIONS_RANGE_START,
+
     SAI_SWITCH_ATTR_EXTENSIONS_RANGE_END
 
 } sai_switch_attr_extensions_t;
@@ -181,6 +181,12 @@ int msync(void *addr, size_t length, int flags);
 
 extern uint64_t test_sx_api_init_set_ms;
 uint64_t time_ms_get(void);
+uint64_t time_us_get(void);
+void mlnx_boot_trace_reset(void);
+void mlnx_boot_trace_add(_In_ const char *name, _In_ const char *category, _In_ uint64_t start_us,
+                         _In_ uint64_t end_us);
+uint64_t mlnx_boot_trace_mark(_In_ const char *name, _In_ const char *category, _In_ uint64_t start_us);
+sai_status_t mlnx_boot_trace_dump(_In_ const char *dir);
 
 extern sx_api_handle_t            gh_sdk;
 extern sai_service_method_table_t g_mlnx_services;
@@ -365,12 +371,30 @@ typedef struct _mlnx_shm_rm_array_info_t {
     size_t elem_size;
     size_t elem_count; /* initialized via elem_count_fn()*/
     size_t offset_to_head;
+    size_t used_count; /* maintained by alloc/free, to avoid scanning the array */
 } mlnx_shm_rm_array_info_t;
 typedef struct _mlnx_shm_rm_array_init_info_t {
     size_t                  elem_size;
     mlnx_shm_rm_size_get_fn elem_count_fn;
     size_t                  elem_count; /* initialized via elem_count_fn()*/
 } mlnx_shm_rm_array_init_info_t;
+/*
+ * Tables of the SAI DB with the entries addressed by position, not allocated with mlnx_shm_rm_array_alloc().
+ * They follow the rm arrays in the shared memory and are sized on switch init from the profile and the chip
+ * limits instead of the worst case of all the chips (see sai_db_t table_info).
+ */
+typedef enum {
+    MLNX_SHM_TABLE_TYPE_BRIDGE_PORT,
+    MLNX_SHM_TABLE_TYPE_L2MC_GROUP_MEMBER,
+    MLNX_SHM_TABLE_TYPE_POLICER_SX_HASH,
+    MLNX_SHM_TABLE_TYPE_HOSTIF,
+    MLNX_SHM_TABLE_TYPE_SIZE
+} mlnx_shm_table_type_t;
+typedef struct _mlnx_shm_table_info_t {
+    size_t elem_size;
+    size_t elem_count;
+    size_t offset_to_head; /* from the start of the rm arrays */
+} mlnx_shm_table_info_t;
 typedef uint16_t mlnx_shm_array_canary_t;
 typedef struct _mlnx_shm_array_t {
     bool                    is_used;
@@ -397,6 +421,9 @@ sai_status_t mlnx_shm_rm_array_alloc(_In_ mlnx_shm_rm_array_type_t  type,
                                      _Out_ mlnx_shm_rm_array_idx_t *idx,
                                      _Out_ void                   **elem);
 sai_status_t mlnx_shm_rm_array_free(_In_ mlnx_shm_rm_array_idx_t idx);
+void mlnx_shm_rm_array_hdr_used_set(_In_ mlnx_shm_rm_array_type_t type,
+                                    _Inout_ mlnx_shm_array_hdr_t  *array_hdr,
+                                    _In_ bool                      is_used);
 uint32_t mlnx_shm_rm_array_free_entries_count(_In_ mlnx_shm_rm_array_type_t type);
 sai_status_t mlnx_shm_rm_array_find(_In_ mlnx_shm_rm_array_type_t  type,
                                     _In_ mlnx_shm_rm_array_cmp_fn  cmp_fn,
@@ -539,6 +566,25 @@ typedef struct _mlnx_object_id_t mlnx_object_id_t;
 typedef sai_status_t (*mlnx_availability_get_fn)(_In_ sai_object_id_t switch_id, _In_ uint32_t attr_count,
                                                  _In_ const sai_attribute_t *attr_list, _Out_ uint64_t *count);
 
+/* Output of the object key enumeration, list is NULL when only the count is requested */
+typedef struct _mlnx_object_key_list_t {
+    sai_object_key_t *list;
+    uint32_t          size;
+    uint32_t          count;
+} mlnx_object_key_list_t;
+
+#define MLNX_OBJECT_KEY_SDK_PAGE_SIZE (256)
+
+typedef sai_status_t (*mlnx_object_key_list_get_fn)(_In_ sai_object_id_t            switch_id,
+                                                    _Inout_ mlnx_object_key_list_t *keys);
+typedef sai_status_t (*mlnx_shm_rm_oid_create_fn)(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ sai_object_id_t *oid);
+
+sai_object_key_t* mlnx_object_key_list_next(_Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_object_key_list_oid_add(_Inout_ mlnx_object_key_list_t *keys, _In_ sai_object_id_t oid);
+sai_status_t mlnx_object_key_list_rm_array_fill(_Inout_ mlnx_object_key_list_t *keys,
+                                                _In_ mlnx_shm_rm_array_type_t type,
+                                                _In_ mlnx_shm_rm_oid_create_fn oid_create);
+
 typedef struct _mlnx_sai_attr_t {
     bool                   found;
     uint32_t               index;
@@ -599,6 +645,12 @@ typedef struct mlnx_bridge_rif_ {
     uint32_t                    index;
     mlnx_rif_mac_data_t         mac_data;
 } mlnx_bridge_rif_t;
+typedef enum _mlnx_bridge_port_index_type_t {
+    MLNX_BRIDGE_PORT_INDEX_LOG,    /* by logical (port, LAG or vport) */
+    MLNX_BRIDGE_PORT_INDEX_TUNNEL, /* by SAI tunnel DB index */
+    MLNX_BRIDGE_PORT_INDEX_VPORT,  /* by parent port and VLAN of a sub-port */
+    MLNX_BRIDGE_PORT_INDEX_MAX
+} mlnx_bridge_port_index_type_t;
 typedef struct mlnx_bridge_port_ {
     uint32_t               index;
     bool                   is_present;
@@ -615,6 +667,7 @@ typedef struct mlnx_bridge_port_ {
     uint16_t               stps;
     mlnx_acl_pbs_entry_t   pbs_entry;
     uint32_t               l2mc_group_ref;
+    uint32_t               index_next[MLNX_BRIDGE_PORT_INDEX_MAX];
 } mlnx_bridge_port_t;
 
 typedef sai_status_t (*sai_attribute_set_fn)(_In_ const sai_object_key_t *key, _In_ const sai_attribute_value_t *value,
@@ -628,10 +681,34 @@ typedef struct _mlnx_fdb_cache_t {
     bool                       fdb_cache_set;
 } mlnx_fdb_cache_t;
 
+typedef struct _mlnx_route_cache_t {
+    sx_uc_route_get_entry_t route_get_entry;
+    sx_router_id_t          vrid;
+    bool                    route_cache_set;
+} mlnx_route_cache_t;
+
+typedef struct _mlnx_neighbor_cache_t {
+    sx_neigh_get_entry_t neigh_get_entry;
+    bool                 neigh_cache_set;
+} mlnx_neighbor_cache_t;
+
 typedef union {
-    mlnx_fdb_cache_t fdb_cache;
+    mlnx_fdb_cache_t      fdb_cache;
+    mlnx_route_cache_t    route_cache;
+    mlnx_neighbor_cache_t neighbor_cache;
 } vendor_cache_t;
 
+/* Pre-fills the getter caches of the bulk get from the SDK table, entries not found are left unset */
+typedef sai_status_t (*mlnx_bulk_get_cache_fill_fn)(_In_ uint32_t                object_count,
+                                                    _In_ const sai_object_key_t *object_key,
+                                                    _Inout_ vendor_cache_t      *caches);
+
+/* Below this number of objects it is cheaper to get each entry from SDK than walking the table,
+ * for a big table the threshold is the number of the SDK pages of the table */
+#define MLNX_BULK_GET_CACHE_FILL_MIN_OBJECTS (64)
+
+sai_status_t mlnx_switch_table_used_entries_get(_In_ sai_object_type_t object_type, _Out_ uint32_t *count);
+
 typedef sai_status_t (*sai_attribute_get_fn)(_In_ const sai_object_key_t *key, _Inout_ sai_attribute_value_t *value,
                                              _In_ uint32_t attr_index, _Inout_ vendor_cache_t *cache, void *arg);
 typedef struct _sai_vendor_attribute_entry_t {
@@ -916,6 +993,13 @@ sai_status_t sai_get_attributes(_In_ const sai_object_key_t *key,
                                 _In_ sai_object_type_t       object_type,
                                 _In_ uint32_t                attr_count,
                                 _Inout_ sai_attribute_t     *attr_list);
+sai_status_t sai_bulk_get_attributes(_In_ sai_object_type_t       object_type,
+                                     _In_ uint32_t                object_count,
+                                     _In_ const sai_object_key_t *object_key,
+                                     _In_ const uint32_t         *attr_count,
+                                     _Inout_ sai_attribute_t    **attr_list,
+                                     _Inout_ vendor_cache_t      *caches,
+                                     _Out_ sai_status_t          *object_statuses);
 sai_status_t mlnx_bulk_attrs_validate(_In_ uint32_t                 object_count,
                                       _In_ const uint32_t          *attr_count,
                                       _In_ const sai_attribute_t  **attr_list_for_create,
@@ -1033,14 +1117,21 @@ sai_status_t mlnx_translate_sai_ip_prefix_to_sdk(_In_ const sai_ip_prefix_t *sai
 _Success_(return == SAI_STATUS_SUCCESS)
 sai_status_t mlnx_translate_sdk_ip_prefix_to_sai(_In_ const sx_ip_prefix_t *sdk_prefix,
                                                  _Out_ sai_ip_prefix_t     *sai_prefix);
+int mlnx_sdk_ip_addr_cmp(_In_ const sx_ip_addr_t *a, _In_ const sx_ip_addr_t *b);
+int mlnx_sdk_ip_prefix_cmp(_In_ const sx_ip_prefix_t *a, _In_ const sx_ip_prefix_t *b);
 
 sai_status_t mlnx_qos_map_set_default(_Inout_ mlnx_qos_map_t *qos_map);
 _Success_(return == SAI_STATUS_SUCCESS)
 sai_status_t mlnx_qos_map_get_by_id(_In_ sai_object_id_t obj_id, _Out_ mlnx_qos_map_t **qos_map);
+/* DB write lock is needed */
+void mlnx_qos_maps_db_init(void);
 
 sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
                                      _In_ const sai_object_id_t    qos_map_id,
                                      _In_ const sai_qos_map_type_t qos_map_type);
+sai_status_t mlnx_port_qos_map_update(_In_ const sai_object_id_t    port,
+                                      _In_ const sai_object_id_t    qos_map_id,
+                                      _In_ const sai_qos_map_type_t qos_map_type);
 
 sai_status_t mlnx_get_hostif_packet_data(sx_receive_info_t *receive_info, uint32_t *attr_num, sai_attribute_t *attr);
 
@@ -1083,6 +1174,9 @@ sai_status_t mlnx_isolation_group_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_object_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_object_eth_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_issu_storage_log_set(sx_verbosity_level_t level);
+sai_status_t mlnx_stats_cache_log_set(sx_verbosity_level_t level);
+sai_status_t mlnx_api_stats_log_set(sx_verbosity_level_t level);
+sai_status_t mlnx_sdk_trace_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_interfacequery_log_set(sx_verbosity_level_t level);
 
 sai_status_t mlnx_fill_objlist(const sai_object_id_t *data, uint32_t count, sai_object_list_t *list);
@@ -1310,9 +1404,15 @@ extern const mlnx_trap_info_t mlnx_traps_info[];
 #define MAX_BRIDGE_1Q_PORTS (MAX_PORTS_DB * 2) /* Ports and LAGs */
 #define MAX_BRIDGE_RIFS     550 /* 256 for VXLAN VNETs + some spare */
 #define MAX_BRIDGE_PORTS    (MAX_VPORTS + MAX_BRIDGE_1Q_PORTS + MAX_BRIDGE_RIFS)
+/* Bridge ports DB size of the running switch, up to MAX_BRIDGE_PORTS */
+#define MLNX_BRIDGE_PORTS_DB_SIZE (mlnx_shm_table_size(MLNX_SHM_TABLE_TYPE_BRIDGE_PORT))
 #define MAX_LANES_SPC1_2    4
 #define MAX_LANES_SPC3_4    8
 #define MAX_HOSTIFS         1000
+/* Host interfaces of the default DB size on top of a hostif per port and LAG - VLAN, FD and genetlink */
+#define MLNX_HOSTIF_DB_SPARE (256)
+/* Host interfaces DB size of the running switch, from the chip limits unless set in the profile */
+#define MLNX_HOSTIF_DB_SIZE (mlnx_shm_table_size(MLNX_SHM_TABLE_TYPE_HOSTIF))
 #define MAX_TRAP_GROUPS     32
 #define MIN_SX_BRIDGE_ID    0x1000
 
@@ -1388,6 +1488,9 @@ typedef struct _mlnx_policer_db_entry_t {
     sx_policer_id_t         sx_policer_id_acl_mirror;
     sx_policer_id_t         sx_policer_id_span_session;
     sx_policer_attributes_t sx_policer_attr;        /* Policer attribute values. The values will be applied to trap group, ACL and port storm policers.*/
+    /* Next links of sx_policer_id_trap and sx_policer_id_acl in the sx policer id hash */
+    uint32_t sx_policer_id_trap_next;
+    uint32_t sx_policer_id_acl_next;
 } mlnx_policer_db_entry_t;
 
 typedef struct {
@@ -1502,6 +1605,9 @@ typedef struct _mlnx_port_config_t {
     uint32_t        isolation_group_bridge_port_refcount;
     sai_object_id_t isolation_group;
     uint32_t        hostif_table_refcount;
+    /* Generation of the ECMP/LAG hash config pushed to the port, 0 - never pushed */
+    uint32_t ecmp_hash_cfg_gen;
+    uint32_t lag_hash_cfg_gen;
 } mlnx_port_config_t;
 typedef enum {
     MLNX_FID_FLOOD_TYPE_ALL,
@@ -1598,6 +1704,7 @@ sai_status_t mlnx_bridge_port_to_oid(mlnx_bridge_port_t *port, sai_object_id_t *
 sai_status_t mlnx_bridge_port_by_idx(uint32_t idx, mlnx_bridge_port_t **port);
 sai_status_t mlnx_bridge_port_by_oid(sai_object_id_t oid, mlnx_bridge_port_t **port);
 sai_status_t mlnx_bridge_port_by_tunnel_id(sx_tunnel_id_t sx_tunnel, mlnx_bridge_port_t **port);
+sai_status_t mlnx_bridge_port_by_vport(sx_port_log_id_t log_port, sx_vlan_id_t vlan_id, mlnx_bridge_port_t **port);
 sai_status_t mlnx_bridge_rif_add(sx_router_id_t vrf_id, mlnx_bridge_rif_t **rif);
 sai_status_t mlnx_bridge_rif_del(mlnx_bridge_rif_t *rif);
 sai_status_t mlnx_bridge_rif_by_idx(uint32_t idx, mlnx_bridge_rif_t **rif);
@@ -1612,6 +1719,9 @@ sai_status_t mlnx_rif_sx_to_sai_oid(_In_ sx_router_interface_t sx_rif_id, _Out_
 sai_status_t mlnx_rif_oid_counter_get(_In_ sai_object_id_t rif_oid, _Out_ sx_router_counter_id_t *sx_counter);
 sai_status_t mlnx_rif_oid_to_bridge_rif(_In_ sai_object_id_t rif_oid, _Out_ uint32_t *bridge_rif_idx);
 sai_status_t mlnx_rif_oid_to_sdk_rif_id(sai_object_id_t rif_oid, sx_router_interface_t *sdk_rif_id);
+typedef sai_status_t (*mlnx_rif_iter_fn)(_In_ sx_router_interface_t sx_rif, _In_ sai_object_id_t rif_oid, _In_ void *ctx);
+sai_status_t mlnx_rif_db_iterate(_In_ mlnx_rif_iter_fn fn, _In_ void *ctx);
+sai_status_t mlnx_router_vrid_list_get(_Out_ sx_router_id_t **vrids, _Out_ uint32_t *vrids_count);
 sai_status_t mlnx_rif_sx_init(_In_ sx_router_id_t                     sx_router,
                               _In_ const sx_router_interface_param_t *intf_params,
                               _In_ const sx_interface_attributes_t   *intf_attribs,
@@ -1698,6 +1808,10 @@ static inline mlnx_sched_obj_t * group_get(mlnx_port_config_t *port, uint8_t lev
     return &port->sched_hierarchy.groups[level][index];
 }
 sai_status_t mlnx_scheduler_port_hierarchy_db_clear(_In_ mlnx_port_config_t *port);
+/* DB write lock is needed */
+void mlnx_sched_refs_port_sync(_In_ mlnx_port_config_t *port);
+/* DB read lock is needed */
+void mlnx_sched_refs_count_get(_In_ uint32_t sched_idx, _Out_ uint32_t *ports_count, _Out_ uint32_t *bindings_count);
 sai_status_t mlnx_wred_port_queue_db_clear(_In_ mlnx_port_config_t *port);
 
 sai_status_t mlnx_bfd_session_oid_create(_In_ mlnx_shm_rm_array_idx_t idx,
@@ -1963,9 +2077,9 @@ sai_status_t mlnx_nhg_get_regular_ecmp(_In_ sai_object_id_t nhg,
 
 #define mlnx_bridge_non1q_port_foreach(port, idx, checked)  \
     for (idx = MAX_BRIDGE_1Q_PORTS, checked = 0;            \
-         (idx < (MAX_BRIDGE_PORTS)) &&                      \
+         (idx < (MLNX_BRIDGE_PORTS_DB_SIZE)) &&             \
          (checked < g_sai_db_ptr->non_1q_bports_created) && \
-         (port = &g_sai_db_ptr->bridge_ports_db[idx]);      \
+         (port = &mlnx_bridge_ports_db[idx]);               \
          idx++, checked++)                                  \
     if (port->is_present)
 
@@ -1978,13 +2092,13 @@ sai_status_t mlnx_nhg_get_regular_ecmp(_In_ sai_object_id_t nhg,
 
 #define mlnx_bridge_1q_port_foreach(port, idx)                \
     for (idx = 0; idx < (MAX_BRIDGE_1Q_PORTS) &&              \
-         (port = &g_sai_db_ptr->bridge_ports_db[idx]); idx++) \
+         (port = &mlnx_bridge_ports_db[idx]); idx++)          \
     if (port->is_present)
 
 #define mlnx_vlan_ports_foreach(vid, port, idx)               \
     for (idx = 0;                                             \
          (idx < MAX_BRIDGE_1Q_PORTS) &&                       \
-         (port = &g_sai_db_ptr->bridge_ports_db[idx]); idx++) \
+         (port = &mlnx_bridge_ports_db[idx]); idx++)          \
     if (port->is_present && mlnx_vlan_port_is_set(vid, port))
 
 #define mlnx_port_non_lag_not_in_lag_foreach(port, idx) \
@@ -2015,6 +2129,29 @@ typedef struct _mlnx_wred_profile_t {
     bool                    in_use;
 } mlnx_wred_profile_t;
 
+/* Ports and LAGs with queues using the WRED profile, indexed as wred_db */
+typedef struct _mlnx_wred_refs_t {
+    /* mlnx_ports_db indexes */
+    uint32_t ports[MLNX_U32BITARRAY_SIZE(MAX_PORTS_DB * 2)];
+    uint32_t queues_count;
+    /* Re-binds of the profile on the attribute set, SDK calls and their time */
+    uint32_t binds;
+    uint32_t last_bind_ports;
+    uint32_t last_bind_sdk_calls;
+    uint64_t last_bind_us;
+    uint64_t max_bind_us;
+    uint64_t max_sdk_call_us;
+    uint64_t sdk_calls_total;
+    uint64_t sdk_us_total;
+} mlnx_wred_refs_t;
+
+/* Shadow of the port ETS element list, indexed as mlnx_ports_db. The elements are in ets_db */
+typedef struct _mlnx_port_ets_shadow_t {
+    sx_port_log_id_t logical;
+    uint32_t         count;
+    bool             is_valid;
+} mlnx_port_ets_shadow_t;
+
 /* UDF db */
 typedef struct _mlnx_udf_list_t {
     uint32_t count;
@@ -2064,6 +2201,7 @@ typedef struct _mlnx_udf_db_t {
 
 #define MAX_QOS_MAPS           MAX_PORTS
 #define MAX_QOS_MAPS_DB        MAX_PORTS_DB
+
 #define SAI_INVALID_PROFILE_ID 0xFFFFFFFF
 #define MAX_SCHED              ((g_resource_limits.cos_port_ets_elements_num) * MAX_PORTS)
 #define MAX_QUEUES             (g_resource_limits.cos_port_ets_traffic_class_max + 1)
@@ -2073,6 +2211,21 @@ typedef struct _mlnx_udf_db_t {
 #define MAX_PORT_PRIO          (g_resource_limits.cos_port_prio_max)
 #define MAX_PCP_PRIO           7
 
+/* Ports and LAGs which have the QoS map set, indexed as qos_maps_db */
+typedef struct _mlnx_qos_map_refs_t {
+    /* mlnx_ports_db indexes */
+    uint32_t ports[MLNX_U32BITARRAY_SIZE(MAX_PORTS_DB * 2)];
+    uint32_t ports_count;
+    /* Updates of the map content and the number of ports they were applied to */
+    uint32_t updates;
+    uint32_t last_update_ports;
+    uint64_t update_ports_total;
+    /* Free list link of a free map, 0 - end of the list */
+    uint32_t next;
+    /* Content hash of a used map */
+    uint32_t hash;
+} mlnx_qos_map_refs_t;
+
 #define ACL_USER_META_RANGE_MIN 0
 #define ACL_USER_META_RANGE_MAX 0x0FFF
 
@@ -2294,6 +2447,8 @@ typedef struct _acl_setting_tbl_t {
     acl_def_rule_mc_container_t def_mc_container;
     uint32_t                    entry_db_first_free_index;
     uint32_t                    entry_db_indexes_allocated;
+    uint32_t                    table_db_indexes_allocated;
+    uint32_t                    group_db_indexes_allocated;
     acl_aeth_syndrome_keys_t    aeth_syndrome_keys;
 } acl_setting_tbl_t;
 
@@ -2523,7 +2678,26 @@ typedef enum _mlnx_switch_hash_object_id {
     SAI_HASH_MAX_OBJ_ID
 } mlnx_switch_usage_hash_object_id_t;
 
+/* Effective hash config of the ports, last pushed one is kept in the DB to skip the ports that are up to date */
+typedef struct _mlnx_hash_ecmp_sx_config_t {
+    sx_router_ecmp_port_hash_params_t  params;
+    sx_router_ecmp_hash_field_enable_t enable_list[FIELDS_ENABLES_NUM];
+    uint32_t                           enable_count;
+    sx_router_ecmp_hash_field_t        field_list[FIELDS_NUM];
+    uint32_t                           field_count;
+} mlnx_hash_ecmp_sx_config_t;
+
+typedef struct _mlnx_hash_lag_sx_config_t {
+    sx_lag_port_hash_params_t  params;
+    sx_lag_hash_field_enable_t enable_list[FIELDS_ENABLES_NUM];
+    uint32_t                   enable_count;
+    sx_lag_hash_field_t        field_list[FIELDS_NUM];
+    uint32_t                   field_count;
+} mlnx_hash_lag_sx_config_t;
+
 sai_status_t mlnx_hash_config_apply_to_port(_In_ sx_port_log_id_t sx_port);
+void mlnx_hash_config_defer_begin(void);
+sai_status_t mlnx_hash_config_defer_commit(void);
 
 sai_status_t mlnx_udf_group_db_index_to_sx_acl_keys(_In_ uint32_t       udf_group_db_index,
                                                     _Out_ sx_acl_key_t *sx_acl_keys,
@@ -2706,8 +2880,17 @@ sai_status_t find_port_in_db(_In_ sai_object_id_t port, _Out_ uint32_t *index);
 sai_status_t db_get_sai_policer_data(_In_ sai_object_id_t            sai_policer_id,
                                      _Out_ mlnx_policer_db_entry_t** policer_data);
 void db_reset_policer_entry(_In_ mlnx_policer_db_entry_t* policers_entry_p);
+void mlnx_policer_db_sx_policer_created(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                        _In_ const sx_policer_id_t         *sx_policer);
+void mlnx_policer_db_sx_policer_destroyed(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                          _In_ const sx_policer_id_t         *sx_policer);
 sai_status_t db_find_sai_policer_entry_ind(_In_ sx_policer_id_t           sx_policer,
                                            _Out_ mlnx_shm_rm_array_idx_t* idx_p);
+/* DB read lock is needed */
+void mlnx_policer_sx_hash_check(_Out_ uint32_t *sx_policers,
+                                _Out_ uint32_t *hashed,
+                                _Out_ uint32_t *missing,
+                                _Out_ uint32_t *stale);
 
 /*
  *  Binds sai_policer to a given sai_object.
@@ -2905,10 +3088,21 @@ typedef struct _tunnel_map_entry_t {
     sai_object_id_t       vr_id_value;
     uint32_t              prev_tunnel_map_entry_idx;
     uint32_t              next_tunnel_map_entry_idx;
+    /* Key and value hash chain links, MLNX_TUNNEL_MAP_ENTRY_INVALID - end of the chain */
+    uint32_t              next_key_hash_idx;
+    uint32_t              next_value_hash_idx;
     /* only used for bridge to vni and vni to bridge type */
     tunnel_map_entry_pair_info_t pair_per_vxlan_array[MAX_VXLAN_TUNNEL];
 } mlnx_tunnel_map_entry_t;
 
+#define MLNX_TUNNEL_MAP_ENTRY_HASH_SIZE 4096
+
+/* Heads of the in use tunnel map entry chains hashed by (map type, key) and by (map type, value) */
+typedef struct _mlnx_tunnel_map_entry_hash_t {
+    uint32_t key_heads[MLNX_TUNNEL_MAP_ENTRY_HASH_SIZE];
+    uint32_t value_heads[MLNX_TUNNEL_MAP_ENTRY_HASH_SIZE];
+} mlnx_tunnel_map_entry_hash_t;
+
 typedef struct _mlnx_bmtor_bridge_t {
     bool            in_use;
     bool            is_default;
@@ -2972,14 +3166,35 @@ typedef struct _mlnx_dscp_remapping_t {
     remapping_acl_data_t remapping_acl_data[DSCP_REMAPPING_TUNNEL_TYPE_MAX];
 } mlnx_dscp_remapping_t;
 
+#define MLNX_TUNNEL_SX_HASH_SIZE 256
+
+/* Free list and SDK tunnel id hash chain links of a tunnel DB entry, see mlnx_tunnel_db_index_init */
+typedef struct _mlnx_tunnel_db_index_entry_t {
+    uint32_t       next_free;
+    /* [0] - IPv4 SDK tunnel, [1] - IPv6 SDK tunnel */
+    uint32_t       next_sx[2];
+    sx_tunnel_id_t sx_tunnel_id[2];
+    bool           sx_linked[2];
+} mlnx_tunnel_db_index_entry_t;
+
+typedef struct _mlnx_tunnel_db_index_t {
+    /* [0] - VXLAN entries, [1] - IP in IP entries */
+    uint32_t free_heads[2];
+    uint32_t used_counts[2];
+    uint32_t sx_heads[MLNX_TUNNEL_SX_HASH_SIZE];
+} mlnx_tunnel_db_index_t;
+
 typedef struct sai_tunnel_db {
-    void                    *db_base_ptr;
-    mlnx_tunneltable_t      *tunneltable_db;
-    mlnx_tunnel_entry_t     *tunnel_entry_db;
-    mlnx_tunnel_map_t       *tunnel_map_db;
-    mlnx_tunnel_map_entry_t *tunnel_map_entry_db;
-    mlnx_bmtor_bridge_t     *bmtor_bridge_db;
-    mlnx_dscp_remapping_t   *dscp_remapping_db;
+    void                         *db_base_ptr;
+    mlnx_tunneltable_t           *tunneltable_db;
+    mlnx_tunnel_entry_t          *tunnel_entry_db;
+    mlnx_tunnel_map_t            *tunnel_map_db;
+    mlnx_tunnel_map_entry_t      *tunnel_map_entry_db;
+    mlnx_bmtor_bridge_t          *bmtor_bridge_db;
+    mlnx_dscp_remapping_t        *dscp_remapping_db;
+    mlnx_tunnel_map_entry_hash_t *tunnel_map_entry_hash;
+    mlnx_tunnel_db_index_t       *tunnel_db_index;
+    mlnx_tunnel_db_index_entry_t *tunnel_db_index_entries;
 } sai_tunnel_db_t;
 
 extern sai_tunnel_db_t *g_sai_tunnel_db_ptr;
@@ -3056,15 +3271,22 @@ typedef struct _mlnx_l2mc_group_t {
     sx_mc_container_id_t mc_container_ports;
     mlnx_acl_pbs_entry_t pbs_entry;
     uint32_t             flood_ctrl_ref;
+    /* l2mc_group_members[] index + 1 of the first member, 0 - no members */
+    uint32_t             members_head;
+    uint32_t             members_count;
 } mlnx_l2mc_group_t;
 
-#define MLNX_L2MC_GROUP_MEMBER_DB_SIZE (64000)
+#define MLNX_L2MC_GROUP_MEMBER_DB_SIZE_DEF (64000)
+#define MLNX_L2MC_GROUP_MEMBER_DB_SIZE     (mlnx_shm_table_size(MLNX_SHM_TABLE_TYPE_L2MC_GROUP_MEMBER))
 
 typedef struct _mlnx_l2mc_group_member_t {
     bool             is_used;
     uint32_t         l2mc_group_db_idx;
     uint32_t         bport_db_idx;
     sai_ip_address_t endpoint_ip;
+    /* l2mc_group_members[] index + 1, 0 - end of list. When entry is free, next is a free list link */
+    uint32_t         next;
+    uint32_t         prev;
 } mlnx_l2mc_group_member_t;
 
 typedef struct _mlnx_mirror_vlan_t {
@@ -3074,6 +3296,12 @@ typedef struct _mlnx_mirror_vlan_t {
     uint8_t  vlan_cfi;
 } mlnx_mirror_vlan_t;
 
+/* Span session parameters as last written to the SDK, served to the getters and setters */
+typedef struct _mlnx_mirror_params_t {
+    bool                     is_valid;
+    sx_span_session_params_t params;
+} mlnx_mirror_params_t;
+
 typedef struct _mlnx_mirror_policer_acl_t {
     bool               is_acl_created;
     uint32_t           refs;
@@ -3102,11 +3330,325 @@ sai_status_t mlnx_sai_issu_init_impl(sai_switch_profile_id_t profile_id,
                                      mlnx_sai_boot_type_t    boot_type);
 sai_status_t mlnx_sai_issu_storage_check_gp_reg_is_set_to_hw();
 
+/* Stats cache */
+#define MLNX_STATS_CACHE_ENTRIES_MAX  (1024)
+#define MLNX_STATS_CACHE_COUNTERS_MAX (128)
+
+sai_status_t mlnx_stats_cache_init(_In_ uint32_t interval_ms);
+void mlnx_stats_cache_deinit(void);
+sai_status_t mlnx_stats_cache_register(_In_ sai_object_type_t     object_type,
+                                       _In_ sai_object_id_t       oid,
+                                       _In_ uint32_t              number_of_counters,
+                                       _In_ const sai_stat_id_t  *counter_ids);
+sai_status_t mlnx_stats_cache_get(_In_ sai_object_id_t       oid,
+                                  _In_ uint32_t              number_of_counters,
+                                  _In_ const sai_stat_id_t  *counter_ids,
+                                  _Out_ uint64_t            *counters,
+                                  _Out_ uint64_t            *age_ms);
+bool mlnx_stats_cache_lookup(_In_ sai_object_type_t     object_type,
+                             _In_ sai_object_id_t       oid,
+                             _In_ uint32_t              number_of_counters,
+                             _In_ const sai_stat_id_t  *counter_ids,
+                             _In_ sai_stats_mode_t      mode,
+                             _Out_ uint64_t            *counters);
+void mlnx_stats_cache_invalidate(_In_ sai_object_id_t oid);
+void mlnx_stats_cache_unregister(_In_ sai_object_id_t oid);
+
+/* Shared memory DBs */
+#define MLNX_SHM_DB_MAX                (5)
+#define MLNX_SHM_DB_HUGE_PAGES_DIR_DEF "/dev/hugepages"
+
+/* Mapping of a shared memory DB in this process */
+typedef struct _mlnx_shm_db_stats_t {
+    /* Shared memory name, NULL - unused entry */
+    const char *name;
+    void       *ptr;
+    uint64_t    size;
+    uint64_t    page_size;
+    bool        hugetlbfs;
+    bool        thp_advised;
+    bool        prefaulted;
+    bool        locked;
+    /* Minor page faults taken in advance by the prefault */
+    uint64_t    prefault_faults;
+    uint64_t    prefault_us;
+} mlnx_shm_db_stats_t;
+
+void mlnx_shm_db_stats_get(_In_ uint32_t idx, _Out_ mlnx_shm_db_stats_t *stats);
+
+/* API stats */
+#define MLNX_API_STATS_BUCKETS     (20)
+#define MLNX_API_STATS_THREADS_MAX (64)
+
+typedef enum _mlnx_api_stats_op_t {
+    MLNX_API_STATS_OP_CREATE,
+    MLNX_API_STATS_OP_REMOVE,
+    MLNX_API_STATS_OP_SET,
+    MLNX_API_STATS_OP_GET,
+    MLNX_API_STATS_OP_BULK_GET,
+    MLNX_API_STATS_OP_GET_STATS,
+    MLNX_API_STATS_OP_MAX
+} mlnx_api_stats_op_t;
+
+typedef struct _mlnx_api_stats_entry_t {
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t total_us;
+    uint64_t lock_wait_us;
+    /* Time in the SDK calls wrapped by the SDK tracer, 0 if the library is built without it */
+    uint64_t sdk_us;
+    uint64_t max_us;
+    uint64_t buckets[MLNX_API_STATS_BUCKETS];
+} mlnx_api_stats_entry_t;
+
+typedef struct _mlnx_api_stats_ctx_t {
+    sai_object_type_t                    object_type;
+    mlnx_api_stats_op_t                  op;
+    /* Per thread number of the call, 0 if the call is not tracked */
+    uint32_t                             call_seq;
+    uint64_t                             start_us;
+    uint64_t                             lock_wait_us;
+    uint64_t                             sdk_us;
+    /* Enclosing API call of the same thread */
+    const struct _mlnx_api_stats_ctx_t *prev;
+} mlnx_api_stats_ctx_t;
+
+extern bool g_mlnx_api_stats_enabled;
+
+void mlnx_api_stats_begin(_Out_ mlnx_api_stats_ctx_t *ctx,
+                          _In_ sai_object_type_t     object_type,
+                          _In_ mlnx_api_stats_op_t   op);
+sai_status_t mlnx_api_stats_end(_In_ const mlnx_api_stats_ctx_t *ctx, _In_ sai_status_t status);
+/* Makes the call and records it as op on object_type in ctx, the value is the status of the call */
+#define MLNX_API_STATS_TIMED(ctx, object_type, op, call) \
+    (mlnx_api_stats_begin((ctx), (object_type), (op)), mlnx_api_stats_end((ctx), (call)))
+const mlnx_api_stats_ctx_t* mlnx_api_stats_current_get(void);
+void mlnx_api_stats_plock_acquire(_In_ cl_plock_t *p_lock, _In_ bool exclusive);
+void mlnx_api_stats_sdk_time_add(_In_ uint64_t sdk_us);
+void mlnx_api_stats_entry_get(_In_ sai_object_type_t       object_type,
+                              _In_ mlnx_api_stats_op_t     op,
+                              _Out_ mlnx_api_stats_entry_t *entry);
+uint64_t mlnx_api_stats_percentile_us(_In_ const mlnx_api_stats_entry_t *entry, _In_ uint32_t percent);
+uint32_t mlnx_api_stats_threads_dropped_get(void);
+const char* mlnx_api_stats_op_str(_In_ mlnx_api_stats_op_t op);
+sai_status_t mlnx_api_stats_u32list_fill(_Inout_ sai_u32_list_t *list);
+
+/* SDK call tracer */
+#define MLNX_SDK_TRACE_MAGIC       (0x45434152544b4453ULL) /* "SDKTRACE" */
+#define MLNX_SDK_TRACE_VERSION     (1)
+#define MLNX_SDK_TRACE_NAME_LEN    (48)
+#define MLNX_SDK_TRACE_RECORDS_DEF (65536)
+#define MLNX_SDK_TRACE_NO_CMD      (UINT32_MAX)
+#define MLNX_SDK_TRACE_NO_OP       (0xff)
+
+/* SDK calls which are traced, the list is the ID <-> name table of the trace file */
+#define MLNX_SDK_TRACE_CALLS(X)                \
+    X(sx_api_acl_flex_key_set)                 \
+    X(sx_api_acl_flex_rules_get)               \
+    X(sx_api_acl_flex_rules_set)               \
+    X(sx_api_acl_group_set)                    \
+    X(sx_api_acl_port_bind_set)                \
+    X(sx_api_acl_region_set)                   \
+    X(sx_api_acl_set)                          \
+    X(sx_api_bridge_vport_set)                 \
+    X(sx_api_bulk_counter_transaction_get)     \
+    X(sx_api_cos_port_buff_type_set)           \
+    X(sx_api_cos_port_buff_type_statistic_get) \
+    X(sx_api_cos_port_ets_element_set)         \
+    X(sx_api_cos_redecn_profile_set)           \
+    X(sx_api_fdb_flood_control_set)            \
+    X(sx_api_fdb_uc_mac_addr_set)              \
+    X(sx_api_flow_counter_get)                 \
+    X(sx_api_flow_counter_set)                 \
+    X(sx_api_host_ifc_trap_group_ext_set)      \
+    X(sx_api_lag_port_group_get)               \
+    X(sx_api_lag_port_group_set)               \
+    X(sx_api_mc_container_set)                 \
+    X(sx_api_policer_set)                      \
+    X(sx_api_port_state_get)                   \
+    X(sx_api_port_state_set)                   \
+    X(sx_api_router_ecmp_get)                  \
+    X(sx_api_router_ecmp_set)                  \
+    X(sx_api_router_interface_get)             \
+    X(sx_api_router_interface_set)             \
+    X(sx_api_router_interface_state_set)       \
+    X(sx_api_router_neigh_get)                 \
+    X(sx_api_router_neigh_set)                 \
+    X(sx_api_router_uc_route_get)              \
+    X(sx_api_router_uc_route_set)              \
+    X(sx_api_span_mirror_get)                  \
+    X(sx_api_span_mirror_set)                  \
+    X(sx_api_span_session_set)                 \
+    X(sx_api_tunnel_decap_rules_set)           \
+    X(sx_api_tunnel_map_set)                   \
+    X(sx_api_tunnel_set)                       \
+    X(sx_api_vlan_port_pvid_get)               \
+    X(sx_api_vlan_port_pvid_set)               \
+    X(sx_api_vlan_ports_set)
+
+#define MLNX_SDK_TRACE_CALL_ID(name) MLNX_SDK_TRACE_CALL_ ## name,
+typedef enum _mlnx_sdk_trace_call_t {
+    MLNX_SDK_TRACE_CALLS(MLNX_SDK_TRACE_CALL_ID)
+    MLNX_SDK_TRACE_CALL_MAX
+} mlnx_sdk_trace_call_t;
+
+/* Trace file layout - header, name tables (at the offsets in the header), ring of records */
+typedef struct _mlnx_sdk_trace_file_hdr_t {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t hdr_size;
+    uint32_t record_size;
+    uint32_t records_max;
+    uint32_t records_offset;
+    uint32_t name_len;
+    uint32_t call_names_offset;
+    uint32_t call_names_count;
+    uint32_t object_type_names_offset;
+    uint32_t object_type_names_count;
+    uint32_t op_names_offset;
+    uint32_t op_names_count;
+    uint32_t cmd_names_offset;
+    uint32_t cmd_names_count;
+    /* Number of records ever written, record N is at index N % records_max */
+    uint64_t head;
+} mlnx_sdk_trace_file_hdr_t;
+
+typedef struct _mlnx_sdk_trace_record_t {
+    /* Record number + 1, written last. 0 or a number of another lap - the record is being written */
+    uint64_t seq;
+    uint64_t start_us;
+    uint32_t duration_us;
+    uint32_t tid;
+    /* Per thread number of the SAI API call which made the SDK call, 0 if made outside of an API call */
+    uint32_t sai_call_seq;
+    int32_t  status;
+    uint32_t cmd;
+    uint16_t call;
+    uint16_t sai_object_type;
+    uint8_t  sai_op;
+    uint8_t  reserved[7];
+} mlnx_sdk_trace_record_t;
+
+extern bool g_mlnx_sdk_trace_enabled;
+
+sai_status_t mlnx_sdk_trace_init(_In_ const char *path, _In_ uint32_t records_max);
+void mlnx_sdk_trace_deinit(void);
+void mlnx_sdk_trace_begin(void);
+sx_status_t mlnx_sdk_trace_end(_In_ mlnx_sdk_trace_call_t call, _In_ uint32_t cmd, _In_ sx_status_t status);
+
+#ifdef SDK_TRACE
+/*
+ * The traced SDK calls are replaced with the calls wrapped by the tracer. Function-like macros are
+ * not expanded when the name is not followed by '(' so the original function is called by the wrapper.
+ */
+#define MLNX_SDK_TRACE_CMD(name, handle, cmd, ...)                               \
+    (mlnx_sdk_trace_begin(),                                                     \
+     mlnx_sdk_trace_end(MLNX_SDK_TRACE_CALL_ ## name, (uint32_t)(cmd),           \
+                        (name)(handle, cmd, __VA_ARGS__)))
+#define MLNX_SDK_TRACE_CALL(name, ...)                                           \
+    (mlnx_sdk_trace_begin(),                                                     \
+     mlnx_sdk_trace_end(MLNX_SDK_TRACE_CALL_ ## name, MLNX_SDK_TRACE_NO_CMD,     \
+                        (name)(__VA_ARGS__)))
+
+#define sx_api_acl_flex_key_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_acl_flex_key_set, handle, cmd, __VA_ARGS__)
+#define sx_api_acl_flex_rules_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_acl_flex_rules_get, __VA_ARGS__)
+#define sx_api_acl_flex_rules_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_acl_flex_rules_set, handle, cmd, __VA_ARGS__)
+#define sx_api_acl_group_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_acl_group_set, handle, cmd, __VA_ARGS__)
+#define sx_api_acl_port_bind_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_acl_port_bind_set, handle, cmd, __VA_ARGS__)
+#define sx_api_acl_region_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_acl_region_set, handle, cmd, __VA_ARGS__)
+#define sx_api_acl_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_acl_set, handle, cmd, __VA_ARGS__)
+#define sx_api_bridge_vport_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_bridge_vport_set, handle, cmd, __VA_ARGS__)
+#define sx_api_bulk_counter_transaction_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_bulk_counter_transaction_get, __VA_ARGS__)
+#define sx_api_cos_port_buff_type_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_cos_port_buff_type_set, handle, cmd, __VA_ARGS__)
+#define sx_api_cos_port_buff_type_statistic_get(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_cos_port_buff_type_statistic_get, handle, cmd, __VA_ARGS__)
+#define sx_api_cos_port_ets_element_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_cos_port_ets_element_set, handle, cmd, __VA_ARGS__)
+#define sx_api_cos_redecn_profile_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_cos_redecn_profile_set, handle, cmd, __VA_ARGS__)
+#define sx_api_fdb_flood_control_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_fdb_flood_control_set, handle, cmd, __VA_ARGS__)
+#define sx_api_fdb_uc_mac_addr_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_fdb_uc_mac_addr_set, handle, cmd, __VA_ARGS__)
+#define sx_api_flow_counter_get(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_flow_counter_get, handle, cmd, __VA_ARGS__)
+#define sx_api_flow_counter_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_flow_counter_set, handle, cmd, __VA_ARGS__)
+#define sx_api_host_ifc_trap_group_ext_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_host_ifc_trap_group_ext_set, handle, cmd, __VA_ARGS__)
+#define sx_api_lag_port_group_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_lag_port_group_get, __VA_ARGS__)
+#define sx_api_lag_port_group_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_lag_port_group_set, handle, cmd, __VA_ARGS__)
+#define sx_api_mc_container_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_mc_container_set, handle, cmd, __VA_ARGS__)
+#define sx_api_policer_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_policer_set, handle, cmd, __VA_ARGS__)
+#define sx_api_port_state_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_port_state_get, __VA_ARGS__)
+#define sx_api_port_state_set(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_port_state_set, __VA_ARGS__)
+#define sx_api_router_ecmp_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_router_ecmp_get, __VA_ARGS__)
+#define sx_api_router_ecmp_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_router_ecmp_set, handle, cmd, __VA_ARGS__)
+#define sx_api_router_interface_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_router_interface_get, __VA_ARGS__)
+#define sx_api_router_interface_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_router_interface_set, handle, cmd, __VA_ARGS__)
+#define sx_api_router_interface_state_set(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_router_interface_state_set, __VA_ARGS__)
+#define sx_api_router_neigh_get(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_router_neigh_get, handle, cmd, __VA_ARGS__)
+#define sx_api_router_neigh_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_router_neigh_set, handle, cmd, __VA_ARGS__)
+#define sx_api_router_uc_route_get(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_router_uc_route_get, handle, cmd, __VA_ARGS__)
+#define sx_api_router_uc_route_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_router_uc_route_set, handle, cmd, __VA_ARGS__)
+#define sx_api_span_mirror_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_span_mirror_get, __VA_ARGS__)
+#define sx_api_span_mirror_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_span_mirror_set, handle, cmd, __VA_ARGS__)
+#define sx_api_span_session_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_span_session_set, handle, cmd, __VA_ARGS__)
+#define sx_api_tunnel_decap_rules_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_tunnel_decap_rules_set, handle, cmd, __VA_ARGS__)
+#define sx_api_tunnel_map_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_tunnel_map_set, handle, cmd, __VA_ARGS__)
+#define sx_api_tunnel_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_tunnel_set, handle, cmd, __VA_ARGS__)
+#define sx_api_vlan_port_pvid_get(...) \
+    MLNX_SDK_TRACE_CALL(sx_api_vlan_port_pvid_get, __VA_ARGS__)
+#define sx_api_vlan_port_pvid_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_vlan_port_pvid_set, handle, cmd, __VA_ARGS__)
+#define sx_api_vlan_ports_set(handle, cmd, ...) \
+    MLNX_SDK_TRACE_CMD(sx_api_vlan_ports_set, handle, cmd, __VA_ARGS__)
+#endif /* SDK_TRACE */
+
+#ifdef SAI_BENCH
+sai_status_t mlnx_bench_switch_init(_In_ const char *config_file, _In_ sx_chip_types_t chip_type);
+sai_status_t mlnx_bench_fdb_event_parse(_In_ uint8_t                             *p_packet,
+                                        _Out_ sai_fdb_event_notification_data_t *fdb_events,
+                                        _Out_ uint32_t                          *event_count,
+                                        _Out_ sai_attribute_t                   *attr_list);
+#endif /* SAI_BENCH */
+
 #define l2mc_group_db(idx)                   (g_sai_db_ptr->l2mc_groups[(idx)])
 #define MLNX_L2MC_GROUP_DB_IDX_IS_VALID(idx) ((idx) < MLNX_L2MC_GROUP_DB_SIZE)
 #define MLNX_L2MC_GROUP_DB_IDX_INVALID ((uint32_t)(-1))
 
-#define l2mc_group_member_db(idx)                   (g_sai_db_ptr->l2mc_group_members[(idx)])
+#define l2mc_group_member_db(idx)                   (mlnx_l2mc_group_members_db[(idx)])
 #define MLNX_L2MC_GROUP_MEMBER_DB_IDX_IS_VALID(idx) ((idx) < MLNX_L2MC_GROUP_MEMBER_DB_SIZE)
 #define MLNX_L2MC_GROUP_MEMBER_DB_IDX_INVALID ((uint32_t)(-1))
 
@@ -3123,6 +3665,17 @@ sai_status_t mlnx_l2mc_group_pbs_info_to_group(_In_ mlnx_acl_pbs_info_t  pbs_inf
 sai_status_t mlnx_l2mc_group_pbs_use(_In_ mlnx_l2mc_group_t *l2mc_group);
 void mlnx_l2mc_group_flood_ctrl_ref_inc(_In_ uint32_t group_db_idx);
 void mlnx_l2mc_group_flood_ctrl_ref_dec(_In_ uint32_t group_db_idx);
+sai_status_t mlnx_create_l2mc_group_members(_In_ sai_object_id_t          switch_id,
+                                            _In_ uint32_t                 object_count,
+                                            _In_ const uint32_t          *attr_count,
+                                            _In_ const sai_attribute_t  **attr_list,
+                                            _In_ sai_bulk_op_error_mode_t mode,
+                                            _Out_ sai_object_id_t        *object_id,
+                                            _Out_ sai_status_t           *object_statuses);
+sai_status_t mlnx_remove_l2mc_group_members(_In_ uint32_t                 object_count,
+                                            _In_ const sai_object_id_t   *object_id,
+                                            _In_ sai_bulk_op_error_mode_t mode,
+                                            _Out_ sai_status_t           *object_statuses);
 
 typedef enum mlnx_platform_type {
     MLNX_PLATFORM_TYPE_INVALID = 0,
@@ -3216,6 +3769,8 @@ typedef struct _mlnx_bfd_session_db_data_t {
     uint32_t            min_rx;
     sai_ip_address_t    src_ip;
     sai_ip_address_t    dst_ip;
+    uint32_t            rx_events;
+    uint32_t            state_changes;
 } mlnx_bfd_session_db_data_t;
 
 typedef struct _mlnx_bfd_session_db_entry_t {
@@ -3244,6 +3799,13 @@ sai_status_t mlnx_set_offload_bfd_rx_session(_Inout_ mlnx_bfd_session_db_data_t
 sai_status_t mlnx_set_offload_bfd_tx_session(_Inout_ mlnx_bfd_session_db_data_t *bfd_db_data,
                                              _In_ sx_access_cmd_t                cmd);
 
+#ifdef SAI_BENCH
+sai_status_t mlnx_bench_bfd_packet_handle(_In_ sai_object_id_t          bfd_session_id,
+                                          _In_ const mlnx_bfd_packet_t *bfd_packet,
+                                          _In_ uint8_t                  ttl);
+sai_status_t mlnx_bench_bfd_timeout_handle(_In_ sai_object_id_t bfd_session_id);
+#endif /* SAI_BENCH */
+
 typedef struct _mlnx_control_pg_buff_profile_entry {
     sx_cos_port_buffer_attr_t sx_pg_buff_reserved_attr;
     bool                      is_valid;
@@ -3382,8 +3944,22 @@ typedef struct _ar_config_data_t {
     ar_xml_port_data_t  port_list[MAX_PORTS_DB];
 } ar_config_data_t;
 
+#define MLNX_BRIDGE_PORT_INDEX_BUCKETS (1 << 16)
+/* Hash index over the bridge ports DB, chained through mlnx_bridge_port_t index_next[].
+ * Values are bridge port db index + 1, 0 ends a chain */
+typedef struct _mlnx_bridge_port_index_t {
+    uint32_t heads[MLNX_BRIDGE_PORT_INDEX_BUCKETS];
+} mlnx_bridge_port_index_t;
+
+/* Layout version of sai_db_t and of the arrays which follow it, bump on any change */
+#define MLNX_SAI_DB_VERSION (2)
+
 typedef struct sai_db {
     cl_plock_t         p_lock;
+    /* Checked by the processes which connect to the SAI DB created by the switch init */
+    uint32_t           db_version;
+    uint32_t           db_hdr_size;
+    uint64_t           db_size;
     sx_mac_addr_t      base_mac_addr;
     char               dev_mac[18];
     uint32_t           ports_number;
@@ -3391,19 +3967,24 @@ typedef struct sai_db {
     uint32_t           max_ipinip_ipv6_loopback_rifs;
     bool               perport_ipcnt_enable;
     mlnx_port_config_t ports_db[MAX_PORTS_DB * 2];
-    mlnx_bridge_port_t bridge_ports_db[MAX_BRIDGE_PORTS];
     uint32_t           non_1q_bports_created; /* to optimize mlnx_bridge_non1q_port_foreach */
+    uint32_t           bports_created; /* to optimize mlnx_bridge_port_availability_get */
+    mlnx_bridge_port_index_t bridge_ports_index[MLNX_BRIDGE_PORT_INDEX_MAX];
     mlnx_bridge_rif_t  bridge_rifs_db[MAX_BRIDGE_RIFS];
     mlnx_vlan_db_t     vlans_db[SXD_VID_MAX];
-    sai_netdev_t       hostif_db[MAX_HOSTIFS];
     sai_object_id_t    default_trap_group;
     sai_object_id_t    default_vrid;
     sx_user_channel_t  callback_channel;
     bool               trap_group_valid[MAX_TRAP_GROUPS];
-    /* index is according to index in mlnx_traps_info */
+    uint32_t           trap_groups_used;
+    uint32_t           policers_sx_acl_created; /* policer DB entries with an ACL or ACL mirror sx policer */
+    uint32_t           policers_sx_trap_created; /* policer DB entries with a trap sx policer */
+    /* index is according to index in mlnx_traps_info, a static table, so not sized on init */
     mlnx_trap_t           traps_db[SXD_TRAP_ID_ACL_MAX];
     mlnx_hostif_channel_t wildcard_channel;
     mlnx_qos_map_t        qos_maps_db[MAX_QOS_MAPS_DB];
+    mlnx_qos_map_refs_t   qos_map_refs[MAX_QOS_MAPS_DB];
+    uint32_t              qos_maps_free_head;
     uint32_t              switch_qos_maps[MLNX_QOS_MAP_TYPES_MAX];
     uint8_t               switch_default_tc;
     /* control priority group default values configured by sdk */
@@ -3414,6 +3995,11 @@ typedef struct sai_db {
     sai_object_id_t                   oper_hash_list[SAI_HASH_MAX_OBJ_ID];
     sx_router_ecmp_port_hash_params_t port_ecmp_hash_params;
     sx_lag_port_hash_params_t         lag_hash_params;
+    /* A port is up to date when its hash config generation matches the generation of the config below */
+    mlnx_hash_ecmp_sx_config_t        ecmp_hash_sx_config;
+    uint32_t                          ecmp_hash_sx_config_gen;
+    mlnx_hash_lag_sx_config_t         lag_hash_sx_config;
+    uint32_t                          lag_hash_sx_config_gen;
     mlnx_samplepacket_t               mlnx_samplepacket_session[MLNX_SAMPLEPACKET_SESSION_MAX];
     bool                              tunnel_module_initialized;
     bool                              port_parsing_depth_set_for_tunnel;
@@ -3467,13 +4053,16 @@ typedef struct sai_db {
     bool                              aggregate_bridge_drops;
     mlnx_dump_configuration_t         dump_configuration;
     mlnx_mirror_vlan_t                erspan_vlan_header[SPAN_SESSION_MAX];
+    mlnx_mirror_params_t              mirror_params[SPAN_SESSION_MAX];
     mlnx_mirror_policer_t             mirror_policer[SPAN_SESSION_MAX];
     int32_t                           mirror_congestion_mode[SPAN_SESSION_MAX];
     uint32_t                          mirror_sample_rate[SPAN_SESSION_MAX];
     mlnx_l2mc_group_t                 l2mc_groups[MLNX_L2MC_GROUP_DB_SIZE];
-    mlnx_l2mc_group_member_t          l2mc_group_members[MLNX_L2MC_GROUP_MEMBER_DB_SIZE];
+    uint32_t                          l2mc_group_members_free_head;
+    uint32_t                          l2mc_group_members_watermark;
     mlnx_debug_counter_trap_t         debug_counter_traps[MLNX_DEBUG_COUNTER_TRAP_DB_SIZE];
     bool                              is_bfd_module_initialized;
+    cl_plock_t                        bfd_lock;
     sai_mac_t                         vxlan_mac;
     bool                              pbhash_transition;
     uint32_t                          pbhash_gre;
@@ -3494,6 +4083,7 @@ typedef struct sai_db {
     sx_mac_addr_t            rif_mac_range_addr;
     bool                     reduced_rif_counter_enable;
     mlnx_ar_db_data_t        ar_db;
+    mlnx_shm_table_info_t    table_info[MLNX_SHM_TABLE_TYPE_SIZE];
     /* must be last element, followed by dynamic arrays */
     mlnx_shm_rm_array_info_t array_info[MLNX_SHM_RM_ARRAY_TYPE_SIZE];
 } sai_db_t;
@@ -3502,6 +4092,17 @@ extern sai_db_t *g_sai_db_ptr;
 
 #define mlnx_ports_db (g_sai_db_ptr->ports_db)
 
+#define MLNX_SHM_RM_ARRAY_BASE_PTR ((uint8_t*)g_sai_db_ptr->array_info + sizeof(g_sai_db_ptr->array_info))
+#define mlnx_shm_table_ptr(type) \
+    ((void*)(MLNX_SHM_RM_ARRAY_BASE_PTR + g_sai_db_ptr->table_info[(type)].offset_to_head))
+#define mlnx_shm_table_size(type) ((uint32_t)g_sai_db_ptr->table_info[(type)].elem_count)
+
+#define mlnx_bridge_ports_db ((mlnx_bridge_port_t*)mlnx_shm_table_ptr(MLNX_SHM_TABLE_TYPE_BRIDGE_PORT))
+#define mlnx_l2mc_group_members_db \
+    ((mlnx_l2mc_group_member_t*)mlnx_shm_table_ptr(MLNX_SHM_TABLE_TYPE_L2MC_GROUP_MEMBER))
+#define mlnx_policer_sx_hash_db ((uint32_t*)mlnx_shm_table_ptr(MLNX_SHM_TABLE_TYPE_POLICER_SX_HASH))
+#define mlnx_hostif_db          ((sai_netdev_t*)mlnx_shm_table_ptr(MLNX_SHM_TABLE_TYPE_HOSTIF))
+
 mlnx_port_config_t * mlnx_port_by_idx(uint16_t id);
 mlnx_port_config_t * mlnx_port_by_local_id(uint16_t local_port);
 
@@ -3516,6 +4117,9 @@ typedef struct mlnx_qos_queue_config {
          port->start_queues_index + idx < port->start_queues_index + MAX_QUEUES && \
          (queue = &g_sai_qos_db_ptr->queue_db[port->start_queues_index + idx]); idx++)
 
+/* DB write lock is needed */
+void mlnx_wred_queue_wred_id_set(_Inout_ mlnx_qos_queue_config_t *queue_cfg, _In_ sai_object_id_t wred_id);
+
 typedef struct mlnx_sched_profile_t {
     bool                        is_used;
     sx_cos_ets_element_config_t ets;
@@ -3523,11 +4127,22 @@ typedef struct mlnx_sched_profile_t {
     uint64_t                    max_rate;
 } mlnx_sched_profile_t;
 
+/* Ports and LAGs with the port, groups or queues using the scheduler profile, indexed as sched_db */
+typedef struct _mlnx_sched_refs_t {
+    /* mlnx_ports_db indexes */
+    uint32_t ports[MLNX_U32BITARRAY_SIZE(MAX_PORTS_DB * 2)];
+    uint32_t ports_count;
+} mlnx_sched_refs_t;
+
 typedef struct sai_qos_db {
-    void                    *db_base_ptr;
-    mlnx_wred_profile_t     *wred_db;
-    mlnx_sched_profile_t    *sched_db;
-    mlnx_qos_queue_config_t *queue_db;
+    void                        *db_base_ptr;
+    mlnx_wred_profile_t         *wred_db;
+    mlnx_sched_profile_t        *sched_db;
+    mlnx_qos_queue_config_t     *queue_db;
+    mlnx_wred_refs_t            *wred_refs;
+    mlnx_port_ets_shadow_t      *ets_shadow;
+    sx_cos_ets_element_config_t *ets_db;
+    mlnx_sched_refs_t           *sched_refs;
 } sai_qos_db_t;
 
 extern sai_qos_db_t *g_sai_qos_db_ptr;
@@ -3644,11 +4259,17 @@ extern sai_buffer_db_t *g_sai_buffer_db_ptr;
 extern uint32_t         g_sai_buffer_db_size;
 
 
-#define sai_db_read_lock()  cl_plock_acquire(&g_sai_db_ptr->p_lock)
-#define sai_db_write_lock() cl_plock_excl_acquire(&g_sai_db_ptr->p_lock)
+#define sai_db_read_lock()  mlnx_api_stats_plock_acquire(&g_sai_db_ptr->p_lock, false)
+#define sai_db_write_lock() mlnx_api_stats_plock_acquire(&g_sai_db_ptr->p_lock, true)
 #define sai_db_unlock()     cl_plock_release(&g_sai_db_ptr->p_lock)
 #define sai_db_sync()       msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC)
 
+/* BFD sessions state. The BFD API takes it inside the DB lock, the BFD packet and timeout events
+ * take only it so they don't wait for (and don't block) the rest of the SAI API */
+#define sai_bfd_db_read_lock()  cl_plock_acquire(&g_sai_db_ptr->bfd_lock)
+#define sai_bfd_db_write_lock() cl_plock_excl_acquire(&g_sai_db_ptr->bfd_lock)
+#define sai_bfd_db_unlock()     cl_plock_release(&g_sai_db_ptr->bfd_lock)
+
 #define sai_qos_db_read_lock()  sai_db_read_lock()
 #define sai_qos_db_write_lock() sai_db_write_lock()
 #define sai_qos_db_unlock()     sai_db_unlock()
@@ -3660,6 +4281,15 @@ extern uint32_t         g_sai_buffer_db_size;
 sai_status_t mlnx_sched_hierarchy_reset(mlnx_port_config_t *port);
 
 sai_status_t mlnx_sched_group_port_init(mlnx_port_config_t *port, bool is_warmboot_init_stage);
+/* DB write lock is needed, the list is the port ETS shadow and is changed only by mlnx_port_ets_elements_set() */
+sai_status_t mlnx_port_ets_list_get(_In_ sx_port_log_id_t               port_id,
+                                    _Out_ sx_cos_ets_element_config_t **ets_list,
+                                    _Out_ uint32_t                     *count);
+/* DB write lock is needed */
+sai_status_t mlnx_port_ets_elements_set(_In_ sx_port_log_id_t             port_id,
+                                        _In_ sx_cos_ets_element_config_t *ets,
+                                        _In_ uint32_t                     count);
+void mlnx_port_ets_shadow_invalidate(_In_ const mlnx_port_config_t *port);
 
 sai_status_t mlnx_queue_cfg_lookup(sx_port_log_id_t log_port_id, uint32_t queue_idx, mlnx_qos_queue_config_t **cfg);
 
@@ -3681,6 +4311,9 @@ sai_status_t mlnx_port_idx_by_obj_id(sai_object_id_t obj_id, uint32_t *index);
 sx_port_log_id_t mlnx_port_get_lag_id(const mlnx_port_config_t *port);
 /* DB read lock is needed */
 uint32_t mlnx_port_idx_get(const mlnx_port_config_t *port);
+/* DB write lock is needed */
+void mlnx_qos_map_port_ref_set(_In_ uint32_t qos_map_idx, _In_ const mlnx_port_config_t *port, _In_ bool ref);
+bool mlnx_qos_map_content_is_identical(_In_ uint32_t qos_map_idx, _In_ uint32_t other_idx);
 
 /* DB read lock is needed */
 sai_status_t mlnx_port_add(mlnx_port_config_t *port, bool is_lag);
@@ -3701,6 +4334,7 @@ bool mlnx_port_is_lag(const mlnx_port_config_t *port);
 bool mlnx_port_is_lag_member(const mlnx_port_config_t *port);
 bool mlnx_port_is_sai_lag_member(const mlnx_port_config_t *port);
 bool mlnx_port_is_sdk_lag_member_not_sai(const mlnx_port_config_t *port);
+bool mlnx_port_is_profile_bind_target(const mlnx_port_config_t *port);
 bool mlnx_log_port_is_cpu(sx_port_log_id_t log_id);
 bool mlnx_log_port_is_vport(sx_port_log_id_t log_id);
 const char * mlnx_port_type_str(const mlnx_port_config_t *port);
@@ -3791,6 +4425,15 @@ sai_status_t mlnx_sched_hierarchy_foreach(mlnx_port_config_t    *port,
 #define SAI_KEY_REDUCED_RIF_COUNTER_ENABLED          "SAI_REDUCED_RIF_COUNTER_ENABLED"
 #define SAI_KEY_ADAPTIVE_ROUTING_CONFIG_FILE         "SAI_ADAPTIVE_ROUTING_CONFIG_FILE"
 #define SAI_KEY_BFD_NAMESPACE                        "SAI_KEY_BFD_NAMESPACE"
+#define SAI_KEY_STATS_CACHE_INTERVAL_MS              "SAI_STATS_CACHE_INTERVAL_MS"
+#define SAI_KEY_API_STATS_ENABLED                    "SAI_API_STATS_ENABLED"
+#define SAI_KEY_BRIDGE_SUB_PORTS_MAX                 "SAI_BRIDGE_SUB_PORTS_MAX"
+#define SAI_KEY_L2MC_GROUP_MEMBERS_MAX               "SAI_L2MC_GROUP_MEMBERS_MAX"
+#define SAI_KEY_HOSTIFS_MAX                          "SAI_HOSTIFS_MAX"
+#define SAI_KEY_DB_HUGE_PAGES                        "SAI_DB_HUGE_PAGES"
+#define SAI_KEY_DB_HUGE_PAGES_DIR                    "SAI_DB_HUGE_PAGES_DIR"
+#define SAI_KEY_SDK_TRACE_FILE                       "SAI_SDK_TRACE_FILE"
+#define SAI_KEY_SDK_TRACE_RECORDS                    "SAI_SDK_TRACE_RECORDS"
 
 #define MLNX_MIRROR_VLAN_TPID           0x8100
 #define MLNX_GRE_PROTOCOL_TYPE          0x8949
@@ -3889,6 +4532,11 @@ typedef enum _tunnel_map_entry_key_value_type_t {
 
 sai_status_t mlnx_translate_sdk_tunnel_id_to_sai_tunnel_id(_In_ const sx_tunnel_id_t sdk_tunnel_id,
                                                            _Out_ sai_object_id_t    *sai_tunnel_id);
+void mlnx_tunnel_db_index_init(void);
+/* caller needs to guard this function with lock */
+bool mlnx_tunnel_db_idx_by_sx_tunnel_next(_In_ sx_tunnel_id_t sx_tunnel_id,
+                                          _Inout_ uint32_t   *node,
+                                          _Out_ uint32_t     *tunnel_db_idx);
 sai_status_t mlnx_parsing_depth_increase(void);
 
 /* caller needs to guard this function with lock */
@@ -3956,6 +4604,8 @@ void SAI_dump_wred(_In_ FILE *file);
 void SAI_dump_gp_reg(_In_ FILE *file);
 void SAI_dump_nhg_nhgm(_In_ FILE *file);
 void SAI_dump_nh(_In_ FILE *file);
+void SAI_dump_api_stats(_In_ FILE *file);
+void SAI_dump_shm(_In_ FILE *file);
 
 sai_status_t sai_dbg_generate_dump_ext(_In_ const char *dump_file_name,
                                        _In_ int32_t     flags);
@@ -4007,4 +4657,8 @@ bool u32_list_equal(_In_ const uint32_t *list1,
                     _In_ const uint32_t *list2,
                     _In_ uint32_t        list2_count);
 
+/* FNV-1a, the hash of the previous data or MLNX_FNV1A_HASH_INIT is passed to hash several fields */
+#define MLNX_FNV1A_HASH_INIT (2166136261U)
+uint32_t mlnx_fnv1a_hash(_In_ uint32_t hash, _In_ const void *data, _In_ size_t size);
+
 #endif /* __MLNXSAI_H_ */
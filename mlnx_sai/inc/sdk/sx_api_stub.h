@@ -0,0 +1,350 @@
+/*
+ *  Copyright (C) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#ifndef __SX_API_STUB_H__
+#define __SX_API_STUB_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * Stub SDK for the SAI benchmarks (sai_bench, --enable-bench).
+ *
+ * sai_bench defines every sx_api_* call made by libsai and is linked with the libsai sources instead
+ * of libsai, without libsxapi and libsw_rm - SAI runs without the SDK daemon and the switch, and a
+ * call missing here fails the link instead of going to the real SDK.
+ * The generic calls are generated by src/sdk/sx_api_stub_gen.py with the prototypes of the SDK
+ * headers. They succeed, the get calls zero their non-const pointer arguments - empty lists and
+ * zero counters for the calls which only pass the configuration down or read counters.
+ * The custom calls are emulated since SAI uses what they return - the handle, the allocated bridge
+ * and mc container ids and the routes.
+ * Every call is counted and may be delayed to simulate the SDK RPC latency.
+ */
+
+#define SX_API_STUB_GENERIC_CALLS(X)                  \
+    X(sx_api_acl_custom_bytes_set)                    \
+    X(sx_api_acl_flex_key_attr_get)                   \
+    X(sx_api_acl_flex_key_get)                        \
+    X(sx_api_acl_flex_key_set)                        \
+    X(sx_api_acl_flex_rules_get)                      \
+    X(sx_api_acl_flex_rules_set)                      \
+    X(sx_api_acl_global_attributes_set)               \
+    X(sx_api_acl_group_attributes_set)                \
+    X(sx_api_acl_group_set)                           \
+    X(sx_api_acl_l4_port_range_get)                   \
+    X(sx_api_acl_l4_port_range_set)                   \
+    X(sx_api_acl_log_verbosity_level_set)             \
+    X(sx_api_acl_policy_based_switching_set)          \
+    X(sx_api_acl_port_bind_set)                       \
+    X(sx_api_acl_range_get)                           \
+    X(sx_api_acl_range_set)                           \
+    X(sx_api_acl_region_get)                          \
+    X(sx_api_acl_region_set)                          \
+    X(sx_api_acl_rif_bind_set)                        \
+    X(sx_api_acl_rule_block_move_set)                 \
+    X(sx_api_acl_set)                                 \
+    X(sx_api_acl_vlan_group_bind_set)                 \
+    X(sx_api_acl_vlan_group_map_set)                  \
+    X(sx_api_ar_classifier_set)                       \
+    X(sx_api_ar_congestion_threshold_set)             \
+    X(sx_api_ar_default_classification_set)           \
+    X(sx_api_ar_init_set)                             \
+    X(sx_api_ar_link_utilization_threshold_get)       \
+    X(sx_api_ar_link_utilization_threshold_set)       \
+    X(sx_api_ar_profile_set)                          \
+    X(sx_api_ar_shaper_rate_set)                      \
+    X(sx_api_bfd_deinit_set)                          \
+    X(sx_api_bfd_init_set)                            \
+    X(sx_api_bfd_log_verbosity_level_set)             \
+    X(sx_api_bfd_offload_get_stats)                   \
+    X(sx_api_bfd_offload_set)                         \
+    X(sx_api_bridge_iter_get)                         \
+    X(sx_api_bridge_log_verbosity_level_set)          \
+    X(sx_api_bridge_vport_set)                        \
+    X(sx_api_bulk_counter_buffer_set)                 \
+    X(sx_api_bulk_counter_log_verbosity_level_set)    \
+    X(sx_api_bulk_counter_transaction_get)            \
+    X(sx_api_bulk_counter_transaction_set)            \
+    X(sx_api_cos_log_verbosity_level_set)             \
+    X(sx_api_cos_pool_statistic_get)                  \
+    X(sx_api_cos_pools_list_get)                      \
+    X(sx_api_cos_port_buff_type_get)                  \
+    X(sx_api_cos_port_buff_type_set)                  \
+    X(sx_api_cos_port_buff_type_statistic_get)        \
+    X(sx_api_cos_port_default_prio_get)               \
+    X(sx_api_cos_port_default_prio_set)               \
+    X(sx_api_cos_port_dscp_to_prio_get)               \
+    X(sx_api_cos_port_dscp_to_prio_set)               \
+    X(sx_api_cos_port_ets_element_get)                \
+    X(sx_api_cos_port_ets_element_set)                \
+    X(sx_api_cos_port_pcpdei_to_prio_get)             \
+    X(sx_api_cos_port_pcpdei_to_prio_set)             \
+    X(sx_api_cos_port_prio_buff_map_get)              \
+    X(sx_api_cos_port_prio_buff_map_set)              \
+    X(sx_api_cos_port_prio_to_dscp_rewrite_set)       \
+    X(sx_api_cos_port_prio_to_pcpdei_rewrite_set)     \
+    X(sx_api_cos_port_rewrite_enable_get)             \
+    X(sx_api_cos_port_rewrite_enable_set)             \
+    X(sx_api_cos_port_shared_buff_type_get)           \
+    X(sx_api_cos_port_shared_buff_type_set)           \
+    X(sx_api_cos_port_tc_mcaware_get)                 \
+    X(sx_api_cos_port_tc_prio_map_set)                \
+    X(sx_api_cos_port_trust_get)                      \
+    X(sx_api_cos_port_trust_set)                      \
+    X(sx_api_cos_prio_to_ieeeprio_get)                \
+    X(sx_api_cos_prio_to_ieeeprio_set)                \
+    X(sx_api_cos_redecn_counters_get)                 \
+    X(sx_api_cos_redecn_general_param_get)            \
+    X(sx_api_cos_redecn_general_param_set)            \
+    X(sx_api_cos_redecn_log_verbosity_level_set)      \
+    X(sx_api_cos_redecn_mirroring_set)                \
+    X(sx_api_cos_redecn_profile_get)                  \
+    X(sx_api_cos_redecn_profile_set)                  \
+    X(sx_api_cos_redecn_profile_tc_bind_set)          \
+    X(sx_api_cos_redecn_tc_enable_set)                \
+    X(sx_api_cos_shared_buff_pool_get)                \
+    X(sx_api_cos_shared_buff_pool_set)                \
+    X(sx_api_dbg_fatal_failure_detection_set)         \
+    X(sx_api_dbg_generate_dump)                       \
+    X(sx_api_dbg_generate_dump_extra)                 \
+    X(sx_api_fdb_age_time_get)                        \
+    X(sx_api_fdb_age_time_set)                        \
+    X(sx_api_fdb_fid_learn_mode_get)                  \
+    X(sx_api_fdb_fid_learn_mode_set)                  \
+    X(sx_api_fdb_flood_control_set)                   \
+    X(sx_api_fdb_flood_get)                           \
+    X(sx_api_fdb_flood_set)                           \
+    X(sx_api_fdb_log_verbosity_level_set)             \
+    X(sx_api_fdb_port_learn_mode_get)                 \
+    X(sx_api_fdb_port_learn_mode_set)                 \
+    X(sx_api_fdb_uc_flush_all_set)                    \
+    X(sx_api_fdb_uc_flush_fid_set)                    \
+    X(sx_api_fdb_uc_flush_port_fid_set)               \
+    X(sx_api_fdb_uc_flush_port_set)                   \
+    X(sx_api_fdb_uc_limit_fid_get)                    \
+    X(sx_api_fdb_uc_limit_fid_set)                    \
+    X(sx_api_fdb_uc_limit_port_get)                   \
+    X(sx_api_fdb_uc_limit_port_set)                   \
+    X(sx_api_fdb_uc_mac_addr_get)                     \
+    X(sx_api_fdb_uc_mac_addr_set)                     \
+    X(sx_api_fdb_unreg_mc_flood_mode_set)             \
+    X(sx_api_fdb_unreg_mc_flood_ports_set)            \
+    X(sx_api_flex_parser_init_set)                    \
+    X(sx_api_flex_parser_log_verbosity_level_set)     \
+    X(sx_api_flex_parser_reg_ext_point_get)           \
+    X(sx_api_flex_parser_reg_ext_point_set)           \
+    X(sx_api_flex_parser_transition_get)              \
+    X(sx_api_flex_parser_transition_set)              \
+    X(sx_api_flow_counter_bulk_set)                   \
+    X(sx_api_flow_counter_clear_set)                  \
+    X(sx_api_flow_counter_get)                        \
+    X(sx_api_flow_counter_log_verbosity_level_set)    \
+    X(sx_api_flow_counter_set)                        \
+    X(sx_api_host_ifc_close)                          \
+    X(sx_api_host_ifc_counters_get)                   \
+    X(sx_api_host_ifc_log_verbosity_level_set)        \
+    X(sx_api_host_ifc_open)                           \
+    X(sx_api_host_ifc_policer_bind_get)               \
+    X(sx_api_host_ifc_policer_bind_set)               \
+    X(sx_api_host_ifc_port_vlan_trap_id_register_get) \
+    X(sx_api_host_ifc_port_vlan_trap_id_register_set) \
+    X(sx_api_host_ifc_trap_filter_set)                \
+    X(sx_api_host_ifc_trap_group_ext_set)             \
+    X(sx_api_host_ifc_trap_group_get)                 \
+    X(sx_api_host_ifc_trap_id_ext_set)                \
+    X(sx_api_host_ifc_trap_id_register_set)           \
+    X(sx_api_issu_end_set)                            \
+    X(sx_api_issu_log_verbosity_level_set)            \
+    X(sx_api_issu_start_set)                          \
+    X(sx_api_lag_log_verbosity_level_set)             \
+    X(sx_api_lag_port_collector_get)                  \
+    X(sx_api_lag_port_collector_set)                  \
+    X(sx_api_lag_port_distributor_get)                \
+    X(sx_api_lag_port_distributor_set)                \
+    X(sx_api_lag_port_group_get)                      \
+    X(sx_api_lag_port_group_set)                      \
+    X(sx_api_lag_port_hash_flow_params_set)           \
+    X(sx_api_mc_container_get)                        \
+    X(sx_api_mc_container_log_verbosity_level_set)    \
+    X(sx_api_mstp_inst_iter_get)                      \
+    X(sx_api_mstp_inst_port_state_get)                \
+    X(sx_api_mstp_inst_port_state_set)                \
+    X(sx_api_mstp_inst_set)                           \
+    X(sx_api_mstp_inst_vlan_list_get)                 \
+    X(sx_api_mstp_inst_vlan_list_set)                 \
+    X(sx_api_mstp_log_verbosity_level_set)            \
+    X(sx_api_mstp_mode_set)                           \
+    X(sx_api_policer_counters_clear_set)              \
+    X(sx_api_policer_counters_get)                    \
+    X(sx_api_policer_log_verbosity_level_set)         \
+    X(sx_api_policer_set)                             \
+    X(sx_api_port_capability_get)                     \
+    X(sx_api_port_counter_buff_get)                   \
+    X(sx_api_port_counter_clear_set)                  \
+    X(sx_api_port_counter_perf_get)                   \
+    X(sx_api_port_counter_rfc_2863_get)               \
+    X(sx_api_port_counter_tc_get)                     \
+    X(sx_api_port_crc_params_set)                     \
+    X(sx_api_port_deinit_set)                         \
+    X(sx_api_port_device_get)                         \
+    X(sx_api_port_device_set)                         \
+    X(sx_api_port_forwarding_mode_set)                \
+    X(sx_api_port_global_fc_enable_get)               \
+    X(sx_api_port_global_fc_enable_set)               \
+    X(sx_api_port_init_set)                           \
+    X(sx_api_port_isolate_get)                        \
+    X(sx_api_port_isolate_set)                        \
+    X(sx_api_port_log_verbosity_level_set)            \
+    X(sx_api_port_mapping_get)                        \
+    X(sx_api_port_mapping_set)                        \
+    X(sx_api_port_mode_get)                           \
+    X(sx_api_port_mtu_get)                            \
+    X(sx_api_port_mtu_set)                            \
+    X(sx_api_port_parsing_depth_set)                  \
+    X(sx_api_port_pfc_enable_get)                     \
+    X(sx_api_port_pfc_enable_set)                     \
+    X(sx_api_port_phy_mode_get)                       \
+    X(sx_api_port_phy_mode_set)                       \
+    X(sx_api_port_phys_loopback_get)                  \
+    X(sx_api_port_phys_loopback_set)                  \
+    X(sx_api_port_rate_capability_get)                \
+    X(sx_api_port_rate_get)                           \
+    X(sx_api_port_rate_set)                           \
+    X(sx_api_port_sflow_get)                          \
+    X(sx_api_port_sflow_set)                          \
+    X(sx_api_port_speed_admin_set)                    \
+    X(sx_api_port_speed_get)                          \
+    X(sx_api_port_state_get)                          \
+    X(sx_api_port_state_set)                          \
+    X(sx_api_port_storm_control_counters_clear_set)   \
+    X(sx_api_port_storm_control_counters_get)         \
+    X(sx_api_port_storm_control_get)                  \
+    X(sx_api_port_storm_control_set)                  \
+    X(sx_api_port_swid_bind_set)                      \
+    X(sx_api_port_swid_port_list_get)                 \
+    X(sx_api_port_swid_set)                           \
+    X(sx_api_port_vport_base_get)                     \
+    X(sx_api_port_vport_set)                          \
+    X(sx_api_register_set)                            \
+    X(sx_api_rm_free_entries_by_type_get)             \
+    X(sx_api_router_counter_clear_set)                \
+    X(sx_api_router_counter_get)                      \
+    X(sx_api_router_counter_set)                      \
+    X(sx_api_router_deinit_set)                       \
+    X(sx_api_router_ecmp_attributes_get)              \
+    X(sx_api_router_ecmp_attributes_set)              \
+    X(sx_api_router_ecmp_counter_bind_set)            \
+    X(sx_api_router_ecmp_get)                         \
+    X(sx_api_router_ecmp_port_hash_params_set)        \
+    X(sx_api_router_ecmp_set)                         \
+    X(sx_api_router_ecmp_update_set)                  \
+    X(sx_api_router_get)                              \
+    X(sx_api_router_init_set)                         \
+    X(sx_api_router_interface_counter_bind_set)       \
+    X(sx_api_router_interface_get)                    \
+    X(sx_api_router_interface_iter_get)               \
+    X(sx_api_router_interface_mac_get)                \
+    X(sx_api_router_interface_mac_set)                \
+    X(sx_api_router_interface_set)                    \
+    X(sx_api_router_interface_state_get)              \
+    X(sx_api_router_interface_state_set)              \
+    X(sx_api_router_log_verbosity_level_set)          \
+    X(sx_api_router_neigh_get)                        \
+    X(sx_api_router_neigh_set)                        \
+    X(sx_api_router_set)                              \
+    X(sx_api_router_uc_route_counter_bind_get)        \
+    X(sx_api_router_uc_route_counter_bind_set)        \
+    X(sx_api_router_vrid_iter_get)                    \
+    X(sx_api_rstp_port_state_get)                     \
+    X(sx_api_rstp_port_state_set)                     \
+    X(sx_api_sdk_init_set)                            \
+    X(sx_api_span_analyzer_set)                       \
+    X(sx_api_span_deinit_set)                         \
+    X(sx_api_span_drop_mirror_set)                    \
+    X(sx_api_span_init_set)                           \
+    X(sx_api_span_log_verbosity_level_set)            \
+    X(sx_api_span_mirror_bind_set)                    \
+    X(sx_api_span_mirror_enable_set)                  \
+    X(sx_api_span_mirror_get)                         \
+    X(sx_api_span_mirror_set)                         \
+    X(sx_api_span_mirror_state_set)                   \
+    X(sx_api_span_session_analyzer_get)               \
+    X(sx_api_span_session_get)                        \
+    X(sx_api_span_session_iter_get)                   \
+    X(sx_api_span_session_policer_bind_set)           \
+    X(sx_api_span_session_set)                        \
+    X(sx_api_span_session_state_set)                  \
+    X(sx_api_system_log_enter_func_severity_set)      \
+    X(sx_api_system_log_verbosity_level_set)          \
+    X(sx_api_table_meta_tunnel_entry_set)             \
+    X(sx_api_topo_device_set)                         \
+    X(sx_api_topo_log_verbosity_level_set)            \
+    X(sx_api_transaction_mode_set)                    \
+    X(sx_api_tunnel_cos_set)                          \
+    X(sx_api_tunnel_counter_get)                      \
+    X(sx_api_tunnel_decap_rules_get)                  \
+    X(sx_api_tunnel_decap_rules_set)                  \
+    X(sx_api_tunnel_hash_set)                         \
+    X(sx_api_tunnel_init_set)                         \
+    X(sx_api_tunnel_iter_get)                         \
+    X(sx_api_tunnel_log_verbosity_level_set)          \
+    X(sx_api_tunnel_map_set)                          \
+    X(sx_api_tunnel_set)                              \
+    X(sx_api_tunnel_ttl_set)                          \
+    X(sx_api_vlan_attrib_set)                         \
+    X(sx_api_vlan_log_verbosity_level_set)            \
+    X(sx_api_vlan_port_accptd_frm_types_get)          \
+    X(sx_api_vlan_port_accptd_frm_types_set)          \
+    X(sx_api_vlan_port_ingr_filter_get)               \
+    X(sx_api_vlan_port_ingr_filter_set)               \
+    X(sx_api_vlan_port_multi_vlan_set)                \
+    X(sx_api_vlan_port_prio_tagged_get)               \
+    X(sx_api_vlan_port_prio_tagged_set)               \
+    X(sx_api_vlan_port_pvid_get)                      \
+    X(sx_api_vlan_port_pvid_set)                      \
+    X(sx_api_vlan_ports_get)                          \
+    X(sx_api_vlan_ports_set)                          \
+    X(sx_api_vlan_set)
+
+#define SX_API_STUB_CUSTOM_CALLS(X)\
+    X(sx_api_open)                \
+    X(sx_api_close)               \
+    X(sx_api_bridge_set)          \
+    X(sx_api_mc_container_set)    \
+    X(sx_api_router_uc_route_set) \
+    X(sx_api_router_uc_route_get)
+
+#define SX_API_STUB_CALL_ID(name) SX_API_STUB_CALL_ ## name,
+typedef enum sx_api_stub_call {
+    SX_API_STUB_GENERIC_CALLS(SX_API_STUB_CALL_ID)
+    SX_API_STUB_CUSTOM_CALLS(SX_API_STUB_CALL_ID)
+    SX_API_STUB_CALL_MAX
+} sx_api_stub_call_t;
+#undef SX_API_STUB_CALL_ID
+
+#define SX_API_STUB_ROUTES_DEF (1 << 20)
+
+/* Latency of every call in ns and the capacity of the route table, 0 for the default */
+int sx_api_stub_init(uint32_t latency_ns, uint32_t routes_max);
+void sx_api_stub_deinit(void);
+/* Counts and delays the call, returns SX_STATUS_SUCCESS */
+int sx_api_stub_enter(sx_api_stub_call_t call);
+uint64_t sx_api_stub_call_count_get(sx_api_stub_call_t call);
+uint64_t sx_api_stub_calls_get(void);
+void sx_api_stub_calls_dump(FILE *file);
+
+#endif /* __SX_API_STUB_H__ */
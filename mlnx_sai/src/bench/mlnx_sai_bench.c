@@ -0,0 +1,1399 @@
+/*
+ *  Copyright (C) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "mlnx_sai.h"
+#include "assert.h"
+#include <getopt.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sdk/sx_api_stub.h>
+
+/*
+ * SAI hot path benchmarks (--enable-bench).
+ *
+ * libsai runs over the stub SDK (sdk/sx_api_stub.c) with the SAI DB created from the XML config
+ * given with -c, no switch and no SDK daemon are needed. Every benchmark reports the number of
+ * operations per second, the heap allocations and the SDK calls per operation. The latency of an
+ * SDK call is simulated with -l so the effect of saving SDK calls can be seen next to the CPU cost.
+ * The benchmarks also check the results of the operations (ASSERT_TRUE), a failed check exits with 1.
+ * ACL entries are not covered - the ACL init depends on the SDK regions and the psort background
+ * threads which are not emulated by the stub.
+ */
+
+#define MLNX_BENCH_ROUTES_DEF       (100000)
+#define MLNX_BENCH_LOOKUPS_DEF      (1000000)
+#define MLNX_BENCH_RM_TYPE          MLNX_SHM_RM_ARRAY_TYPE_NEXTHOP
+#define MLNX_BENCH_ROUTE_BASE       (0x0a000000) /* 10.0.0.0 */
+#define MLNX_BENCH_FDB_MAC_BASE     (0x020000000000ULL)
+#define MLNX_BENCH_BFD_SESSIONS     (64)
+#define MLNX_BENCH_BFD_THREADS      (4)
+#define MLNX_BENCH_BFD_DISC_BASE    (0x1000)
+#define MLNX_BENCH_BFD_PEER_BASE    (0x2000)
+
+#define ASSERT_TRUE(x, fmt, ...)                            \
+    if (!(x)) {                                             \
+        fprintf(stderr,                                     \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n", \
+                __func__, __LINE__, #x, ## __VA_ARGS__);    \
+        exit(1); }
+
+typedef struct mlnx_bench_opts {
+    const char     *config_file;
+    const char     *filter;
+    sx_chip_types_t chip_type;
+    uint32_t        routes;
+    uint32_t        l2mc_members;
+    uint32_t        lookups;
+    uint32_t        latency_ns;
+    bool            stub_dump;
+} mlnx_bench_opts_t;
+
+typedef struct mlnx_bench {
+    const char *name;
+    uint64_t    start_ns;
+    uint64_t    start_allocs;
+    uint64_t    start_sdk_calls;
+} mlnx_bench_t;
+
+static mlnx_bench_opts_t bench_opts = {
+    .chip_type = SX_CHIP_TYPE_SPECTRUM2,
+    .routes = MLNX_BENCH_ROUTES_DEF,
+    .l2mc_members = MLNX_L2MC_GROUP_MEMBER_DB_SIZE_DEF,
+    .lookups = MLNX_BENCH_LOOKUPS_DEF,
+};
+static sai_object_id_t   bench_switch_id;
+static uint64_t          bench_allocs;
+
+#ifdef __GLIBC__
+/* Count the heap allocations of libsai, the definitions of the executable preempt the libc ones */
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t nmemb, size_t size);
+extern void* __libc_realloc(void *ptr, size_t size);
+
+void* malloc(size_t size)
+{
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t nmemb, size_t size)
+{
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __libc_calloc(nmemb, size);
+}
+
+void* realloc(void *ptr, size_t size)
+{
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __libc_realloc(ptr, size);
+}
+#endif /* __GLIBC__ */
+
+static const char* bench_profile_get_value(_In_ sai_switch_profile_id_t profile_id, _In_ const char *variable)
+{
+    return NULL;
+}
+
+static int bench_profile_get_next_value(_In_ sai_switch_profile_id_t profile_id,
+                                        _Out_ const char           **variable,
+                                        _Out_ const char           **value)
+{
+    return -1;
+}
+
+static const sai_service_method_table_t bench_services = {
+    .profile_get_value = bench_profile_get_value,
+    .profile_get_next_value = bench_profile_get_next_value,
+};
+
+static uint64_t bench_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool bench_selected(_In_ const char *name)
+{
+    return !bench_opts.filter || strstr(name, bench_opts.filter);
+}
+
+static void bench_start(_Out_ mlnx_bench_t *bench, _In_ const char *name)
+{
+    bench->name = name;
+    bench->start_allocs = __atomic_load_n(&bench_allocs, __ATOMIC_RELAXED);
+    bench->start_sdk_calls = sx_api_stub_calls_get();
+    bench->start_ns = bench_time_ns();
+}
+
+static void bench_end(_In_ const mlnx_bench_t *bench, _In_ uint64_t ops)
+{
+    uint64_t ns, allocs, sdk_calls;
+
+    ns = bench_time_ns() - bench->start_ns;
+    allocs = __atomic_load_n(&bench_allocs, __ATOMIC_RELAXED) - bench->start_allocs;
+    sdk_calls = sx_api_stub_calls_get() - bench->start_sdk_calls;
+
+    if (!ops) {
+        printf("%-32s %10s\n", bench->name, "no ops");
+        return;
+    }
+
+    printf("%-32s %10" PRIu64 " %14.0f %10" PRIu64 " %10.2f %10.2f\n",
+           bench->name, ops, ns ? (double)ops * 1e9 / (double)ns : 0.0, ns / ops,
+           (double)allocs / (double)ops, (double)sdk_calls / (double)ops);
+}
+
+static void bench_route_entry_init(_Out_ sai_route_entry_t *route_entry, _In_ uint32_t idx)
+{
+    memset(route_entry, 0, sizeof(*route_entry));
+    route_entry->switch_id = bench_switch_id;
+    route_entry->vr_id = g_sai_db_ptr->default_vrid;
+    route_entry->destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    route_entry->destination.addr.ip4 = htonl(MLNX_BENCH_ROUTE_BASE + idx);
+    route_entry->destination.mask.ip4 = 0xffffffff;
+}
+
+static sai_status_t bench_routes(void)
+{
+    sai_route_api_t   *route_api;
+    sai_route_entry_t *route_entries;
+    sai_attribute_t    attr;
+    mlnx_bench_t       bench;
+    sai_status_t       status;
+    uint32_t           ii;
+
+    status = sai_api_query(SAI_API_ROUTE, (void**)&route_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    route_entries = calloc(bench_opts.routes, sizeof(*route_entries));
+    if (!route_entries) {
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (ii = 0; ii < bench_opts.routes; ii++) {
+        bench_route_entry_init(&route_entries[ii], ii);
+    }
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    bench_start(&bench, "route create");
+    for (ii = 0; ii < bench_opts.routes; ii++) {
+        status = route_api->create_route_entry(&route_entries[ii], 1, &attr);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to create route %u - %d\n", ii, status);
+            goto out;
+        }
+    }
+    bench_end(&bench, ii);
+
+    bench_start(&bench, "route get packet action");
+    for (ii = 0; ii < bench_opts.routes; ii++) {
+        status = route_api->get_route_entry_attribute(&route_entries[ii], 1, &attr);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to get route %u - %d\n", ii, status);
+            goto out;
+        }
+    }
+    bench_end(&bench, ii);
+
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+    bench_start(&bench, "route set packet action");
+    for (ii = 0; ii < bench_opts.routes; ii++) {
+        status = route_api->set_route_entry_attribute(&route_entries[ii], &attr);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to set route %u - %d\n", ii, status);
+            goto out;
+        }
+    }
+    bench_end(&bench, ii);
+
+    bench_start(&bench, "route remove");
+    for (ii = 0; ii < bench_opts.routes; ii++) {
+        status = route_api->remove_route_entry(&route_entries[ii]);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to remove route %u - %d\n", ii, status);
+            goto out;
+        }
+    }
+    bench_end(&bench, ii);
+
+out:
+    free(route_entries);
+    return status;
+}
+
+static sai_status_t bench_shm_rm(void)
+{
+    mlnx_shm_rm_array_idx_t *idxs;
+    mlnx_bench_t             bench;
+    sai_status_t             status = SAI_STATUS_SUCCESS;
+    uint32_t                 count, ii;
+    void                    *elem;
+
+    sai_db_write_lock();
+
+    count = mlnx_shm_rm_array_free_entries_count(MLNX_BENCH_RM_TYPE);
+    idxs = calloc(count, sizeof(*idxs));
+    if (!idxs) {
+        sai_db_unlock();
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    bench_start(&bench, "shm rm array alloc");
+    for (ii = 0; ii < count; ii++) {
+        status = mlnx_shm_rm_array_alloc(MLNX_BENCH_RM_TYPE, &idxs[ii], &elem);
+        if (SAI_ERR(status)) {
+            break;
+        }
+    }
+    count = ii;
+    bench_end(&bench, count);
+
+    bench_start(&bench, "shm rm array free");
+    for (ii = 0; ii < count; ii++) {
+        status = mlnx_shm_rm_array_free(idxs[ii]);
+        if (SAI_ERR(status)) {
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+
+    sai_db_unlock();
+
+    free(idxs);
+    return status;
+}
+
+static uint32_t bench_bridge_ports_get(_Out_ sai_object_id_t *oids, _Out_ sx_port_log_id_t *logs)
+{
+    mlnx_bridge_port_t *bport;
+    mlnx_port_config_t *port;
+    uint32_t            count = 0, ii;
+
+    sai_db_read_lock();
+
+    mlnx_port_phy_foreach(port, ii) {
+        if (SAI_ERR(mlnx_bridge_port_by_log(port->logical, &bport))) {
+            continue;
+        }
+        if (SAI_ERR(mlnx_bridge_port_to_oid(bport, &oids[count]))) {
+            continue;
+        }
+        logs[count++] = port->logical;
+    }
+
+    sai_db_unlock();
+
+    return count;
+}
+
+static sai_status_t bench_bridge_ports(void)
+{
+    sai_bridge_api_t   *bridge_api;
+    mlnx_bridge_port_t *bport;
+    sai_object_id_t     oids[MAX_PORTS];
+    sx_port_log_id_t    logs[MAX_PORTS];
+    sai_attribute_t     attr;
+    mlnx_bench_t        bench;
+    sai_status_t        status = SAI_STATUS_SUCCESS;
+    uint32_t            count, ii;
+
+    status = sai_api_query(SAI_API_BRIDGE, (void**)&bridge_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    count = bench_bridge_ports_get(oids, logs);
+    if (!count) {
+        fprintf(stderr, "No bridge ports\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    sai_db_read_lock();
+
+    bench_start(&bench, "bridge port by log port");
+    for (ii = 0; ii < bench_opts.lookups; ii++) {
+        status = mlnx_bridge_port_by_log(logs[ii % count], &bport);
+        if (SAI_ERR(status)) {
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+
+    bench_start(&bench, "bridge port by oid");
+    for (ii = 0; ii < bench_opts.lookups; ii++) {
+        status = mlnx_bridge_port_by_oid(oids[ii % count], &bport);
+        if (SAI_ERR(status)) {
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+
+    sai_db_unlock();
+
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    /* Attribute dispatch - get attribute served from the SAI DB */
+    bench_start(&bench, "bridge port get port id");
+    for (ii = 0; ii < bench_opts.lookups; ii++) {
+        attr.id = SAI_BRIDGE_PORT_ATTR_PORT_ID;
+        status = bridge_api->get_bridge_port_attribute(oids[ii % count], 1, &attr);
+        if (SAI_ERR(status)) {
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+
+    return status;
+}
+
+static sai_status_t bench_l2mc_groups_create(_In_ const sai_l2mc_group_api_t *l2mc_api,
+                                             _Out_ sai_object_id_t           *groups,
+                                             _In_ uint32_t                    groups_count)
+{
+    sai_status_t status;
+    uint32_t     ii;
+
+    for (ii = 0; ii < groups_count; ii++) {
+        status = l2mc_api->create_l2mc_group(&groups[ii], bench_switch_id, 0, NULL);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to create L2MC group %u - %d\n", ii, status);
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void bench_l2mc_groups_remove(_In_ const sai_l2mc_group_api_t *l2mc_api,
+                                     _In_ const sai_object_id_t      *groups,
+                                     _In_ uint32_t                    groups_count)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < groups_count; ii++) {
+        l2mc_api->remove_l2mc_group(groups[ii]);
+    }
+}
+
+static sai_status_t bench_l2mc(void)
+{
+    sai_l2mc_group_api_t   *l2mc_api;
+    sai_object_id_t         ports[MAX_PORTS];
+    sx_port_log_id_t        logs[MAX_PORTS];
+    sai_object_id_t        *groups = NULL, *members = NULL;
+    sai_attribute_t        *attrs = NULL;
+    const sai_attribute_t **attr_lists = NULL;
+    uint32_t               *attr_counts = NULL;
+    sai_status_t           *statuses = NULL;
+    mlnx_bench_t            bench;
+    sai_status_t            status;
+    uint32_t                ports_count, groups_count, members_count, ii;
+
+    status = sai_api_query(SAI_API_L2MC_GROUP, (void**)&l2mc_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    ports_count = bench_bridge_ports_get(ports, logs);
+    if (!ports_count) {
+        fprintf(stderr, "No bridge ports\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    /* Every port is a member of every group */
+    groups_count = (bench_opts.l2mc_members + ports_count - 1) / ports_count;
+    groups_count = MIN(groups_count, MLNX_L2MC_GROUP_DB_SIZE);
+    members_count = MIN(bench_opts.l2mc_members, groups_count * ports_count);
+    members_count = MIN(members_count, MLNX_L2MC_GROUP_MEMBER_DB_SIZE);
+
+    groups = calloc(groups_count, sizeof(*groups));
+    members = calloc(members_count, sizeof(*members));
+    attrs = calloc((size_t)members_count * 2, sizeof(*attrs));
+    attr_lists = calloc(members_count, sizeof(*attr_lists));
+    attr_counts = calloc(members_count, sizeof(*attr_counts));
+    statuses = calloc(members_count, sizeof(*statuses));
+    if (!groups || !members || !attrs || !attr_lists || !attr_counts || !statuses) {
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    status = bench_l2mc_groups_create(l2mc_api, groups, groups_count);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    for (ii = 0; ii < members_count; ii++) {
+        attrs[ii * 2].id = SAI_L2MC_GROUP_MEMBER_ATTR_L2MC_GROUP_ID;
+        attrs[ii * 2].value.oid = groups[ii / ports_count];
+        attrs[ii * 2 + 1].id = SAI_L2MC_GROUP_MEMBER_ATTR_L2MC_OUTPUT_ID;
+        attrs[ii * 2 + 1].value.oid = ports[ii % ports_count];
+        attr_lists[ii] = &attrs[ii * 2];
+        attr_counts[ii] = 2;
+    }
+
+    bench_start(&bench, "l2mc member create");
+    for (ii = 0; ii < members_count; ii++) {
+        status = l2mc_api->create_l2mc_group_member(&members[ii], bench_switch_id, 2, attr_lists[ii]);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to create L2MC group member %u - %d\n", ii, status);
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+    members_count = ii;
+
+    bench_start(&bench, "l2mc member remove");
+    for (ii = 0; ii < members_count; ii++) {
+        status = l2mc_api->remove_l2mc_group_member(members[ii]);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to remove L2MC group member %u - %d\n", ii, status);
+            goto out_groups;
+        }
+    }
+    bench_end(&bench, ii);
+
+    bench_start(&bench, "l2mc member bulk create");
+    status = mlnx_create_l2mc_group_members(bench_switch_id, members_count, attr_counts, attr_lists,
+                                            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, members, statuses);
+    bench_end(&bench, members_count);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to bulk create L2MC group members - %d\n", status);
+        goto out_groups;
+    }
+
+    bench_start(&bench, "l2mc member bulk remove");
+    status = mlnx_remove_l2mc_group_members(members_count, members, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses);
+    bench_end(&bench, members_count);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to bulk remove L2MC group members - %d\n", status);
+    }
+
+out_groups:
+    bench_l2mc_groups_remove(l2mc_api, groups, groups_count);
+out:
+    free(groups);
+    free(members);
+    free(attrs);
+    free(attr_lists);
+    free(attr_counts);
+    free(statuses);
+    return status;
+}
+
+/*
+ * All the free QoS maps are allocated, freed in random order and allocated again. Each round has to get
+ * the same number of maps with distinct DB indexes, the create/remove churn is then measured on a full DB.
+ */
+static sai_status_t bench_qos_maps_fill(_In_ const sai_qos_map_api_t *qos_map_api,
+                                        _Out_ sai_object_id_t        *maps,
+                                        _In_ uint32_t                 maps_max,
+                                        _Out_ uint32_t               *maps_count)
+{
+    sai_qos_map_t   map_list = { 0 };
+    sai_attribute_t attrs[2];
+    uint8_t        *used = NULL;
+    uint32_t        ii, db_idx;
+    sai_status_t    status = SAI_STATUS_SUCCESS;
+
+    used = calloc(MAX_QOS_MAPS + 1, sizeof(*used));
+    if (!used) {
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    attrs[0].id = SAI_QOS_MAP_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_QOS_MAP_TYPE_TC_TO_QUEUE;
+    attrs[1].id = SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST;
+    attrs[1].value.qosmap.count = 1;
+    attrs[1].value.qosmap.list = &map_list;
+
+    for (ii = 0; ii < maps_max; ii++) {
+        status = qos_map_api->create_qos_map(&maps[ii], bench_switch_id, 2, attrs);
+        if (status == SAI_STATUS_TABLE_FULL) {
+            status = SAI_STATUS_SUCCESS;
+            break;
+        }
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to create QoS map %u - %d\n", ii, status);
+            goto out;
+        }
+
+        status = mlnx_object_to_type(maps[ii], SAI_OBJECT_TYPE_QOS_MAP, &db_idx, NULL);
+        ASSERT_TRUE(SAI_OK(status) && db_idx && (db_idx <= MAX_QOS_MAPS) && !used[db_idx],
+                    "QoS map %u got invalid or used DB index %u", ii, db_idx);
+        used[db_idx] = 1;
+    }
+
+    *maps_count = ii;
+
+out:
+    free(used);
+    return status;
+}
+
+/* Maps of the same content are found identical by the content hash, a set of the list re-hashes the map */
+static void bench_qos_maps_content_check(_In_ const sai_qos_map_api_t *qos_map_api,
+                                         _In_ sai_object_id_t          map,
+                                         _In_ sai_object_id_t          other)
+{
+    sai_qos_map_t   map_list = { 0 }, get_list = { 0 };
+    sai_attribute_t attr;
+    uint32_t        map_idx, other_idx;
+    sai_status_t    status;
+
+    ASSERT_TRUE(SAI_OK(mlnx_object_to_type(map, SAI_OBJECT_TYPE_QOS_MAP, &map_idx, NULL)), "");
+    ASSERT_TRUE(SAI_OK(mlnx_object_to_type(other, SAI_OBJECT_TYPE_QOS_MAP, &other_idx, NULL)), "");
+    ASSERT_TRUE(mlnx_qos_map_content_is_identical(map_idx, other_idx), "maps %u %u", map_idx, other_idx);
+
+    map_list.key.tc = 1;
+    map_list.value.queue_index = 2;
+    attr.id = SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST;
+    attr.value.qosmap.count = 1;
+    attr.value.qosmap.list = &map_list;
+    status = qos_map_api->set_qos_map_attribute(other, &attr);
+    ASSERT_TRUE(SAI_OK(status), "status %d", status);
+    ASSERT_TRUE(!mlnx_qos_map_content_is_identical(map_idx, other_idx), "maps %u %u", map_idx, other_idx);
+
+    attr.value.qosmap.list = &get_list;
+    status = qos_map_api->get_qos_map_attribute(other, 1, &attr);
+    ASSERT_TRUE(SAI_OK(status) && (attr.value.qosmap.count == 1), "status %d count %u", status,
+                attr.value.qosmap.count);
+    ASSERT_TRUE((get_list.key.tc == 1) && (get_list.value.queue_index == 2), "tc %u queue %u", get_list.key.tc,
+                get_list.value.queue_index);
+
+    memset(&map_list, 0, sizeof(map_list));
+    attr.value.qosmap.list = &map_list;
+    status = qos_map_api->set_qos_map_attribute(other, &attr);
+    ASSERT_TRUE(SAI_OK(status), "status %d", status);
+    ASSERT_TRUE(mlnx_qos_map_content_is_identical(map_idx, other_idx), "maps %u %u", map_idx, other_idx);
+}
+
+static sai_status_t bench_qos_maps(void)
+{
+    sai_qos_map_api_t *qos_map_api;
+    sai_object_id_t   *maps;
+    sai_qos_map_t      map_list = { 0 };
+    sai_attribute_t    attrs[2];
+    mlnx_bench_t       bench;
+    sai_status_t       status;
+    sai_object_id_t    tmp;
+    uint32_t           count = 0, refill_count, ii, jj, round;
+
+    status = sai_api_query(SAI_API_QOS_MAP, (void**)&qos_map_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    maps = calloc(MAX_QOS_MAPS + 1, sizeof(*maps));
+    if (!maps) {
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    srand(1);
+
+    bench_start(&bench, "qos map create all");
+    status = bench_qos_maps_fill(qos_map_api, maps, MAX_QOS_MAPS + 1, &count);
+    bench_end(&bench, count);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+    ASSERT_TRUE(count > 1, "free QoS maps %u", count);
+
+    bench_qos_maps_content_check(qos_map_api, maps[0], maps[1]);
+
+    for (round = 0; round < 4; round++) {
+        for (ii = count - 1; ii > 0; ii--) {
+            jj = (uint32_t)rand() % (ii + 1);
+            tmp = maps[ii];
+            maps[ii] = maps[jj];
+            maps[jj] = tmp;
+        }
+
+        bench_start(&bench, "qos map remove random");
+        for (ii = 0; ii < count; ii++) {
+            status = qos_map_api->remove_qos_map(maps[ii]);
+            if (SAI_ERR(status)) {
+                fprintf(stderr, "Failed to remove QoS map %" PRIx64 " - %d\n", maps[ii], status);
+                goto out;
+            }
+        }
+        bench_end(&bench, count);
+
+        bench_start(&bench, "qos map create all");
+        status = bench_qos_maps_fill(qos_map_api, maps, MAX_QOS_MAPS + 1, &refill_count);
+        bench_end(&bench, refill_count);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+        ASSERT_TRUE(refill_count == count, "created %u QoS maps after random free, expected %u", refill_count,
+                    count);
+    }
+
+    /* Churn on an almost full DB - the last free slot is taken and released */
+    status = qos_map_api->remove_qos_map(maps[count - 1]);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+    count--;
+
+    attrs[0].id = SAI_QOS_MAP_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_QOS_MAP_TYPE_TC_TO_QUEUE;
+    attrs[1].id = SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST;
+    attrs[1].value.qosmap.count = 1;
+    attrs[1].value.qosmap.list = &map_list;
+
+    status = qos_map_api->create_qos_map(&tmp, bench_switch_id, 2, attrs);
+    ASSERT_TRUE(SAI_OK(status), "status %d", status);
+    status = qos_map_api->create_qos_map(&maps[count], bench_switch_id, 2, attrs);
+    ASSERT_TRUE(status == SAI_STATUS_TABLE_FULL, "create on full DB status %d", status);
+    status = qos_map_api->remove_qos_map(tmp);
+    ASSERT_TRUE(SAI_OK(status), "status %d", status);
+
+    bench_start(&bench, "qos map create/remove full");
+    for (ii = 0; ii < bench_opts.lookups / 10; ii++) {
+        status = qos_map_api->create_qos_map(&tmp, bench_switch_id, 2, attrs);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to create QoS map - %d\n", status);
+            break;
+        }
+        status = qos_map_api->remove_qos_map(tmp);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to remove QoS map - %d\n", status);
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+
+out:
+    for (ii = 0; ii < count; ii++) {
+        qos_map_api->remove_qos_map(maps[ii]);
+    }
+    free(maps);
+    return status;
+}
+
+static sai_status_t bench_fdb_events(void)
+{
+    sai_fdb_event_notification_data_t *fdb_events = NULL;
+    sai_attribute_t                   *attr_list = NULL;
+    sx_fdb_notify_data_t              *packet = NULL;
+    sai_object_id_t                    ports[MAX_PORTS];
+    sx_port_log_id_t                   logs[MAX_PORTS];
+    mlnx_bench_t                       bench;
+    sai_status_t                       status = SAI_STATUS_SUCCESS;
+    uint32_t                           ports_count, event_count, batches, ii, jj;
+    uint64_t                           mac;
+
+    ports_count = bench_bridge_ports_get(ports, logs);
+    if (!ports_count) {
+        fprintf(stderr, "No bridge ports\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    packet = calloc(1, sizeof(*packet));
+    fdb_events = calloc(SX_FDB_NOTIFY_SIZE_MAX, sizeof(*fdb_events));
+    attr_list = calloc(SX_FDB_NOTIFY_SIZE_MAX * FDB_NOTIF_ATTRIBS_NUM, sizeof(*attr_list));
+    if (!packet || !fdb_events || !attr_list) {
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    packet->records_num = SX_FDB_NOTIFY_SIZE_MAX;
+    for (ii = 0; ii < SX_FDB_NOTIFY_SIZE_MAX; ii++) {
+        packet->records_arr[ii].type = SX_FDB_NOTIFY_TYPE_NEW_MAC_PORT;
+        packet->records_arr[ii].log_port = logs[ii % ports_count];
+        packet->records_arr[ii].fid = DEFAULT_VLAN;
+        mac = MLNX_BENCH_FDB_MAC_BASE + ii;
+        for (jj = 0; jj < 6; jj++) {
+            packet->records_arr[ii].mac_addr.ether_addr_octet[jj] = (uint8_t)(mac >> (8 * (5 - jj)));
+        }
+    }
+
+    batches = MAX(bench_opts.lookups / SX_FDB_NOTIFY_SIZE_MAX, 1);
+
+    bench_start(&bench, "fdb event parse (per record)");
+    for (ii = 0; ii < batches; ii++) {
+        status = mlnx_bench_fdb_event_parse((uint8_t*)packet, fdb_events, &event_count, attr_list);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to parse FDB event - %d\n", status);
+            break;
+        }
+    }
+    bench_end(&bench, (uint64_t)ii * SX_FDB_NOTIFY_SIZE_MAX);
+
+out:
+    free(packet);
+    free(fdb_events);
+    free(attr_list);
+    return status;
+}
+
+typedef struct mlnx_bench_bfd_worker {
+    pthread_t        thread;
+    sai_object_id_t *sessions;
+    uint32_t         first;
+    uint32_t         step;
+    uint32_t         count;
+    uint32_t         cycles;
+    sai_status_t     status;
+} mlnx_bench_bfd_worker_t;
+
+static sai_bfd_api_t *bench_bfd_api;
+static uint64_t       bench_bfd_up_notifs;
+static uint64_t       bench_bfd_down_notifs;
+static uint64_t       bench_bfd_bad_notifs;
+static uint64_t       bench_bfd_gets;
+static uint64_t       bench_bfd_bad_gets;
+static bool           bench_bfd_stop;
+
+static void bench_bfd_state_change(_In_ uint32_t                                   count,
+                                   _In_ const sai_bfd_session_state_notification_t *data)
+{
+    sai_attribute_t attr;
+    uint32_t        ii;
+
+    for (ii = 0; ii < count; ii++) {
+        /* The notification is raised with no lock held, the session can be read back from the callback */
+        attr.id = SAI_BFD_SESSION_ATTR_LOCAL_DISCRIMINATOR;
+        if (SAI_ERR(bench_bfd_api->get_bfd_session_attribute(data[ii].bfd_session_id, 1, &attr))) {
+            __atomic_add_fetch(&bench_bfd_bad_notifs, 1, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        if (data[ii].session_state == SAI_BFD_SESSION_STATE_UP) {
+            __atomic_add_fetch(&bench_bfd_up_notifs, 1, __ATOMIC_RELAXED);
+        } else if (data[ii].session_state == SAI_BFD_SESSION_STATE_DOWN) {
+            __atomic_add_fetch(&bench_bfd_down_notifs, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&bench_bfd_bad_notifs, 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/* Session goes DOWN -> UP on the peer INIT packet and UP -> DOWN on the detection timeout */
+static void* bench_bfd_worker(void *arg)
+{
+    mlnx_bench_bfd_worker_t *worker = arg;
+    mlnx_bfd_packet_t        packet;
+    uint32_t                 cycle, ii, idx;
+
+    for (cycle = 0; cycle < worker->cycles; cycle++) {
+        for (ii = 0; ii < worker->count; ii++) {
+            idx = worker->first + ii * worker->step;
+
+            memset(&packet, 0, sizeof(packet));
+            packet.vers_diag = 1 << 5;
+            packet.flags = SAI_BFD_SESSION_STATE_INIT << 6;
+            packet.mult = 3;
+            packet.length = sizeof(packet);
+            packet.my_disc = htonl(MLNX_BENCH_BFD_PEER_BASE + idx);
+            packet.your_disc = htonl(MLNX_BENCH_BFD_DISC_BASE + idx);
+            packet.min_tx = htonl(BFD_MIN_SUPPORTED_INTERVAL);
+            packet.min_rx = htonl(BFD_MIN_SUPPORTED_INTERVAL);
+
+            worker->status = mlnx_bench_bfd_packet_handle(worker->sessions[idx], &packet, 255);
+            if (SAI_ERR(worker->status)) {
+                fprintf(stderr, "Failed to handle BFD packet - %d\n", worker->status);
+                return NULL;
+            }
+
+            worker->status = mlnx_bench_bfd_timeout_handle(worker->sessions[idx]);
+            if (SAI_ERR(worker->status)) {
+                fprintf(stderr, "Failed to handle BFD timeout - %d\n", worker->status);
+                return NULL;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void* bench_bfd_reader(void *arg)
+{
+    sai_object_id_t *sessions = arg;
+    sai_attribute_t  attr;
+    uint32_t         ii = 0, idx;
+
+    /* The session read during the transitions is consistent - the peer keeps its discriminator */
+    while (!__atomic_load_n(&bench_bfd_stop, __ATOMIC_RELAXED)) {
+        idx = ii++ % MLNX_BENCH_BFD_SESSIONS;
+        attr.id = SAI_BFD_SESSION_ATTR_REMOTE_DISCRIMINATOR;
+        if (SAI_ERR(bench_bfd_api->get_bfd_session_attribute(sessions[idx], 1, &attr)) ||
+            (attr.value.u32 != MLNX_BENCH_BFD_PEER_BASE + idx)) {
+            __atomic_add_fetch(&bench_bfd_bad_gets, 1, __ATOMIC_RELAXED);
+        }
+        __atomic_add_fetch(&bench_bfd_gets, 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+static sai_status_t bench_bfd(void)
+{
+    mlnx_bench_bfd_worker_t workers[MLNX_BENCH_BFD_THREADS];
+    sai_object_id_t         sessions[MLNX_BENCH_BFD_SESSIONS];
+    sai_switch_api_t       *switch_api;
+    sai_attribute_t         attrs[11], attr;
+    mlnx_bench_t            bench;
+    pthread_t               reader;
+    sai_status_t            status;
+    uint32_t                count = 0, cycles, ii;
+    uint64_t                expected;
+
+    status = sai_api_query(SAI_API_BFD, (void**)&bench_bfd_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = sai_api_query(SAI_API_SWITCH, (void**)&switch_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    attr.id = SAI_SWITCH_ATTR_BFD_SESSION_STATE_CHANGE_NOTIFY;
+    attr.value.ptr = (sai_pointer_t)bench_bfd_state_change;
+    status = switch_api->set_switch_attribute(bench_switch_id, &attr);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to set BFD notification - %d\n", status);
+        return status;
+    }
+
+    memset(attrs, 0, sizeof(attrs));
+    attrs[0].id = SAI_BFD_SESSION_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_BFD_SESSION_TYPE_ASYNC_ACTIVE;
+    attrs[1].id = SAI_BFD_SESSION_ATTR_VIRTUAL_ROUTER;
+    attrs[1].value.oid = g_sai_db_ptr->default_vrid;
+    attrs[2].id = SAI_BFD_SESSION_ATTR_LOCAL_DISCRIMINATOR;
+    attrs[3].id = SAI_BFD_SESSION_ATTR_REMOTE_DISCRIMINATOR;
+    attrs[4].id = SAI_BFD_SESSION_ATTR_UDP_SRC_PORT;
+    attrs[5].id = SAI_BFD_SESSION_ATTR_IPHDR_VERSION;
+    attrs[5].value.u8 = 4;
+    attrs[6].id = SAI_BFD_SESSION_ATTR_SRC_IP_ADDRESS;
+    attrs[6].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    attrs[6].value.ipaddr.addr.ip4 = htonl(MLNX_BENCH_ROUTE_BASE + 1);
+    attrs[7].id = SAI_BFD_SESSION_ATTR_DST_IP_ADDRESS;
+    attrs[7].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    attrs[8].id = SAI_BFD_SESSION_ATTR_MIN_TX;
+    attrs[8].value.u32 = BFD_MIN_SUPPORTED_INTERVAL;
+    attrs[9].id = SAI_BFD_SESSION_ATTR_MIN_RX;
+    attrs[9].value.u32 = BFD_MIN_SUPPORTED_INTERVAL;
+    attrs[10].id = SAI_BFD_SESSION_ATTR_MULTIPLIER;
+    attrs[10].value.u8 = 3;
+
+    for (count = 0; count < MLNX_BENCH_BFD_SESSIONS; count++) {
+        attrs[2].value.u32 = MLNX_BENCH_BFD_DISC_BASE + count;
+        attrs[3].value.u32 = MLNX_BENCH_BFD_PEER_BASE + count;
+        attrs[4].value.u32 = 49152 + count;
+        attrs[7].value.ipaddr.addr.ip4 = htonl(MLNX_BENCH_ROUTE_BASE + 0x100 + count);
+        status = bench_bfd_api->create_bfd_session(&sessions[count], bench_switch_id, ARRAY_SIZE(attrs), attrs);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to create BFD session - %d\n", status);
+            goto out;
+        }
+    }
+
+    /* Each worker owns every MLNX_BENCH_BFD_THREADS'th session, a transition is a packet or a timeout event */
+    cycles = MAX(bench_opts.lookups / 10 / (2 * MLNX_BENCH_BFD_SESSIONS), 1);
+    __atomic_store_n(&bench_bfd_stop, false, __ATOMIC_RELAXED);
+
+    if (pthread_create(&reader, NULL, bench_bfd_reader, sessions)) {
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    bench_start(&bench, "bfd session transitions");
+    for (ii = 0; ii < MLNX_BENCH_BFD_THREADS; ii++) {
+        workers[ii].sessions = sessions;
+        workers[ii].first = ii;
+        workers[ii].step = MLNX_BENCH_BFD_THREADS;
+        workers[ii].count = MLNX_BENCH_BFD_SESSIONS / MLNX_BENCH_BFD_THREADS;
+        workers[ii].cycles = cycles;
+        workers[ii].status = SAI_STATUS_SUCCESS;
+        if (pthread_create(&workers[ii].thread, NULL, bench_bfd_worker, &workers[ii])) {
+            workers[ii].status = SAI_STATUS_FAILURE;
+            workers[ii].count = 0;
+        }
+    }
+    for (ii = 0; ii < MLNX_BENCH_BFD_THREADS; ii++) {
+        if (workers[ii].count) {
+            pthread_join(workers[ii].thread, NULL);
+        }
+        if (SAI_ERR(workers[ii].status)) {
+            status = workers[ii].status;
+        }
+    }
+    bench_end(&bench, (uint64_t)cycles * 2 * MLNX_BENCH_BFD_SESSIONS);
+
+    __atomic_store_n(&bench_bfd_stop, true, __ATOMIC_RELAXED);
+    pthread_join(reader, NULL);
+    printf("%-32s %10" PRIu64 "\n", "bfd session get (concurrent)", __atomic_load_n(&bench_bfd_gets, __ATOMIC_RELAXED));
+
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    /* Every transition is notified once and the session can be read from the callback */
+    expected = (uint64_t)cycles * MLNX_BENCH_BFD_SESSIONS;
+    ASSERT_TRUE((bench_bfd_up_notifs == expected) && (bench_bfd_down_notifs == expected) && !bench_bfd_bad_notifs,
+                "notifications UP %" PRIu64 " DOWN %" PRIu64 " bad %" PRIu64 ", expected %" PRIu64,
+                bench_bfd_up_notifs, bench_bfd_down_notifs, bench_bfd_bad_notifs, expected);
+    ASSERT_TRUE(!bench_bfd_bad_gets, "%" PRIu64 " of %" PRIu64 " concurrent gets failed or were inconsistent",
+                bench_bfd_bad_gets, bench_bfd_gets);
+
+out:
+    for (ii = 0; ii < count; ii++) {
+        bench_bfd_api->remove_bfd_session(sessions[ii]);
+    }
+    attr.value.ptr = NULL;
+    switch_api->set_switch_attribute(bench_switch_id, &attr);
+    return status;
+}
+
+/* The getters return the values last set, from the cached span session params with no SDK call */
+static void bench_mirror_retarget_check(_In_ const sai_mirror_api_t *mirror_api,
+                                        _In_ sai_object_id_t         session,
+                                        _In_ const sai_attribute_t  *retarget)
+{
+    sai_attribute_t attrs[4];
+    uint64_t        sdk_calls;
+    sai_status_t    status;
+    uint32_t        ii;
+
+    for (ii = 0; ii < ARRAY_SIZE(attrs); ii++) {
+        memset(&attrs[ii], 0, sizeof(attrs[ii]));
+        attrs[ii].id = retarget[ii].id;
+    }
+
+    sdk_calls = sx_api_stub_calls_get();
+    status = mirror_api->get_mirror_session_attribute(session, ARRAY_SIZE(attrs), attrs);
+    ASSERT_TRUE(SAI_OK(status), "status %d", status);
+    ASSERT_TRUE(sx_api_stub_calls_get() == sdk_calls, "%" PRIu64 " SDK calls", sx_api_stub_calls_get() - sdk_calls);
+
+    ASSERT_TRUE((attrs[0].value.ipaddr.addr_family == SAI_IP_ADDR_FAMILY_IPV4) &&
+                (attrs[0].value.ipaddr.addr.ip4 == retarget[0].value.ipaddr.addr.ip4), "DST IP 0x%x",
+                ntohl(attrs[0].value.ipaddr.addr.ip4));
+    ASSERT_TRUE(!memcmp(attrs[1].value.mac, retarget[1].value.mac, sizeof(sai_mac_t)), "DST MAC");
+    ASSERT_TRUE(attrs[2].value.u16 == retarget[2].value.u16, "VLAN %u", attrs[2].value.u16);
+    ASSERT_TRUE(attrs[3].value.u8 == retarget[3].value.u8, "TTL %u", attrs[3].value.u8);
+}
+
+static sai_status_t bench_mirror(void)
+{
+    sai_mirror_api_t   *mirror_api;
+    sai_object_id_t     session = SAI_NULL_OBJECT_ID;
+    mlnx_port_config_t *port, *monitor_port = NULL;
+    sai_attribute_t     attrs[12], retarget[4];
+    mlnx_bench_t        bench;
+    sai_status_t        status;
+    uint32_t            rounds, ii, jj;
+    uint64_t            edits, sdk_calls;
+
+    status = sai_api_query(SAI_API_MIRROR, (void**)&mirror_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    mlnx_port_phy_foreach(port, ii) {
+        monitor_port = port;
+        break;
+    }
+    if (!monitor_port) {
+        fprintf(stderr, "No ports\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    memset(attrs, 0, sizeof(attrs));
+    attrs[0].id = SAI_MIRROR_SESSION_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_MIRROR_SESSION_TYPE_ENHANCED_REMOTE;
+    attrs[1].id = SAI_MIRROR_SESSION_ATTR_MONITOR_PORT;
+    attrs[1].value.oid = monitor_port->saiport;
+    attrs[2].id = SAI_MIRROR_SESSION_ATTR_ERSPAN_ENCAPSULATION_TYPE;
+    attrs[2].value.s32 = SAI_ERSPAN_ENCAPSULATION_TYPE_MIRROR_L3_GRE_TUNNEL;
+    attrs[3].id = SAI_MIRROR_SESSION_ATTR_IPHDR_VERSION;
+    attrs[3].value.u8 = 4;
+    attrs[4].id = SAI_MIRROR_SESSION_ATTR_TOS;
+    attrs[5].id = SAI_MIRROR_SESSION_ATTR_SRC_IP_ADDRESS;
+    attrs[5].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    attrs[5].value.ipaddr.addr.ip4 = htonl(MLNX_BENCH_ROUTE_BASE + 1);
+    attrs[6].id = SAI_MIRROR_SESSION_ATTR_DST_IP_ADDRESS;
+    attrs[6].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    attrs[6].value.ipaddr.addr.ip4 = htonl(MLNX_BENCH_ROUTE_BASE + 2);
+    attrs[7].id = SAI_MIRROR_SESSION_ATTR_SRC_MAC_ADDRESS;
+    attrs[7].value.mac[5] = 1;
+    attrs[8].id = SAI_MIRROR_SESSION_ATTR_DST_MAC_ADDRESS;
+    attrs[8].value.mac[5] = 2;
+    attrs[9].id = SAI_MIRROR_SESSION_ATTR_GRE_PROTOCOL_TYPE;
+    attrs[9].value.u16 = MLNX_GRE_PROTOCOL_TYPE;
+    attrs[10].id = SAI_MIRROR_SESSION_ATTR_VLAN_HEADER_VALID;
+    attrs[10].value.booldata = true;
+    attrs[11].id = SAI_MIRROR_SESSION_ATTR_VLAN_ID;
+    attrs[11].value.u16 = DEFAULT_VLAN;
+
+    status = mirror_api->create_mirror_session(&session, bench_switch_id, ARRAY_SIZE(attrs), attrs);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to create mirror session - %d\n", status);
+        return status;
+    }
+
+    /* Re-target to a new collector - DST IP, DST MAC, VLAN and TTL */
+    memset(retarget, 0, sizeof(retarget));
+    retarget[0].id = SAI_MIRROR_SESSION_ATTR_DST_IP_ADDRESS;
+    retarget[0].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    retarget[1].id = SAI_MIRROR_SESSION_ATTR_DST_MAC_ADDRESS;
+    retarget[2].id = SAI_MIRROR_SESSION_ATTR_VLAN_ID;
+    retarget[3].id = SAI_MIRROR_SESSION_ATTR_TTL;
+
+    rounds = MAX(bench_opts.lookups / 100, 1);
+
+    edits = sx_api_stub_call_count_get(SX_API_STUB_CALL_sx_api_span_session_set);
+    sdk_calls = sx_api_stub_calls_get();
+
+    bench_start(&bench, "mirror retarget (attr sets)");
+    for (ii = 0; ii < rounds && SAI_OK(status); ii++) {
+        retarget[0].value.ipaddr.addr.ip4 = htonl(MLNX_BENCH_ROUTE_BASE + 0x100 + (ii & 0xff));
+        retarget[1].value.mac[5] = (uint8_t)ii;
+        retarget[2].value.u16 = (uint16_t)(DEFAULT_VLAN + 1 + (ii & 0xff));
+        retarget[3].value.u8 = (uint8_t)(64 + (ii & 0x3f));
+        for (jj = 0; jj < ARRAY_SIZE(retarget); jj++) {
+            status = mirror_api->set_mirror_session_attribute(session, &retarget[jj]);
+            if (SAI_ERR(status)) {
+                fprintf(stderr, "Failed to set mirror session attribute %d - %d\n", retarget[jj].id, status);
+                break;
+            }
+        }
+    }
+    bench_end(&bench, ii);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    /* At most one EDIT per set, the span session is not read back from SDK */
+    edits = sx_api_stub_call_count_get(SX_API_STUB_CALL_sx_api_span_session_set) - edits;
+    ASSERT_TRUE(edits && (edits <= (uint64_t)rounds * ARRAY_SIZE(retarget)), "%" PRIu64 " EDITs for %u sets", edits,
+                rounds * (uint32_t)ARRAY_SIZE(retarget));
+    ASSERT_TRUE(sx_api_stub_calls_get() - sdk_calls == edits, "%" PRIu64 " SDK calls, %" PRIu64 " EDITs",
+                sx_api_stub_calls_get() - sdk_calls, edits);
+    bench_mirror_retarget_check(mirror_api, session, retarget);
+
+    /* The same values again - the EDIT is skipped */
+    sdk_calls = sx_api_stub_calls_get();
+    bench_start(&bench, "mirror retarget (unchanged)");
+    for (ii = 0; ii < rounds && SAI_OK(status); ii++) {
+        for (jj = 0; jj < ARRAY_SIZE(retarget); jj++) {
+            status = mirror_api->set_mirror_session_attribute(session, &retarget[jj]);
+            if (SAI_ERR(status)) {
+                fprintf(stderr, "Failed to set mirror session attribute %d - %d\n", retarget[jj].id, status);
+                break;
+            }
+        }
+    }
+    bench_end(&bench, ii);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    ASSERT_TRUE(sx_api_stub_calls_get() == sdk_calls, "%" PRIu64 " SDK calls", sx_api_stub_calls_get() - sdk_calls);
+    bench_mirror_retarget_check(mirror_api, session, retarget);
+
+out:
+    /* The stub SDK does not return the analyzer port so remove fails to unbind it, not checked */
+    mirror_api->remove_mirror_session(session);
+    return status;
+}
+
+static sai_status_t bench_scheduler_queues_apply(_In_ const sai_queue_api_t *queue_api,
+                                                 _In_ sai_object_id_t        scheduler_id,
+                                                 _Out_ uint32_t             *queues)
+{
+    mlnx_port_config_t      *port;
+    mlnx_qos_queue_config_t *queue;
+    sai_attribute_t          attr;
+    sai_object_id_t          queue_id;
+    sai_status_t             status;
+    uint32_t                 ii, qi;
+
+    *queues = 0;
+    attr.id = SAI_QUEUE_ATTR_SCHEDULER_PROFILE_ID;
+    attr.value.oid = scheduler_id;
+
+    mlnx_port_phy_foreach(port, ii) {
+        port_queues_foreach(port, queue, qi) {
+            status = mlnx_create_queue_object(port->logical, (uint8_t)qi, &queue_id);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+
+            status = queue_api->set_queue_attribute(queue_id, &attr);
+            if (SAI_ERR(status)) {
+                fprintf(stderr, "Failed to set scheduler on queue %u of port 0x%x - %d\n",
+                        qi, port->logical, status);
+                return status;
+            }
+
+            (*queues)++;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t bench_scheduler(void)
+{
+    sai_scheduler_api_t *scheduler_api;
+    sai_queue_api_t     *queue_api;
+    sai_object_id_t      scheduler_id;
+    sai_attribute_t      attrs[2], weight;
+    mlnx_port_config_t  *port;
+    mlnx_bench_t         bench;
+    sai_status_t         status;
+    uint32_t             queues, ports = 0, rounds, ii;
+    uint64_t             ets_sets;
+
+    status = sai_api_query(SAI_API_SCHEDULER, (void**)&scheduler_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = sai_api_query(SAI_API_QUEUE, (void**)&queue_api);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    attrs[0].id = SAI_SCHEDULER_ATTR_SCHEDULING_TYPE;
+    attrs[0].value.s32 = SAI_SCHEDULING_TYPE_DWRR;
+    attrs[1].id = SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT;
+    attrs[1].value.u8 = 1;
+
+    status = scheduler_api->create_scheduler(&scheduler_id, bench_switch_id, ARRAY_SIZE(attrs), attrs);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to create scheduler profile - %d\n", status);
+        return status;
+    }
+
+    status = bench_scheduler_queues_apply(queue_api, scheduler_id, &queues);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    printf("Scheduler profile is used by %u queues\n", queues);
+
+    mlnx_port_phy_foreach(port, ii) {
+        if (mlnx_port_is_profile_bind_target(port)) {
+            ports++;
+        }
+    }
+
+    /* Reshape of the profile shared by all the queues */
+    weight.id = SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT;
+    rounds = MAX(bench_opts.lookups / 1000, 1);
+
+    ets_sets = sx_api_stub_call_count_get(SX_API_STUB_CALL_sx_api_cos_port_ets_element_set);
+
+    bench_start(&bench, "scheduler profile set");
+    for (ii = 0; ii < rounds; ii++) {
+        weight.value.u8 = (uint8_t)(1 + ii % 100);
+        status = scheduler_api->set_scheduler_attribute(scheduler_id, &weight);
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Failed to set scheduler weight - %d\n", status);
+            break;
+        }
+    }
+    bench_end(&bench, ii);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    /*
+     * All the elements of a port are applied with one SDK call. The ETS list reads are not checked, the stub
+     * SDK returns an empty list so the shadow is never complete.
+     */
+    ets_sets = sx_api_stub_call_count_get(SX_API_STUB_CALL_sx_api_cos_port_ets_element_set) - ets_sets;
+    ASSERT_TRUE(ets_sets == (uint64_t)rounds * ports, "%" PRIu64 " ETS sets for %u ports, %u rounds", ets_sets,
+                ports, rounds);
+
+    attrs[1].value.u8 = 0;
+    status = scheduler_api->get_scheduler_attribute(scheduler_id, 1, &attrs[1]);
+    ASSERT_TRUE(SAI_OK(status) && (attrs[1].value.u8 == weight.value.u8), "status %d weight %u, expected %u",
+                status, attrs[1].value.u8, weight.value.u8);
+
+out:
+    bench_scheduler_queues_apply(queue_api, SAI_NULL_OBJECT_ID, &queues);
+    scheduler_api->remove_scheduler(scheduler_id);
+    return status;
+}
+
+static const struct {
+    const char  *name;
+    sai_status_t (*run)(void);
+} bench_list[] = {
+    { "route", bench_routes },
+    { "shm_rm", bench_shm_rm },
+    { "bridge_port", bench_bridge_ports },
+    { "l2mc", bench_l2mc },
+    { "qos_map", bench_qos_maps },
+    { "fdb", bench_fdb_events },
+    { "bfd", bench_bfd },
+    { "mirror", bench_mirror },
+    { "scheduler", bench_scheduler },
+};
+
+static bool bench_chip_type_parse(_In_ const char *str, _Out_ sx_chip_types_t *chip_type)
+{
+    static const struct {
+        const char     *name;
+        sx_chip_types_t chip_type;
+    } chip_types[] = {
+        { "spc", SX_CHIP_TYPE_SPECTRUM },
+        { "spc2", SX_CHIP_TYPE_SPECTRUM2 },
+        { "spc3", SX_CHIP_TYPE_SPECTRUM3 },
+        { "spc4", SX_CHIP_TYPE_SPECTRUM4 },
+    };
+    uint32_t                  ii;
+
+    for (ii = 0; ii < ARRAY_SIZE(chip_types); ii++) {
+        if (!strcmp(str, chip_types[ii].name)) {
+            *chip_type = chip_types[ii].chip_type;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void bench_usage(_In_ const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s -c <sai xml config> [options]\n"
+            "  -t <spc|spc2|spc3|spc4>  chip type (spc2)\n"
+            "  -r <count>               routes (%u)\n"
+            "  -m <count>               L2MC group members (%u)\n"
+            "  -n <count>               lookups and FDB records (%u)\n"
+            "  -l <ns>                  simulated latency of an SDK call (0)\n"
+            "  -b <name>                run only the benchmarks with name containing <name>\n"
+            "  -s                       dump the SDK calls made\n",
+            prog, MLNX_BENCH_ROUTES_DEF, MLNX_L2MC_GROUP_MEMBER_DB_SIZE_DEF, MLNX_BENCH_LOOKUPS_DEF);
+}
+
+int main(int argc, char **argv)
+{
+    mlnx_object_id_t mlnx_switch_id = { 0 };
+    sai_status_t     status;
+    uint32_t         ii;
+    int              opt, rc = 0;
+
+    while ((opt = getopt(argc, argv, "c:t:r:m:n:l:b:sh")) != -1) {
+        switch (opt) {
+        case 'c':
+            bench_opts.config_file = optarg;
+            break;
+
+        case 't':
+            if (!bench_chip_type_parse(optarg, &bench_opts.chip_type)) {
+                bench_usage(argv[0]);
+                return 1;
+            }
+            break;
+
+        case 'r':
+            bench_opts.routes = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'm':
+            bench_opts.l2mc_members = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'n':
+            bench_opts.lookups = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'l':
+            bench_opts.latency_ns = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'b':
+            bench_opts.filter = optarg;
+            break;
+
+        case 's':
+            bench_opts.stub_dump = true;
+            break;
+
+        default:
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (!bench_opts.config_file) {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    if (sx_api_stub_init(bench_opts.latency_ns, bench_opts.routes)) {
+        fprintf(stderr, "Failed to init stub SDK\n");
+        return 1;
+    }
+
+    status = sai_api_initialize(0, &bench_services);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to initialize SAI API - %d\n", status);
+        return 1;
+    }
+
+    status = mlnx_bench_switch_init(bench_opts.config_file, bench_opts.chip_type);
+    if (SAI_ERR(status)) {
+        fprintf(stderr, "Failed to initialize switch from %s - %d\n", bench_opts.config_file, status);
+        return 1;
+    }
+
+    mlnx_switch_id.id.is_created = true;
+    mlnx_object_id_to_sai(SAI_OBJECT_TYPE_SWITCH, &mlnx_switch_id, &bench_switch_id);
+
+    printf("SDK call latency %u ns\n", bench_opts.latency_ns);
+    printf("%-32s %10s %14s %10s %10s %10s\n", "Benchmark", "Ops", "Ops/sec", "ns/op", "Allocs/op", "SDK/op");
+
+    for (ii = 0; ii < ARRAY_SIZE(bench_list); ii++) {
+        if (!bench_selected(bench_list[ii].name)) {
+            continue;
+        }
+
+        status = bench_list[ii].run();
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "Benchmark %s failed - %d\n", bench_list[ii].name, status);
+            rc = 1;
+        }
+    }
+
+    if (bench_opts.stub_dump) {
+        printf("\nSDK calls\n");
+        sx_api_stub_calls_dump(stdout);
+    }
+
+    sx_api_stub_deinit();
+
+    return rc;
+}
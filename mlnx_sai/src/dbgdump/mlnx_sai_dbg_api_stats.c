@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "mlnx_sai.h"
+#include <sx/utils/dbg_utils.h>
+#include "assert.h"
+#include "mlnx_sai_dbg.h"
+
+#define MAX_OBJ_TYPE_STR_LEN 50
+#define MAX_OP_STR_LEN       12
+
+static void SAI_dump_api_stats_print(_In_ FILE *file)
+{
+    mlnx_api_stats_entry_t    entry;
+    mlnx_api_stats_op_t       op;
+    sai_object_type_t         object_type;
+    char                      object_type_str[MAX_OBJ_TYPE_STR_LEN];
+    char                      op_str[MAX_OP_STR_LEN];
+    uint64_t                  avg_us, p50_us, p99_us, avg_lock_wait_us, avg_sdk_us;
+    dbg_utils_table_columns_t api_stats_clmns[] = {
+        {"Object type",    40, PARAM_STRING_E, object_type_str},
+        {"Op",             10, PARAM_STRING_E, op_str},
+        {"Calls",          12, PARAM_UINT64_E, &entry.calls},
+        {"Errors",         8,  PARAM_UINT64_E, &entry.errors},
+        {"Avg us",         10, PARAM_UINT64_E, &avg_us},
+        {"P50 us",         10, PARAM_UINT64_E, &p50_us},
+        {"P99 us",         10, PARAM_UINT64_E, &p99_us},
+        {"Max us",         10, PARAM_UINT64_E, &entry.max_us},
+        {"Avg lock us",    11, PARAM_UINT64_E, &avg_lock_wait_us},
+        {"Avg SDK us",     11, PARAM_UINT64_E, &avg_sdk_us},
+        {NULL,             0,  0,              NULL}
+    };
+
+    assert(file);
+
+    fprintf(file, "\nAPI stats enabled - %s\n", g_mlnx_api_stats_enabled ? "TRUE" : "FALSE");
+    fprintf(file, "Threads without API stats slot - %u\n", mlnx_api_stats_threads_dropped_get());
+    dbg_utils_print_general_header(file, "API calls");
+    dbg_utils_print_table_headline(file, api_stats_clmns);
+
+    for (object_type = SAI_OBJECT_TYPE_NULL + 1; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        for (op = 0; op < MLNX_API_STATS_OP_MAX; op++) {
+            mlnx_api_stats_entry_get(object_type, op, &entry);
+            if (!entry.calls) {
+                continue;
+            }
+
+            snprintf(object_type_str, sizeof(object_type_str), "%s", SAI_TYPE_STR(object_type));
+            snprintf(op_str, sizeof(op_str), "%s", mlnx_api_stats_op_str(op));
+            avg_us = entry.total_us / entry.calls;
+            p50_us = mlnx_api_stats_percentile_us(&entry, 50);
+            p99_us = mlnx_api_stats_percentile_us(&entry, 99);
+            avg_lock_wait_us = entry.lock_wait_us / entry.calls;
+            avg_sdk_us = entry.sdk_us / entry.calls;
+
+            dbg_utils_print_table_data_line(file, api_stats_clmns);
+        }
+    }
+}
+
+void SAI_dump_api_stats(_In_ FILE *file)
+{
+    dbg_utils_print_module_header(file, "SAI API STATS");
+
+    SAI_dump_api_stats_print(file);
+}
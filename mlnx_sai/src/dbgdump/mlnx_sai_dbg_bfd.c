@@ -34,6 +34,7 @@ static void SAI_dump_bfd_getdb(_Out_ mlnx_bfd_session_db_entry_t *bfd_session_db
     assert(count);
 
     sai_db_read_lock();
+    sai_bfd_db_read_lock();
 
     db_size = mlnx_shm_rm_array_size_get(MLNX_SHM_RM_ARRAY_TYPE_BFD_SESSION);
 
@@ -49,6 +50,7 @@ static void SAI_dump_bfd_getdb(_Out_ mlnx_bfd_session_db_entry_t *bfd_session_db
 
     *count = copied;
 
+    sai_bfd_db_unlock();
     sai_db_unlock();
 }
 
@@ -83,6 +85,9 @@ static void SAI_dump_bfd_print(_In_ FILE                              *file,
         {"TC",            3,  PARAM_UINT8_E,  &cur_bfd_data.traffic_class},
         {"TOS",           4,  PARAM_UINT8_E,  &cur_bfd_data.tos},
         {"TTL",           4,  PARAM_UINT8_E,  &cur_bfd_data.ttl},
+        {"State",         5,  PARAM_UINT32_E, &cur_bfd_data.bfd_session_state},
+        {"RX events",     10, PARAM_UINT32_E, &cur_bfd_data.rx_events},
+        {"State changes", 13, PARAM_UINT32_E, &cur_bfd_data.state_changes},
         {NULL,            0,               0, NULL}
     };
 
@@ -27,8 +27,8 @@ static void SAI_dump_bridge_port_getdb(_Out_ mlnx_bridge_port_t *mlnx_bridge_por
     sai_db_read_lock();
 
     memcpy(mlnx_bridge_port_db,
-           g_sai_db_ptr->bridge_ports_db,
-           MAX_BRIDGE_PORTS * sizeof(mlnx_bridge_port_t));
+           mlnx_bridge_ports_db,
+           MLNX_BRIDGE_PORTS_DB_SIZE * sizeof(mlnx_bridge_port_t));
 
     sai_db_unlock();
 }
@@ -106,7 +106,7 @@ static void SAI_dump_bridge_port_print(_In_ FILE *file, _In_ const mlnx_bridge_p
 
     dbg_utils_print_table_headline(file, bridge_port_clmns);
 
-    for (ii = 0; ii < MAX_BRIDGE_PORTS; ii++) {
+    for (ii = 0; ii < MLNX_BRIDGE_PORTS_DB_SIZE; ii++) {
         if (mlnx_bridge_port_db[ii].is_present) {
             memcpy(&cur_bridge_port, &mlnx_bridge_port_db[ii], sizeof(mlnx_bridge_port_t));
 
@@ -243,7 +243,7 @@ void SAI_dump_bridge(_In_ FILE *file)
     mlnx_bridge_port_t *mlnx_bridge_port_db = NULL;
     mlnx_bridge_rif_t  *mlnx_bridge_rifs_db = NULL;
 
-    mlnx_bridge_port_db = calloc(MAX_BRIDGE_PORTS, sizeof(mlnx_bridge_port_t));
+    mlnx_bridge_port_db = calloc(MLNX_BRIDGE_PORTS_DB_SIZE, sizeof(mlnx_bridge_port_t));
     if (!mlnx_bridge_port_db) {
         goto out;
     }
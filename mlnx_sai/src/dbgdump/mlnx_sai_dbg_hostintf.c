@@ -55,8 +55,8 @@ static void SAI_dump_hostintf_getdb(_Out_ sai_object_id_t  *default_trap_group,
            sizeof(trap_mirror_db_t));
 
     memcpy(hostif_db,
-           g_sai_db_ptr->hostif_db,
-           sizeof(g_sai_db_ptr->hostif_db));
+           mlnx_hostif_db,
+           MLNX_HOSTIF_DB_SIZE * sizeof(sai_netdev_t));
 
     sai_db_unlock();
 }
@@ -221,7 +221,7 @@ static void SAI_dump_hostif_db_print(_In_ FILE *file, _In_ sai_netdev_t *hostif_
 
     dbg_utils_print_table_headline(file, hostif_db_clmns);
 
-    for (ii = 0; ii < MAX_HOSTIFS; ii++) {
+    for (ii = 0; ii < MLNX_HOSTIF_DB_SIZE; ii++) {
         if (hostif_db[ii].is_used) {
             memcpy(&curr_host_if, &hostif_db[ii], sizeof(sai_netdev_t));
 
@@ -291,7 +291,7 @@ void SAI_dump_hostintf(_In_ FILE *file)
     trap_mirror_db_t trap_mirror_discard_router_db;
 
     memset(trap_group_valid, 0, MAX_TRAP_GROUPS * sizeof(bool));
-    hostif_db = (sai_netdev_t*)calloc(MAX_HOSTIFS, sizeof(sai_netdev_t));
+    hostif_db = (sai_netdev_t*)calloc(MLNX_HOSTIF_DB_SIZE, sizeof(sai_netdev_t));
     traps_db = (mlnx_trap_t*)calloc(SXD_TRAP_ID_ACL_MAX, sizeof(mlnx_trap_t));
     memset(&trap_mirror_discard_wred_db, 0, sizeof(trap_mirror_db_t));
     memset(&trap_mirror_discard_router_db, 0, sizeof(trap_mirror_db_t));
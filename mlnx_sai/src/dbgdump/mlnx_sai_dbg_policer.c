@@ -193,6 +193,31 @@ static void SAI_dump_policer_print(_In_ FILE                           *file,
     }
 }
 
+static void SAI_dump_policer_sx_hash_print(_In_ FILE *file)
+{
+    uint32_t                  sx_policers, hashed, missing, stale;
+    dbg_utils_table_columns_t policer_sx_hash_clmns[] = {
+        {"sx policers", 11, PARAM_UINT32_E, &sx_policers},
+        {"hashed",      11, PARAM_UINT32_E, &hashed},
+        {"missing",     11, PARAM_UINT32_E, &missing},
+        {"stale",       11, PARAM_UINT32_E, &stale},
+        {NULL,          0,  0,              NULL}
+    };
+
+    sai_db_read_lock();
+    mlnx_policer_sx_hash_check(&sx_policers, &hashed, &missing, &stale);
+    sai_db_unlock();
+
+    dbg_utils_print_secondary_header(file, "sx policer id hash");
+
+    dbg_utils_print_table_headline(file, policer_sx_hash_clmns);
+    dbg_utils_print_table_data_line(file, policer_sx_hash_clmns);
+
+    if (missing || stale) {
+        fprintf(file, "sx policer id hash is inconsistent with policers_db\n");
+    }
+}
+
 void SAI_dump_policer(_In_ FILE *file)
 {
     uint32_t                        policer_total_cnt = mlnx_shm_rm_array_size_get(MLNX_SHM_RM_ARRAY_TYPE_POLICER);
@@ -209,6 +234,7 @@ void SAI_dump_policer(_In_ FILE *file)
         dbg_utils_print_module_header(file, "SAI Policer");
 
         SAI_dump_policer_print(file, policers_db, policer_cnt);
+        SAI_dump_policer_sx_hash_print(file);
     }
 
     free(policers_db);
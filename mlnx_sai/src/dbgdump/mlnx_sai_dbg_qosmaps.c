@@ -19,12 +19,14 @@
 #include <sx/utils/dbg_utils.h>
 #include "assert.h"
 
-static void SAI_dump_qosmaps_getdb(_Out_ mlnx_qos_map_t *qos_maps_db,
-                                   _Out_ uint32_t       *switch_qos_maps,
-                                   _Out_ uint8_t        *switch_default_tc,
-                                   _Out_ bool           *is_switch_priority_lossless)
+static void SAI_dump_qosmaps_getdb(_Out_ mlnx_qos_map_t      *qos_maps_db,
+                                   _Out_ mlnx_qos_map_refs_t *qos_map_refs,
+                                   _Out_ uint32_t            *switch_qos_maps,
+                                   _Out_ uint8_t             *switch_default_tc,
+                                   _Out_ bool                *is_switch_priority_lossless)
 {
     assert(NULL != qos_maps_db);
+    assert(NULL != qos_map_refs);
     assert(NULL != switch_qos_maps);
     assert(NULL != switch_default_tc);
     assert(NULL != g_sai_db_ptr);
@@ -36,6 +38,10 @@ static void SAI_dump_qosmaps_getdb(_Out_ mlnx_qos_map_t *qos_maps_db,
            g_sai_db_ptr->qos_maps_db,
            MAX_QOS_MAPS * sizeof(mlnx_qos_map_t));
 
+    memcpy(qos_map_refs,
+           g_sai_db_ptr->qos_map_refs,
+           MAX_QOS_MAPS * sizeof(mlnx_qos_map_refs_t));
+
     memcpy(switch_qos_maps,
            g_sai_db_ptr->switch_qos_maps,
            MLNX_QOS_MAP_TYPES_MAX * sizeof(uint32_t));
@@ -356,6 +362,54 @@ static void SAI_dump_qos_maps_db_print(_In_ FILE *file, _In_ mlnx_qos_map_t *qos
     }
 }
 
+static void SAI_dump_qos_map_refs_print(_In_ FILE                      *file,
+                                        _In_ const mlnx_qos_map_t      *qos_maps_db,
+                                        _In_ const mlnx_qos_map_refs_t *qos_map_refs)
+{
+    uint32_t                  ii = 0;
+    uint32_t                  jj = 0;
+    char                      identical_str[LINE_LENGTH];
+    mlnx_qos_map_refs_t       curr_qos_map_refs;
+    dbg_utils_table_columns_t qos_map_refs_clmns[] = {
+        {"db idx",        11, PARAM_UINT32_E, &ii},
+        {"ports",         7,  PARAM_UINT32_E, &curr_qos_map_refs.ports_count},
+        {"updates",       10, PARAM_UINT32_E, &curr_qos_map_refs.updates},
+        {"last ports",    10, PARAM_UINT32_E, &curr_qos_map_refs.last_update_ports},
+        {"total ports",   12, PARAM_UINT64_E, &curr_qos_map_refs.update_ports_total},
+        {"hash",          10, PARAM_HEX_E,    &curr_qos_map_refs.hash},
+        {"identical to",  12, PARAM_STRING_E, &identical_str},
+        {NULL,            0,  0,              NULL}
+    };
+
+    assert(NULL != qos_maps_db);
+    assert(NULL != qos_map_refs);
+
+    dbg_utils_print_secondary_header(file, "qos_map_refs");
+
+    dbg_utils_print_table_headline(file, qos_map_refs_clmns);
+
+    for (ii = 0; ii < MAX_QOS_MAPS; ii++) {
+        if (qos_maps_db[ii].is_used) {
+            memcpy(&curr_qos_map_refs, &qos_map_refs[ii], sizeof(mlnx_qos_map_refs_t));
+
+            /* First other map with the same content */
+            strcpy(identical_str, "-");
+            for (jj = 0; jj < MAX_QOS_MAPS; jj++) {
+                if ((jj != ii) && qos_maps_db[jj].is_used && (qos_map_refs[jj].hash == curr_qos_map_refs.hash) &&
+                    (qos_maps_db[jj].type == qos_maps_db[ii].type) &&
+                    (qos_maps_db[jj].count == qos_maps_db[ii].count) &&
+                    !memcmp(&qos_maps_db[jj].from, &qos_maps_db[ii].from, sizeof(qos_maps_db[ii].from)) &&
+                    !memcmp(&qos_maps_db[jj].to, &qos_maps_db[ii].to, sizeof(qos_maps_db[ii].to))) {
+                    snprintf(identical_str, sizeof(identical_str), "%u", jj);
+                    break;
+                }
+            }
+
+            dbg_utils_print_table_data_line(file, qos_map_refs_clmns);
+        }
+    }
+}
+
 static void SAI_dump_switch_qos_maps_print(_In_ FILE *file, _In_ uint32_t *switch_qos_maps)
 {
     uint32_t                  ii = 0;
@@ -416,19 +470,24 @@ static void SAI_dump_is_switch_priority_lossless_print(_In_ FILE *file, _In_ boo
 
 void SAI_dump_qosmaps(_In_ FILE *file)
 {
-    mlnx_qos_map_t *qos_maps_db = NULL;
-    uint32_t       *switch_qos_maps = NULL;
-    uint8_t         switch_default_tc = 0;
-    bool           *is_switch_priority_lossless = NULL;
+    mlnx_qos_map_t      *qos_maps_db = NULL;
+    mlnx_qos_map_refs_t *qos_map_refs = NULL;
+    uint32_t            *switch_qos_maps = NULL;
+    uint8_t              switch_default_tc = 0;
+    bool                *is_switch_priority_lossless = NULL;
 
     qos_maps_db = (mlnx_qos_map_t*)calloc(MAX_QOS_MAPS, sizeof(mlnx_qos_map_t));
+    qos_map_refs = (mlnx_qos_map_refs_t*)calloc(MAX_QOS_MAPS, sizeof(mlnx_qos_map_refs_t));
     switch_qos_maps = (uint32_t*)calloc(MLNX_QOS_MAP_TYPES_MAX, sizeof(uint32_t));
     is_switch_priority_lossless = (bool*)calloc(MAX_LOSSLESS_SP, sizeof(bool));
 
-    if ((!qos_maps_db) || (!switch_qos_maps) || (!is_switch_priority_lossless)) {
+    if ((!qos_maps_db) || (!qos_map_refs) || (!switch_qos_maps) || (!is_switch_priority_lossless)) {
         if (qos_maps_db) {
             free(qos_maps_db);
         }
+        if (qos_map_refs) {
+            free(qos_map_refs);
+        }
         if (switch_qos_maps) {
             free(switch_qos_maps);
         }
@@ -440,6 +499,7 @@ void SAI_dump_qosmaps(_In_ FILE *file)
     }
 
     SAI_dump_qosmaps_getdb(qos_maps_db,
+                           qos_map_refs,
                            switch_qos_maps,
                            &switch_default_tc,
                            is_switch_priority_lossless);
@@ -447,11 +507,13 @@ void SAI_dump_qosmaps(_In_ FILE *file)
     dbg_utils_print_module_header(file, "SAI Qosmaps");
 
     SAI_dump_qos_maps_db_print(file, qos_maps_db);
+    SAI_dump_qos_map_refs_print(file, qos_maps_db, qos_map_refs);
     SAI_dump_switch_qos_maps_print(file, switch_qos_maps);
     SAI_dump_switch_default_tc_print(file, &switch_default_tc);
     SAI_dump_is_switch_priority_lossless_print(file, is_switch_priority_lossless);
 
     free(qos_maps_db);
+    free(qos_map_refs);
     free(switch_qos_maps);
     free(is_switch_priority_lossless);
 }
@@ -19,9 +19,15 @@
 #include <sx/utils/dbg_utils.h>
 #include "assert.h"
 
-static void SAI_dump_scheduler_getdb(_Out_ mlnx_sched_profile_t *sched_db)
+static void SAI_dump_scheduler_getdb(_Out_ mlnx_sched_profile_t *sched_db,
+                                     _Out_ uint32_t             *ports_count,
+                                     _Out_ uint32_t             *bindings_count)
 {
+    uint32_t ii;
+
     assert(NULL != sched_db);
+    assert(NULL != ports_count);
+    assert(NULL != bindings_count);
     assert(NULL != g_sai_qos_db_ptr);
 
     sai_db_read_lock();
@@ -30,12 +36,21 @@ static void SAI_dump_scheduler_getdb(_Out_ mlnx_sched_profile_t *sched_db)
            g_sai_qos_db_ptr->sched_db,
            MAX_SCHED * sizeof(mlnx_sched_profile_t));
 
+    for (ii = 0; ii < MAX_SCHED; ii++) {
+        if (sched_db[ii].is_used) {
+            mlnx_sched_refs_count_get(ii, &ports_count[ii], &bindings_count[ii]);
+        }
+    }
+
     sai_db_unlock();
 }
 
-static void SAI_dump_sched_db_print(_In_ FILE *file, _In_ mlnx_sched_profile_t *sched_db)
+static void SAI_dump_sched_db_print(_In_ FILE                       *file,
+                                    _In_ const mlnx_sched_profile_t *sched_db,
+                                    _In_ const uint32_t             *ports_count,
+                                    _In_ const uint32_t             *bindings_count)
 {
-    uint32_t                  ii = 0;
+    uint32_t                  ii = 0, ports = 0, bindings = 0;
     sai_object_id_t           obj_id = SAI_NULL_OBJECT_ID;
     mlnx_sched_profile_t      curr_sched_db;
     dbg_utils_table_columns_t sched_db_clmns[] = {
@@ -54,6 +69,8 @@ static void SAI_dump_sched_db_print(_In_ FILE *file, _In_ mlnx_sched_profile_t *
         {"dwrr weight",        14, PARAM_UINT8_E,  &curr_sched_db.ets.dwrr_weight},
         {"min rate",           13, PARAM_UINT32_E, &curr_sched_db.min_rate},
         {"max rate",           19, PARAM_UINT64_E, &curr_sched_db.max_rate},
+        {"ports",              7,  PARAM_UINT32_E, &ports},
+        {"bindings",           8,  PARAM_UINT32_E, &bindings},
         {NULL,                 0,  0,              NULL}
     };
 
@@ -63,11 +80,15 @@ static void SAI_dump_sched_db_print(_In_ FILE *file, _In_ mlnx_sched_profile_t *
 
     dbg_utils_print_secondary_header(file, "sched_db");
 
+    fprintf(file, "\"ports\" - ports and LAGs using the profile, \"bindings\" - port, group and queue bindings\n");
+
     dbg_utils_print_table_headline(file, sched_db_clmns);
 
     for (ii = 0; ii < MAX_SCHED; ii++) {
         if (sched_db[ii].is_used) {
             memcpy(&curr_sched_db, &sched_db[ii], sizeof(mlnx_sched_profile_t));
+            ports = ports_count[ii];
+            bindings = bindings_count[ii];
 
             if (SAI_STATUS_SUCCESS !=
                 mlnx_create_object(SAI_OBJECT_TYPE_SCHEDULER, ii, NULL, &obj_id)) {
@@ -82,18 +103,26 @@ static void SAI_dump_sched_db_print(_In_ FILE *file, _In_ mlnx_sched_profile_t *
 void SAI_dump_scheduler(_In_ FILE *file)
 {
     mlnx_sched_profile_t *sched_db = NULL;
+    uint32_t             *ports_count = NULL, *bindings_count = NULL;
 
     sched_db = (mlnx_sched_profile_t*)calloc(MAX_SCHED, sizeof(mlnx_sched_profile_t));
+    ports_count = (uint32_t*)calloc(MAX_SCHED, sizeof(uint32_t));
+    bindings_count = (uint32_t*)calloc(MAX_SCHED, sizeof(uint32_t));
 
-    if ((!sched_db)) {
+    if ((!sched_db) || (!ports_count) || (!bindings_count)) {
+        free(sched_db);
+        free(ports_count);
+        free(bindings_count);
         return;
     }
 
-    SAI_dump_scheduler_getdb(sched_db);
+    SAI_dump_scheduler_getdb(sched_db, ports_count, bindings_count);
 
     dbg_utils_print_module_header(file, "SAI Scheduler");
 
-    SAI_dump_sched_db_print(file, sched_db);
+    SAI_dump_sched_db_print(file, sched_db, ports_count, bindings_count);
 
     free(sched_db);
+    free(ports_count);
+    free(bindings_count);
 }
@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "mlnx_sai.h"
+#include <sx/utils/dbg_utils.h>
+#include "assert.h"
+#include "mlnx_sai_dbg.h"
+
+#define MAX_SHM_NAME_STR_LEN    32
+#define MAX_SHM_BACKING_STR_LEN 16
+#define BASE_PAGE_SIZE          (4096)
+#define THP_PMD_SIZE_DEF        (2 * 1024 * 1024)
+#define THP_PMD_SIZE_PATH       "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size"
+
+static uint64_t SAI_dump_shm_thp_pmd_size_get(void)
+{
+    unsigned long long pmd_size = 0;
+    FILE              *file;
+
+    file = fopen(THP_PMD_SIZE_PATH, "r");
+    if (!file) {
+        return THP_PMD_SIZE_DEF;
+    }
+
+    if ((fscanf(file, "%llu", &pmd_size) != 1) || !pmd_size) {
+        pmd_size = THP_PMD_SIZE_DEF;
+    }
+
+    fclose(file);
+
+    return pmd_size;
+}
+
+/* Bytes of the mapping at ptr which are mapped with transparent huge pages */
+static uint64_t SAI_dump_shm_pmd_mapped_get(_In_ const void *ptr)
+{
+    unsigned long long start, end, kb = 0;
+    char               line[256];
+    bool               found = false;
+    FILE              *file;
+
+    file = fopen("/proc/self/smaps", "r");
+    if (!file) {
+        return 0;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        /* Mapping header line - "start-end perms ..." */
+        if (sscanf(line, "%llx-%llx ", &start, &end) == 2) {
+            if (found) {
+                break;
+            }
+            found = (start == (unsigned long long)(uintptr_t)ptr);
+            continue;
+        }
+
+        if (found && ((sscanf(line, "ShmemPmdMapped: %llu kB", &kb) == 1) ||
+                      (sscanf(line, "FilePmdMapped: %llu kB", &kb) == 1))) {
+            break;
+        }
+    }
+
+    fclose(file);
+
+    return kb * 1024;
+}
+
+static void SAI_dump_shm_print(_In_ FILE *file)
+{
+    mlnx_shm_db_stats_t       stats;
+    uint64_t                  size_kb, page_kb, pages, huge_kb, base_pages, tlb_saved, pmd_size, huge_bytes;
+    char                      name_str[MAX_SHM_NAME_STR_LEN];
+    char                      backing_str[MAX_SHM_BACKING_STR_LEN];
+    char                      locked_str[MAX_SHM_BACKING_STR_LEN];
+    uint32_t                  ii;
+    dbg_utils_table_columns_t shm_clmns[] = {
+        {"DB",              16, PARAM_STRING_E, name_str},
+        {"Backing",         12, PARAM_STRING_E, backing_str},
+        {"Size KB",         10, PARAM_UINT64_E, &size_kb},
+        {"Page KB",         8,  PARAM_UINT64_E, &page_kb},
+        {"Huge KB",         10, PARAM_UINT64_E, &huge_kb},
+        {"Pages",           10, PARAM_UINT64_E, &pages},
+        {"4K pages",        10, PARAM_UINT64_E, &base_pages},
+        {"TLB saved",       10, PARAM_UINT64_E, &tlb_saved},
+        {"Locked",          8,  PARAM_STRING_E, locked_str},
+        {"Prefault faults", 15, PARAM_UINT64_E, &stats.prefault_faults},
+        {"Prefault us",     11, PARAM_UINT64_E, &stats.prefault_us},
+        {NULL,              0,  0,              NULL}
+    };
+
+    assert(file);
+
+    pmd_size = SAI_dump_shm_thp_pmd_size_get();
+
+    dbg_utils_print_general_header(file, "Shared memory DBs");
+    fprintf(file, "\"TLB saved\" - TLB entries needed to cover the DB with 4K pages and not needed with its pages\n");
+    fprintf(file, "\"Prefault faults\" - page faults taken on init instead of on the lookups\n");
+    dbg_utils_print_table_headline(file, shm_clmns);
+
+    for (ii = 0; ii < MLNX_SHM_DB_MAX; ii++) {
+        mlnx_shm_db_stats_get(ii, &stats);
+        if (!stats.name) {
+            continue;
+        }
+
+        if (stats.hugetlbfs) {
+            huge_bytes = stats.size;
+            pages = (stats.size + stats.page_size - 1) / stats.page_size;
+        } else {
+            huge_bytes = SAI_dump_shm_pmd_mapped_get(stats.ptr);
+            pages = huge_bytes / pmd_size + (stats.size - huge_bytes + BASE_PAGE_SIZE - 1) / BASE_PAGE_SIZE;
+        }
+
+        snprintf(name_str, sizeof(name_str), "%s", stats.name);
+        snprintf(backing_str, sizeof(backing_str), "%s",
+                 stats.hugetlbfs ? "hugetlbfs" : (stats.thp_advised ? "shm THP" : "shm"));
+        snprintf(locked_str, sizeof(locked_str), "%s", stats.locked ? "TRUE" : "FALSE");
+        size_kb = stats.size / 1024;
+        page_kb = stats.page_size / 1024;
+        huge_kb = huge_bytes / 1024;
+        base_pages = (stats.size + BASE_PAGE_SIZE - 1) / BASE_PAGE_SIZE;
+        tlb_saved = base_pages - MIN(pages, base_pages);
+
+        dbg_utils_print_table_data_line(file, shm_clmns);
+    }
+}
+
+void SAI_dump_shm(_In_ FILE *file)
+{
+    dbg_utils_print_module_header(file, "SAI SHARED MEMORY");
+
+    SAI_dump_shm_print(file);
+}
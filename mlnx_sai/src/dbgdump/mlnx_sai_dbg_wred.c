@@ -19,9 +19,10 @@
 #include <sx/utils/dbg_utils.h>
 #include "assert.h"
 
-static void SAI_dump_wred_getdb(_Out_ mlnx_wred_profile_t *wred_db)
+static void SAI_dump_wred_getdb(_Out_ mlnx_wred_profile_t *wred_db, _Out_ mlnx_wred_refs_t *wred_refs)
 {
     assert(NULL != wred_db);
+    assert(NULL != wred_refs);
     assert(NULL != g_sai_qos_db_ptr);
 
     sai_db_read_lock();
@@ -29,6 +30,9 @@ static void SAI_dump_wred_getdb(_Out_ mlnx_wred_profile_t *wred_db)
     memcpy(wred_db,
            g_sai_qos_db_ptr->wred_db,
            g_resource_limits.cos_redecn_profiles_max * sizeof(mlnx_wred_profile_t));
+    memcpy(wred_refs,
+           g_sai_qos_db_ptr->wred_refs,
+           g_resource_limits.cos_redecn_profiles_max * sizeof(mlnx_wred_refs_t));
 
     sai_db_unlock();
 }
@@ -71,21 +75,80 @@ static void SAI_dump_wred_db_print(_In_ FILE *file, _In_ mlnx_wred_profile_t *wr
     }
 }
 
+static void SAI_dump_wred_refs_print(_In_ FILE                      *file,
+                                     _In_ const mlnx_wred_profile_t *wred_db,
+                                     _In_ const mlnx_wred_refs_t    *wred_refs)
+{
+    uint32_t                  ii = 0, jj, ports;
+    sai_object_id_t           obj_id = SAI_NULL_OBJECT_ID;
+    mlnx_wred_refs_t          curr_refs;
+    dbg_utils_table_columns_t wred_refs_clmns[] = {
+        {"sai oid",          16, PARAM_UINT64_E, &obj_id},
+        {"db idx",           6,  PARAM_UINT32_E, &ii},
+        {"queues",           6,  PARAM_UINT32_E, &curr_refs.queues_count},
+        {"ports",            5,  PARAM_UINT32_E, &ports},
+        {"binds",            6,  PARAM_UINT32_E, &curr_refs.binds},
+        {"last ports",       10, PARAM_UINT32_E, &curr_refs.last_bind_ports},
+        {"last SDK calls",   14, PARAM_UINT32_E, &curr_refs.last_bind_sdk_calls},
+        {"last us",          10, PARAM_UINT64_E, &curr_refs.last_bind_us},
+        {"max us",           10, PARAM_UINT64_E, &curr_refs.max_bind_us},
+        {"SDK calls",        10, PARAM_UINT64_E, &curr_refs.sdk_calls_total},
+        {"SDK us",           10, PARAM_UINT64_E, &curr_refs.sdk_us_total},
+        {"max SDK call us",  15, PARAM_UINT64_E, &curr_refs.max_sdk_call_us},
+        {NULL,               0,  0,              NULL}
+    };
+
+    dbg_utils_print_secondary_header(file, "wred_refs");
+    fprintf(file, "\"ports\" - ports and LAGs with queues using the profile, re-bound on the attribute set\n");
+    fprintf(file, "\"last us\" - time of the last re-bind, \"SDK us\" - time in the SDK calls of all the re-binds\n");
+
+    dbg_utils_print_table_headline(file, wred_refs_clmns);
+
+    for (ii = 0; ii < g_resource_limits.cos_redecn_profiles_max; ii++) {
+        if (!wred_db[ii].in_use) {
+            continue;
+        }
+
+        memcpy(&curr_refs, &wred_refs[ii], sizeof(curr_refs));
+
+        ports = 0;
+        for (jj = 0; jj < MAX_PORTS * 2; jj++) {
+            if (array_bit_test(curr_refs.ports, jj)) {
+                ports++;
+            }
+        }
+
+        if (SAI_STATUS_SUCCESS !=
+            mlnx_create_object(SAI_OBJECT_TYPE_WRED, ii, NULL, &obj_id)) {
+            obj_id = SAI_NULL_OBJECT_ID;
+        }
+
+        dbg_utils_print_table_data_line(file, wred_refs_clmns);
+    }
+}
+
 void SAI_dump_wred(_In_ FILE *file)
 {
     mlnx_wred_profile_t *wred_db = NULL;
+    mlnx_wred_refs_t    *wred_refs = NULL;
 
     wred_db = (mlnx_wred_profile_t*)calloc(g_resource_limits.cos_redecn_profiles_max, sizeof(mlnx_wred_profile_t));
+    wred_refs = (mlnx_wred_refs_t*)calloc(g_resource_limits.cos_redecn_profiles_max, sizeof(mlnx_wred_refs_t));
 
-    if ((!wred_db)) {
+    if ((!wred_db) || (!wred_refs)) {
+        free(wred_db);
+        free(wred_refs);
         return;
     }
 
-    SAI_dump_wred_getdb(wred_db);
+    SAI_dump_wred_getdb(wred_db, wred_refs);
 
     dbg_utils_print_module_header(file, "SAI Wred");
 
     SAI_dump_wred_db_print(file, wred_db);
 
+    SAI_dump_wred_refs_print(file, wred_db, wred_refs);
+
     free(wred_db);
+    free(wred_refs);
 }
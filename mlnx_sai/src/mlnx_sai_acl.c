@@ -984,6 +984,8 @@ static void acl_psort_optimize_table(_In_ uint32_t table_index);
 static sai_status_t acl_db_find_entry_free_index(_Out_ uint32_t *free_index);
 static sai_status_t acl_db_find_table_free_index(_Out_ uint32_t *free_index);
 static sai_status_t acl_db_find_group_free_index(_Out_ uint32_t *free_index);
+static void acl_db_table_index_free(_In_ uint32_t table_index);
+static void acl_db_group_index_free(_In_ uint32_t group_index);
 static sai_status_t mlnx_acl_db_entry_delete(_In_ uint32_t entry_index);
 static sai_status_t mlnx_acl_db_entry_add_to_table(_In_ uint32_t table_index, _In_ uint32_t entry_index);
 static sai_status_t mlnx_acl_db_peer_entries_insert_to_table(_In_ uint32_t table_index,
@@ -5699,6 +5701,7 @@ static sai_status_t acl_db_find_table_free_index(_Out_ uint32_t *free_index)
             (0 == acl_db_table(ii).queued)) {
             *free_index = ii;
             acl_db_table(ii).is_used = true;
+            sai_acl_db->acl_settings_tbl->table_db_indexes_allocated++;
             status = SAI_STATUS_SUCCESS;
             break;
         }
@@ -5725,6 +5728,7 @@ static sai_status_t acl_db_find_group_free_index(_Out_ uint32_t *free_index)
         if (false == sai_acl_db_group_ptr(ii)->is_used) {
             *free_index = ii;
             sai_acl_db_group_ptr(ii)->is_used = true;
+            sai_acl_db->acl_settings_tbl->group_db_indexes_allocated++;
             status = SAI_STATUS_SUCCESS;
             break;
         }
@@ -5739,24 +5743,41 @@ static sai_status_t acl_db_find_group_free_index(_Out_ uint32_t *free_index)
     return status;
 }
 
+static void acl_db_table_index_free(_In_ uint32_t table_index)
+{
+    assert(table_index < ACL_TABLE_DB_SIZE);
+
+    if (acl_db_table(table_index).is_used) {
+        assert(sai_acl_db->acl_settings_tbl->table_db_indexes_allocated > 0);
+        sai_acl_db->acl_settings_tbl->table_db_indexes_allocated--;
+    }
+
+    acl_db_table(table_index).is_used = false;
+}
+
+static void acl_db_group_index_free(_In_ uint32_t group_index)
+{
+    assert(group_index < (ACL_GROUP_NUMBER / g_sai_db_ptr->acl_divider));
+
+    if (sai_acl_db_group_ptr(group_index)->is_used) {
+        assert(sai_acl_db->acl_settings_tbl->group_db_indexes_allocated > 0);
+        sai_acl_db->acl_settings_tbl->group_db_indexes_allocated--;
+    }
+
+    sai_acl_db_group_ptr(group_index)->is_used = false;
+}
+
 sai_status_t mlnx_acl_db_free_entries_get(_In_ sai_object_type_t resource_type, _Out_ uint32_t         *free_entries)
 {
-    uint32_t ii, count = 0;
+    uint32_t count;
 
     assert((resource_type == SAI_OBJECT_TYPE_ACL_TABLE_GROUP) || (resource_type == SAI_OBJECT_TYPE_ACL_TABLE));
 
     if (resource_type == SAI_OBJECT_TYPE_ACL_TABLE_GROUP) {
-        for (ii = 0; ii < (ACL_GROUP_NUMBER / g_sai_db_ptr->acl_divider); ii++) {
-            if (false == sai_acl_db_group_ptr(ii)->is_used) {
-                count++;
-            }
-        }
+        count = (ACL_GROUP_NUMBER / g_sai_db_ptr->acl_divider) -
+                sai_acl_db->acl_settings_tbl->group_db_indexes_allocated;
     } else { /* SAI_OBJECT_TYPE_ACL_TABLE */
-        for (ii = 0; ii < ACL_TABLE_DB_SIZE; ii++) {
-            if (false == acl_db_table(ii).is_used) {
-                count++;
-            }
-        }
+        count = ACL_TABLE_DB_SIZE - sai_acl_db->acl_settings_tbl->table_db_indexes_allocated;
     }
 
     *free_entries = count;
@@ -14171,7 +14192,7 @@ sai_status_t mlnx_create_acl_table(_Out_ sai_object_id_t     * acl_table_id,
     bool                         is_dynamic_sized;
     uint32_t                     acl_table_index = 0, ii;
     bool                         key_created = false, region_created = false;
-    bool                         acl_created = false, is_table_inited = false;
+    bool                         acl_created = false, is_table_inited = false, is_table_index_allocated = false;
     bool                         is_range_types_unique, is_ip_ident_used = false, is_aeth_syndrome_used = false;
 
     SX_LOG_ENTER();
@@ -14354,6 +14375,7 @@ sai_status_t mlnx_create_acl_table(_Out_ sai_object_id_t     * acl_table_id,
     if (SAI_STATUS_SUCCESS != status) {
         goto out;
     }
+    is_table_index_allocated = true;
 
     key_count = key_index;
     sx_status = sx_api_acl_flex_key_set(gh_sdk, SX_ACCESS_CMD_CREATE, keys, key_count, &key_handle);
@@ -14448,7 +14470,9 @@ sai_status_t mlnx_create_acl_table(_Out_ sai_object_id_t     * acl_table_id,
 
 out:
     if (status != SAI_STATUS_SUCCESS) {
-        acl_db_table(acl_table_index).is_used = false;
+        if (is_table_index_allocated) {
+            acl_db_table_index_free(acl_table_index);
+        }
 
         if (is_table_inited) {
             if (SAI_STATUS_SUCCESS != mlnx_acl_table_deinit(acl_table_index)) {
@@ -15226,7 +15250,7 @@ static sai_status_t mlnx_delete_acl_table(_In_ sai_object_id_t acl_table_id)
         goto out;
     }
 
-    acl_db_table(table_index).is_used = false;
+    acl_db_table_index_free(table_index);
 
 out:
     acl_global_unlock();
@@ -22225,7 +22249,7 @@ static sai_status_t mlnx_remove_acl_table_group(_In_ sai_object_id_t acl_table_g
         goto out;
     }
 
-    sai_acl_db_group_ptr(group_index)->is_used = false;
+    acl_db_group_index_free(group_index);
 
 out:
     acl_global_unlock();
@@ -22537,7 +22561,7 @@ sai_status_t mlnx_gp_reg_db_alloc_by_gp_reg_id(_Out_ mlnx_gp_reg_db_t **gp_reg_d
         goto out;
     }
 
-    (*gp_reg_data)->mlnx_array.is_used = true;
+    mlnx_shm_rm_array_hdr_used_set(MLNX_SHM_RM_ARRAY_TYPE_GP_REG, &(*gp_reg_data)->mlnx_array, true);
 
 out:
     return sai_status;
@@ -0,0 +1,358 @@
+/*
+ *  Copyright (c) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "sai_windows.h"
+#include "sai.h"
+#include "mlnx_sai.h"
+#include "assert.h"
+
+#undef  __MODULE__
+#define __MODULE__ SAI_API_STATS
+
+/*
+ * Per API call counters and latency histograms.
+ *
+ * Every thread which calls an instrumented API gets its own slot on the first call, the slot is
+ * only written by its owner so recording takes no lock and no atomic RMW. Readers sum the slots,
+ * the values they see may be a few calls behind.
+ * The time spent waiting for the SAI DB lock is accumulated per thread by the DB lock macros and
+ * attributed to the API calls that were in progress. The time spent in the SDK calls is accumulated
+ * the same way by the SDK call wrappers of the tracer (built with --enable-sdk-trace).
+ * Slots are never released so the statistics of threads which exited are kept.
+ * The calls in progress are also tracked per thread (when stats or the SDK tracer are enabled) so
+ * the SDK calls can be attributed to the API call which made them.
+ */
+
+#ifdef _WIN32
+#define MLNX_API_STATS_TLS __declspec(thread)
+#else
+#define MLNX_API_STATS_TLS __thread
+#endif
+
+#define MLNX_API_STATS_RECORD_SIZE (10)
+
+typedef struct _mlnx_api_stats_slot_t {
+    uint64_t               lock_wait_us;
+    uint64_t               sdk_us;
+    mlnx_api_stats_entry_t entries[SAI_OBJECT_TYPE_MAX][MLNX_API_STATS_OP_MAX];
+} mlnx_api_stats_slot_t;
+
+static sx_verbosity_level_t                           LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
+bool                                                  g_mlnx_api_stats_enabled = false;
+static mlnx_api_stats_slot_t                         *api_stats_slots[MLNX_API_STATS_THREADS_MAX];
+static uint32_t                                       api_stats_slots_count;
+static uint32_t                                       api_stats_threads_dropped;
+static MLNX_API_STATS_TLS mlnx_api_stats_slot_t      *api_stats_slot;
+static MLNX_API_STATS_TLS bool                        api_stats_slot_failed;
+static MLNX_API_STATS_TLS uint32_t                    api_call_seq;
+static MLNX_API_STATS_TLS const mlnx_api_stats_ctx_t *api_call_current;
+
+static const char * const mlnx_api_stats_op_strs[MLNX_API_STATS_OP_MAX] = {
+    [MLNX_API_STATS_OP_CREATE] = "create",
+    [MLNX_API_STATS_OP_REMOVE] = "remove",
+    [MLNX_API_STATS_OP_SET] = "set",
+    [MLNX_API_STATS_OP_GET] = "get",
+    [MLNX_API_STATS_OP_BULK_GET] = "bulk get",
+    [MLNX_API_STATS_OP_GET_STATS] = "get stats",
+};
+
+sai_status_t mlnx_api_stats_log_set(sx_verbosity_level_t level)
+{
+    LOG_VAR_NAME(__MODULE__) = level;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+const char* mlnx_api_stats_op_str(_In_ mlnx_api_stats_op_t op)
+{
+    return (op < MLNX_API_STATS_OP_MAX) ? mlnx_api_stats_op_strs[op] : "unknown";
+}
+
+static mlnx_api_stats_slot_t* mlnx_api_stats_slot_get(void)
+{
+    mlnx_api_stats_slot_t *slot;
+    uint32_t               idx;
+
+    if (api_stats_slot || api_stats_slot_failed) {
+        return api_stats_slot;
+    }
+
+    idx = __atomic_fetch_add(&api_stats_slots_count, 1, __ATOMIC_RELAXED);
+    if (idx >= MLNX_API_STATS_THREADS_MAX) {
+        __atomic_fetch_add(&api_stats_threads_dropped, 1, __ATOMIC_RELAXED);
+        api_stats_slot_failed = true;
+        return NULL;
+    }
+
+    slot = calloc(1, sizeof(*slot));
+    if (!slot) {
+        SX_LOG_ERR("Failed to allocate API stats slot\n");
+        api_stats_slot_failed = true;
+        return NULL;
+    }
+
+    __atomic_store_n(&api_stats_slots[idx], slot, __ATOMIC_RELEASE);
+    api_stats_slot = slot;
+
+    return slot;
+}
+
+/* Bucket N counts the calls which took [2^(N-1), 2^N) usec, the last bucket counts all the longer ones */
+static uint32_t mlnx_api_stats_bucket_get(_In_ uint64_t latency_us)
+{
+    uint32_t bucket = 0;
+
+    while (latency_us && (bucket < MLNX_API_STATS_BUCKETS - 1)) {
+        latency_us >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+void mlnx_api_stats_begin(_Out_ mlnx_api_stats_ctx_t *ctx,
+                          _In_ sai_object_type_t     object_type,
+                          _In_ mlnx_api_stats_op_t   op)
+{
+    mlnx_api_stats_slot_t *slot;
+
+    assert(ctx);
+    assert(op < MLNX_API_STATS_OP_MAX);
+
+    ctx->object_type = object_type;
+    ctx->op = op;
+    ctx->call_seq = 0;
+    ctx->start_us = 0;
+    ctx->prev = NULL;
+
+    if (!g_mlnx_api_stats_enabled && !g_mlnx_sdk_trace_enabled) {
+        return;
+    }
+
+    /* The SDK tracer attributes SDK calls to the innermost API call of the thread */
+    if (!++api_call_seq) {
+        ++api_call_seq;
+    }
+    ctx->call_seq = api_call_seq;
+    ctx->prev = api_call_current;
+    api_call_current = ctx;
+
+    if (!g_mlnx_api_stats_enabled) {
+        return;
+    }
+
+    slot = mlnx_api_stats_slot_get();
+    if (!slot) {
+        return;
+    }
+
+    ctx->lock_wait_us = slot->lock_wait_us;
+    ctx->sdk_us = slot->sdk_us;
+    ctx->start_us = time_us_get();
+}
+
+/* Returns status */
+sai_status_t mlnx_api_stats_end(_In_ const mlnx_api_stats_ctx_t *ctx, _In_ sai_status_t status)
+{
+    mlnx_api_stats_entry_t *entry;
+    uint64_t                latency_us;
+
+    assert(ctx);
+
+    if (!ctx->call_seq) {
+        return status;
+    }
+
+    api_call_current = ctx->prev;
+
+    /* Stats were disabled or no slot when the call started */
+    if (!ctx->start_us || !api_stats_slot) {
+        return status;
+    }
+
+    if ((ctx->object_type <= SAI_OBJECT_TYPE_NULL) || (ctx->object_type >= SAI_OBJECT_TYPE_MAX)) {
+        return status;
+    }
+
+    latency_us = time_us_get() - ctx->start_us;
+    entry = &api_stats_slot->entries[ctx->object_type][ctx->op];
+
+    entry->calls++;
+    if (SAI_ERR(status)) {
+        entry->errors++;
+    }
+    entry->total_us += latency_us;
+    entry->lock_wait_us += api_stats_slot->lock_wait_us - ctx->lock_wait_us;
+    entry->sdk_us += api_stats_slot->sdk_us - ctx->sdk_us;
+    if (latency_us > entry->max_us) {
+        entry->max_us = latency_us;
+    }
+    entry->buckets[mlnx_api_stats_bucket_get(latency_us)]++;
+
+    return status;
+}
+
+const mlnx_api_stats_ctx_t* mlnx_api_stats_current_get(void)
+{
+    return api_call_current;
+}
+
+void mlnx_api_stats_plock_acquire(_In_ cl_plock_t *p_lock, _In_ bool exclusive)
+{
+    uint64_t start_us;
+
+    if (!g_mlnx_api_stats_enabled || !api_stats_slot) {
+        if (exclusive) {
+            cl_plock_excl_acquire(p_lock);
+        } else {
+            cl_plock_acquire(p_lock);
+        }
+        return;
+    }
+
+    start_us = time_us_get();
+    if (exclusive) {
+        cl_plock_excl_acquire(p_lock);
+    } else {
+        cl_plock_acquire(p_lock);
+    }
+    api_stats_slot->lock_wait_us += time_us_get() - start_us;
+}
+
+/* Called by the SDK call wrappers with the time of an SDK call */
+void mlnx_api_stats_sdk_time_add(_In_ uint64_t sdk_us)
+{
+    if (!g_mlnx_api_stats_enabled || !api_stats_slot) {
+        return;
+    }
+
+    api_stats_slot->sdk_us += sdk_us;
+}
+
+void mlnx_api_stats_entry_get(_In_ sai_object_type_t       object_type,
+                              _In_ mlnx_api_stats_op_t     op,
+                              _Out_ mlnx_api_stats_entry_t *entry)
+{
+    const mlnx_api_stats_entry_t *slot_entry;
+    const mlnx_api_stats_slot_t  *slot;
+    uint32_t                      slots_count, ii, bucket;
+
+    assert(entry);
+    assert(object_type < SAI_OBJECT_TYPE_MAX);
+    assert(op < MLNX_API_STATS_OP_MAX);
+
+    memset(entry, 0, sizeof(*entry));
+
+    slots_count = __atomic_load_n(&api_stats_slots_count, __ATOMIC_RELAXED);
+    slots_count = MIN(slots_count, MLNX_API_STATS_THREADS_MAX);
+
+    for (ii = 0; ii < slots_count; ii++) {
+        slot = __atomic_load_n(&api_stats_slots[ii], __ATOMIC_ACQUIRE);
+        if (!slot) {
+            continue;
+        }
+
+        slot_entry = &slot->entries[object_type][op];
+        entry->calls += slot_entry->calls;
+        entry->errors += slot_entry->errors;
+        entry->total_us += slot_entry->total_us;
+        entry->lock_wait_us += slot_entry->lock_wait_us;
+        entry->sdk_us += slot_entry->sdk_us;
+        entry->max_us = MAX(entry->max_us, slot_entry->max_us);
+        for (bucket = 0; bucket < MLNX_API_STATS_BUCKETS; bucket++) {
+            entry->buckets[bucket] += slot_entry->buckets[bucket];
+        }
+    }
+}
+
+/* Upper bound of the bucket which holds the percentile, precise to a factor of 2 */
+uint64_t mlnx_api_stats_percentile_us(_In_ const mlnx_api_stats_entry_t *entry, _In_ uint32_t percent)
+{
+    uint64_t threshold, count = 0;
+    uint32_t bucket;
+
+    assert(entry);
+
+    if (!entry->calls) {
+        return 0;
+    }
+
+    threshold = (entry->calls * percent + 99) / 100;
+
+    for (bucket = 0; bucket < MLNX_API_STATS_BUCKETS - 1; bucket++) {
+        count += entry->buckets[bucket];
+        if (count >= threshold) {
+            return MIN((1ULL << bucket), entry->max_us);
+        }
+    }
+
+    return entry->max_us;
+}
+
+uint32_t mlnx_api_stats_threads_dropped_get(void)
+{
+    return __atomic_load_n(&api_stats_threads_dropped, __ATOMIC_RELAXED);
+}
+
+static uint32_t mlnx_api_stats_u32_saturate(_In_ uint64_t value)
+{
+    return (value > UINT32_MAX) ? UINT32_MAX : (uint32_t)value;
+}
+
+/* Fills SAI_SWITCH_ATTR_API_LATENCY_STATS - MLNX_API_STATS_RECORD_SIZE values per called object type and op */
+sai_status_t mlnx_api_stats_u32list_fill(_Inout_ sai_u32_list_t *list)
+{
+    mlnx_api_stats_entry_t entry;
+    mlnx_api_stats_op_t    op;
+    sai_object_type_t      object_type;
+    sai_status_t           status;
+    uint32_t              *values = NULL, count = 0;
+
+    assert(list);
+
+    values = calloc((size_t)SAI_OBJECT_TYPE_MAX * MLNX_API_STATS_OP_MAX * MLNX_API_STATS_RECORD_SIZE,
+                    sizeof(*values));
+    if (!values) {
+        SX_LOG_ERR("Failed to allocate memory for API stats\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (object_type = SAI_OBJECT_TYPE_NULL + 1; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        for (op = 0; op < MLNX_API_STATS_OP_MAX; op++) {
+            mlnx_api_stats_entry_get(object_type, op, &entry);
+            if (!entry.calls) {
+                continue;
+            }
+
+            values[count++] = object_type;
+            values[count++] = op;
+            values[count++] = mlnx_api_stats_u32_saturate(entry.calls);
+            values[count++] = mlnx_api_stats_u32_saturate(entry.errors);
+            values[count++] = mlnx_api_stats_u32_saturate(entry.total_us / entry.calls);
+            values[count++] = mlnx_api_stats_u32_saturate(mlnx_api_stats_percentile_us(&entry, 50));
+            values[count++] = mlnx_api_stats_u32_saturate(mlnx_api_stats_percentile_us(&entry, 99));
+            values[count++] = mlnx_api_stats_u32_saturate(entry.max_us);
+            values[count++] = mlnx_api_stats_u32_saturate(entry.lock_wait_us / entry.calls);
+            values[count++] = mlnx_api_stats_u32_saturate(entry.sdk_us / entry.calls);
+        }
+    }
+
+    status = mlnx_fill_u32list(values, count, list);
+
+    free(values);
+    return status;
+}
@@ -151,6 +151,12 @@ sai_status_t mlnx_bfd_session_oid_create(_In_ mlnx_shm_rm_array_idx_t idx, _Out_
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_bfd_session_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    return mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_BFD_SESSION, mlnx_bfd_session_oid_create);
+}
+
 static sai_status_t mlnx_fill_sdk_bfd_tx_params(_In_ const mlnx_bfd_session_db_data_t *bfd_db_data,
                                                 _Out_ mlnx_bfd_packet_t               *tx_bfd_packet,
                                                 _Out_ sx_bfd_session_params_t         *tx_params)
@@ -315,13 +321,35 @@ static sai_status_t mlnx_bfd_session_destroy(_In_ mlnx_bfd_session_db_entry_t *b
     return sdk_to_sai(sx_status_rx);
 }
 
+/* DB write lock is needed */
+static sai_status_t mlnx_bfd_module_init(void)
+{
+    sx_status_t          sx_status;
+    sx_bfd_init_params_t bfd_init_params;
+
+    if (g_sai_db_ptr->is_bfd_module_initialized) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    memset(&bfd_init_params, 0, sizeof(bfd_init_params));
+    sx_status = sx_api_bfd_init_set(gh_sdk, &bfd_init_params);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Cannot init BFD module: %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    g_sai_db_ptr->is_bfd_module_initialized = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* BFD module is initialized by the session create, the events only edit the sessions under the BFD lock */
 sai_status_t mlnx_set_offload_bfd_rx_session(_Inout_ mlnx_bfd_session_db_data_t *bfd_db_data,
                                              _In_ mlnx_shm_rm_array_idx_t        bfd_session_db_index,
                                              _In_ sx_access_cmd_t                cmd)
 {
     sai_status_t            status;
     sx_status_t             sx_status;
-    sx_bfd_init_params_t    bfd_init_params;
     mlnx_bfd_packet_t       rx_bfd_packet = {0};
     sx_bfd_session_params_t rx_params = {0};
 
@@ -337,17 +365,6 @@ sai_status_t mlnx_set_offload_bfd_rx_session(_Inout_ mlnx_bfd_session_db_data_t
         return status;
     }
 
-    if (!g_sai_db_ptr->is_bfd_module_initialized) {
-        memset(&bfd_init_params, 0, sizeof(bfd_init_params));
-        sx_status = sx_api_bfd_init_set(gh_sdk, &bfd_init_params);
-        if (SX_ERR(sx_status)) {
-            SX_LOG_ERR("Cannot init BFD module: %s.\n", SX_STATUS_MSG(sx_status));
-            status = sdk_to_sai(sx_status);
-            return status;
-        }
-        g_sai_db_ptr->is_bfd_module_initialized = true;
-    }
-
     sx_status = sx_api_bfd_offload_set(gh_sdk, cmd, &rx_params, &bfd_db_data->rx_session);
     if (SX_ERR(sx_status)) {
         SX_LOG_ERR("Error create RX BFD session: %s.\n", SX_STATUS_MSG(sx_status));
@@ -469,12 +486,15 @@ sai_status_t mlnx_bfd_session_stats_get(_In_ sai_object_id_t      bfd_session_id
                                           &bfd_session_db_entry,
                                           NULL);
     if (SAI_ERR(status)) {
+        sai_db_unlock();
         SX_LOG_ERR("Cannot get BFD DB data by OID - %" PRId64 ".\n", bfd_session_id);
         SX_LOG_EXIT();
         return status;
     }
 
+    sai_bfd_db_read_lock();
     bfd_db_data = bfd_session_db_entry->data;
+    sai_bfd_db_unlock();
 
     sai_db_unlock();
 
@@ -758,7 +778,9 @@ static sai_status_t mlnx_bfd_session_attr_get(_In_ const sai_object_key_t   *key
     }
 
     default_vr_id = g_sai_db_ptr->default_vrid;
+    sai_bfd_db_read_lock();
     bfd_db_data = bfd_session_db_entry->data;
+    sai_bfd_db_unlock();
 
     bfd_session_state = bfd_db_data.bfd_session_state;
     sai_db_unlock();
@@ -903,6 +925,8 @@ static sai_status_t mlnx_bfd_session_attr_set(_In_ const sai_object_key_t      *
         return status;
     }
 
+    /* The BFD events update the session state, hold them off until the entry is written back */
+    sai_bfd_db_write_lock();
     bfd_db_data = bfd_session_db_entry->data;
 
     switch (arg_type) {
@@ -1026,6 +1050,7 @@ static sai_status_t mlnx_bfd_session_attr_set(_In_ const sai_object_key_t      *
     bfd_session_db_entry->data = bfd_db_data;
 
 out:
+    sai_bfd_db_unlock();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -1134,10 +1159,12 @@ static sai_status_t mlnx_create_bfd_session(_Out_ sai_object_id_t      *bfd_sess
     bfd_db_data.remote_multiplier = bfd_db_data.multiplier = read_attr->u8;
 
     sai_db_write_lock();
+    sai_bfd_db_write_lock();
 
     status = mlnx_bfd_session_db_entry_alloc(&bfd_session_db_entry, &bfd_session_db_index);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Cannot allocate BFD session entry in DB.\n");
+        sai_bfd_db_unlock();
         sai_db_unlock();
         SX_LOG_EXIT();
         return status;
@@ -1145,6 +1172,11 @@ static sai_status_t mlnx_create_bfd_session(_Out_ sai_object_id_t      *bfd_sess
 
     SX_LOG_DBG("BFD session entry allocated in DB %p.\n", bfd_session_db_entry);
 
+    status = mlnx_bfd_module_init();
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
     status = mlnx_set_offload_bfd_rx_session(&bfd_db_data, bfd_session_db_index, SX_ACCESS_CMD_CREATE);
     if (SAI_ERR(status)) {
         goto out;
@@ -1173,6 +1205,7 @@ out:
         mlnx_bfd_session_db_entry_free(bfd_session_db_index);
     }
 
+    sai_bfd_db_unlock();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -1200,6 +1233,7 @@ static sai_status_t mlnx_remove_bfd_session(_In_ sai_object_id_t bfd_session_id)
     MLNX_LOG_OID_REMOVE(bfd_session_id);
 
     sai_db_write_lock();
+    sai_bfd_db_write_lock();
 
     status = mlnx_bfd_session_oid_to_data(bfd_session_id, &bfd_session_db_entry, &idx);
     if (SAI_ERR(status)) {
@@ -1218,6 +1252,7 @@ static sai_status_t mlnx_remove_bfd_session(_In_ sai_object_id_t bfd_session_id)
     }
 
 out:
+    sai_bfd_db_unlock();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -364,6 +364,122 @@ static sai_object_id_t mlnx_bridge_dummy_1d_oid(void)
     return g_sai_db_ptr->dummy_1d_bridge_oid;
 }
 
+static bool mlnx_bridge_port_index_key_get(_In_ const mlnx_bridge_port_t     *port,
+                                           _In_ mlnx_bridge_port_index_type_t type,
+                                           _Out_ uint64_t                    *key)
+{
+    switch (type) {
+    case MLNX_BRIDGE_PORT_INDEX_LOG:
+        *key = port->logical;
+        return true;
+
+    case MLNX_BRIDGE_PORT_INDEX_TUNNEL:
+        if (port->port_type != SAI_BRIDGE_PORT_TYPE_TUNNEL) {
+            return false;
+        }
+        *key = port->tunnel_idx;
+        return true;
+
+    case MLNX_BRIDGE_PORT_INDEX_VPORT:
+        if (port->port_type != SAI_BRIDGE_PORT_TYPE_SUB_PORT) {
+            return false;
+        }
+        *key = ((uint64_t)port->parent << 16) | port->vlan_id;
+        return true;
+
+    default:
+        assert(false);
+        return false;
+    }
+}
+
+static uint32_t mlnx_bridge_port_index_bucket(_In_ uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return (uint32_t)(key & (MLNX_BRIDGE_PORT_INDEX_BUCKETS - 1));
+}
+
+static void mlnx_bridge_port_index_insert(_In_ const mlnx_bridge_port_t *port)
+{
+    mlnx_bridge_port_index_t     *index;
+    mlnx_bridge_port_index_type_t type;
+    uint32_t                      bucket;
+    uint64_t                      key;
+
+    for (type = 0; type < MLNX_BRIDGE_PORT_INDEX_MAX; type++) {
+        if (!mlnx_bridge_port_index_key_get(port, type, &key)) {
+            continue;
+        }
+
+        index = &g_sai_db_ptr->bridge_ports_index[type];
+        bucket = mlnx_bridge_port_index_bucket(key);
+
+        mlnx_bridge_ports_db[port->index].index_next[type] = index->heads[bucket];
+        index->heads[bucket] = port->index + 1;
+    }
+}
+
+static void mlnx_bridge_port_index_remove(_In_ const mlnx_bridge_port_t *port)
+{
+    mlnx_bridge_port_index_t     *index;
+    mlnx_bridge_port_index_type_t type;
+    uint32_t                     *link;
+    uint64_t                      key;
+
+    for (type = 0; type < MLNX_BRIDGE_PORT_INDEX_MAX; type++) {
+        if (!mlnx_bridge_port_index_key_get(port, type, &key)) {
+            continue;
+        }
+
+        index = &g_sai_db_ptr->bridge_ports_index[type];
+        link = &index->heads[mlnx_bridge_port_index_bucket(key)];
+
+        while (*link) {
+            if (*link - 1 == port->index) {
+                *link = mlnx_bridge_ports_db[port->index].index_next[type];
+                mlnx_bridge_ports_db[port->index].index_next[type] = 0;
+                break;
+            }
+
+            link = &mlnx_bridge_ports_db[*link - 1].index_next[type];
+        }
+    }
+}
+
+/* Returns the matching bridge port with the lowest db index below idx_end, same as a linear scan of the DB would */
+static mlnx_bridge_port_t * mlnx_bridge_port_index_find(_In_ mlnx_bridge_port_index_type_t type,
+                                                        _In_ uint64_t                      key,
+                                                        _In_ uint32_t                      idx_end)
+{
+    const mlnx_bridge_port_index_t *index;
+    mlnx_bridge_port_t             *it, *found = NULL;
+    uint32_t                        entry;
+    uint64_t                        it_key;
+
+    index = &g_sai_db_ptr->bridge_ports_index[type];
+
+    for (entry = index->heads[mlnx_bridge_port_index_bucket(key)]; entry; entry = it->index_next[type]) {
+        it = &mlnx_bridge_ports_db[entry - 1];
+
+        if (!it->is_present || (it->index >= idx_end)) {
+            continue;
+        }
+
+        if (!mlnx_bridge_port_index_key_get(it, type, &it_key) || (it_key != key)) {
+            continue;
+        }
+
+        if (!found || (it->index < found->index)) {
+            found = it;
+        }
+    }
+
+    return found;
+}
+
 static sai_status_t mlnx_bridge_port_add(sx_bridge_id_t         bridge_id,
                                          sai_bridge_port_type_t port_type,
                                          mlnx_bridge_port_t   **port)
@@ -376,12 +492,12 @@ static sai_status_t mlnx_bridge_port_add(sx_bridge_id_t         bridge_id,
         db_end = MAX_BRIDGE_1Q_PORTS;
     } else {
         db_start = MAX_BRIDGE_1Q_PORTS;
-        db_end = MAX_BRIDGE_PORTS;
+        db_end = MLNX_BRIDGE_PORTS_DB_SIZE;
     }
 
     for (ii = db_start; ii < db_end; ii++) {
-        if (!g_sai_db_ptr->bridge_ports_db[ii].is_present) {
-            new_port = &g_sai_db_ptr->bridge_ports_db[ii];
+        if (!mlnx_bridge_ports_db[ii].is_present) {
+            new_port = &mlnx_bridge_ports_db[ii];
 
             new_port->bridge_id = bridge_id;
             new_port->port_type = port_type;
@@ -392,6 +508,8 @@ static sai_status_t mlnx_bridge_port_add(sx_bridge_id_t         bridge_id,
                 g_sai_db_ptr->non_1q_bports_created++;
             }
 
+            g_sai_db_ptr->bports_created++;
+
             *port = new_port;
             return SAI_STATUS_SUCCESS;
         }
@@ -407,23 +525,30 @@ static sai_status_t mlnx_bridge_port_del(mlnx_bridge_port_t *port)
         g_sai_db_ptr->non_1q_bports_created--;
     }
 
+    if (port->is_present) {
+        assert(g_sai_db_ptr->bports_created > 0);
+        g_sai_db_ptr->bports_created--;
+
+        mlnx_bridge_port_index_remove(port);
+    }
+
     memset(port, 0, sizeof(*port));
     return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_bridge_port_by_idx(uint32_t idx, mlnx_bridge_port_t **port)
 {
-    if (idx >= MAX_BRIDGE_PORTS) {
-        SX_LOG_ERR("Invalid bridge port idx - greater or equal than %u\n", MAX_BRIDGE_PORTS);
+    if (idx >= MLNX_BRIDGE_PORTS_DB_SIZE) {
+        SX_LOG_ERR("Invalid bridge port idx - greater or equal than %u\n", MLNX_BRIDGE_PORTS_DB_SIZE);
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    if (!g_sai_db_ptr->bridge_ports_db[idx].is_present) {
+    if (!mlnx_bridge_ports_db[idx].is_present) {
         SX_LOG_ERR("Bridge port %d is removed or not created yet\n", idx);
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    *port = &g_sai_db_ptr->bridge_ports_db[idx];
+    *port = &mlnx_bridge_ports_db[idx];
     return SAI_STATUS_SUCCESS;
 }
 
@@ -443,66 +568,63 @@ sai_status_t mlnx_bridge_port_by_oid(sai_object_id_t oid, mlnx_bridge_port_t **p
 
 sai_status_t mlnx_bridge_port_by_tunnel_id(sx_tunnel_id_t sx_tunnel, mlnx_bridge_port_t **port)
 {
-    mlnx_bridge_port_t        *it;
-    uint32_t                   ii, checked;
-    const mlnx_tunnel_entry_t *tunnel_entry;
-
-    mlnx_bridge_non1q_port_foreach(it, ii, checked) {
-        if (it->port_type != SAI_BRIDGE_PORT_TYPE_TUNNEL) {
-            continue;
-        }
-
-        tunnel_entry = &g_sai_tunnel_db_ptr->tunnel_entry_db[it->tunnel_idx];
+    mlnx_bridge_port_t *it, *found = NULL;
+    uint32_t            ii, node = 0;
 
-        if ((tunnel_entry->sx_tunnel_id_ipv4 == sx_tunnel) && tunnel_entry->ipv4_created) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
+    /* P2P tunnels share the sx tunnel of the main tunnel, so several tunnel entries may match */
+    while (mlnx_tunnel_db_idx_by_sx_tunnel_next(sx_tunnel, &node, &ii)) {
+        it = mlnx_bridge_port_index_find(MLNX_BRIDGE_PORT_INDEX_TUNNEL, ii, MLNX_BRIDGE_PORTS_DB_SIZE);
+        if (it && (!found || (it->index < found->index))) {
+            found = it;
         }
+    }
 
-        if ((tunnel_entry->sx_tunnel_id_ipv6 == sx_tunnel) && tunnel_entry->ipv6_created) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    if (!found) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
     }
 
-    return SAI_STATUS_ITEM_NOT_FOUND;
+    *port = found;
+    return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_bridge_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **port)
 {
     mlnx_bridge_port_t *it;
-    uint32_t            ii, checked;
 
-    mlnx_bridge_1q_port_foreach(it, ii) {
-        if (it->logical == log) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    it = mlnx_bridge_port_index_find(MLNX_BRIDGE_PORT_INDEX_LOG, log, MLNX_BRIDGE_PORTS_DB_SIZE);
+    if (!it) {
+        return SAI_STATUS_INVALID_PORT_NUMBER;
     }
 
-    mlnx_bridge_non1q_port_foreach(it, ii, checked) {
-        if (it->logical == log) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    *port = it;
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t mlnx_bridge_1q_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **port)
+{
+    mlnx_bridge_port_t *it;
+
+    it = mlnx_bridge_port_index_find(MLNX_BRIDGE_PORT_INDEX_LOG, log, MAX_BRIDGE_1Q_PORTS);
+    if (!it) {
+        return SAI_STATUS_INVALID_PORT_NUMBER;
     }
 
-    return SAI_STATUS_INVALID_PORT_NUMBER;
+    *port = it;
+    return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mlnx_bridge_1q_port_by_log(sx_port_log_id_t log, mlnx_bridge_port_t **port)
+sai_status_t mlnx_bridge_port_by_vport(sx_port_log_id_t log_port, sx_vlan_id_t vlan_id, mlnx_bridge_port_t **port)
 {
     mlnx_bridge_port_t *it;
-    uint32_t            ii;
 
-    mlnx_bridge_1q_port_foreach(it, ii) {
-        if (it->logical == log) {
-            *port = it;
-            return SAI_STATUS_SUCCESS;
-        }
+    it = mlnx_bridge_port_index_find(MLNX_BRIDGE_PORT_INDEX_VPORT, ((uint64_t)log_port << 16) | vlan_id,
+                                     MLNX_BRIDGE_PORTS_DB_SIZE);
+    if (!it) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
     }
 
-    return SAI_STATUS_INVALID_PORT_NUMBER;
+    *port = it;
+    return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_bridge_port_to_oid(mlnx_bridge_port_t *port, sai_object_id_t *oid)
@@ -1195,6 +1317,70 @@ sai_status_t mlnx_bridge_availability_get(_In_ sai_object_id_t        switch_id,
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_bridge_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    const mlnx_bridge_t *bridge;
+    sai_object_key_t    *key;
+    sai_status_t         status;
+    uint32_t             ii;
+
+    assert(keys);
+
+    mlnx_object_key_list_oid_add(keys, mlnx_bridge_default_1q_oid());
+
+    mlnx_bridge_1d_foreach(bridge, ii) {
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_create_bridge_1d_object(bridge->sx_bridge_id, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_bridge_port_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    mlnx_bridge_port_t *port;
+    sai_object_key_t   *key;
+    sai_status_t        status;
+    uint32_t            ii, checked;
+
+    assert(keys);
+
+    mlnx_bridge_1q_port_foreach(port, ii) {
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_bridge_port_to_oid(port, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    mlnx_bridge_non1q_port_foreach(port, ii, checked) {
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_bridge_port_to_oid(port, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static mlnx_fid_flood_ctrl_type_t mlnx_bridge_flood_type_to_fid_type(_In_ sai_bridge_flood_control_type_t type)
 {
     assert(type <= SAI_BRIDGE_FLOOD_CONTROL_TYPE_COMBINED);
@@ -1512,7 +1698,7 @@ static sai_status_t mlnx_bridge_db_alloc(_In_ sx_bridge_id_t            sx_bridg
 
     *bridge = mlnx_bridge_1d_by_rm_idx(*idx);
 
-    (*bridge)->array_hdr.is_used = true;
+    mlnx_shm_rm_array_hdr_used_set(MLNX_SHM_RM_ARRAY_TYPE_BRIDGE, &(*bridge)->array_hdr, true);
 
     memset(&(*bridge)->flood_data, 0, sizeof(mlnx_fid_flood_data_t));
 
@@ -1528,7 +1714,7 @@ static sai_status_t mlnx_bridge_db_free(_In_ mlnx_shm_rm_array_idx_t idx, _In_ m
     memset(&bridge->flood_data, 0, sizeof(mlnx_fid_flood_data_t));
 
     bridge->sx_bridge_id = 0;
-    bridge->array_hdr.is_used = false;
+    mlnx_shm_rm_array_hdr_used_set(MLNX_SHM_RM_ARRAY_TYPE_BRIDGE, &bridge->array_hdr, false);
 
     return SAI_STATUS_SUCCESS;
 }
@@ -2896,15 +3082,11 @@ sai_status_t mlnx_bridge_port_availability_get(_In_ sai_object_id_t        switc
 {
     const rm_sdk_table_type_e table_type = RM_SDK_TABLE_TYPE_VPORTS_E;
     sx_status_t               sx_status;
-    uint32_t                  ii, bports_left_1 = 0, bports_left_2 = 0;
+    uint32_t                  bports_left_1 = 0, bports_left_2 = 0;
 
     assert(count);
 
-    for (ii = 0; ii < MAX_BRIDGE_PORTS; ii++) {
-        if (!g_sai_db_ptr->bridge_ports_db[ii].is_present) {
-            ++bports_left_1;
-        }
-    }
+    bports_left_1 = MLNX_BRIDGE_PORTS_DB_SIZE - g_sai_db_ptr->bports_created;
 
     sx_status = sx_api_rm_free_entries_by_type_get(gh_sdk, table_type, &bports_left_2);
     if (SX_ERR(sx_status)) {
@@ -2935,6 +3117,7 @@ static sai_status_t mlnx_create_bridge_port(_Out_ sai_object_id_t     * bridge_p
     sai_status_t                 status = SAI_STATUS_NOT_IMPLEMENTED;
     mlnx_object_id_t             mlnx_bridge_id = {0};
     mlnx_bridge_port_t          *bridge_port = NULL;
+    mlnx_bridge_port_t          *vport_bridge_port;
     mlnx_bridge_rif_t           *bridge_rif;
     sx_bridge_id_t               bridge_id;
     mlnx_shm_rm_array_idx_t      bridge_rm_idx;
@@ -3121,6 +3304,12 @@ static sai_status_t mlnx_create_bridge_port(_Out_ sai_object_id_t     * bridge_p
         }
         vlan_id = attr_val->u16;
 
+        if (SAI_OK(mlnx_bridge_port_by_vport(log_port, vlan_id, &vport_bridge_port))) {
+            SX_LOG_ERR("Sub-port for port %x vlan %u already exists\n", log_port, vlan_id);
+            status = SAI_STATUS_ITEM_ALREADY_EXISTS;
+            goto out;
+        }
+
         sx_tagging_mode = SX_TAGGED_MEMBER;
         status = find_attrib_in_list(attr_count,
                                      attr_list,
@@ -3246,6 +3435,8 @@ static sai_status_t mlnx_create_bridge_port(_Out_ sai_object_id_t     * bridge_p
         goto out;
     }
 
+    mlnx_bridge_port_index_insert(bridge_port);
+
     status = find_attrib_in_list(attr_count, attr_list, SAI_BRIDGE_PORT_ATTR_ADMIN_STATE, &attr_val, &attr_idx);
     if (SAI_ERR(status)) {
         admin_state = false;
@@ -3589,6 +3780,8 @@ sai_status_t mlnx_bridge_init(void)
         bridge_port->parent = -1;
         bridge_port->vlan_id = 0;
 
+        mlnx_bridge_port_index_insert(bridge_port);
+
         if (!is_warmboot_init_stage ||
             (!(port->before_issu_lag_id) && port->sdk_port_added)) {
             status = mlnx_vlan_port_add(DEFAULT_VLAN, SAI_VLAN_TAGGING_MODE_UNTAGGED, bridge_port);
@@ -3606,6 +3799,8 @@ sai_status_t mlnx_bridge_init(void)
     }
     router_port->admin_state = true;
 
+    mlnx_bridge_port_index_insert(router_port);
+
     g_sai_db_ptr->sx_bridge_id = bridge_id;
 
     status = mlnx_create_bridge_object(SAI_BRIDGE_TYPE_1Q, MLNX_SHM_RM_ARRAY_IDX_UNINITIALIZED,
@@ -2239,6 +2239,8 @@ static sai_status_t mlnx_sai_remove_buffer_pool(_In_ sai_object_id_t pool_id)
         goto bail;
     }
 
+    mlnx_stats_cache_unregister(pool_id);
+
     if (SAI_BUFFER_POOL_TYPE_INGRESS == sai_pool_attr.pool_type) {
         g_sai_buffer_db_ptr->pool_allocation[1 + sai_pool_attr.sx_pool_id -
                                              g_sai_buffer_db_ptr->buffer_pool_ids.base_ingress_user_sx_pool_id] =
@@ -5053,6 +5055,7 @@ sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer
     uint32_t                           ii = 0;
     sx_access_cmd_t                    cmd = SX_ACCESS_CMD_NONE;
     bool                               is_locked = false;
+    sai_object_id_t                    shp_pool_id = SAI_NULL_OBJECT_ID;
 
     SX_LOG_ENTER();
     oid_to_str(buffer_pool_id, key_str);
@@ -5073,6 +5076,11 @@ sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer
         sai_status = SAI_STATUS_INVALID_PARAMETER;
         goto bail;
     }
+    if (mlnx_stats_cache_lookup(SAI_OBJECT_TYPE_BUFFER_POOL, buffer_pool_id, number_of_counters, counter_ids, mode,
+                                counters)) {
+        sai_status = SAI_STATUS_SUCCESS;
+        goto bail;
+    }
 
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd))) {
@@ -5086,11 +5094,11 @@ sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer
     }
 
     if (sai_pool_attr.is_shp_mapped) {
-        oid_to_str(g_sai_buffer_db_ptr->shp_ipool_map->shp_pool_id, key_str);
+        shp_pool_id = g_sai_buffer_db_ptr->shp_ipool_map->shp_pool_id;
+        oid_to_str(shp_pool_id, key_str);
         SX_LOG_DBG("Get stats %s\n", key_str);
         if (SAI_STATUS_SUCCESS !=
-            (sai_status =
-                 mlnx_get_sai_pool_data(g_sai_buffer_db_ptr->shp_ipool_map->shp_pool_id, &sai_shp_pool_attr))) {
+            (sai_status = mlnx_get_sai_pool_data(shp_pool_id, &sai_shp_pool_attr))) {
             goto bail;
         }
     }
@@ -5105,6 +5113,10 @@ sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer
         goto bail;
     }
 
+    if (SAI_STATS_MODE_READ_AND_CLEAR == mode) {
+        mlnx_stats_cache_invalidate(buffer_pool_id);
+    }
+
     if (sai_pool_attr.is_shp_mapped) {
         /* make sdk request in any case when there is association between iPool and SHP */
         if (SX_STATUS_SUCCESS != (sx_status = sx_api_cos_pool_statistic_get(gh_sdk, cmd,
@@ -5114,6 +5126,10 @@ sai_status_t mlnx_sai_get_buffer_pool_stats_ext(_In_ sai_object_id_t      buffer
             sai_status = sdk_to_sai(sx_status);
             goto bail;
         }
+
+        if (SAI_STATS_MODE_READ_AND_CLEAR == mode) {
+            mlnx_stats_cache_invalidate(shp_pool_id);
+        }
     }
 
     for (ii = 0; ii < number_of_counters; ii++) {
@@ -5189,6 +5205,7 @@ sai_status_t mlnx_clear_buffer_pool_stats(_In_ sai_object_id_t      pool_id,
     bool                                is_db_locked = false;
     sx_cos_pool_id_t                   *pool_ids = NULL;
     uint32_t                            pool_ids_count = 1;
+    sai_object_id_t                     shp_pool_id = SAI_NULL_OBJECT_ID;
 
     SX_LOG_ENTER();
     oid_to_str(pool_id, key_str);
@@ -5211,13 +5228,13 @@ sai_status_t mlnx_clear_buffer_pool_stats(_In_ sai_object_id_t      pool_id,
     }
 
     if (sai_pool_attr.is_shp_mapped) {
+        shp_pool_id = g_sai_buffer_db_ptr->shp_ipool_map->shp_pool_id;
         if (SAI_STATUS_SUCCESS !=
-            (sai_status =
-                 mlnx_get_sai_pool_data(g_sai_buffer_db_ptr->shp_ipool_map->shp_pool_id, &shp_sai_pool_attr))) {
+            (sai_status = mlnx_get_sai_pool_data(shp_pool_id, &shp_sai_pool_attr))) {
             goto bail;
         }
         pool_ids_count++;
-        oid_to_str(g_sai_buffer_db_ptr->shp_ipool_map->shp_pool_id, key_str);
+        oid_to_str(shp_pool_id, key_str);
         SX_LOG_DBG("Clear stats %s\n", key_str);
     }
     sai_db_unlock();
@@ -5246,6 +5263,11 @@ sai_status_t mlnx_clear_buffer_pool_stats(_In_ sai_object_id_t      pool_id,
         goto bail;
     }
 
+    mlnx_stats_cache_invalidate(pool_id);
+    if (pool_ids_count > 1) {
+        mlnx_stats_cache_invalidate(shp_pool_id);
+    }
+
 bail:
     if (is_db_locked) {
         sai_db_unlock();
@@ -130,6 +130,12 @@ sai_status_t mlnx_counter_oid_create(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ sai
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_counter_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    return mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_COUNTER, mlnx_counter_oid_create);
+}
+
 sai_status_t mlnx_counter_oid_to_data(_In_ sai_object_id_t           oid,
                                       _Out_ mlnx_counter_t         **counter_db_entry,
                                       _Out_ mlnx_shm_rm_array_idx_t *idx)
@@ -552,6 +558,10 @@ sai_status_t mlnx_remove_counter(_In_ sai_object_id_t counter_id)
     status = mlnx_counter_db_free(idx);
     sai_db_unlock();
 
+    if (SAI_OK(status)) {
+        mlnx_stats_cache_unregister(counter_id);
+    }
+
     return status;
 }
 
@@ -749,6 +759,11 @@ sai_status_t mlnx_get_counter_stats_ext(_In_ sai_object_id_t      counter_id,
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
+    if (mlnx_stats_cache_lookup(SAI_OBJECT_TYPE_COUNTER, counter_id, number_of_counters, counter_ids, mode,
+                                counters)) {
+        return SAI_STATUS_SUCCESS;
+    }
+
     sai_status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_COUNTER, counter_id, &mlnx_oid);
     if (SAI_ERR(sai_status)) {
         SX_LOG_ERR("Failed get mlnx object id\n");
@@ -776,6 +791,9 @@ sai_status_t mlnx_get_counter_stats_ext(_In_ sai_object_id_t      counter_id,
     }
 out:
     sai_db_unlock();
+    if (SAI_STATS_MODE_READ_AND_CLEAR == mode) {
+        mlnx_stats_cache_invalidate(counter_id);
+    }
     return sai_status;
 }
 
@@ -850,6 +868,7 @@ static sai_status_t mlnx_clear_counter_stats(_In_ sai_object_id_t      counter_i
 
 out:
     sai_db_unlock();
+    mlnx_stats_cache_invalidate(counter_id);
     return sai_status;
 }
 
@@ -409,6 +409,13 @@ static sai_status_t mlnx_debug_counter_oid_create(_In_ mlnx_shm_rm_array_idx_t i
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_debug_counter_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    return mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_DEBUG_COUNTER,
+                                              mlnx_debug_counter_oid_create);
+}
+
 static sai_status_t mlnx_debug_counter_oid_to_data(_In_ sai_object_id_t           oid,
                                                    _Out_ mlnx_debug_counter_t   **dbg_counter,
                                                    _Out_ mlnx_shm_rm_array_idx_t *idx)
@@ -1376,6 +1383,8 @@ static sai_status_t mlnx_debug_counter_sx_init(_In_ mlnx_debug_counter_t     *db
         goto out;
     }
 
+    mlnx_policer_db_sx_policer_created(&policer_db_entry->data, sx_policer);
+
     /* Trap group */
     status = mlnx_hostif_trap_group_allocate(sx_trap_group);
     if (SAI_ERR(status)) {
@@ -1441,6 +1450,7 @@ out:
         }
 
         if (policer_db_entry != NULL) {
+            mlnx_policer_db_sx_policer_destroyed(&policer_db_entry->data, &policer_db_entry->data.sx_policer_id_trap);
             db_reset_policer_entry(&policer_db_entry->data);
         }
 
@@ -1541,6 +1551,7 @@ static sai_status_t mlnx_debug_counter_sx_uninit(_In_ const mlnx_debug_counter_t
         return sdk_to_sai(sx_status);
     }
 
+    mlnx_policer_db_sx_policer_destroyed(&policer_array->data, &policer_array->data.sx_policer_id_trap);
     db_reset_policer_entry(&policer_array->data);
 
     /* Trap group */
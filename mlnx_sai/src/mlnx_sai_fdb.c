@@ -312,6 +312,75 @@ static sai_status_t mlnx_get_mac(const sai_fdb_entry_t *fdb_entry, sx_fdb_uc_mac
     return SAI_STATUS_SUCCESS;
 }
 
+/* Walks the SDK FDB page by page */
+sai_status_t mlnx_fdb_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    sx_fdb_uc_mac_addr_params_t *macs = NULL;
+    sx_fdb_uc_mac_addr_params_t  mac_key;
+    sx_fdb_uc_key_filter_t       filter;
+    sx_access_cmd_t              cmd = SX_ACCESS_CMD_GET_FIRST;
+    sai_object_key_t            *key;
+    sx_status_t                  sx_status;
+    sai_status_t                 status = SAI_STATUS_SUCCESS;
+    uint32_t                     macs_count, ii;
+
+    assert(keys);
+
+    macs = calloc(MLNX_OBJECT_KEY_SDK_PAGE_SIZE, sizeof(*macs));
+    if (!macs) {
+        SX_LOG_ERR("Failed to allocate memory for FDB entries\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    memset(&mac_key, 0, sizeof(mac_key));
+    memset(&filter, 0, sizeof(filter));
+
+    while (true) {
+        macs_count = MLNX_OBJECT_KEY_SDK_PAGE_SIZE;
+
+        sx_status = sx_api_fdb_uc_mac_addr_get(gh_sdk, DEFAULT_ETH_SWID, cmd, SX_FDB_UC_ALL, &mac_key, &filter,
+                                               macs, &macs_count);
+        if (SX_STATUS_ENTRY_NOT_FOUND == sx_status) {
+            break;
+        }
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get FDB entries - %s\n", SX_STATUS_MSG(sx_status));
+            status = sdk_to_sai(sx_status);
+            goto out;
+        }
+
+        for (ii = 0; ii < macs_count; ii++) {
+            key = mlnx_object_key_list_next(keys);
+            if (!key) {
+                continue;
+            }
+
+            key->key.fdb_entry.switch_id = switch_id;
+            memcpy(key->key.fdb_entry.mac_address, &macs[ii].mac_addr, sizeof(key->key.fdb_entry.mac_address));
+
+            if (macs[ii].fid_vid < MIN_SX_BRIDGE_ID) {
+                status = mlnx_vlan_oid_create(macs[ii].fid_vid, &key->key.fdb_entry.bv_id);
+            } else {
+                status = mlnx_create_bridge_1d_object(macs[ii].fid_vid, &key->key.fdb_entry.bv_id);
+            }
+            if (SAI_ERR(status)) {
+                goto out;
+            }
+        }
+
+        if (macs_count < MLNX_OBJECT_KEY_SDK_PAGE_SIZE) {
+            break;
+        }
+
+        mac_key = macs[macs_count - 1];
+        cmd = SX_ACCESS_CMD_GETNEXT;
+    }
+
+out:
+    free(macs);
+    return status;
+}
+
 static sai_status_t mlnx_get_n_delete_mac(const sai_fdb_entry_t *fdb_entry, sx_fdb_uc_mac_addr_params_t *mac_entry)
 {
     sai_status_t status;
@@ -970,6 +1039,17 @@ static sai_status_t mlnx_get_fdb_entry_attribute(_In_ const sai_fdb_entry_t *fdb
     return sai_get_attributes(&key, SAI_OBJECT_TYPE_FDB_ENTRY, attr_count, attr_list);
 }
 
+static void fdb_cache_set(mlnx_fdb_cache_t *fdb_cache, const sx_fdb_uc_mac_addr_params_t *mac_entry)
+{
+    fdb_cache->fdb_cache_set = true;
+    fdb_cache->action = mac_entry->action;
+    fdb_cache->entry_type = mac_entry->entry_type;
+    fdb_cache->log_port = mac_entry->log_port;
+    memcpy(&fdb_cache->endpoint_ip,
+           &mac_entry->dest.next_hop.next_hop_key.next_hop_key_entry.ip_tunnel.underlay_dip,
+           sizeof(fdb_cache->endpoint_ip));
+}
+
 static sai_status_t fill_fdb_cache(mlnx_fdb_cache_t *fdb_cache, const sai_fdb_entry_t *fdb_entry)
 {
     sai_status_t                status;
@@ -983,17 +1063,155 @@ static sai_status_t fill_fdb_cache(mlnx_fdb_cache_t *fdb_cache, const sai_fdb_en
         return status;
     }
 
-    fdb_cache->fdb_cache_set = true;
-    fdb_cache->action = mac_entry.action;
-    fdb_cache->entry_type = mac_entry.entry_type;
-    fdb_cache->log_port = mac_entry.log_port;
-    memcpy(&fdb_cache->endpoint_ip,
-           &mac_entry.dest.next_hop.next_hop_key.next_hop_key_entry.ip_tunnel.underlay_dip,
-           sizeof(fdb_cache->endpoint_ip));
+    fdb_cache_set(fdb_cache, &mac_entry);
 
     return SAI_STATUS_SUCCESS;
 }
 
+typedef struct _mlnx_fdb_bulk_key_t {
+    struct {
+        sx_fid_t      fid;
+        sx_mac_addr_t mac;
+    } key;
+    uint32_t idx;
+} mlnx_fdb_bulk_key_t;
+
+/* Orders the keys as SDK orders the FDB - by FID and then by MAC */
+static int mlnx_fdb_bulk_key_cmp(const void *a, const void *b)
+{
+    const mlnx_fdb_bulk_key_t *key_a = a, *key_b = b;
+
+    if (key_a->key.fid != key_b->key.fid) {
+        return (key_a->key.fid < key_b->key.fid) ? -1 : 1;
+    }
+
+    return memcmp(&key_a->key.mac, &key_b->key.mac, sizeof(key_a->key.mac));
+}
+
+static void mlnx_fdb_bulk_key_set(_In_ const sx_fdb_uc_mac_addr_params_t *mac_entry, _Out_ mlnx_fdb_bulk_key_t *key)
+{
+    memset(key, 0, sizeof(*key));
+
+    key->key.fid = mac_entry->fid_vid;
+    memcpy(&key->key.mac, &mac_entry->mac_addr, sizeof(key->key.mac));
+}
+
+/*
+ * Fills the FDB caches of the bulk get with a single page by page walk over the SDK FDB,
+ * instead of a separate SDK get per entry.
+ * The walk starts at the lowest requested entry and stops past the highest one.
+ * The entries that are not found are left uncached and are read by the getters.
+ */
+sai_status_t mlnx_fdb_bulk_cache_fill(_In_ uint32_t                object_count,
+                                      _In_ const sai_object_key_t *object_key,
+                                      _Inout_ vendor_cache_t      *caches)
+{
+    mlnx_fdb_bulk_key_t         *keys = NULL, *found, lookup;
+    sx_fdb_uc_mac_addr_params_t *macs = NULL;
+    sx_fdb_uc_mac_addr_params_t  mac_key;
+    sx_fdb_uc_key_filter_t       filter;
+    sx_access_cmd_t              cmd = SX_ACCESS_CMD_GET;
+    sx_status_t                  sx_status;
+    sai_status_t                 status = SAI_STATUS_SUCCESS;
+    uint32_t                     keys_count = 0, keys_left, macs_count, ii;
+    bool                         is_past_last = false;
+
+    assert(object_key);
+    assert(caches);
+
+    keys = calloc(object_count, sizeof(*keys));
+    macs = calloc(MLNX_OBJECT_KEY_SDK_PAGE_SIZE, sizeof(*macs));
+    if (!keys || !macs) {
+        SX_LOG_ERR("Failed to allocate memory for FDB bulk get\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        memset(&mac_key, 0, sizeof(mac_key));
+
+        /* Invalid keys are reported by the getters */
+        if (SAI_ERR(mlnx_fdb_entry_to_sdk(&object_key[ii].key.fdb_entry, &mac_key))) {
+            continue;
+        }
+
+        mlnx_fdb_bulk_key_set(&mac_key, &keys[keys_count]);
+        keys[keys_count].idx = ii;
+        keys_count++;
+    }
+
+    qsort(keys, keys_count, sizeof(*keys), mlnx_fdb_bulk_key_cmp);
+
+    memset(&filter, 0, sizeof(filter));
+
+    /* GET of the first entry, then GETNEXT from it */
+    memset(&mac_key, 0, sizeof(mac_key));
+    if (keys_count) {
+        mac_key.fid_vid = keys[0].key.fid;
+        memcpy(&mac_key.mac_addr, &keys[0].key.mac, sizeof(mac_key.mac_addr));
+    }
+
+    keys_left = keys_count;
+
+    while ((keys_left > 0) && !is_past_last) {
+        macs_count = (SX_ACCESS_CMD_GET == cmd) ? 1 : MLNX_OBJECT_KEY_SDK_PAGE_SIZE;
+
+        sx_status = sx_api_fdb_uc_mac_addr_get(gh_sdk, DEFAULT_ETH_SWID, cmd, SX_FDB_UC_ALL, &mac_key, &filter,
+                                               macs, &macs_count);
+        if (SX_STATUS_ENTRY_NOT_FOUND == sx_status) {
+            if (SX_ACCESS_CMD_GET != cmd) {
+                break;
+            }
+            macs_count = 0;
+        } else if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get FDB entries - %s\n", SX_STATUS_MSG(sx_status));
+            status = sdk_to_sai(sx_status);
+            goto out;
+        }
+
+        for (ii = 0; ii < macs_count; ii++) {
+            mlnx_fdb_bulk_key_set(&macs[ii], &lookup);
+
+            /* Past the last requested entry, the rest of the FDB is not needed */
+            if (mlnx_fdb_bulk_key_cmp(&lookup, &keys[keys_count - 1]) > 0) {
+                is_past_last = true;
+                break;
+            }
+
+            found = bsearch(&lookup, keys, keys_count, sizeof(*keys), mlnx_fdb_bulk_key_cmp);
+            if (!found) {
+                continue;
+            }
+
+            /* The same entry can be requested more than once */
+            while ((found > keys) && (0 == mlnx_fdb_bulk_key_cmp(found - 1, &lookup))) {
+                found--;
+            }
+
+            for (; (found < &keys[keys_count]) && (0 == mlnx_fdb_bulk_key_cmp(found, &lookup)); found++) {
+                fdb_cache_set(&caches[found->idx].fdb_cache, &macs[ii]);
+                keys_left--;
+            }
+        }
+
+        if (SX_ACCESS_CMD_GET == cmd) {
+            cmd = SX_ACCESS_CMD_GETNEXT;
+            continue;
+        }
+
+        if (macs_count < MLNX_OBJECT_KEY_SDK_PAGE_SIZE) {
+            break;
+        }
+
+        mac_key = macs[macs_count - 1];
+    }
+
+out:
+    free(macs);
+    free(keys);
+    return status;
+}
+
 /* Get FDB entry type [sai_fdb_entry_type_t] */
 static sai_status_t mlnx_fdb_type_get(_In_ const sai_object_key_t   *key,
                                       _Inout_ sai_attribute_value_t *value,
@@ -1289,9 +1507,27 @@ sai_status_t mlnx_fdb_log_set(sx_verbosity_level_t level)
     }
 }
 
+static sai_status_t mlnx_create_fdb_entry_timed(_In_ const sai_fdb_entry_t* fdb_entry,
+                                                _In_ uint32_t               attr_count,
+                                                _In_ const sai_attribute_t *attr_list)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_FDB_ENTRY, MLNX_API_STATS_OP_CREATE,
+                                mlnx_create_fdb_entry(fdb_entry, attr_count, attr_list));
+}
+
+static sai_status_t mlnx_remove_fdb_entry_timed(_In_ const sai_fdb_entry_t* fdb_entry)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_FDB_ENTRY, MLNX_API_STATS_OP_REMOVE,
+                                mlnx_remove_fdb_entry(fdb_entry));
+}
+
 const sai_fdb_api_t mlnx_fdb_api = {
-    mlnx_create_fdb_entry,
-    mlnx_remove_fdb_entry,
+    mlnx_create_fdb_entry_timed,
+    mlnx_remove_fdb_entry_timed,
     mlnx_set_fdb_entry_attribute,
     mlnx_get_fdb_entry_attribute,
     mlnx_flush_fdb_entries,
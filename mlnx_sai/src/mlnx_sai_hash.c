@@ -903,147 +903,218 @@ static sai_status_t mlnx_hash_convert_ecmp_sai_field_to_sx(const sai_attribute_v
     return status;
 }
 
-/* Get operational ECMP config and apply it for specified port */
+/* While deferred, the ECMP/LAG config updates are only marked as pending and pushed to the ports on commit */
+static bool hash_config_deferred;
+static bool hash_ecmp_config_pending;
+static bool hash_lag_config_pending;
+
+static bool mlnx_hash_is_warmboot_init_stage(void)
+{
+    return (BOOT_TYPE_WARM == g_sai_db_ptr->boot_type) && !g_sai_db_ptr->issu_end_called;
+}
+
+static sai_status_t mlnx_hash_ecmp_sx_config_get(_Out_ mlnx_hash_ecmp_sx_config_t *config)
+{
+    memset(config, 0, sizeof(*config));
+
+    return mlnx_hash_ecmp_global_config_get(&config->params, config->enable_list, &config->enable_count,
+                                            config->field_list, &config->field_count);
+}
+
+static sai_status_t mlnx_hash_lag_sx_config_get(_Out_ mlnx_hash_lag_sx_config_t *config)
+{
+    memset(config, 0, sizeof(*config));
+
+    return mlnx_hash_lag_global_config_get(&config->params, config->enable_list, &config->enable_count,
+                                           config->field_list, &config->field_count);
+}
+
+/* Calculates the effective ECMP config and starts a new generation if it differs from the last pushed one */
 /* SAI DB lock is needed */
-static sai_status_t mlnx_hash_ecmp_cfg_apply_on_port(_In_ sx_port_log_id_t port_log_id)
+static sai_status_t mlnx_hash_ecmp_sx_config_refresh(void)
 {
-    sai_status_t                       status;
-    sx_router_ecmp_port_hash_params_t  port_hash_param;
-    sx_router_ecmp_hash_field_enable_t hash_enable_list[FIELDS_ENABLES_NUM] = {0};
-    sx_router_ecmp_hash_field_t        hash_field_list[FIELDS_NUM] = {0};
-    uint32_t                           enable_count = 0;
-    uint32_t                           field_count = 0;
-
-    status = mlnx_hash_ecmp_global_config_get(&port_hash_param,
-                                              hash_enable_list,
-                                              &enable_count,
-                                              hash_field_list,
-                                              &field_count);
+    sai_status_t               status;
+    mlnx_hash_ecmp_sx_config_t config;
+
+    status = mlnx_hash_ecmp_sx_config_get(&config);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to get ECMP hash config\n");
         return status;
     }
 
-    status = sx_api_router_ecmp_port_hash_params_set(gh_sdk, SX_ACCESS_CMD_SET, port_log_id, &port_hash_param,
-                                                     hash_enable_list, enable_count,
-                                                     hash_field_list, field_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to set ECMP hash params for port %x.\n", port_log_id);
-        return sdk_to_sai(status);
+    if ((0 == g_sai_db_ptr->ecmp_hash_sx_config_gen) ||
+        memcmp(&config, &g_sai_db_ptr->ecmp_hash_sx_config, sizeof(config))) {
+        memcpy(&g_sai_db_ptr->ecmp_hash_sx_config, &config, sizeof(config));
+        g_sai_db_ptr->ecmp_hash_sx_config_gen++;
+        if (0 == g_sai_db_ptr->ecmp_hash_sx_config_gen) {
+            g_sai_db_ptr->ecmp_hash_sx_config_gen++;
+        }
     }
 
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_hash_lag_cfg_apply_on_port(_In_ sx_port_log_id_t port_log_id)
+/* SAI DB lock is needed */
+static sai_status_t mlnx_hash_lag_sx_config_refresh(void)
 {
-    sai_status_t               status;
-    sx_status_t                sx_status;
-    sx_lag_port_hash_params_t  lag_hash_params;
-    sx_lag_hash_field_enable_t hash_enable_list[FIELDS_ENABLES_NUM] = {0};
-    sx_lag_hash_field_t        hash_field_list[FIELDS_NUM] = {0};
-    uint32_t                   enable_count = 0;
-    uint32_t                   field_count = 0;
-
-    status = mlnx_hash_lag_global_config_get(&lag_hash_params, hash_enable_list, &enable_count,
-                                             hash_field_list, &field_count);
+    sai_status_t              status;
+    mlnx_hash_lag_sx_config_t config;
+
+    status = mlnx_hash_lag_sx_config_get(&config);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to get LAG hash config\n");
         return status;
     }
 
-    sx_status = sx_api_lag_port_hash_flow_params_set(gh_sdk, SX_ACCESS_CMD_SET, port_log_id, &lag_hash_params,
-                                                     hash_enable_list, enable_count,
-                                                     hash_field_list, field_count);
+    if ((0 == g_sai_db_ptr->lag_hash_sx_config_gen) ||
+        memcmp(&config, &g_sai_db_ptr->lag_hash_sx_config, sizeof(config))) {
+        memcpy(&g_sai_db_ptr->lag_hash_sx_config, &config, sizeof(config));
+        g_sai_db_ptr->lag_hash_sx_config_gen++;
+        if (0 == g_sai_db_ptr->lag_hash_sx_config_gen) {
+            g_sai_db_ptr->lag_hash_sx_config_gen++;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_hash_ecmp_sx_config_push(_In_ sx_port_log_id_t port_log_id)
+{
+    const mlnx_hash_ecmp_sx_config_t *config = &g_sai_db_ptr->ecmp_hash_sx_config;
+    sx_status_t                       sx_status;
+
+    sx_status = sx_api_router_ecmp_port_hash_params_set(gh_sdk, SX_ACCESS_CMD_SET, port_log_id, &config->params,
+                                                        config->enable_list, config->enable_count,
+                                                        config->field_list, config->field_count);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set ECMP hash params for port %x - %s.\n", port_log_id, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_hash_lag_sx_config_push(_In_ sx_port_log_id_t port_log_id)
+{
+    const mlnx_hash_lag_sx_config_t *config = &g_sai_db_ptr->lag_hash_sx_config;
+    sx_status_t                      sx_status;
+
+    sx_status = sx_api_lag_port_hash_flow_params_set(gh_sdk, SX_ACCESS_CMD_SET, port_log_id, &config->params,
+                                                     config->enable_list, config->enable_count,
+                                                     config->field_list, config->field_count);
     if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to set LAG hash params for LAG %x, - %s\n", port_log_id, SX_STATUS_MSG(sx_status));
+        SX_LOG_ERR("Failed to set LAG hash params for port %x - %s\n", port_log_id, SX_STATUS_MSG(sx_status));
         return sdk_to_sai(sx_status);
     }
 
     return SAI_STATUS_SUCCESS;
 }
 
+/* Get operational ECMP and LAG config and apply it for specified port */
+/* SAI DB lock is needed */
 sai_status_t mlnx_hash_config_apply_to_port(_In_ sx_port_log_id_t sx_port)
 {
-    sai_status_t status;
+    sai_status_t        status;
+    mlnx_port_config_t *port = NULL;
+
+    status = mlnx_hash_ecmp_sx_config_refresh();
+    if (SAI_ERR(status)) {
+        return status;
+    }
 
-    status = mlnx_hash_ecmp_cfg_apply_on_port(sx_port);
+    status = mlnx_hash_lag_sx_config_refresh();
     if (SAI_ERR(status)) {
         return status;
     }
 
-    status = mlnx_hash_lag_cfg_apply_on_port(sx_port);
+    status = mlnx_hash_ecmp_sx_config_push(sx_port);
     if (SAI_ERR(status)) {
         return status;
     }
 
+    status = mlnx_hash_lag_sx_config_push(sx_port);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    /* Port or LAG may not be in the DB yet, it is then just pushed again on the next change */
+    if (SAI_OK(mlnx_port_by_log_id_soft(sx_port, &port))) {
+        port->ecmp_hash_cfg_gen = g_sai_db_ptr->ecmp_hash_sx_config_gen;
+        port->lag_hash_cfg_gen = g_sai_db_ptr->lag_hash_sx_config_gen;
+    }
+
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_hash_ecmp_hash_params_apply_to_ports(
-    const sx_router_ecmp_port_hash_params_t  *port_hash_param,
-    const sx_router_ecmp_hash_field_enable_t *hash_enable_list,
-    uint32_t                                  enable_count,
-    const sx_router_ecmp_hash_field_t        *hash_field_list,
-    uint32_t                                  field_count)
+/* Pushes the last calculated ECMP config to the ports that don't have it yet */
+/* SAI DB lock is needed */
+static sai_status_t mlnx_hash_ecmp_sx_config_apply_to_ports(void)
 {
-    sx_status_t         sx_status;
+    sai_status_t        status;
     mlnx_port_config_t *port;
-    uint32_t            ii;
-    const bool          is_warmboot_init_stage = (BOOT_TYPE_WARM == g_sai_db_ptr->boot_type) &&
-                                                 !g_sai_db_ptr->issu_end_called;
-
-    assert(port_hash_param != NULL);
-    assert(hash_enable_list != NULL);
-    assert(hash_field_list != NULL);
+    uint32_t            ii, updated = 0, skipped = 0;
+    const uint32_t      gen = g_sai_db_ptr->ecmp_hash_sx_config_gen;
+    const bool          is_warmboot_init_stage = mlnx_hash_is_warmboot_init_stage();
 
     mlnx_port_not_in_lag_foreach(port, ii) {
-        if (!is_warmboot_init_stage || (port->sdk_port_added && port->logical)) {
-            sx_status = sx_api_router_ecmp_port_hash_params_set(gh_sdk, SX_ACCESS_CMD_SET, port->logical,
-                                                                port_hash_param,
-                                                                hash_enable_list, enable_count,
-                                                                hash_field_list, field_count);
-            if (SX_STATUS_SUCCESS != sx_status) {
-                SX_LOG_ERR("Failed to set ecmp hash params for %s %x - %s.\n",
-                           mlnx_port_type_str(port),
-                           port->logical,
-                           SX_STATUS_MSG(sx_status));
-                return sdk_to_sai(sx_status);
-            }
+        if (is_warmboot_init_stage && !(port->sdk_port_added && port->logical)) {
+            continue;
         }
+
+        /* SDK config is rebuilt during the warmboot, so it is always pushed */
+        if (!is_warmboot_init_stage && (port->ecmp_hash_cfg_gen == gen)) {
+            skipped++;
+            continue;
+        }
+
+        status = mlnx_hash_ecmp_sx_config_push(port->logical);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to set ecmp hash params for %s %x\n", mlnx_port_type_str(port), port->logical);
+            return status;
+        }
+
+        port->ecmp_hash_cfg_gen = gen;
+        updated++;
     }
 
+    SX_LOG_DBG("ECMP hash config gen %u - updated %u ports, %u are up to date\n", gen, updated, skipped);
+
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_hash_lag_params_apply_to_ports(_In_ const sx_lag_port_hash_params_t  *lag_hash_params,
-                                                        _In_ const sx_lag_hash_field_enable_t *enable_list,
-                                                        _In_ uint32_t                          enable_count,
-                                                        _In_ const sx_lag_hash_field_t        *field_list,
-                                                        _In_ uint32_t                          field_count)
+/* SAI DB lock is needed */
+static sai_status_t mlnx_hash_lag_sx_config_apply_to_ports(void)
 {
-    sx_status_t         sx_status;
+    sai_status_t        status;
     mlnx_port_config_t *port;
-    uint32_t            ii;
-    const bool          is_warmboot_init_stage = (BOOT_TYPE_WARM == g_sai_db_ptr->boot_type) &&
-                                                 !g_sai_db_ptr->issu_end_called;
-
-    assert(lag_hash_params);
-    assert(enable_list);
-    assert(field_list);
+    uint32_t            ii, updated = 0, skipped = 0;
+    const uint32_t      gen = g_sai_db_ptr->lag_hash_sx_config_gen;
+    const bool          is_warmboot_init_stage = mlnx_hash_is_warmboot_init_stage();
 
     mlnx_port_not_in_lag_foreach(port, ii) {
-        if (!is_warmboot_init_stage || (port->sdk_port_added && port->logical)) {
-            sx_status = sx_api_lag_port_hash_flow_params_set(gh_sdk, SX_ACCESS_CMD_SET, port->logical,
-                                                             lag_hash_params, enable_list, enable_count,
-                                                             field_list, field_count);
-            if (SX_ERR(sx_status)) {
-                SX_LOG_ERR("Failed to apply LAG hash configuration to LAG %x\n", port->logical);
-                return sdk_to_sai(sx_status);
-            }
+        if (is_warmboot_init_stage && !(port->sdk_port_added && port->logical)) {
+            continue;
+        }
+
+        /* SDK config is rebuilt during the warmboot, so it is always pushed */
+        if (!is_warmboot_init_stage && (port->lag_hash_cfg_gen == gen)) {
+            skipped++;
+            continue;
+        }
+
+        status = mlnx_hash_lag_sx_config_push(port->logical);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to apply LAG hash configuration to %s %x\n", mlnx_port_type_str(port),
+                       port->logical);
+            return status;
         }
+
+        port->lag_hash_cfg_gen = gen;
+        updated++;
     }
 
+    SX_LOG_DBG("LAG hash config gen %u - updated %u ports, %u are up to date\n", gen, updated, skipped);
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -1278,52 +1349,80 @@ static sai_status_t mlnx_hash_lag_global_config_get(_Out_ sx_lag_port_hash_param
                                           (sx_router_ecmp_hash_field_t*)field_list, field_count);
 }
 
+/* SAI DB lock is needed */
 sai_status_t mlnx_hash_ecmp_sx_config_update(void)
 {
-    sai_status_t                       status;
-    sx_router_ecmp_port_hash_params_t  port_hash_param;
-    sx_router_ecmp_hash_field_enable_t enable_list[FIELDS_ENABLES_NUM] = {0};
-    sx_router_ecmp_hash_field_t        field_list[FIELDS_NUM] = {0};
-    uint32_t                           enable_count = 0;
-    uint32_t                           field_count = 0;
+    sai_status_t status;
 
-    status = mlnx_hash_ecmp_global_config_get(&port_hash_param, enable_list, &enable_count, field_list, &field_count);
-    if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to get ECMP hash config\n");
-        return status;
+    if (hash_config_deferred) {
+        hash_ecmp_config_pending = true;
+        return SAI_STATUS_SUCCESS;
     }
 
-    status = mlnx_hash_ecmp_hash_params_apply_to_ports(&port_hash_param, enable_list, enable_count,
-                                                       field_list, field_count);
+    status = mlnx_hash_ecmp_sx_config_refresh();
     if (SAI_ERR(status)) {
         return status;
     }
 
-    return SAI_STATUS_SUCCESS;
+    return mlnx_hash_ecmp_sx_config_apply_to_ports();
 }
 
+/* SAI DB lock is needed */
 sai_status_t mlnx_hash_lag_sx_config_update(void)
 {
-    sai_status_t               status;
-    sx_lag_port_hash_params_t  lag_hash_params;
-    sx_lag_hash_field_enable_t enable_list[FIELDS_ENABLES_NUM] = {0};
-    sx_lag_hash_field_t        field_list[FIELDS_NUM] = {0};
-    uint32_t                   enable_count = 0;
-    uint32_t                   field_count = 0;
+    sai_status_t status;
 
-    status = mlnx_hash_lag_global_config_get(&lag_hash_params, enable_list, &enable_count, field_list, &field_count);
-    if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to get LAG hash config\n");
-        return status;
+    if (hash_config_deferred) {
+        hash_lag_config_pending = true;
+        return SAI_STATUS_SUCCESS;
     }
 
-    status = mlnx_hash_lag_params_apply_to_ports(&lag_hash_params, enable_list, enable_count,
-                                                 field_list, field_count);
+    status = mlnx_hash_lag_sx_config_refresh();
     if (SAI_ERR(status)) {
         return status;
     }
 
-    return SAI_STATUS_SUCCESS;
+    return mlnx_hash_lag_sx_config_apply_to_ports();
+}
+
+/*
+ * Several hash related DB changes (e.g. seed, algorithm and fields) can be grouped between begin and commit,
+ * so the ports are reconfigured once with the final config instead of once per change.
+ * SAI DB write lock is needed.
+ */
+void mlnx_hash_config_defer_begin(void)
+{
+    assert(!hash_config_deferred);
+
+    hash_config_deferred = true;
+    hash_ecmp_config_pending = false;
+    hash_lag_config_pending = false;
+}
+
+/* SAI DB write lock is needed */
+sai_status_t mlnx_hash_config_defer_commit(void)
+{
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    assert(hash_config_deferred);
+
+    hash_config_deferred = false;
+
+    if (hash_ecmp_config_pending) {
+        hash_ecmp_config_pending = false;
+        status = mlnx_hash_ecmp_sx_config_update();
+        if (SAI_ERR(status)) {
+            hash_lag_config_pending = false;
+            return status;
+        }
+    }
+
+    if (hash_lag_config_pending) {
+        hash_lag_config_pending = false;
+        status = mlnx_hash_lag_sx_config_update();
+    }
+
+    return status;
 }
 
 /* Apply hash configuration */
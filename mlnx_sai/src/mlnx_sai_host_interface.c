@@ -1208,28 +1208,28 @@ static sai_status_t create_netdev(uint32_t index)
 #endif
     int system_err;
 
-    if (SAI_HOSTIF_OBJECT_TYPE_VLAN == g_sai_db_ptr->hostif_db[index].sub_type) {
+    if (SAI_HOSTIF_OBJECT_TYPE_VLAN == mlnx_hostif_db[index].sub_type) {
         snprintf(add_link_command, sizeof(add_link_command), "ip link add link swid%u_eth name %s type vlan id %u",
-                 DEFAULT_ETH_SWID, g_sai_db_ptr->hostif_db[index].ifname, g_sai_db_ptr->hostif_db[index].vid);
+                 DEFAULT_ETH_SWID, mlnx_hostif_db[index].ifname, mlnx_hostif_db[index].vid);
     } else {
         snprintf(add_link_command, sizeof(add_link_command), "ip link add %s type sx_netdev swid %u port 0x%x",
-                 g_sai_db_ptr->hostif_db[index].ifname, DEFAULT_ETH_SWID, g_sai_db_ptr->hostif_db[index].port_id);
+                 mlnx_hostif_db[index].ifname, DEFAULT_ETH_SWID, mlnx_hostif_db[index].port_id);
     }
 
     /* TODO : temporary WA for SwitchX. L2 and Router port are created with port MAC. But since we want to use them for
      * routing, we set them with the router MAC to avoid mismatch of the MAC value.
      */
     snprintf(set_addr_command, sizeof(set_addr_command), "ip link set dev %s address %s > /dev/null 2>&1",
-             g_sai_db_ptr->hostif_db[index].ifname, g_sai_db_ptr->dev_mac);
+             mlnx_hostif_db[index].ifname, g_sai_db_ptr->dev_mac);
 
     /* Enable ipv6 for router port (by default, ipv6 is off on port/lag netdev)
      * TODO : Right now we are enabling on any port/lag netdev, could improve by enabling just on router port.
      * This will require iteration on all router ports and checking port id match, and also different order sequences.
      */
-    if ((SAI_HOSTIF_OBJECT_TYPE_PORT == g_sai_db_ptr->hostif_db[index].sub_type) ||
-        (SAI_HOSTIF_OBJECT_TYPE_LAG == g_sai_db_ptr->hostif_db[index].sub_type)) {
+    if ((SAI_HOSTIF_OBJECT_TYPE_PORT == mlnx_hostif_db[index].sub_type) ||
+        (SAI_HOSTIF_OBJECT_TYPE_LAG == mlnx_hostif_db[index].sub_type)) {
         snprintf(disable_ipv6_command, sizeof(disable_ipv6_command), "sysctl -w net.ipv6.conf.%s.disable_ipv6=0",
-                 g_sai_db_ptr->hostif_db[index].ifname);
+                 mlnx_hostif_db[index].ifname);
         snprintf(command, sizeof(command), "%s && %s && %s",
                  add_link_command, disable_ipv6_command, set_addr_command);
     } else {
@@ -1239,7 +1239,7 @@ static sai_status_t create_netdev(uint32_t index)
          */
 #ifdef ACS_OS
         snprintf(up_command, sizeof(up_command), "ip link set dev %s up > /dev/null 2>&1",
-                 g_sai_db_ptr->hostif_db[index].ifname);
+                 mlnx_hostif_db[index].ifname);
         snprintf(command, sizeof(command), "%s && %s && %s",
                  add_link_command, set_addr_command, up_command);
 #else
@@ -1291,9 +1291,9 @@ static sai_status_t resolve_group(uint32_t index, const char* mcgrp_name)
 
 #ifdef ACS_OS
     /* sonic uses hard coded group 1 and not "packets" resolved group id */
-    g_sai_db_ptr->hostif_db[index].psample_group.group_id = 1;
+    mlnx_hostif_db[index].psample_group.group_id = 1;
 #else
-    g_sai_db_ptr->hostif_db[index].psample_group.group_id = group;
+    mlnx_hostif_db[index].psample_group.group_id = group;
 #endif
     nl_socket_free(sk);
 #endif
@@ -1338,13 +1338,13 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
 
     cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
 
-    for (ii = 0; ii < MAX_HOSTIFS; ii++) {
-        if (false == g_sai_db_ptr->hostif_db[ii].is_used) {
+    for (ii = 0; ii < MLNX_HOSTIF_DB_SIZE; ii++) {
+        if (false == mlnx_hostif_db[ii].is_used) {
             break;
         }
     }
 
-    if (MAX_HOSTIFS == ii) {
+    if (MLNX_HOSTIF_DB_SIZE == ii) {
         SX_LOG_ERR("Hostifs table full\n");
         cl_plock_release(&g_sai_db_ptr->p_lock);
         return SAI_STATUS_TABLE_FULL;
@@ -1368,13 +1368,13 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
         }
 
         if (SAI_OBJECT_TYPE_VLAN == sai_object_type_query(rif_port->oid)) {
-            status = sai_object_to_vlan(rif_port->oid, &g_sai_db_ptr->hostif_db[ii].vid);
+            status = sai_object_to_vlan(rif_port->oid, &mlnx_hostif_db[ii].vid);
             if (SAI_ERR(status)) {
                 cl_plock_release(&g_sai_db_ptr->p_lock);
                 return status;
             }
 
-            g_sai_db_ptr->hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_VLAN;
+            mlnx_hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_VLAN;
         } else if (SAI_OBJECT_TYPE_PORT == sai_object_type_query(rif_port->oid)) {
             if (SAI_STATUS_SUCCESS !=
                 (status = mlnx_object_to_type(rif_port->oid, SAI_OBJECT_TYPE_PORT, &rif_port_data, NULL))) {
@@ -1382,8 +1382,8 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
                 return status;
             }
 
-            g_sai_db_ptr->hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_PORT;
-            g_sai_db_ptr->hostif_db[ii].port_id = (sx_port_log_id_t)rif_port_data;
+            mlnx_hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_PORT;
+            mlnx_hostif_db[ii].port_id = (sx_port_log_id_t)rif_port_data;
             status = mlnx_port_idx_by_obj_id(rif_port->oid, &port_db_idx);
             if (SAI_ERR(status)) {
                 sai_db_unlock();
@@ -1400,8 +1400,8 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
                 return status;
             }
 
-            g_sai_db_ptr->hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_LAG;
-            g_sai_db_ptr->hostif_db[ii].port_id = (sx_port_log_id_t)rif_port_data;
+            mlnx_hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_LAG;
+            mlnx_hostif_db[ii].port_id = (sx_port_log_id_t)rif_port_data;
             status = mlnx_port_idx_by_obj_id(rif_port->oid, &port_db_idx);
             if (SAI_ERR(status)) {
                 sai_db_unlock();
@@ -1421,8 +1421,8 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstringop-truncation"
 #endif
-        strncpy(g_sai_db_ptr->hostif_db[ii].ifname, name->chardata, SAI_HOSTIF_NAME_SIZE);
-        g_sai_db_ptr->hostif_db[ii].ifname[SAI_HOSTIF_NAME_SIZE] = '\0';
+        strncpy(mlnx_hostif_db[ii].ifname, name->chardata, SAI_HOSTIF_NAME_SIZE);
+        mlnx_hostif_db[ii].ifname[SAI_HOSTIF_NAME_SIZE] = '\0';
 #if __GNUC__ >= 8
 #pragma GCC diagnostic pop
 #endif
@@ -1449,13 +1449,13 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
             return SAI_STATUS_INVALID_ATTRIBUTE_0 + name_index;
         }
 
-        if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_open(gh_sdk, &g_sai_db_ptr->hostif_db[ii].fd))) {
+        if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_open(gh_sdk, &mlnx_hostif_db[ii].fd))) {
             SX_LOG_ERR("host ifc open fd failed - %s.\n", SX_STATUS_MSG(status));
             cl_plock_release(&g_sai_db_ptr->p_lock);
             return status;
         }
 
-        g_sai_db_ptr->hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_FD;
+        mlnx_hostif_db[ii].sub_type = SAI_HOSTIF_OBJECT_TYPE_FD;
     } else if (SAI_HOSTIF_TYPE_GENETLINK == type->s32) {
         if (SAI_STATUS_ITEM_NOT_FOUND !=
             (status =
@@ -1489,9 +1489,9 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
         }
 
         /* check if genetlink hostif already exists */
-        for (int i = 0; i < MAX_HOSTIFS; i++) {
-            if ((SAI_HOSTIF_OBJECT_TYPE_GENETLINK == g_sai_db_ptr->hostif_db[i].sub_type) &&
-                (true == g_sai_db_ptr->hostif_db[i].is_used)) {
+        for (uint32_t i = 0; i < MLNX_HOSTIF_DB_SIZE; i++) {
+            if ((SAI_HOSTIF_OBJECT_TYPE_GENETLINK == mlnx_hostif_db[i].sub_type) &&
+                (true == mlnx_hostif_db[i].is_used)) {
                 SX_LOG_ERR("Failed to create genetlink hostif, already exist\n");
                 cl_plock_release(&g_sai_db_ptr->p_lock);
                 return SAI_STATUS_ITEM_ALREADY_EXISTS;
@@ -1507,15 +1507,15 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstringop-truncation"
 #endif
-        strncpy(g_sai_db_ptr->hostif_db[ii].ifname, name->chardata, SAI_HOSTIF_NAME_SIZE);
-        g_sai_db_ptr->hostif_db[ii].ifname[SAI_HOSTIF_NAME_SIZE] = '\0';
+        strncpy(mlnx_hostif_db[ii].ifname, name->chardata, SAI_HOSTIF_NAME_SIZE);
+        mlnx_hostif_db[ii].ifname[SAI_HOSTIF_NAME_SIZE] = '\0';
 
-        strncpy(g_sai_db_ptr->hostif_db[ii].mcgrpname, mcgrp_name->chardata, SAI_HOSTIF_GENETLINK_MCGRP_NAME_SIZE - 1);
-        g_sai_db_ptr->hostif_db[ii].mcgrpname[SAI_HOSTIF_GENETLINK_MCGRP_NAME_SIZE - 1] = '\0';
+        strncpy(mlnx_hostif_db[ii].mcgrpname, mcgrp_name->chardata, SAI_HOSTIF_GENETLINK_MCGRP_NAME_SIZE - 1);
+        mlnx_hostif_db[ii].mcgrpname[SAI_HOSTIF_GENETLINK_MCGRP_NAME_SIZE - 1] = '\0';
 #if __GNUC__ >= 8
 #pragma GCC diagnostic pop
 #endif
-        g_sai_db_ptr->hostif_db[ii].sub_type =
+        mlnx_hostif_db[ii].sub_type =
             SAI_HOSTIF_OBJECT_TYPE_GENETLINK;
     } else {
         SX_LOG_ERR("Invalid host interface type %d\n", type->s32);
@@ -1523,7 +1523,7 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
         return SAI_STATUS_INVALID_ATTR_VALUE_0 + type_index;
     }
 
-    g_sai_db_ptr->hostif_db[ii].is_used = true;
+    mlnx_hostif_db[ii].is_used = true;
     msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
     cl_plock_release(&g_sai_db_ptr->p_lock);
     mlnx_hif.id.u32 = ii;
@@ -1542,12 +1542,12 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
 /* requires sai_db read lock */
 static sai_status_t check_hostif_is_valid_by_idx_unlocked(uint32_t hif_idx)
 {
-    if (hif_idx >= MAX_HOSTIFS) {
+    if (hif_idx >= MLNX_HOSTIF_DB_SIZE) {
         SX_LOG_ERR("Invalid Host if ID %u\n", hif_idx);
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    if (!g_sai_db_ptr->hostif_db[hif_idx].is_used) {
+    if (!mlnx_hostif_db[hif_idx].is_used) {
         SX_LOG_ERR("Invalid Host if ID %u\n entry not used", hif_idx);
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -1606,32 +1606,32 @@ static sai_status_t mlnx_remove_host_interface(_In_ sai_object_id_t hif_id)
 
     sai_db_write_lock();
 
-    if (g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].refcount > 0) {
+    if (mlnx_hostif_db[mlnx_hif.id.u32].refcount > 0) {
         SX_LOG_ERR("Failed to remove hostif with refcount %d - object in use\n",
-                   g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].refcount);
+                   mlnx_hostif_db[mlnx_hif.id.u32].refcount);
         status = SAI_STATUS_OBJECT_IN_USE;
         goto out;
     }
 
-    if (SAI_HOSTIF_OBJECT_TYPE_FD == g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
+    if (SAI_HOSTIF_OBJECT_TYPE_FD == mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_host_ifc_close(gh_sdk, &g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].fd))) {
+            (status = sx_api_host_ifc_close(gh_sdk, &mlnx_hostif_db[mlnx_hif.id.u32].fd))) {
             SX_LOG_ERR("host ifc close fd failed - %s.\n", SX_STATUS_MSG(status));
             goto out;
         }
-    } else if (SAI_HOSTIF_OBJECT_TYPE_GENETLINK != g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
-        if ((SAI_HOSTIF_OBJECT_TYPE_PORT == g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) ||
-            (SAI_HOSTIF_OBJECT_TYPE_LAG == g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type)) {
-            status = mlnx_port_idx_by_log_id(g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].port_id, &port_db_idx);
+    } else if (SAI_HOSTIF_OBJECT_TYPE_GENETLINK != mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
+        if ((SAI_HOSTIF_OBJECT_TYPE_PORT == mlnx_hostif_db[mlnx_hif.id.u32].sub_type) ||
+            (SAI_HOSTIF_OBJECT_TYPE_LAG == mlnx_hostif_db[mlnx_hif.id.u32].sub_type)) {
+            status = mlnx_port_idx_by_log_id(mlnx_hostif_db[mlnx_hif.id.u32].port_id, &port_db_idx);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("Failed to get port db idx from port id 0x%x\n",
-                           g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].port_id);
+                           mlnx_hostif_db[mlnx_hif.id.u32].port_id);
                 goto out;
             }
             mlnx_ports_db[port_db_idx].has_hostif = false;
             mlnx_ports_db[port_db_idx].hostif_db_idx = 0;
         }
-        snprintf(command, sizeof(command), "ip link delete %s", g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].ifname);
+        snprintf(command, sizeof(command), "ip link delete %s", mlnx_hostif_db[mlnx_hif.id.u32].ifname);
         system_err = system(command);
         if (0 != system_err) {
             SX_LOG_ERR("Command \"%s\" failed\n", command);
@@ -1640,7 +1640,7 @@ static sai_status_t mlnx_remove_host_interface(_In_ sai_object_id_t hif_id)
         }
     }
 
-    memset(&g_sai_db_ptr->hostif_db[mlnx_hif.id.u32], 0, sizeof(g_sai_db_ptr->hostif_db[mlnx_hif.id.u32]));
+    memset(&mlnx_hostif_db[mlnx_hif.id.u32], 0, sizeof(mlnx_hostif_db[mlnx_hif.id.u32]));
     sai_db_sync();
 out:
     sai_db_unlock();
@@ -1657,9 +1657,9 @@ sai_status_t mlnx_netdev_restore(void)
 
     cl_plock_acquire(&g_sai_db_ptr->p_lock);
 
-    for (ii = 0; ii < MAX_HOSTIFS; ii++) {
-        if ((false == g_sai_db_ptr->hostif_db[ii].is_used) ||
-            (SAI_HOSTIF_OBJECT_TYPE_FD == g_sai_db_ptr->hostif_db[ii].sub_type)) {
+    for (ii = 0; ii < MLNX_HOSTIF_DB_SIZE; ii++) {
+        if ((false == mlnx_hostif_db[ii].is_used) ||
+            (SAI_HOSTIF_OBJECT_TYPE_FD == mlnx_hostif_db[ii].sub_type)) {
             continue;
         }
 
@@ -1740,9 +1740,9 @@ static sai_status_t mlnx_host_interface_type_get(_In_ const sai_object_key_t   *
     }
 
     cl_plock_acquire(&g_sai_db_ptr->p_lock);
-    if (SAI_HOSTIF_OBJECT_TYPE_FD == g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
+    if (SAI_HOSTIF_OBJECT_TYPE_FD == mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
         value->s32 = SAI_HOSTIF_TYPE_FD;
-    } else if (SAI_HOSTIF_OBJECT_TYPE_GENETLINK == g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
+    } else if (SAI_HOSTIF_OBJECT_TYPE_GENETLINK == mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
         value->s32 = SAI_HOSTIF_TYPE_GENETLINK;
     } else {
         value->s32 = SAI_HOSTIF_TYPE_NETDEV;
@@ -1778,7 +1778,7 @@ static sai_status_t mlnx_host_interface_rif_port_get(_In_ const sai_object_key_t
 
     sai_db_read_lock();
 
-    type = g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type;
+    type = mlnx_hostif_db[mlnx_hif.id.u32].sub_type;
 
     switch (type) {
     case SAI_HOSTIF_OBJECT_TYPE_FD:
@@ -1788,17 +1788,17 @@ static sai_status_t mlnx_host_interface_rif_port_get(_In_ const sai_object_key_t
 
     case SAI_HOSTIF_OBJECT_TYPE_PORT:
     case SAI_HOSTIF_OBJECT_TYPE_LAG:
-        status = mlnx_log_port_to_object(g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].port_id,
+        status = mlnx_log_port_to_object(mlnx_hostif_db[mlnx_hif.id.u32].port_id,
                                          &value->oid);
         break;
 
     case SAI_HOSTIF_OBJECT_TYPE_VLAN:
-        status = mlnx_vlan_oid_create(g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].vid,
+        status = mlnx_vlan_oid_create(mlnx_hostif_db[mlnx_hif.id.u32].vid,
                                       &value->oid);
         break;
 
     default:
-        SX_LOG_ERR("Unexpected host if type %d\n", g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type);
+        SX_LOG_ERR("Unexpected host if type %d\n", mlnx_hostif_db[mlnx_hif.id.u32].sub_type);
         status = SAI_STATUS_INVALID_PARAMETER;
     }
 
@@ -1833,13 +1833,13 @@ static sai_status_t mlnx_host_interface_name_get(_In_ const sai_object_key_t   *
 
     cl_plock_acquire(&g_sai_db_ptr->p_lock);
 
-    if (SAI_HOSTIF_OBJECT_TYPE_FD == g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
+    if (SAI_HOSTIF_OBJECT_TYPE_FD == mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
         SX_LOG_ERR("Name can not be retrieved for host interface channel type FD\n");
         cl_plock_release(&g_sai_db_ptr->p_lock);
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    strncpy(value->chardata, g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].ifname, SAI_HOSTIF_NAME_SIZE);
+    strncpy(value->chardata, mlnx_hostif_db[mlnx_hif.id.u32].ifname, SAI_HOSTIF_NAME_SIZE);
     cl_plock_release(&g_sai_db_ptr->p_lock);
 
     SX_LOG_EXIT();
@@ -1872,13 +1872,13 @@ static sai_status_t mlnx_host_interface_genetlink_mcrp_name_get(_In_ const sai_o
 
     cl_plock_acquire(&g_sai_db_ptr->p_lock);
 
-    if (SAI_HOSTIF_OBJECT_TYPE_GENETLINK != g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
+    if (SAI_HOSTIF_OBJECT_TYPE_GENETLINK != mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
         SX_LOG_ERR("Multicast group name can be retrieved only for host interface channel type genetlink\n");
         cl_plock_release(&g_sai_db_ptr->p_lock);
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    strncpy(value->chardata, g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].mcgrpname, SAI_HOSTIF_GENETLINK_MCGRP_NAME_SIZE);
+    strncpy(value->chardata, mlnx_hostif_db[mlnx_hif.id.u32].mcgrpname, SAI_HOSTIF_GENETLINK_MCGRP_NAME_SIZE);
     cl_plock_release(&g_sai_db_ptr->p_lock);
 
     SX_LOG_EXIT();
@@ -2187,16 +2187,9 @@ sai_status_t mlnx_sai_unbind_policer_from_trap_group(_In_ sai_object_id_t sai_tr
 
 uint32_t mlnx_hostif_trap_group_db_free_entries_count(void)
 {
-    sx_trap_group_t group_id;
-    uint32_t        free = 0;
+    assert(g_sai_db_ptr->trap_groups_used <= MAX_TRAP_GROUPS);
 
-    for (group_id = 0; group_id < MAX_TRAP_GROUPS; group_id++) {
-        if (!g_sai_db_ptr->trap_group_valid[group_id]) {
-            free++;
-        }
-    }
-
-    return free;
+    return MAX_TRAP_GROUPS - g_sai_db_ptr->trap_groups_used;
 }
 
 sai_status_t mlnx_hostif_trap_group_allocate(_Out_ sx_trap_group_t *trap_group)
@@ -2208,6 +2201,7 @@ sai_status_t mlnx_hostif_trap_group_allocate(_Out_ sx_trap_group_t *trap_group)
     for (group_id = 0; group_id < MAX_TRAP_GROUPS; group_id++) {
         if (!g_sai_db_ptr->trap_group_valid[group_id]) {
             g_sai_db_ptr->trap_group_valid[group_id] = true;
+            g_sai_db_ptr->trap_groups_used++;
             *trap_group = group_id;
             return SAI_STATUS_SUCCESS;
         }
@@ -2230,6 +2224,11 @@ sai_status_t mlnx_hostif_trap_group_free(_In_ sx_trap_group_t trap_group)
         return SAI_STATUS_FAILURE;
     }
 
+    if (g_sai_db_ptr->trap_group_valid[trap_group]) {
+        assert(g_sai_db_ptr->trap_groups_used > 0);
+        g_sai_db_ptr->trap_groups_used--;
+    }
+
     g_sai_db_ptr->trap_group_valid[trap_group] = false;
     return SAI_STATUS_SUCCESS;
 }
@@ -2384,7 +2383,7 @@ static sai_status_t mlnx_remove_hostif_trap_group(_In_ sai_object_id_t hostif_tr
         goto out;
     }
 
-    g_sai_db_ptr->trap_group_valid[group_id] = false;
+    status = mlnx_hostif_trap_group_free(group_id);
 
 out:
     sai_db_unlock();
@@ -3876,14 +3875,14 @@ static sai_status_t mlnx_recv_hostif_packet(_In_ sai_object_id_t   hif_id,
 
     cl_plock_acquire(&g_sai_db_ptr->p_lock);
 
-    if (SAI_HOSTIF_OBJECT_TYPE_FD != g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
-        SX_LOG_ERR("Can't recv on non FD host interface type %u\n", g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type);
+    if (SAI_HOSTIF_OBJECT_TYPE_FD != mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
+        SX_LOG_ERR("Can't recv on non FD host interface type %u\n", mlnx_hostif_db[mlnx_hif.id.u32].sub_type);
         status = SAI_STATUS_INVALID_PARAMETER;
         cl_plock_release(&g_sai_db_ptr->p_lock);
         goto out;
     }
 
-    memcpy(&fd, &g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].fd, sizeof(fd));
+    memcpy(&fd, &mlnx_hostif_db[mlnx_hif.id.u32].fd, sizeof(fd));
     cl_plock_release(&g_sai_db_ptr->p_lock);
 
     packet_size = (uint32_t)*buffer_size;
@@ -4009,13 +4008,13 @@ static sai_status_t mlnx_send_hostif_packet(_In_ sai_object_id_t        hif_id,
 
         cl_plock_acquire(&g_sai_db_ptr->p_lock);
 
-        if (SAI_HOSTIF_OBJECT_TYPE_FD != g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].sub_type) {
+        if (SAI_HOSTIF_OBJECT_TYPE_FD != mlnx_hostif_db[mlnx_hif.id.u32].sub_type) {
             SX_LOG_ERR("Can't send on non FD host interface type %u\n", mlnx_hif.field.sub_type);
             cl_plock_release(&g_sai_db_ptr->p_lock);
             return SAI_STATUS_INVALID_PARAMETER;
         }
 
-        memcpy(&fd, &g_sai_db_ptr->hostif_db[mlnx_hif.id.u32].fd, sizeof(fd));
+        memcpy(&fd, &mlnx_hostif_db[mlnx_hif.id.u32].fd, sizeof(fd));
         cl_plock_release(&g_sai_db_ptr->p_lock);
     }
 
@@ -4051,6 +4050,38 @@ sai_status_t mlnx_hostif_trap_group_availability_get(_In_ sai_object_id_t
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_hostif_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    mlnx_object_id_t  mlnx_hif;
+    sai_object_key_t *key;
+    sai_status_t      status;
+    uint32_t          ii;
+
+    assert(keys);
+
+    for (ii = 0; ii < MLNX_HOSTIF_DB_SIZE; ii++) {
+        if (!mlnx_hostif_db[ii].is_used) {
+            continue;
+        }
+
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        memset(&mlnx_hif, 0, sizeof(mlnx_hif));
+        mlnx_hif.id.u32 = ii;
+
+        status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_HOSTIF, &mlnx_hif, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /* require sai_db read lock */
 static sai_status_t mlnx_hostif_table_entry_fill_sx_reg_key(sai_hostif_table_entry_type_t table_entry_type,
                                                             sai_object_id_t               port_vlan_lag,
@@ -4241,26 +4272,26 @@ static sai_status_t mlnx_hif_table_entry_fill_user_channel_by_hif_idx(
 
     switch (channel_type) {
     case SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_FD:
-        if (g_sai_db_ptr->hostif_db[hostif_idx].sub_type != SAI_HOSTIF_OBJECT_TYPE_FD) {
+        if (mlnx_hostif_db[hostif_idx].sub_type != SAI_HOSTIF_OBJECT_TYPE_FD) {
             SX_LOG_ERR("Can't set non FD host interface type %u\n",
-                       g_sai_db_ptr->hostif_db[hostif_idx].sub_type);
+                       mlnx_hostif_db[hostif_idx].sub_type);
             return SAI_STATUS_INVALID_PARAMETER;
         }
         user_channel->type = SX_USER_CHANNEL_TYPE_FD;
-        memcpy(&user_channel->channel.fd, &g_sai_db_ptr->hostif_db[hostif_idx].fd,
+        memcpy(&user_channel->channel.fd, &mlnx_hostif_db[hostif_idx].fd,
                sizeof(user_channel->channel.fd));
         break;
 
     case SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_GENETLINK:
-        if (g_sai_db_ptr->hostif_db[hostif_idx].sub_type != SAI_HOSTIF_OBJECT_TYPE_GENETLINK) {
+        if (mlnx_hostif_db[hostif_idx].sub_type != SAI_HOSTIF_OBJECT_TYPE_GENETLINK) {
             SX_LOG_ERR("Can't set non FD host interface type %u\n",
-                       g_sai_db_ptr->hostif_db[hostif_idx].sub_type);
+                       mlnx_hostif_db[hostif_idx].sub_type);
             return SAI_STATUS_INVALID_PARAMETER;
         }
 
         user_channel->type = SX_USER_CHANNEL_TYPE_PSAMPLE;
         user_channel->channel.psample_params.group_id =
-            g_sai_db_ptr->hostif_db[hostif_idx].psample_group.group_id;
+            mlnx_hostif_db[hostif_idx].psample_group.group_id;
         break;
 
     case SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_CB:
@@ -4671,7 +4702,7 @@ sai_status_t mlnx_create_hostif_table_entry(_Out_ sai_object_id_t      *hif_tabl
 
     if ((channel->s32 == SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_FD) ||
         (channel->s32 == SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_GENETLINK)) {
-        g_sai_db_ptr->hostif_db[mlnx_hif_oid.id.u32].refcount++;
+        mlnx_hostif_db[mlnx_hif_oid.id.u32].refcount++;
     }
 
     MLNX_LOG_OID_CREATED(*hif_table_entry);
@@ -4715,7 +4746,7 @@ sai_status_t mlnx_remove_hostif_table_entry(_In_ sai_object_id_t hif_table_entry
 
     if ((mlnx_hif.ext.hostif_table_entry.channel_type == SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_FD) ||
         (mlnx_hif.ext.hostif_table_entry.channel_type == SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_GENETLINK)) {
-        if (g_sai_db_ptr->hostif_db[mlnx_hif.ext.hostif_table_entry.hostif_db_idx].refcount == 0) {
+        if (mlnx_hostif_db[mlnx_hif.ext.hostif_table_entry.hostif_db_idx].refcount == 0) {
             SX_LOG_ERR("Invalid hostif index %d in table entry oid\n", mlnx_hif.ext.hostif_table_entry.hostif_db_idx);
             status = SAI_STATUS_FAILURE;
             goto out;
@@ -4825,7 +4856,7 @@ sai_status_t mlnx_remove_hostif_table_entry(_In_ sai_object_id_t hif_table_entry
 
     if ((mlnx_hif.ext.hostif_table_entry.channel_type == SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_FD) ||
         (mlnx_hif.ext.hostif_table_entry.channel_type == SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_GENETLINK)) {
-        g_sai_db_ptr->hostif_db[mlnx_hif.ext.hostif_table_entry.hostif_db_idx].refcount--;
+        mlnx_hostif_db[mlnx_hif.ext.hostif_table_entry.hostif_db_idx].refcount--;
     }
 
     if (entry_type == SAI_HOSTIF_TABLE_ENTRY_TYPE_VLAN) {
@@ -5023,14 +5054,14 @@ static sai_status_t mlnx_table_entry_hostif_get(_In_ const sai_object_key_t   *k
         goto out;
     }
 
-    if ((mlnx_hif_table.ext.hostif_table_entry.hostif_db_idx >= MAX_HOSTIFS)) {
+    if ((mlnx_hif_table.ext.hostif_table_entry.hostif_db_idx >= MLNX_HOSTIF_DB_SIZE)) {
         SX_LOG_ERR("Invalid hostif object id - hostif db index %d\n",
                    mlnx_hif_table.ext.hostif_table_entry.hostif_db_idx);
         status = SAI_STATUS_INVALID_PARAMETER;
         goto out;
     }
 
-    if (g_sai_db_ptr->hostif_db[mlnx_hif_table.ext.hostif_table_entry.hostif_db_idx].refcount == 0) {
+    if (mlnx_hostif_db[mlnx_hif_table.ext.hostif_table_entry.hostif_db_idx].refcount == 0) {
         SX_LOG_ERR("Hostif idx %d is not used for table entry\n", mlnx_hif_table.ext.hostif_table_entry.hostif_db_idx);
         status = SAI_STATUS_INVALID_PARAMETER;
         goto out;
@@ -197,6 +197,9 @@ sai_status_t sai_log_set_eth(_In_ sai_api_t sai_api_id, sx_log_severity_t severi
         mlnx_utils_log_set(severity);
         mlnx_utils_eth_log_set(severity);
         mlnx_issu_storage_log_set(severity);
+        mlnx_stats_cache_log_set(severity);
+        mlnx_api_stats_log_set(severity);
+        mlnx_sdk_trace_log_set(severity);
         mlnx_object_eth_log_set(severity);
         return mlnx_object_log_set(severity);
 
@@ -447,6 +450,10 @@ sai_status_t sai_dbg_do_dump(_In_ const char *dump_file_name)
 
     SAI_dump_nh(file);
 
+    SAI_dump_api_stats(file);
+
+    SAI_dump_shm(file);
+
     fclose(file);
 
 #ifndef _WIN32
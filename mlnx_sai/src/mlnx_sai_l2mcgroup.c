@@ -24,8 +24,12 @@
 #define __MODULE__ SAI_L2MC_GROUP
 
 #define l2mc_group_ptr_to_db_idx(ptr)        ((uint32_t)((ptr) - g_sai_db_ptr->l2mc_groups))
-#define l2mc_group_member_ptr_to_db_idx(ptr) ((uint32_t)((ptr) - g_sai_db_ptr->l2mc_group_members))
+#define l2mc_group_member_ptr_to_db_idx(ptr) ((uint32_t)((ptr) - mlnx_l2mc_group_members_db))
 #define IS_L2MC_GROUP_MEMBER_TUNNEL(bport)   ((bport)->port_type == SAI_BRIDGE_PORT_TYPE_TUNNEL)
+#define l2mc_group_member_by_link(link)      ((link) ? &l2mc_group_member_db((link) - 1) : NULL)
+#define mlnx_l2mc_group_member_foreach(group, member)                         \
+    for (member = l2mc_group_member_by_link((group)->members_head); (member); \
+         member = l2mc_group_member_by_link((member)->next))
 
 static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
 static sai_status_t mlnx_l2mcgroup_attrib_get(_In_ const sai_object_key_t   *key,
@@ -193,24 +197,32 @@ static sai_status_t mlnx_l2mc_group_db_free(_Out_ mlnx_l2mc_group_t *l2mc_group)
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Freed entries are kept in a list linked through 'next', entries above the watermark were never used
+ */
 static sai_status_t mlnx_l2mc_group_member_db_alloc(_Out_ mlnx_l2mc_group_member_t **l2mc_group_member)
 {
     uint32_t ii;
 
     assert(l2mc_group_member);
 
-    for (ii = 0; ii < MLNX_L2MC_GROUP_MEMBER_DB_SIZE; ii++) {
-        if (!l2mc_group_member_db(ii).is_used) {
-            memset(&l2mc_group_member_db(ii), 0, sizeof(l2mc_group_member_db(ii)));
-            l2mc_group_member_db(ii).is_used = true;
-
-            *l2mc_group_member = &l2mc_group_member_db(ii);
-            return SAI_STATUS_SUCCESS;
-        }
+    if (g_sai_db_ptr->l2mc_group_members_free_head) {
+        ii = g_sai_db_ptr->l2mc_group_members_free_head - 1;
+        g_sai_db_ptr->l2mc_group_members_free_head = l2mc_group_member_db(ii).next;
+    } else if (g_sai_db_ptr->l2mc_group_members_watermark < MLNX_L2MC_GROUP_MEMBER_DB_SIZE) {
+        ii = g_sai_db_ptr->l2mc_group_members_watermark++;
+    } else {
+        SX_LOG_ERR("Failed to allocate L2 MC group member in DB - DB is full\n");
+        return SAI_STATUS_INSUFFICIENT_RESOURCES;
     }
 
-    SX_LOG_ERR("Failed to allocate L2 MC group member in DB - DB is full\n");
-    return SAI_STATUS_INSUFFICIENT_RESOURCES;
+    assert(!l2mc_group_member_db(ii).is_used);
+
+    memset(&l2mc_group_member_db(ii), 0, sizeof(l2mc_group_member_db(ii)));
+    l2mc_group_member_db(ii).is_used = true;
+
+    *l2mc_group_member = &l2mc_group_member_db(ii);
+    return SAI_STATUS_SUCCESS;
 }
 
 static sai_status_t mlnx_l2mc_group_member_db_free(_Out_ mlnx_l2mc_group_member_t *l2mc_group_member)
@@ -219,9 +231,46 @@ static sai_status_t mlnx_l2mc_group_member_db_free(_Out_ mlnx_l2mc_group_member_
 
     l2mc_group_member->is_used = false;
 
+    l2mc_group_member->next = g_sai_db_ptr->l2mc_group_members_free_head;
+    g_sai_db_ptr->l2mc_group_members_free_head = l2mc_group_member_ptr_to_db_idx(l2mc_group_member) + 1;
+
     return SAI_STATUS_SUCCESS;
 }
 
+static void mlnx_l2mc_group_member_link(_In_ mlnx_l2mc_group_t *l2mc_group, _In_ mlnx_l2mc_group_member_t *member)
+{
+    uint32_t member_link = l2mc_group_member_ptr_to_db_idx(member) + 1;
+
+    member->prev = 0;
+    member->next = l2mc_group->members_head;
+
+    if (l2mc_group->members_head) {
+        l2mc_group_member_by_link(l2mc_group->members_head)->prev = member_link;
+    }
+
+    l2mc_group->members_head = member_link;
+    l2mc_group->members_count++;
+}
+
+static void mlnx_l2mc_group_member_unlink(_In_ mlnx_l2mc_group_t *l2mc_group, _In_ mlnx_l2mc_group_member_t *member)
+{
+    assert(l2mc_group->members_count > 0);
+
+    if (member->prev) {
+        l2mc_group_member_by_link(member->prev)->next = member->next;
+    } else {
+        l2mc_group->members_head = member->next;
+    }
+
+    if (member->next) {
+        l2mc_group_member_by_link(member->next)->prev = member->prev;
+    }
+
+    member->next = 0;
+    member->prev = 0;
+    l2mc_group->members_count--;
+}
+
 sai_status_t mlnx_l2mc_group_oid_create(_In_ const mlnx_l2mc_group_t *l2mc_group, _Out_ sai_object_id_t *oid)
 {
     mlnx_object_id_t *moid;
@@ -239,20 +288,36 @@ sai_status_t mlnx_l2mc_group_oid_create(_In_ const mlnx_l2mc_group_t *l2mc_group
     return SAI_STATUS_SUCCESS;
 }
 
+/* Bridge ports of the group port members (the ones in the ports mc container) */
 static sai_status_t mlnx_l2mc_group_bports_get(_In_ const mlnx_l2mc_group_t *l2mc_group,
                                                _Out_ mlnx_bridge_port_t    **bports,
                                                _Inout_ uint32_t             *bports_count)
 {
-    sai_status_t     status;
-    sx_port_log_id_t sx_ports[MAX_BRIDGE_1Q_PORTS] = {0};
-    uint32_t         ports_count = MAX_BRIDGE_1Q_PORTS, ii;
+    sai_status_t                    status;
+    const mlnx_l2mc_group_member_t *member;
+    mlnx_bridge_port_t             *bport;
+    uint32_t                        ports_count = 0;
 
     assert(l2mc_group);
     assert(bports);
+    assert(bports_count);
 
-    status = mlnx_l2mc_group_sx_ports_get(l2mc_group, sx_ports, &ports_count);
-    if (SAI_ERR(status)) {
-        return status;
+    mlnx_l2mc_group_member_foreach(l2mc_group, member) {
+        status = mlnx_bridge_port_by_idx(member->bport_db_idx, &bport);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to find bridge port %u of L2 MC group member %u\n", member->bport_db_idx,
+                       l2mc_group_member_ptr_to_db_idx(member));
+            return SAI_STATUS_FAILURE;
+        }
+
+        if (IS_L2MC_GROUP_MEMBER_TUNNEL(bport)) {
+            continue;
+        }
+
+        if (ports_count < *bports_count) {
+            bports[ports_count] = bport;
+        }
+        ports_count++;
     }
 
     if (*bports_count < ports_count) {
@@ -261,15 +326,6 @@ static sai_status_t mlnx_l2mc_group_bports_get(_In_ const mlnx_l2mc_group_t *l2m
         return SAI_STATUS_BUFFER_OVERFLOW;
     }
 
-    for (ii = 0; ii < ports_count; ii++) {
-        status = mlnx_bridge_port_by_log(sx_ports[ii], &bports[ii]);
-        if (SAI_ERR(status)) {
-            SX_LOG_ERR("Failed to find bridge port for log port %x in mc container %x\n",
-                       sx_ports[ii], l2mc_group->mc_container_ports);
-            return SAI_STATUS_FAILURE;
-        }
-    }
-
     *bports_count = ports_count;
 
     return SAI_STATUS_SUCCESS;
@@ -321,58 +377,47 @@ sai_status_t mlnx_l2mc_group_oid_to_db_idx(_In_ sai_object_id_t oid, _Out_ uint3
     return SAI_STATUS_SUCCESS;
 }
 
+/* Built from the group member list, which mirrors the content of the ports mc container */
 sai_status_t mlnx_l2mc_group_sx_ports_get(_In_ const mlnx_l2mc_group_t *l2mc_group,
                                           _Out_ sx_port_log_id_t       *sx_ports,
                                           _Inout_ uint32_t             *ports_count)
 {
-    sx_status_t                  sx_status;
-    sx_mc_container_attributes_t sx_mc_container_attributes;
-    sx_mc_next_hop_t            *sx_next_hops = NULL;
-    uint32_t                     next_hops_count = MAX_BRIDGE_1Q_PORTS, ii;
-    sx_status_t                  status = SAI_STATUS_SUCCESS;
+    const mlnx_l2mc_group_member_t *member;
+    mlnx_bridge_port_t             *bport;
+    sai_status_t                    status;
+    uint32_t                        count = 0;
 
     assert(l2mc_group);
     assert(sx_ports);
     assert(*ports_count >= MAX_BRIDGE_1Q_PORTS);
 
-    memset(&sx_mc_container_attributes, 0, sizeof(sx_mc_container_attributes));
-    sx_next_hops = (sx_mc_next_hop_t*)malloc(sizeof(sx_mc_next_hop_t) * MAX_BRIDGE_1Q_PORTS);
-
-    if (!sx_next_hops) {
-        SX_LOG_ERR("Can't allocate memory\n");
-        status = SAI_STATUS_NO_MEMORY;
-        goto out;
-    }
+    mlnx_l2mc_group_member_foreach(l2mc_group, member) {
+        status = mlnx_bridge_port_by_idx(member->bport_db_idx, &bport);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to find bridge port %u of L2 MC group member %u\n", member->bport_db_idx,
+                       l2mc_group_member_ptr_to_db_idx(member));
+            return SAI_STATUS_FAILURE;
+        }
 
-    sx_status = sx_api_mc_container_get(gh_sdk,
-                                        SX_ACCESS_CMD_GET,
-                                        l2mc_group->mc_container_ports,
-                                        sx_next_hops,
-                                        &next_hops_count,
-                                        &sx_mc_container_attributes);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to get ports from sx_mc_container %x - %s\n", l2mc_group->mc_container_ports,
-                   SX_STATUS_MSG(sx_status));
-        status = sdk_to_sai(sx_status);
-        goto out;
-    }
+        if (IS_L2MC_GROUP_MEMBER_TUNNEL(bport)) {
+            continue;
+        }
 
-    if (*ports_count < next_hops_count) {
-        SX_LOG_ERR("sx_ports array size %u < %u\n", *ports_count, next_hops_count);
-        *ports_count = next_hops_count;
-        status = SAI_STATUS_BUFFER_OVERFLOW;
-        goto out;
+        if (count < *ports_count) {
+            sx_ports[count] = bport->logical;
+        }
+        count++;
     }
 
-    for (ii = 0; ii < next_hops_count; ii++) {
-        sx_ports[ii] = sx_next_hops[ii].data.log_port;
+    if (*ports_count < count) {
+        SX_LOG_ERR("sx_ports array size %u < %u\n", *ports_count, count);
+        *ports_count = count;
+        return SAI_STATUS_BUFFER_OVERFLOW;
     }
 
-    *ports_count = next_hops_count;
+    *ports_count = count;
 
-out:
-    free(sx_next_hops);
-    return status;
+    return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_l2mc_group_to_pbs_info(_In_ const mlnx_l2mc_group_t *l2mc_group,
@@ -467,10 +512,6 @@ void mlnx_l2mc_group_flood_ctrl_ref_dec(_In_ uint32_t group_db_idx)
 
 static sai_status_t mlnx_l2mc_group_is_in_use(_In_ mlnx_l2mc_group_t *l2mc_group, _Out_ bool *is_in_use)
 {
-    sx_status_t                  sx_status;
-    sx_mc_container_attributes_t sx_mc_container_attributes;
-    uint32_t                     tunnel_count = 0, ports_count = 0, members = 0;
-
     assert(l2mc_group);
     assert(is_in_use);
 
@@ -486,38 +527,8 @@ static sai_status_t mlnx_l2mc_group_is_in_use(_In_ mlnx_l2mc_group_t *l2mc_group
         return SAI_STATUS_SUCCESS;
     }
 
-    if (SX_MC_CONTAINER_ID_CHECK_RANGE(l2mc_group->mc_container_tunnels)) {
-        memset(&sx_mc_container_attributes, 0, sizeof(sx_mc_container_attributes));
-        sx_status = sx_api_mc_container_get(gh_sdk,
-                                            SX_ACCESS_CMD_GET,
-                                            l2mc_group->mc_container_tunnels,
-                                            NULL,
-                                            &tunnel_count,
-                                            &sx_mc_container_attributes);
-        if (SX_ERR(sx_status)) {
-            SX_LOG_ERR("Failed to get next hops count from sx_mc_container %x - %s\n",
-                       l2mc_group->mc_container_tunnels,
-                       SX_STATUS_MSG(sx_status));
-            return sdk_to_sai(sx_status);
-        }
-    }
-
-    memset(&sx_mc_container_attributes, 0, sizeof(sx_mc_container_attributes));
-    sx_status = sx_api_mc_container_get(gh_sdk,
-                                        SX_ACCESS_CMD_GET,
-                                        l2mc_group->mc_container_ports,
-                                        NULL,
-                                        &ports_count,
-                                        &sx_mc_container_attributes);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to get next hops count from sx_mc_container %x - %s\n", l2mc_group->mc_container_ports,
-                   SX_STATUS_MSG(sx_status));
-        return sdk_to_sai(sx_status);
-    }
-
-
-    if ((members = tunnel_count + ports_count) > 0) {
-        SX_LOG_ERR("L2 MC group has %d member(s)\n", members);
+    if (l2mc_group->members_count > 0) {
+        SX_LOG_ERR("L2 MC group has %d member(s)\n", l2mc_group->members_count);
         *is_in_use = true;
         return SAI_STATUS_SUCCESS;
     }
@@ -600,41 +611,60 @@ static sai_status_t mlnx_l2mc_group_member_oid_to_sai(_In_ sai_object_id_t
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_l2mc_sx_container_ports_update(_In_ mlnx_l2mc_group_t        *l2mc_group,
-                                                        _In_ const mlnx_bridge_port_t *bport,
-                                                        _In_ bool                      add)
+static sai_status_t mlnx_l2mc_sx_container_ports_update(_In_ mlnx_l2mc_group_t      *l2mc_group,
+                                                        _In_ const sx_port_log_id_t *sx_ports,
+                                                        _In_ uint32_t                ports_count,
+                                                        _In_ bool                    add)
 {
+    sai_status_t                 status = SAI_STATUS_SUCCESS;
     sx_status_t                  sx_status;
     sx_access_cmd_t              sx_cmd;
     sx_mc_container_attributes_t sx_mc_container_attributes;
-    sx_mc_next_hop_t             sx_mc_next_hop;
+    sx_mc_next_hop_t             sx_mc_next_hop, *sx_mc_next_hops = &sx_mc_next_hop;
+    uint32_t                     ii;
 
     assert(l2mc_group);
-    assert(bport);
-    assert(!IS_L2MC_GROUP_MEMBER_TUNNEL(bport));
+    assert(sx_ports);
+    assert(ports_count > 0);
+
+    if (ports_count > 1) {
+        sx_mc_next_hops = calloc(ports_count, sizeof(*sx_mc_next_hops));
+        if (!sx_mc_next_hops) {
+            SX_LOG_ERR("Failed to allocate memory\n");
+            return SAI_STATUS_NO_MEMORY;
+        }
+    } else {
+        memset(&sx_mc_next_hop, 0, sizeof(sx_mc_next_hop));
+    }
 
     memset(&sx_mc_container_attributes, 0, sizeof(sx_mc_container_attributes));
-    memset(&sx_mc_next_hop, 0, sizeof(sx_mc_next_hop));
 
     sx_cmd = add ? SX_ACCESS_CMD_ADD : SX_ACCESS_CMD_DELETE;
 
     sx_mc_container_attributes.type = SX_MC_CONTAINER_TYPE_PORT;
-    sx_mc_next_hop.type = SX_MC_NEXT_HOP_TYPE_LOG_PORT;
-    sx_mc_next_hop.data.log_port = bport->logical;
+
+    for (ii = 0; ii < ports_count; ii++) {
+        sx_mc_next_hops[ii].type = SX_MC_NEXT_HOP_TYPE_LOG_PORT;
+        sx_mc_next_hops[ii].data.log_port = sx_ports[ii];
+    }
 
     sx_status = sx_api_mc_container_set(gh_sdk,
                                         sx_cmd,
                                         &l2mc_group->mc_container_ports,
-                                        &sx_mc_next_hop,
-                                        1,
+                                        sx_mc_next_hops,
+                                        ports_count,
                                         &sx_mc_container_attributes);
     if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to %s port %x, sx_mc_container %x - %s\n", SX_ACCESS_CMD_STR(sx_cmd), bport->logical,
-                   l2mc_group->mc_container_ports, SX_STATUS_MSG(sx_status));
-        return sdk_to_sai(sx_status);
+        SX_LOG_ERR("Failed to %s %u port(s) (first %x), sx_mc_container %x - %s\n", SX_ACCESS_CMD_STR(sx_cmd),
+                   ports_count, sx_ports[0], l2mc_group->mc_container_ports, SX_STATUS_MSG(sx_status));
+        status = sdk_to_sai(sx_status);
     }
 
-    return SAI_STATUS_SUCCESS;
+    if (sx_mc_next_hops != &sx_mc_next_hop) {
+        free(sx_mc_next_hops);
+    }
+
+    return status;
 }
 
 static sai_status_t mlnx_l2mc_sx_container_tunnels_update(_In_ mlnx_l2mc_group_t        *l2mc_group,
@@ -737,18 +767,18 @@ static sai_status_t mlnx_l2mc_sx_container_tunnels_update(_In_ mlnx_l2mc_group_t
     return sai_status;
 }
 
-static sai_status_t mlnx_l2mc_sx_pbs_update(_In_ mlnx_l2mc_group_t        *l2mc_group,
-                                            _In_ const mlnx_bridge_port_t *bport,
-                                            _In_ bool                      add)
+static sai_status_t mlnx_l2mc_sx_pbs_update(_In_ mlnx_l2mc_group_t      *l2mc_group,
+                                            _In_ const sx_port_log_id_t *sx_ports,
+                                            _In_ uint32_t                ports_count,
+                                            _In_ bool                    add)
 {
     sx_status_t        sx_status;
-    sx_port_log_id_t   sx_port;
     sx_acl_pbs_id_t    sx_pbs;
     sx_access_cmd_t    sx_cmd;
     sx_acl_pbs_entry_t sx_pbs_entry;
 
     assert(l2mc_group);
-    assert(bport);
+    assert(sx_ports);
 
     if (l2mc_group->pbs_entry.ref_counter == 0) {
         return SAI_STATUS_SUCCESS;
@@ -758,21 +788,20 @@ static sai_status_t mlnx_l2mc_sx_pbs_update(_In_ mlnx_l2mc_group_t        *l2mc_
 
     memset(&sx_pbs_entry, 0, sizeof(sx_pbs_entry));
 
-    sx_port = bport->logical;
     sx_cmd = add ? SX_ACCESS_CMD_ADD_PORTS : SX_ACCESS_CMD_DELETE_PORTS;
 
     sx_pbs_entry.entry_type = SX_ACL_PBS_ENTRY_TYPE_MULTICAST;
-    sx_pbs_entry.port_num = 1;
-    sx_pbs_entry.log_ports = &sx_port;
+    sx_pbs_entry.port_num = ports_count;
+    sx_pbs_entry.log_ports = (sx_port_log_id_t*)sx_ports;
 
     sx_status = sx_api_acl_policy_based_switching_set(gh_sdk, sx_cmd, DEFAULT_ETH_SWID, &sx_pbs_entry, &sx_pbs);
     if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed to %s port %x to pbs %x - %s\n", SX_ACCESS_CMD_STR(sx_cmd), sx_port, sx_pbs,
-                   SX_STATUS_MSG(sx_status));
+        SX_LOG_ERR("Failed to %s %u port(s) (first %x) to pbs %x - %s\n", SX_ACCESS_CMD_STR(sx_cmd), ports_count,
+                   sx_ports[0], sx_pbs, SX_STATUS_MSG(sx_status));
         return sdk_to_sai(sx_status);
     }
 
-    SX_LOG_NTC("Added port %x to PBS %x\n", sx_port, sx_pbs);
+    SX_LOG_NTC("%s %u port(s) (first %x) to PBS %x\n", SX_ACCESS_CMD_STR(sx_cmd), ports_count, sx_ports[0], sx_pbs);
 
     return SAI_STATUS_SUCCESS;
 }
@@ -995,12 +1024,12 @@ static sai_status_t mlnx_l2mc_group_update(_In_ mlnx_l2mc_group_t        *l2mc_g
     switch (bport->port_type) {
     case SAI_BRIDGE_PORT_TYPE_PORT:
     case SAI_BRIDGE_PORT_TYPE_SUB_PORT:
-        status = mlnx_l2mc_sx_container_ports_update(l2mc_group, bport, add);
+        status = mlnx_l2mc_sx_container_ports_update(l2mc_group, &bport->logical, 1, add);
         if (SAI_ERR(status)) {
             return status;
         }
 
-        status = mlnx_l2mc_sx_pbs_update(l2mc_group, bport, add);
+        status = mlnx_l2mc_sx_pbs_update(l2mc_group, &bport->logical, 1, add);
         if (SAI_ERR(status)) {
             return status;
         }
@@ -1050,13 +1079,6 @@ static sai_status_t mlnx_l2mcgroup_member_add(_In_ mlnx_l2mc_group_t        *l2m
         return status;
     }
 
-    if ((bport->port_type != SAI_BRIDGE_PORT_TYPE_PORT) && (bport->port_type != SAI_BRIDGE_PORT_TYPE_SUB_PORT) &&
-        (bport->port_type != SAI_BRIDGE_PORT_TYPE_TUNNEL)) {
-        SX_LOG_ERR("Only SAI_BRIDGE_PORT_TYPE_PORT/SUB_PORT/TUNNEL is supported, but %s received\n",
-                   SAI_TYPE_STR(bport->port_type));
-        return SAI_STATUS_NOT_SUPPORTED;
-    }
-
     status = mlnx_l2mc_group_update(l2mc_group, l2mc_group_member, true);
     if (SAI_ERR(status)) {
         return status;
@@ -1205,11 +1227,12 @@ static sai_status_t mlnx_l2mcgroup_attrib_get(_In_ const sai_object_key_t   *key
                                               _Inout_ vendor_cache_t        *cache,
                                               void                          *arg)
 {
-    sai_status_t          status;
-    sai_l2mc_group_attr_t attr;
-    mlnx_l2mc_group_t    *l2mc_group;
-    sai_object_id_t      *l2mc_group_members = NULL;
-    uint32_t              l2mc_group_members_count = 0, ii = 0, it = 0;
+    sai_status_t              status;
+    sai_l2mc_group_attr_t     attr;
+    mlnx_l2mc_group_t        *l2mc_group;
+    sai_object_id_t          *l2mc_group_members = NULL;
+    mlnx_l2mc_group_member_t *member;
+    uint32_t                  l2mc_group_members_count = 0, it = 0;
 
     SX_LOG_ENTER();
 
@@ -1228,25 +1251,21 @@ static sai_status_t mlnx_l2mcgroup_attrib_get(_In_ const sai_object_key_t   *key
         goto out;
     }
 
-    for (ii = 0; ii < MLNX_L2MC_GROUP_MEMBER_DB_SIZE; ii++) {
-        if (l2mc_group_member_db(ii).is_used &&
-            (l2mc_group_member_db(ii).l2mc_group_db_idx == l2mc_group_ptr_to_db_idx(l2mc_group))) {
-            l2mc_group_members_count++;
-        }
-    }
+    l2mc_group_members_count = l2mc_group->members_count;
 
     l2mc_group_members = malloc(l2mc_group_members_count * sizeof(sai_object_id_t));
+    if ((l2mc_group_members_count > 0) && !l2mc_group_members) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
 
-    for (ii = 0; ii < l2mc_group_members_count; ++ii) {
-        if (l2mc_group_member_db(ii).is_used &&
-            (l2mc_group_member_db(ii).l2mc_group_db_idx == l2mc_group_ptr_to_db_idx(l2mc_group))) {
-            status = mlnx_l2mc_group_member_sai_to_oid(&l2mc_group_member_db(ii),
-                                                       &l2mc_group_members[it]);
-            ++it;
+    mlnx_l2mc_group_member_foreach(l2mc_group, member) {
+        status = mlnx_l2mc_group_member_sai_to_oid(member, &l2mc_group_members[it]);
+        ++it;
 
-            if (SAI_ERR(status)) {
-                goto out;
-            }
+        if (SAI_ERR(status)) {
+            goto out;
         }
     }
 
@@ -1271,42 +1290,32 @@ static sai_status_t mlnx_get_l2mc_group_attribute(_In_ sai_object_id_t     l2mc_
     return sai_get_attributes(&key, SAI_OBJECT_TYPE_L2MC_GROUP, attr_count, attr_list);
 }
 
-/**
- * @brief Create L2MC group member
- *
- * @param[out] l2mc_group_member_id L2MC group member id
- * @param[in] switch_id Switch ID
- * @param[in] attr_count Number of attributes
- * @param[in] attr_list Array of attributes
- *
- * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+/*
+ * Validates the create attributes, allocates a member for them and links it to the group.
+ * SAI DB write lock is expected to be held
  */
-static sai_status_t mlnx_create_l2mc_group_member(_Out_ sai_object_id_t      *l2mc_group_member_id,
-                                                  _In_ sai_object_id_t        switch_id,
-                                                  _In_ uint32_t               attr_count,
-                                                  _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_l2mc_group_member_prepare(_In_ uint32_t                    attr_count,
+                                                   _In_ const sai_attribute_t      *attr_list,
+                                                   _Out_ mlnx_l2mc_group_t        **l2mc_group,
+                                                   _Out_ mlnx_l2mc_group_member_t **l2mc_group_member,
+                                                   _Out_ mlnx_bridge_port_t       **bport)
 {
     sai_status_t                 status;
     const sai_attribute_value_t *attr_group_id = NULL, *attr_output_id = NULL, *attr_endpoint_ip = NULL;
-    mlnx_l2mc_group_t           *l2mc_group = NULL;
-    mlnx_l2mc_group_member_t    *l2mc_group_member = NULL;
-    mlnx_bridge_port_t          *bport;
+    mlnx_l2mc_group_member_t    *member;
     uint32_t                     attr_index;
 
-    SX_LOG_ENTER();
+    assert(l2mc_group);
+    assert(l2mc_group_member);
+    assert(bport);
 
-    status = check_attribs_on_create(attr_count, attr_list, SAI_OBJECT_TYPE_L2MC_GROUP_MEMBER, l2mc_group_member_id);
-    if (SAI_ERR(status)) {
-        return status;
-    }
-    MLNX_LOG_ATTRS(attr_count, attr_list, SAI_OBJECT_TYPE_L2MC_GROUP_MEMBER);
+    *l2mc_group_member = NULL;
 
     find_attrib_in_list(attr_count, attr_list, SAI_L2MC_GROUP_MEMBER_ATTR_L2MC_GROUP_ID, &attr_group_id, &attr_index);
     assert(attr_group_id);
 
-    status = mlnx_l2mc_group_oid_to_sai(attr_group_id->oid, &l2mc_group);
+    status = mlnx_l2mc_group_oid_to_sai(attr_group_id->oid, l2mc_group);
     if (SAI_ERR(status)) {
-        SX_LOG_EXIT();
         return SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_index;
     }
 
@@ -1314,10 +1323,17 @@ static sai_status_t mlnx_create_l2mc_group_member(_Out_ sai_object_id_t      *l2
                         &attr_index);
     assert(attr_output_id);
 
-    status = mlnx_bridge_port_by_oid(attr_output_id->oid, &bport);
+    status = mlnx_bridge_port_by_oid(attr_output_id->oid, bport);
     if (SAI_ERR(status)) {
-        status = SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_index;
-        goto out;
+        return SAI_STATUS_INVALID_ATTR_VALUE_0 + attr_index;
+    }
+
+    if (((*bport)->port_type != SAI_BRIDGE_PORT_TYPE_PORT) &&
+        ((*bport)->port_type != SAI_BRIDGE_PORT_TYPE_SUB_PORT) &&
+        ((*bport)->port_type != SAI_BRIDGE_PORT_TYPE_TUNNEL)) {
+        SX_LOG_ERR("Only SAI_BRIDGE_PORT_TYPE_PORT/SUB_PORT/TUNNEL is supported, but %s received\n",
+                   SAI_TYPE_STR((*bport)->port_type));
+        return SAI_STATUS_NOT_SUPPORTED;
     }
 
     find_attrib_in_list(attr_count,
@@ -1326,31 +1342,73 @@ static sai_status_t mlnx_create_l2mc_group_member(_Out_ sai_object_id_t      *l2
                         &attr_endpoint_ip,
                         &attr_index);
 
-    sai_db_write_lock();
-
-    if (!IS_L2MC_GROUP_MEMBER_TUNNEL(bport) && (NULL != attr_endpoint_ip)) {
-        SX_LOG_ERR("Endpoint IP shouldn't be passed because bridge port %d isn't tunnel port\n", bport->index);
-        status = SAI_STATUS_INVALID_PARAMETER;
-        goto out;
-    } else if (IS_L2MC_GROUP_MEMBER_TUNNEL(bport) && (NULL == attr_endpoint_ip)) {
-        SX_LOG_ERR("Endpoint IP should be passed because bridge port %d is tunnel port\n", bport->index);
-        status = SAI_STATUS_INVALID_PARAMETER;
-        goto out;
+    if (!IS_L2MC_GROUP_MEMBER_TUNNEL(*bport) && (NULL != attr_endpoint_ip)) {
+        SX_LOG_ERR("Endpoint IP shouldn't be passed because bridge port %d isn't tunnel port\n", (*bport)->index);
+        return SAI_STATUS_INVALID_PARAMETER;
+    } else if (IS_L2MC_GROUP_MEMBER_TUNNEL(*bport) && (NULL == attr_endpoint_ip)) {
+        SX_LOG_ERR("Endpoint IP should be passed because bridge port %d is tunnel port\n", (*bport)->index);
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = mlnx_l2mc_group_member_db_alloc(&l2mc_group_member);
+    status = mlnx_l2mc_group_member_db_alloc(&member);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_l2mc_group_oid_to_db_idx(attr_group_id->oid, &l2mc_group_member->l2mc_group_db_idx);
+    member->l2mc_group_db_idx = l2mc_group_ptr_to_db_idx(*l2mc_group);
+    member->bport_db_idx = (*bport)->index;
+    if (IS_L2MC_GROUP_MEMBER_TUNNEL(*bport)) {
+        memcpy(&member->endpoint_ip, &attr_endpoint_ip->ipaddr, sizeof(member->endpoint_ip));
+    }
+
+    /* Linked before the SDK update so the group port list used for flood control already has the member */
+    mlnx_l2mc_group_member_link(*l2mc_group, member);
+
+    *l2mc_group_member = member;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_l2mc_group_member_release(_In_ mlnx_l2mc_group_t        *l2mc_group,
+                                           _In_ mlnx_l2mc_group_member_t *l2mc_group_member)
+{
+    mlnx_l2mc_group_member_unlink(l2mc_group, l2mc_group_member);
+    mlnx_l2mc_group_member_db_free(l2mc_group_member);
+}
+
+/**
+ * @brief Create L2MC group member
+ *
+ * @param[out] l2mc_group_member_id L2MC group member id
+ * @param[in] switch_id Switch ID
+ * @param[in] attr_count Number of attributes
+ * @param[in] attr_list Array of attributes
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+static sai_status_t mlnx_create_l2mc_group_member(_Out_ sai_object_id_t      *l2mc_group_member_id,
+                                                  _In_ sai_object_id_t        switch_id,
+                                                  _In_ uint32_t               attr_count,
+                                                  _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t              status;
+    mlnx_l2mc_group_t        *l2mc_group = NULL;
+    mlnx_l2mc_group_member_t *l2mc_group_member = NULL;
+    mlnx_bridge_port_t       *bport;
+
+    SX_LOG_ENTER();
+
+    status = check_attribs_on_create(attr_count, attr_list, SAI_OBJECT_TYPE_L2MC_GROUP_MEMBER, l2mc_group_member_id);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
+    MLNX_LOG_ATTRS(attr_count, attr_list, SAI_OBJECT_TYPE_L2MC_GROUP_MEMBER);
 
-    l2mc_group_member->bport_db_idx = bport->index;
-    if (IS_L2MC_GROUP_MEMBER_TUNNEL(bport)) {
-        memcpy(&l2mc_group_member->endpoint_ip, &attr_endpoint_ip->ipaddr, sizeof(l2mc_group_member->endpoint_ip));
+    sai_db_write_lock();
+
+    status = mlnx_l2mc_group_member_prepare(attr_count, attr_list, &l2mc_group, &l2mc_group_member, &bport);
+    if (SAI_ERR(status)) {
+        goto out;
     }
 
     status = mlnx_l2mcgroup_member_add(l2mc_group, l2mc_group_member);
@@ -1367,7 +1425,7 @@ static sai_status_t mlnx_create_l2mc_group_member(_Out_ sai_object_id_t      *l2
 
 out:
     if (SAI_ERR(status) && (NULL != l2mc_group_member)) {
-        mlnx_l2mc_group_member_db_free(l2mc_group_member);
+        mlnx_l2mc_group_member_release(l2mc_group, l2mc_group_member);
     }
     sai_db_unlock();
     SX_LOG_EXIT();
@@ -1399,9 +1457,12 @@ static sai_status_t mlnx_remove_l2mc_group_member(_In_ sai_object_id_t l2mc_grou
         goto out;
     }
 
+    mlnx_l2mc_group_member_unlink(l2mc_group, l2mc_group_member);
+
     status = mlnx_l2mcgroup_member_del(l2mc_group, l2mc_group_member);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to remove L2 MC group member %lx\n", l2mc_group_member_id);
+        mlnx_l2mc_group_member_link(l2mc_group, l2mc_group_member);
         goto out;
     }
 
@@ -1413,7 +1474,389 @@ static sai_status_t mlnx_remove_l2mc_group_member(_In_ sai_object_id_t l2mc_grou
 out:
     SX_LOG_EXIT();
     sai_db_unlock();
-    return SAI_STATUS_SUCCESS;
+    return status;
+}
+
+static bool mlnx_l2mc_group_member_is_linked(_In_ const mlnx_l2mc_group_t        *l2mc_group,
+                                             _In_ const mlnx_l2mc_group_member_t *l2mc_group_member)
+{
+    return (l2mc_group_member->prev != 0) ||
+           (l2mc_group->members_head == l2mc_group_member_ptr_to_db_idx(l2mc_group_member) + 1);
+}
+
+/*
+ * Adds or removes the port members collected for one group (batch_head/batch_next are object index + 1 lists)
+ * with a single mc container and PBS update. The members are already linked (add) or unlinked (remove).
+ */
+static sai_status_t mlnx_l2mc_group_members_batch_update(_In_ mlnx_l2mc_group_t         *l2mc_group,
+                                                         _In_ mlnx_l2mc_group_member_t **members,
+                                                         _In_ uint32_t                   batch_head,
+                                                         _In_ const uint32_t            *batch_next,
+                                                         _In_ sx_port_log_id_t          *sx_ports,
+                                                         _In_ bool                       add,
+                                                         _Inout_ sai_status_t           *object_statuses)
+{
+    sai_status_t              status;
+    mlnx_l2mc_group_member_t *member;
+    mlnx_bridge_port_t       *bport;
+    uint32_t                  ports_count = 0, entry;
+    bool                      failure = false;
+
+    for (entry = batch_head; entry; entry = batch_next[entry - 1]) {
+        status = mlnx_bridge_port_by_idx(members[entry - 1]->bport_db_idx, &bport);
+        assert(SAI_OK(status));
+
+        sx_ports[ports_count++] = bport->logical;
+    }
+
+    status = mlnx_l2mc_sx_container_ports_update(l2mc_group, sx_ports, ports_count, add);
+    if (SAI_OK(status)) {
+        status = mlnx_l2mc_sx_pbs_update(l2mc_group, sx_ports, ports_count, add);
+        if (SAI_ERR(status)) {
+            mlnx_l2mc_sx_container_ports_update(l2mc_group, sx_ports, ports_count, !add);
+        }
+    }
+
+    if (SAI_ERR(status)) {
+        for (entry = batch_head; entry; entry = batch_next[entry - 1]) {
+            member = members[entry - 1];
+
+            if (add) {
+                mlnx_l2mc_group_member_release(l2mc_group, member);
+            } else {
+                mlnx_l2mc_group_member_link(l2mc_group, member);
+            }
+
+            object_statuses[entry - 1] = status;
+        }
+
+        return status;
+    }
+
+    /* Flood control is configured per port, the update is a no-op unless the group is used for flooding */
+    for (entry = batch_head; entry; entry = batch_next[entry - 1]) {
+        member = members[entry - 1];
+
+        mlnx_bridge_port_by_idx(member->bport_db_idx, &bport);
+
+        status = mlnx_l2mc_group_flood_ctrl_update(l2mc_group, bport, add);
+        if (SAI_ERR(status)) {
+            failure = true;
+            object_statuses[entry - 1] = status;
+
+            if (add) {
+                mlnx_l2mc_sx_container_ports_update(l2mc_group, &bport->logical, 1, false);
+                mlnx_l2mc_sx_pbs_update(l2mc_group, &bport->logical, 1, false);
+                mlnx_l2mc_group_member_release(l2mc_group, member);
+            } else {
+                mlnx_l2mc_group_member_link(l2mc_group, member);
+            }
+            continue;
+        }
+
+        if (add) {
+            bport->l2mc_group_ref++;
+        } else {
+            if (bport->l2mc_group_ref == 0) {
+                SX_LOG_ERR("Attempt to decrease bport %d L2MC ref while it is 0\n", bport->index);
+            } else {
+                bport->l2mc_group_ref--;
+            }
+
+            mlnx_l2mc_group_member_db_free(member);
+        }
+
+        object_statuses[entry - 1] = SAI_STATUS_SUCCESS;
+    }
+
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+}
+
+/* sx_ports is a scratch buffer of object_count entries, allocated by the caller before the members are linked */
+static sai_status_t mlnx_l2mc_group_members_batches_apply(_In_ mlnx_l2mc_group_member_t **members,
+                                                          _In_ const uint32_t            *batch_heads,
+                                                          _In_ const uint32_t            *batch_next,
+                                                          _In_ uint32_t                   object_count,
+                                                          _In_ bool                       add,
+                                                          _In_ sx_port_log_id_t          *sx_ports,
+                                                          _Inout_ sai_status_t           *object_statuses)
+{
+    sai_status_t status;
+    uint32_t     group_db_idx;
+    bool         failure = false;
+
+    for (group_db_idx = 0; group_db_idx < MLNX_L2MC_GROUP_DB_SIZE; group_db_idx++) {
+        if (!batch_heads[group_db_idx]) {
+            continue;
+        }
+
+        status = mlnx_l2mc_group_members_batch_update(&l2mc_group_db(group_db_idx), members,
+                                                      batch_heads[group_db_idx], batch_next, sx_ports, add,
+                                                      object_statuses);
+        if (SAI_ERR(status)) {
+            failure = true;
+        }
+    }
+
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Bulk L2MC group members creation.
+ *
+ * Port members of the same group are added with one mc container and one PBS update.
+ * Not a part of sai_l2mc_group_api_t, which has no bulk entries.
+ *
+ * @param[in] switch_id SAI Switch object id
+ * @param[in] object_count Number of objects to create
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to create.
+ * @param[in] attr_list List of attributes for every object.
+ * @param[in] mode Bulk operation error handling mode.
+ *
+ * @param[out] object_id List of object ids returned
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are created or #SAI_STATUS_FAILURE when
+ * any of the objects fails to create. When there is failure, Caller is expected to go through the
+ * list of returned statuses to find out which fails and which succeeds.
+ */
+sai_status_t mlnx_create_l2mc_group_members(_In_ sai_object_id_t          switch_id,
+                                            _In_ uint32_t                 object_count,
+                                            _In_ const uint32_t          *attr_count,
+                                            _In_ const sai_attribute_t  **attr_list,
+                                            _In_ sai_bulk_op_error_mode_t mode,
+                                            _Out_ sai_object_id_t        *object_id,
+                                            _Out_ sai_status_t           *object_statuses)
+{
+    sai_status_t               status;
+    mlnx_l2mc_group_t         *l2mc_group;
+    mlnx_l2mc_group_member_t **members = NULL;
+    mlnx_bridge_port_t        *bport;
+    uint32_t                   batch_heads[MLNX_L2MC_GROUP_DB_SIZE] = {0};
+    uint32_t                  *batch_next = NULL;
+    sx_port_log_id_t          *sx_ports = NULL;
+    uint32_t                   group_db_idx, ii;
+    bool                       stop_on_error, failure = false;
+
+    SX_LOG_ENTER();
+
+    status =
+        mlnx_bulk_create_attrs_validate(object_count, attr_count, attr_list, mode, object_statuses, &stop_on_error);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    members = calloc(object_count, sizeof(*members));
+    batch_next = calloc(object_count, sizeof(*batch_next));
+    sx_ports = calloc(object_count, sizeof(*sx_ports));
+    if (!members || !batch_next || !sx_ports) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        free(members);
+        free(batch_next);
+        free(sx_ports);
+        SX_LOG_EXIT();
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    sai_db_write_lock();
+
+    for (ii = 0; ii < object_count; ii++) {
+        object_id[ii] = SAI_NULL_OBJECT_ID;
+
+        status = check_attribs_on_create(attr_count[ii], attr_list[ii], SAI_OBJECT_TYPE_L2MC_GROUP_MEMBER,
+                                         &object_id[ii]);
+        if (SAI_OK(status)) {
+            MLNX_LOG_ATTRS(attr_count[ii], attr_list[ii], SAI_OBJECT_TYPE_L2MC_GROUP_MEMBER);
+
+            status = mlnx_l2mc_group_member_prepare(attr_count[ii], attr_list[ii], &l2mc_group, &members[ii],
+                                                    &bport);
+        }
+
+        if (SAI_OK(status)) {
+            if (IS_L2MC_GROUP_MEMBER_TUNNEL(bport)) {
+                /* Tunnel members may need the tunnels mc container to be created, add them one by one */
+                status = mlnx_l2mcgroup_member_add(l2mc_group, members[ii]);
+                if (SAI_ERR(status)) {
+                    mlnx_l2mc_group_member_release(l2mc_group, members[ii]);
+                    members[ii] = NULL;
+                }
+            } else {
+                group_db_idx = l2mc_group_ptr_to_db_idx(l2mc_group);
+                batch_next[ii] = batch_heads[group_db_idx];
+                batch_heads[group_db_idx] = ii + 1;
+            }
+        }
+
+        object_statuses[ii] = status;
+
+        if (SAI_ERR(status)) {
+            failure = true;
+        }
+
+        if (SAI_ERR(status) && stop_on_error) {
+            break;
+        }
+    }
+
+    if (SAI_ERR(status) && stop_on_error) {
+        for (ii++; ii < object_count; ii++) {
+            object_id[ii] = SAI_NULL_OBJECT_ID;
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+        }
+    }
+
+    status = mlnx_l2mc_group_members_batches_apply(members, batch_heads, batch_next, object_count, true, sx_ports,
+                                                   object_statuses);
+    if (SAI_ERR(status)) {
+        failure = true;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        if (object_statuses[ii] != SAI_STATUS_SUCCESS) {
+            continue;
+        }
+
+        mlnx_l2mc_group_member_sai_to_oid(members[ii], &object_id[ii]);
+        MLNX_LOG_OID_CREATED(object_id[ii]);
+    }
+
+    sai_db_unlock();
+
+    free(members);
+    free(batch_next);
+    free(sx_ports);
+
+    mlnx_bulk_statuses_print("L2MC group members", object_statuses, object_count, SAI_COMMON_API_BULK_CREATE);
+    SX_LOG_EXIT();
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Bulk L2MC group members removal.
+ *
+ * Port members of the same group are removed with one mc container and one PBS update.
+ * Not a part of sai_l2mc_group_api_t, which has no bulk entries.
+ *
+ * @param[in] object_count Number of objects to remove
+ * @param[in] object_id List of object ids
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to allocate the buffer.
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or #SAI_STATUS_FAILURE when
+ * any of the objects fails to remove. When there is failure, Caller is expected to go through the
+ * list of returned statuses to find out which fails and which succeeds.
+ */
+sai_status_t mlnx_remove_l2mc_group_members(_In_ uint32_t                 object_count,
+                                            _In_ const sai_object_id_t   *object_id,
+                                            _In_ sai_bulk_op_error_mode_t mode,
+                                            _Out_ sai_status_t           *object_statuses)
+{
+    sai_status_t               status;
+    mlnx_l2mc_group_t         *l2mc_group;
+    mlnx_l2mc_group_member_t **members = NULL;
+    mlnx_bridge_port_t        *bport;
+    uint32_t                   batch_heads[MLNX_L2MC_GROUP_DB_SIZE] = {0};
+    uint32_t                  *batch_next = NULL;
+    sx_port_log_id_t          *sx_ports = NULL;
+    uint32_t                   group_db_idx, ii;
+    bool                       stop_on_error, failure = false;
+
+    SX_LOG_ENTER();
+
+    status = mlnx_bulk_remove_attrs_validate(object_count, mode, object_statuses, &stop_on_error);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    members = calloc(object_count, sizeof(*members));
+    batch_next = calloc(object_count, sizeof(*batch_next));
+    sx_ports = calloc(object_count, sizeof(*sx_ports));
+    if (!members || !batch_next || !sx_ports) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        free(members);
+        free(batch_next);
+        free(sx_ports);
+        SX_LOG_EXIT();
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    sai_db_write_lock();
+
+    for (ii = 0; ii < object_count; ii++) {
+        MLNX_LOG_OID_REMOVE(object_id[ii]);
+
+        status = mlnx_l2mc_group_member_oid_to_sai(object_id[ii], &members[ii], &l2mc_group);
+        if (SAI_OK(status) && !mlnx_l2mc_group_member_is_linked(l2mc_group, members[ii])) {
+            SX_LOG_ERR("L2 MC group member %lx is listed more than once\n", object_id[ii]);
+            status = SAI_STATUS_INVALID_OBJECT_ID;
+        }
+
+        if (SAI_OK(status)) {
+            mlnx_l2mc_group_member_unlink(l2mc_group, members[ii]);
+
+            mlnx_bridge_port_by_idx(members[ii]->bport_db_idx, &bport);
+
+            if (IS_L2MC_GROUP_MEMBER_TUNNEL(bport)) {
+                status = mlnx_l2mcgroup_member_del(l2mc_group, members[ii]);
+                if (SAI_ERR(status)) {
+                    mlnx_l2mc_group_member_link(l2mc_group, members[ii]);
+                } else {
+                    mlnx_l2mc_group_member_db_free(members[ii]);
+                }
+            } else {
+                group_db_idx = l2mc_group_ptr_to_db_idx(l2mc_group);
+                batch_next[ii] = batch_heads[group_db_idx];
+                batch_heads[group_db_idx] = ii + 1;
+            }
+        }
+
+        object_statuses[ii] = status;
+
+        if (SAI_ERR(status)) {
+            failure = true;
+        }
+
+        if (SAI_ERR(status) && stop_on_error) {
+            break;
+        }
+    }
+
+    if (SAI_ERR(status) && stop_on_error) {
+        for (ii++; ii < object_count; ii++) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+        }
+    }
+
+    status = mlnx_l2mc_group_members_batches_apply(members, batch_heads, batch_next, object_count, false, sx_ports,
+                                                   object_statuses);
+    if (SAI_ERR(status)) {
+        failure = true;
+    }
+
+    sai_db_unlock();
+
+    free(members);
+    free(batch_next);
+    free(sx_ports);
+
+    mlnx_bulk_statuses_print("L2MC group members", object_statuses, object_count, SAI_COMMON_API_BULK_REMOVE);
+    SX_LOG_EXIT();
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
 static sai_status_t mlnx_l2mcgroup_member_attrib_get(_In_ const sai_object_key_t   *key,
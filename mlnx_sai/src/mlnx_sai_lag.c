@@ -165,10 +165,9 @@ static inline bool is_vlan_flood_config_block_all(uint16_t vid, mlnx_fid_flood_c
 
 static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_config_t *from, port_params_t clone)
 {
-    sai_status_t                 status = SAI_STATUS_SUCCESS;
-    sx_status_t                  sx_status = SX_STATUS_SUCCESS;
-    sx_cos_ets_element_config_t *ets = NULL;
-    sx_port_log_id_t            *log_ports = NULL;
+    sai_status_t      status = SAI_STATUS_SUCCESS;
+    sx_status_t       sx_status = SX_STATUS_SUCCESS;
+    sx_port_log_id_t *log_ports = NULL;
 
     if (clone & PORT_PARAMS_QOS) {
         sx_cos_rewrite_enable_t rewrite_enable;
@@ -260,32 +259,23 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
     }
 
     if (clone & PORT_PARAMS_ETS_GROUP) {
-        uint32_t max_ets_count = MAX_ETS_ELEMENTS;
+        sx_cos_ets_element_config_t *from_ets;
+        uint32_t                     ets_count;
 
-        ets = (sx_cos_ets_element_config_t*)malloc(sizeof(sx_cos_ets_element_config_t) * max_ets_count);
-        if (!ets) {
-            return SAI_STATUS_NO_MEMORY;
-        }
-
-        sx_status = sx_api_cos_port_ets_element_get(gh_sdk, from->logical, ets, &max_ets_count);
-        if (SX_ERR(sx_status)) {
-            SX_LOG_ERR("Failed get ETS list - %s\n", SX_STATUS_MSG(sx_status));
-            status = sdk_to_sai(sx_status);
+        status = mlnx_port_ets_list_get(from->logical, &from_ets, &ets_count);
+        if (SAI_ERR(status)) {
             goto out;
         }
 
-        sx_status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                                    to->logical, ets, max_ets_count);
-        if (SX_ERR(sx_status)) {
-            SX_LOG_ERR("Failed to update ETS elements on LAG port id 0x%x - %s\n",
-                       to->logical,
-                       SX_STATUS_MSG(sx_status));
-            status = sdk_to_sai(sx_status);
+        status = mlnx_port_ets_elements_set(to->logical, from_ets, ets_count);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to update ETS elements on LAG port id 0x%x\n", to->logical);
             goto out;
         }
 
         memcpy(&to->sched_hierarchy, &from->sched_hierarchy, sizeof(to->sched_hierarchy));
         to->scheduler_id = from->scheduler_id;
+        mlnx_sched_refs_port_sync(to);
     }
 
     if (clone & PORT_PARAMS_QUEUE) {
@@ -310,6 +300,7 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
             memcpy(&(to_queue_cfg->sched_obj), &(queue_cfg->sched_obj),
                    sizeof(to_queue_cfg->sched_obj));
         }
+        mlnx_sched_refs_port_sync(to);
 
         port_queues_foreach(from, queue_cfg, ii) {
             SX_LOG_DBG("Cloning WRED from %x to %x, qi %d, wred %lx\n",
@@ -441,7 +432,6 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
     }
 
 out:
-    free(ets);
     free(log_ports);
     return status;
 }
@@ -1492,13 +1482,15 @@ static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_membe
                            mlnx_ports_db[lag_db_idx].logical, ii);
                 goto out;
             }
-            lag_queue_cfg->wred_id = port_queue_cfg->wred_id;
+            mlnx_wred_queue_wred_id_set(lag_queue_cfg, port_queue_cfg->wred_id);
             memcpy(&(lag_queue_cfg->sched_obj), &(port_queue_cfg->sched_obj),
                    sizeof(lag_queue_cfg->sched_obj));
         }
         /* copy ets group/subgroup */
         memcpy(&lag->sched_hierarchy, &port->sched_hierarchy, sizeof(lag->sched_hierarchy));
         port->scheduler_id = lag->scheduler_id;
+        mlnx_sched_refs_port_sync(lag);
+        mlnx_sched_refs_port_sync(port);
         memcpy(mlnx_ports_db[lag_db_idx].port_policers,
                port->port_policers,
                sizeof(port->port_policers));
@@ -1656,7 +1648,7 @@ static sai_status_t mlnx_hostif_reapply(mlnx_port_config_t *port_config)
     if (port_config->has_hostif) {
         hostif_db_idx = port_config->hostif_db_idx;
         snprintf(set_addr_command, sizeof(set_addr_command), "ip link set dev %s address %s > /dev/null 2>&1",
-                 g_sai_db_ptr->hostif_db[hostif_db_idx].ifname, g_sai_db_ptr->dev_mac);
+                 mlnx_hostif_db[hostif_db_idx].ifname, g_sai_db_ptr->dev_mac);
         system_err = system(set_addr_command);
         if (0 != system_err) {
             SX_LOG_ERR("Failed running \"%s\".\n", set_addr_command);
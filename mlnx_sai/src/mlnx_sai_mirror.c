@@ -128,42 +128,9 @@ static sai_status_t mlnx_mirror_session_sample_rate_get(_In_ const sai_object_ke
 static sai_status_t mlnx_mirror_session_monitor_port_set(_In_ const sai_object_key_t      *key,
                                                          _In_ const sai_attribute_value_t *value,
                                                          void                             *arg);
-static sai_status_t mlnx_mirror_session_truncate_size_set(_In_ const sai_object_key_t      *key,
-                                                          _In_ const sai_attribute_value_t *value,
-                                                          void                             *arg);
-static sai_status_t mlnx_mirror_session_tc_set(_In_ const sai_object_key_t      *key,
-                                               _In_ const sai_attribute_value_t *value,
-                                               void                             *arg);
-static sai_status_t mlnx_mirror_session_vlan_tpid_set(_In_ const sai_object_key_t      *key,
-                                                      _In_ const sai_attribute_value_t *value,
-                                                      void                             *arg);
-static sai_status_t mlnx_mirror_session_vlan_id_set(_In_ const sai_object_key_t      *key,
-                                                    _In_ const sai_attribute_value_t *value,
-                                                    void                             *arg);
-static sai_status_t mlnx_mirror_session_vlan_pri_set(_In_ const sai_object_key_t      *key,
-                                                     _In_ const sai_attribute_value_t *value,
-                                                     void                             *arg);
-static sai_status_t mlnx_mirror_session_vlan_cfi_set(_In_ const sai_object_key_t      *key,
-                                                     _In_ const sai_attribute_value_t *value,
-                                                     void                             *arg);
-static sai_status_t mlnx_mirror_session_vlan_header_valid_set(_In_ const sai_object_key_t      *key,
-                                                              _In_ const sai_attribute_value_t *value,
-                                                              void                             *arg);
-static sai_status_t mlnx_mirror_session_tos_set(_In_ const sai_object_key_t      *key,
-                                                _In_ const sai_attribute_value_t *value,
-                                                void                             *arg);
-static sai_status_t mlnx_mirror_session_ttl_set(_In_ const sai_object_key_t      *key,
-                                                _In_ const sai_attribute_value_t *value,
-                                                void                             *arg);
-static sai_status_t mlnx_mirror_session_ip_address_set(_In_ const sai_object_key_t      *key,
-                                                       _In_ const sai_attribute_value_t *value,
-                                                       void                             *arg);
-static sai_status_t mlnx_mirror_session_mac_address_set(_In_ const sai_object_key_t      *key,
-                                                        _In_ const sai_attribute_value_t *value,
-                                                        void                             *arg);
-static sai_status_t mlnx_mirror_session_gre_protocol_type_set(_In_ const sai_object_key_t      *key,
-                                                              _In_ const sai_attribute_value_t *value,
-                                                              void                             *arg);
+static sai_status_t mlnx_mirror_session_param_set(_In_ const sai_object_key_t      *key,
+                                                  _In_ const sai_attribute_value_t *value,
+                                                  void                             *arg);
 static sai_status_t mlnx_mirror_session_policer_set(_In_ const sai_object_key_t      *key,
                                                     _In_ const sai_attribute_value_t *value,
                                                     void                             *arg);
@@ -186,37 +153,37 @@ static const sai_vendor_attribute_entry_t mirror_vendor_attribs[] = {
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_truncate_size_get, NULL,
-      mlnx_mirror_session_truncate_size_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_TRUNCATE_SIZE },
     { SAI_MIRROR_SESSION_ATTR_TC,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_tc_get, NULL,
-      mlnx_mirror_session_tc_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_TC },
     { SAI_MIRROR_SESSION_ATTR_VLAN_TPID,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_vlan_tpid_get, NULL,
-      mlnx_mirror_session_vlan_tpid_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_VLAN_TPID },
     { SAI_MIRROR_SESSION_ATTR_VLAN_ID,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_vlan_id_get, NULL,
-      mlnx_mirror_session_vlan_id_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_VLAN_ID },
     { SAI_MIRROR_SESSION_ATTR_VLAN_PRI,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_vlan_pri_get, NULL,
-      mlnx_mirror_session_vlan_pri_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_VLAN_PRI },
     { SAI_MIRROR_SESSION_ATTR_VLAN_CFI,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_vlan_cfi_get, NULL,
-      mlnx_mirror_session_vlan_cfi_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_VLAN_CFI },
     { SAI_MIRROR_SESSION_ATTR_VLAN_HEADER_VALID,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_vlan_header_valid_get, NULL,
-      mlnx_mirror_session_vlan_header_valid_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_VLAN_HEADER_VALID },
     { SAI_MIRROR_SESSION_ATTR_ERSPAN_ENCAPSULATION_TYPE,
       { true, false, false, true },
       { true, false, false, true },
@@ -231,37 +198,37 @@ static const sai_vendor_attribute_entry_t mirror_vendor_attribs[] = {
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_tos_get, NULL,
-      mlnx_mirror_session_tos_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_TOS },
     { SAI_MIRROR_SESSION_ATTR_TTL,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_ttl_get, NULL,
-      mlnx_mirror_session_ttl_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_TTL },
     { SAI_MIRROR_SESSION_ATTR_SRC_IP_ADDRESS,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_ip_address_get, (void*)MIRROR_SRC_IP_ADDRESS,
-      mlnx_mirror_session_ip_address_set, (void*)MIRROR_SRC_IP_ADDRESS },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_SRC_IP_ADDRESS },
     { SAI_MIRROR_SESSION_ATTR_DST_IP_ADDRESS,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_ip_address_get, (void*)MIRROR_DST_IP_ADDRESS,
-      mlnx_mirror_session_ip_address_set, (void*)MIRROR_DST_IP_ADDRESS },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_DST_IP_ADDRESS },
     { SAI_MIRROR_SESSION_ATTR_SRC_MAC_ADDRESS,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_mac_address_get, (void*)MIRROR_SRC_MAC_ADDRESS,
-      mlnx_mirror_session_mac_address_set, (void*)MIRROR_SRC_MAC_ADDRESS },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_SRC_MAC_ADDRESS },
     { SAI_MIRROR_SESSION_ATTR_DST_MAC_ADDRESS,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_mac_address_get, (void*)MIRROR_DST_MAC_ADDRESS,
-      mlnx_mirror_session_mac_address_set, (void*)MIRROR_DST_MAC_ADDRESS },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_DST_MAC_ADDRESS },
     { SAI_MIRROR_SESSION_ATTR_GRE_PROTOCOL_TYPE,
       { true, false, true, true },
       { true, false, true, true },
       mlnx_mirror_session_gre_protocol_type_get, NULL,
-      mlnx_mirror_session_gre_protocol_type_set, NULL },
+      mlnx_mirror_session_param_set, (void*)SAI_MIRROR_SESSION_ATTR_GRE_PROTOCOL_TYPE },
     { SAI_MIRROR_SESSION_ATTR_POLICER,
       { true, false, true, true },
       { true, false, true, true },
@@ -424,6 +391,21 @@ static sai_status_t mlnx_mirror_policer_validate(_In_ sai_object_id_t policer_oi
     return mlnx_mirror_policer_sx_attrs_validate(&policer->sx_policer_attr);
 }
 
+/* DB read lock is needed */
+static sai_status_t mlnx_mirror_session_sdk_params_get(_In_ sx_span_session_id_t       sdk_mirror_obj_id,
+                                                       _Out_ sx_span_session_params_t *sdk_mirror_obj_params)
+{
+    const mlnx_mirror_params_t *mirror_params = &g_sai_db_ptr->mirror_params[sdk_mirror_obj_id];
+
+    if (mirror_params->is_valid) {
+        *sdk_mirror_obj_params = mirror_params->params;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /* Not cached (e.g. session created before the cache was added), the next set caches it */
+    return sdk_to_sai(sx_api_span_session_get(gh_sdk, sdk_mirror_obj_id, sdk_mirror_obj_params));
+}
+
 static sai_status_t mlnx_get_sdk_mirror_obj_params(_In_ sai_object_id_t            sai_mirror_obj_id,
                                                    _Inout_ sx_span_session_id_t   *sdk_mirror_obj_id,
                                                    _Out_ sx_span_session_params_t *sdk_mirror_obj_params)
@@ -441,8 +423,16 @@ static sai_status_t mlnx_get_sdk_mirror_obj_params(_In_ sai_object_id_t
         return status;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = (sdk_to_sai(sx_api_span_session_get(gh_sdk, sdk_mirror_obj_id_u32, sdk_mirror_obj_params))))) {
+    if (sdk_mirror_obj_id_u32 >= SPAN_SESSION_MAX) {
+        SX_LOG_ERR("sai mirror obj id: %" PRIx64 " - session id %d\n", sai_mirror_obj_id, sdk_mirror_obj_id_u32);
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    sai_db_read_lock();
+    status = mlnx_mirror_session_sdk_params_get((sx_span_session_id_t)sdk_mirror_obj_id_u32, sdk_mirror_obj_params);
+    sai_db_unlock();
+    if (SAI_ERR(status)) {
         SX_LOG_ERR("Error getting span session from sdk mirror session id %d\n", sdk_mirror_obj_id_u32);
         SX_LOG_EXIT();
         return status;
@@ -1355,505 +1345,249 @@ static sai_status_t mlnx_mirror_session_monitor_port_set(_In_ const sai_object_k
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_truncate_size_set(_In_ const sai_object_key_t      *key,
-                                                          _In_ const sai_attribute_value_t *value,
-                                                          void                             *arg)
+static sai_status_t mlnx_mirror_session_truncate_size_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                            _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
     /* Min size SPC1 32, SPC2 48 bytes */
     if (0 == value->u16) {
-        sdk_mirror_obj_params.truncate = false;
-        sdk_mirror_obj_params.truncate_size = 0;
+        sdk_mirror_obj_params->truncate = false;
+        sdk_mirror_obj_params->truncate_size = 0;
     } else {
-        sdk_mirror_obj_params.truncate = true;
-        sdk_mirror_obj_params.truncate_size = value->u16;
-    }
-
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
+        sdk_mirror_obj_params->truncate = true;
+        sdk_mirror_obj_params->truncate_size = value->u16;
     }
 
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_tc_set(_In_ const sai_object_key_t      *key,
-                                               _In_ const sai_attribute_value_t *value,
-                                               void                             *arg)
+static sai_status_t mlnx_mirror_session_tc_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                 _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_LOCAL_ETH_TYPE1:
-        sdk_mirror_obj_params.span_type_format.local_eth_type1.switch_prio = value->u8;
+        sdk_mirror_obj_params->span_type_format.local_eth_type1.switch_prio = value->u8;
         break;
 
     case SX_SPAN_TYPE_REMOTE_ETH_VLAN_TYPE1:
-        sdk_mirror_obj_params.span_type_format.remote_eth_vlan_type1.switch_prio = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_vlan_type1.switch_prio = value->u8;
         break;
 
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.switch_prio = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.switch_prio = value->u8;
         break;
 
     default:
         SX_LOG_ERR("Error: mirror type should be either SPAN or RSPAN or ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+                   sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_vlan_tpid_set(_In_ const sai_object_key_t      *key,
-                                                      _In_ const sai_attribute_value_t *value,
-                                                      void                             *arg)
+static sai_status_t mlnx_mirror_session_vlan_tpid_apply(_In_ const sx_span_session_params_t *sdk_mirror_obj_params,
+                                                        _In_ const mlnx_mirror_vlan_t       *vlan_header,
+                                                        _In_ const sai_attribute_value_t    *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
         if (MLNX_MIRROR_VLAN_TPID != value->u16) {
             SX_LOG_ERR("VLAN TPID must be %x on set\n", MLNX_MIRROR_VLAN_TPID);
-            SX_LOG_EXIT();
             return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u16;
         }
-        sai_db_write_lock();
 
-        if (!g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid) {
-            assert(0 == sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid);
+        if (!vlan_header->vlan_header_valid) {
+            assert(0 == sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid);
             SX_LOG_WRN("Need to set vlan header valid to true to update VLAN ID in packet for ERSPAN \n");
-            sai_db_unlock();
-            SX_LOG_EXIT();
-            return SAI_STATUS_SUCCESS;
         }
-
-        sai_db_unlock();
         break;
 
     case SX_SPAN_TYPE_REMOTE_ETH_VLAN_TYPE1:
         if (MLNX_MIRROR_VLAN_TPID != value->u16) {
             SX_LOG_ERR("VLAN TPID must be %x on set\n", MLNX_MIRROR_VLAN_TPID);
-            SX_LOG_EXIT();
             return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u16;
         }
         break;
 
     default:
         SX_LOG_ERR("Error: VLAN tpid is only valid for RSPAN or ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+                   sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_vlan_id_set(_In_ const sai_object_key_t      *key,
-                                                    _In_ const sai_attribute_value_t *value,
-                                                    void                             *arg)
+static sai_status_t mlnx_mirror_session_vlan_id_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                      _Inout_ mlnx_mirror_vlan_t       *vlan_header,
+                                                      _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_VLAN_TYPE1:
         if (MLNX_VLAN_ID_WHEN_TP_DISABLED == value->u16) {
             SX_LOG_ERR("VLAN ID cannot be %d for RSPAN on set\n", MLNX_VLAN_ID_WHEN_TP_DISABLED);
-            SX_LOG_EXIT();
             return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u16;
         }
-        sdk_mirror_obj_params.span_type_format.remote_eth_vlan_type1.vid = value->u16;
+        sdk_mirror_obj_params->span_type_format.remote_eth_vlan_type1.vid = value->u16;
         break;
 
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sai_db_write_lock();
-        g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_id = value->u16;
-        if (!g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid) {
-            assert(0 == sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid);
+        vlan_header->vlan_id = value->u16;
+        if (!vlan_header->vlan_header_valid) {
+            assert(0 == sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid);
             SX_LOG_WRN("Need to set vlan header valid to true to update VLAN ID in packet for ERSPAN \n");
-            sai_db_unlock();
-            SX_LOG_EXIT();
-            return SAI_STATUS_SUCCESS;
+            break;
         }
 
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid = value->u16;
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
-        sai_db_unlock();
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid = value->u16;
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
         break;
 
     default:
         SX_LOG_ERR("Error: VLAN id is only valid for RSPAN or ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+                   sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_vlan_pri_set(_In_ const sai_object_key_t      *key,
-                                                     _In_ const sai_attribute_value_t *value,
-                                                     void                             *arg)
+static sai_status_t mlnx_mirror_session_vlan_pri_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                       _Inout_ mlnx_mirror_vlan_t       *vlan_header,
+                                                       _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
     if (MIRROR_VLAN_PRI_MAX < value->u8) {
         SX_LOG_ERR("Error: VLAN PRI should be at most %d but getting %d\n", MIRROR_VLAN_PRI_MAX, value->u8);
-        SX_LOG_EXIT();
         return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u8;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_VLAN_TYPE1:
-        sdk_mirror_obj_params.span_type_format.remote_eth_vlan_type1.pcp = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_vlan_type1.pcp = value->u8;
         break;
 
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sai_db_write_lock();
-        g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_pri = value->u8;
-        if (!g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid) {
-            assert(0 == sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid);
+        vlan_header->vlan_pri = value->u8;
+        if (!vlan_header->vlan_header_valid) {
+            assert(0 == sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid);
             SX_LOG_WRN("Need to set vlan header valid to true to update VLAN PRI in packet for ERSPAN \n");
-            sai_db_unlock();
-            SX_LOG_EXIT();
-            return SAI_STATUS_SUCCESS;
+            break;
         }
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.pcp = value->u8;
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
-        sai_db_unlock();
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.pcp = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
         break;
 
     default:
         SX_LOG_ERR("Error: VLAN pri is only valid for RSPAN or ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+                   sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_vlan_cfi_set(_In_ const sai_object_key_t      *key,
-                                                     _In_ const sai_attribute_value_t *value,
-                                                     void                             *arg)
+static sai_status_t mlnx_mirror_session_vlan_cfi_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                       _Inout_ mlnx_mirror_vlan_t       *vlan_header,
+                                                       _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
     if (MIRROR_VLAN_CFI_MAX < value->u8) {
         SX_LOG_ERR("Error: VLAN cfi should be at most %d but getting %d\n", MIRROR_VLAN_CFI_MAX, value->u8);
-        SX_LOG_EXIT();
         return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u8;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_VLAN_TYPE1:
-        sdk_mirror_obj_params.span_type_format.remote_eth_vlan_type1.dei = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_vlan_type1.dei = value->u8;
         break;
 
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sai_db_write_lock();
-        g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_cfi = value->u8;
-        if (!g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid) {
-            assert(0 == sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid);
+        vlan_header->vlan_cfi = value->u8;
+        if (!vlan_header->vlan_header_valid) {
+            assert(0 == sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid);
             SX_LOG_WRN("Need to set vlan header valid to true to update VLAN CFI in packet for ERSPAN \n");
-            sai_db_unlock();
-            SX_LOG_EXIT();
-            return SAI_STATUS_SUCCESS;
+            break;
         }
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dei = value->u8;
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
-        sai_db_unlock();
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dei = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
         break;
 
     default:
         SX_LOG_ERR("Error: VLAN cfi is only valid for RSPAN or ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+                   sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sai mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_vlan_header_valid_set(_In_ const sai_object_key_t      *key,
-                                                              _In_ const sai_attribute_value_t *value,
-                                                              void                             *arg)
+static sai_status_t mlnx_mirror_session_vlan_header_valid_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                                _Inout_ mlnx_mirror_vlan_t       *vlan_header,
+                                                                _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sai_db_write_lock();
-        if (g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid && !value->booldata) {
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid = 0;
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_DISABLE;
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.pcp = 0;
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dei = 0;
-            g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_id = 0;
-            g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_pri = 0;
-            g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_cfi = 0;
-            g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid = false;
-        } else if (!g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid && value->booldata) {
-            g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_header_valid = true;
-            if (0 == g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_id) {
-                sai_db_unlock();
+        if (vlan_header->vlan_header_valid && !value->booldata) {
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid = 0;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_DISABLE;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.pcp = 0;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dei = 0;
+            memset(vlan_header, 0, sizeof(*vlan_header));
+        } else if (!vlan_header->vlan_header_valid && value->booldata) {
+            vlan_header->vlan_header_valid = true;
+            if (0 == vlan_header->vlan_id) {
                 SX_LOG_WRN("vlan id is still 0 for ERSPAN session\n");
-                SX_LOG_EXIT();
-                return SAI_STATUS_SUCCESS;
+                break;
             }
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.vid =
-                g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_id;
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.pcp =
-                g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_pri;
-            sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dei =
-                g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id].vlan_cfi;
-        } else {
-            sai_db_unlock();
-            SX_LOG_EXIT();
-            return SAI_STATUS_SUCCESS;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.vid = vlan_header->vlan_id;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.tp = MLNX_MIRROR_TP_ENABLE;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.pcp = vlan_header->vlan_pri;
+            sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dei = vlan_header->vlan_cfi;
         }
-        sai_db_unlock();
         break;
 
     default:
         SX_LOG_ERR("Error: VLAN cfi is only valid for RSPAN or ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+                   sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sai mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_tos_set(_In_ const sai_object_key_t      *key,
-                                                _In_ const sai_attribute_value_t *value,
-                                                void                             *arg)
+static sai_status_t mlnx_mirror_session_tos_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                  _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dscp =
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dscp =
             (value->u8 >> DSCP_OFFSET) & DSCP_MASK_AFTER_SHIFT;
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.ecn = value->u8 & ~DSCP_MASK;
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.ecn = value->u8 & ~DSCP_MASK;
         SX_LOG_NTC("SAI TOS: %d, SDK DSCP: %d, SDK ECN: %d\n", value->u8,
-                   sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dscp,
-                   sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.ecn);
+                   sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dscp,
+                   sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.ecn);
         break;
 
     default:
-        SX_LOG_ERR("Error: TOS is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+        SX_LOG_ERR("Error: TOS is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror session id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_ttl_set(_In_ const sai_object_key_t      *key,
-                                                _In_ const sai_attribute_value_t *value,
-                                                void                             *arg)
+static sai_status_t mlnx_mirror_session_ttl_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                  _In_ const sai_attribute_value_t *value)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.ttl = value->u8;
+        sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.ttl = value->u8;
         break;
 
     default:
-        SX_LOG_ERR("Error: TTL is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+        SX_LOG_ERR("Error: TTL is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror session id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
@@ -1885,158 +1619,227 @@ static sai_status_t mlnx_check_mirror_ip_family(_In_ sai_ip_addr_family_t sai_ip
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_ip_address_set(_In_ const sai_object_key_t      *key,
-                                                       _In_ const sai_attribute_value_t *value,
-                                                       void                             *arg)
+static sai_status_t mlnx_mirror_session_ip_address_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                         _In_ const sai_attribute_value_t *value,
+                                                         _In_ long                         arg)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_ip_version_t          sdk_ip_version_to_check = SX_IP_VERSION_IPV4;
-    sx_ip_addr_t            *sdk_ip_address = NULL;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    assert((MIRROR_SRC_IP_ADDRESS == (long)arg) || (MIRROR_DST_IP_ADDRESS == (long)arg));
+    sai_status_t    status = SAI_STATUS_FAILURE;
+    sx_ip_version_t sdk_ip_version_to_check = SX_IP_VERSION_IPV4;
+    sx_ip_addr_t   *sdk_ip_address = NULL;
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
+    assert((MIRROR_SRC_IP_ADDRESS == arg) || (MIRROR_DST_IP_ADDRESS == arg));
 
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        if (MIRROR_SRC_IP_ADDRESS == (long)arg) {
-            sdk_ip_version_to_check = sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dest_ip.version;
-            sdk_ip_address = &sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.src_ip;
-        } else if (MIRROR_DST_IP_ADDRESS == (long)arg) {
-            sdk_ip_version_to_check = sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.src_ip.version;
-            sdk_ip_address = &sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.dest_ip;
+        if (MIRROR_SRC_IP_ADDRESS == arg) {
+            sdk_ip_version_to_check = sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dest_ip.version;
+            sdk_ip_address = &sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.src_ip;
+        } else {
+            sdk_ip_version_to_check = sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.src_ip.version;
+            sdk_ip_address = &sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.dest_ip;
         }
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_check_mirror_ip_family(value->ipaddr.addr_family, sdk_ip_version_to_check))) {
             SX_LOG_ERR("Error: SAI IP address family does not match SDK IP address family\n");
-            SX_LOG_EXIT();
+            return status;
         }
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_translate_sai_ip_address_to_sdk(&value->ipaddr, sdk_ip_address))) {
             SX_LOG_ERR("Error: IP address should only be IPv4 or IPv6\n");
-            SX_LOG_EXIT();
             return status;
         }
         break;
 
     default:
-        SX_LOG_ERR("Error: IP address is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+        SX_LOG_ERR("Error: IP address is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
-    }
-
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_mac_address_set(_In_ const sai_object_key_t      *key,
-                                                        _In_ const sai_attribute_value_t *value,
-                                                        void                             *arg)
+static sai_status_t mlnx_mirror_session_mac_address_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                          _In_ const sai_attribute_value_t *value,
+                                                          _In_ long                         arg)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
-    sx_span_session_params_t sdk_mirror_obj_params;
-
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
-    SX_LOG_ENTER();
-
-    assert((MIRROR_SRC_MAC_ADDRESS == (long)arg) || (MIRROR_DST_MAC_ADDRESS == (long)arg));
-
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
-        SX_LOG_EXIT();
-        return status;
-    }
+    assert((MIRROR_SRC_MAC_ADDRESS == arg) || (MIRROR_DST_MAC_ADDRESS == arg));
 
-    switch (sdk_mirror_obj_params.span_type) {
+    switch (sdk_mirror_obj_params->span_type) {
     case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        if (MIRROR_SRC_MAC_ADDRESS == (long)arg) {
-            memcpy(sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.smac.ether_addr_octet,
+        if (MIRROR_SRC_MAC_ADDRESS == arg) {
+            memcpy(sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.smac.ether_addr_octet,
                    value->mac,
                    sizeof(value->mac));
-        } else if (MIRROR_DST_MAC_ADDRESS == (long)arg) {
-            memcpy(sdk_mirror_obj_params.span_type_format.remote_eth_l3_type1.mac.ether_addr_octet, value->mac,
+        } else {
+            memcpy(sdk_mirror_obj_params->span_type_format.remote_eth_l3_type1.mac.ether_addr_octet, value->mac,
                    sizeof(value->mac));
         }
         break;
 
     default:
-        SX_LOG_ERR("Error: mac address is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
+        SX_LOG_ERR("Error: mac address is only valid for ERSPAN, but getting %d\n", sdk_mirror_obj_params->span_type);
         return SAI_STATUS_FAILURE;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status =
-             sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
-                                                &sdk_mirror_obj_id)))) {
-        SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
-        SX_LOG_EXIT();
-        return status;
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_mirror_session_gre_protocol_type_apply(
+    _In_ const sx_span_session_params_t *sdk_mirror_obj_params,
+    _In_ const sai_attribute_value_t    *value)
+{
+    switch (sdk_mirror_obj_params->span_type) {
+    case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
+        if (MLNX_GRE_PROTOCOL_TYPE != value->u16) {
+            SX_LOG_ERR("GRE protocol type must be %x on set but the given value is %x\n",
+                       MLNX_GRE_PROTOCOL_TYPE,
+                       value->u16);
+            return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u16;
+        }
+        break;
+
+    default:
+        SX_LOG_ERR("Error: GRE protocol type is only valid for ERSPAN, but getting %d\n",
+                   sdk_mirror_obj_params->span_type);
+        return SAI_STATUS_FAILURE;
     }
 
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_mirror_session_gre_protocol_type_set(_In_ const sai_object_key_t      *key,
-                                                              _In_ const sai_attribute_value_t *value,
-                                                              void                             *arg)
+/* Updates the span session params and ERSPAN VLAN header copies with one attribute, nothing is written to SDK */
+static sai_status_t mlnx_mirror_session_param_apply(_Inout_ sx_span_session_params_t *sdk_mirror_obj_params,
+                                                    _Inout_ mlnx_mirror_vlan_t       *vlan_header,
+                                                    _In_ const sai_attribute_t       *attr)
+{
+    switch (attr->id) {
+    case SAI_MIRROR_SESSION_ATTR_TRUNCATE_SIZE:
+        return mlnx_mirror_session_truncate_size_apply(sdk_mirror_obj_params, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_TC:
+        return mlnx_mirror_session_tc_apply(sdk_mirror_obj_params, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_VLAN_TPID:
+        return mlnx_mirror_session_vlan_tpid_apply(sdk_mirror_obj_params, vlan_header, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_VLAN_ID:
+        return mlnx_mirror_session_vlan_id_apply(sdk_mirror_obj_params, vlan_header, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_VLAN_PRI:
+        return mlnx_mirror_session_vlan_pri_apply(sdk_mirror_obj_params, vlan_header, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_VLAN_CFI:
+        return mlnx_mirror_session_vlan_cfi_apply(sdk_mirror_obj_params, vlan_header, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_VLAN_HEADER_VALID:
+        return mlnx_mirror_session_vlan_header_valid_apply(sdk_mirror_obj_params, vlan_header, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_TOS:
+        return mlnx_mirror_session_tos_apply(sdk_mirror_obj_params, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_TTL:
+        return mlnx_mirror_session_ttl_apply(sdk_mirror_obj_params, &attr->value);
+
+    case SAI_MIRROR_SESSION_ATTR_SRC_IP_ADDRESS:
+        return mlnx_mirror_session_ip_address_apply(sdk_mirror_obj_params, &attr->value, MIRROR_SRC_IP_ADDRESS);
+
+    case SAI_MIRROR_SESSION_ATTR_DST_IP_ADDRESS:
+        return mlnx_mirror_session_ip_address_apply(sdk_mirror_obj_params, &attr->value, MIRROR_DST_IP_ADDRESS);
+
+    case SAI_MIRROR_SESSION_ATTR_SRC_MAC_ADDRESS:
+        return mlnx_mirror_session_mac_address_apply(sdk_mirror_obj_params, &attr->value, MIRROR_SRC_MAC_ADDRESS);
+
+    case SAI_MIRROR_SESSION_ATTR_DST_MAC_ADDRESS:
+        return mlnx_mirror_session_mac_address_apply(sdk_mirror_obj_params, &attr->value, MIRROR_DST_MAC_ADDRESS);
+
+    case SAI_MIRROR_SESSION_ATTR_GRE_PROTOCOL_TYPE:
+        return mlnx_mirror_session_gre_protocol_type_apply(sdk_mirror_obj_params, &attr->value);
+
+    default:
+        SX_LOG_ERR("Mirror session attribute %d is not a span session parameter\n", attr->id);
+        return SAI_STATUS_ATTR_NOT_SUPPORTED_0;
+    }
+}
+
+/*
+ * Applies the attribute to the cached span session params and writes them to SDK with an EDIT, skipped when
+ * the value has not changed.
+ */
+static sai_status_t mlnx_mirror_session_params_set(_In_ sai_object_id_t        sai_mirror_obj_id,
+                                                   _In_ const sai_attribute_t *attr)
 {
-    sx_span_session_id_t     sdk_mirror_obj_id = 0;
-    sai_status_t             status = SAI_STATUS_FAILURE;
     sx_span_session_params_t sdk_mirror_obj_params;
+    sx_span_session_id_t     sdk_mirror_obj_id = 0;
+    mlnx_mirror_params_t    *mirror_params;
+    mlnx_mirror_vlan_t       vlan_header;
+    uint32_t                 sdk_mirror_obj_id_u32 = 0;
+    sai_status_t             status;
 
-    memset(&sdk_mirror_obj_params, 0, sizeof(sx_span_session_params_t));
     SX_LOG_ENTER();
 
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_get_sdk_mirror_obj_params(key->key.object_id, &sdk_mirror_obj_id, &sdk_mirror_obj_params))) {
-        SX_LOG_ERR("Error getting mirror session params from sai mirror obj id %" PRIx64 "\n", key->key.object_id);
+        (status =
+             mlnx_object_to_type(sai_mirror_obj_id, SAI_OBJECT_TYPE_MIRROR_SESSION, &sdk_mirror_obj_id_u32, NULL))) {
+        SX_LOG_ERR("Invalid sai mirror obj id %" PRIx64 "\n", sai_mirror_obj_id);
         SX_LOG_EXIT();
         return status;
     }
 
-    switch (sdk_mirror_obj_params.span_type) {
-    case SX_SPAN_TYPE_REMOTE_ETH_L3_TYPE1:
-        if (MLNX_GRE_PROTOCOL_TYPE != value->u16) {
-            SX_LOG_ERR("GRE protocol type must be %x on set but the given value is %x\n",
-                       MLNX_GRE_PROTOCOL_TYPE,
-                       value->u16);
-            SX_LOG_EXIT();
-            return SAI_STATUS_INVALID_ATTR_VALUE_0 + value->u16;
+    if (sdk_mirror_obj_id_u32 >= SPAN_SESSION_MAX) {
+        SX_LOG_ERR("sai mirror obj id: %" PRIx64 " - session id %d\n", sai_mirror_obj_id, sdk_mirror_obj_id_u32);
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    sdk_mirror_obj_id = (sx_span_session_id_t)sdk_mirror_obj_id_u32;
+    mirror_params = &g_sai_db_ptr->mirror_params[sdk_mirror_obj_id];
+
+    sai_db_write_lock();
+
+    status = mlnx_mirror_session_sdk_params_get(sdk_mirror_obj_id, &sdk_mirror_obj_params);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Error getting span session from sdk mirror session id %d\n", sdk_mirror_obj_id);
+        goto out;
+    }
+
+    vlan_header = g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id];
+
+    status = mlnx_mirror_session_param_apply(&sdk_mirror_obj_params, &vlan_header, attr);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    if (!mirror_params->is_valid ||
+        memcmp(&mirror_params->params, &sdk_mirror_obj_params, sizeof(sdk_mirror_obj_params))) {
+        status = sdk_to_sai(sx_api_span_session_set(gh_sdk, SX_ACCESS_CMD_EDIT, &sdk_mirror_obj_params,
+                                                    &sdk_mirror_obj_id));
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Error setting span session for sdk mirror obj id %d\n", sdk_mirror_obj_id);
+            goto out;
         }
-        break;
 
-    default:
-        SX_LOG_ERR("Error: GRE protocol type is only valid for ERSPAN, but getting %d\n",
-                   sdk_mirror_obj_params.span_type);
-        SX_LOG_EXIT();
-        return SAI_STATUS_FAILURE;
+        mirror_params->params = sdk_mirror_obj_params;
+        mirror_params->is_valid = true;
     }
 
+    g_sai_db_ptr->erspan_vlan_header[sdk_mirror_obj_id] = vlan_header;
+
+out:
+    sai_db_unlock();
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
+}
+
+static sai_status_t mlnx_mirror_session_param_set(_In_ const sai_object_key_t      *key,
+                                                  _In_ const sai_attribute_value_t *value,
+                                                  void                             *arg)
+{
+    sai_attribute_t attr;
+
+    attr.id = (sai_attr_id_t)(long)arg;
+    attr.value = *value;
+
+    return mlnx_mirror_session_params_set(key->key.object_id, &attr);
 }
 
 static sai_status_t mlnx_mirror_session_policer_set(_In_ const sai_object_key_t      *key,
@@ -3030,6 +2833,8 @@ static sai_status_t mlnx_create_mirror_session(_Out_ sai_object_id_t      *sai_m
 
     g_sai_db_ptr->mirror_congestion_mode[sdk_mirror_obj_id] = congestion_mode;
     g_sai_db_ptr->mirror_sample_rate[sdk_mirror_obj_id] = sample_rate;
+    g_sai_db_ptr->mirror_params[sdk_mirror_obj_id].params = sdk_mirror_obj_params;
+    g_sai_db_ptr->mirror_params[sdk_mirror_obj_id].is_valid = true;
 
     MLNX_LOG_OID_CREATED(*sai_mirror_obj_id);
 
@@ -3160,6 +2965,8 @@ static sai_status_t mlnx_remove_mirror_session(_In_ const sai_object_id_t sai_mi
 
     memset(&g_sai_db_ptr->mirror_policer[sdk_mirror_obj_id], 0,
            sizeof(g_sai_db_ptr->mirror_policer[sdk_mirror_obj_id]));
+    memset(&g_sai_db_ptr->mirror_params[sdk_mirror_obj_id], 0,
+           sizeof(g_sai_db_ptr->mirror_params[sdk_mirror_obj_id]));
 
     sai_db_unlock();
 
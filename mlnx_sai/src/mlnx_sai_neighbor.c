@@ -433,6 +433,299 @@ static sai_status_t mlnx_get_neighbor(const sai_neighbor_entry_t* neighbor_entry
     return SAI_STATUS_SUCCESS;
 }
 
+typedef struct _mlnx_neighbor_key_list_ctx_t {
+    sai_object_id_t         switch_id;
+    sx_neigh_get_entry_t   *neighs;
+    mlnx_object_key_list_t *keys;
+} mlnx_neighbor_key_list_ctx_t;
+
+static sai_status_t mlnx_neighbor_rif_key_list_get(_In_ sx_router_interface_t sx_rif,
+                                                   _In_ sai_object_id_t       rif_oid,
+                                                   _In_ sx_ip_version_t       version,
+                                                   _Inout_ mlnx_neighbor_key_list_ctx_t *ctx)
+{
+    sx_status_t        sx_status;
+    sai_status_t       status;
+    sai_object_key_t  *key;
+    sx_ip_addr_t       ip_key;
+    sx_neigh_filter_t  filter;
+    sx_access_cmd_t    cmd = SX_ACCESS_CMD_GET_FIRST;
+    uint32_t           neighs_count, ii;
+
+    memset(&ip_key, 0, sizeof(ip_key));
+    memset(&filter, 0, sizeof(filter));
+    ip_key.version = version;
+
+    while (true) {
+        neighs_count = MLNX_OBJECT_KEY_SDK_PAGE_SIZE;
+
+        sx_status = sx_api_router_neigh_get(gh_sdk, cmd, sx_rif, &ip_key, &filter, ctx->neighs, &neighs_count);
+        if (SX_STATUS_ENTRY_NOT_FOUND == sx_status) {
+            break;
+        }
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get neighbors of rif %u - %s\n", sx_rif, SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
+
+        for (ii = 0; ii < neighs_count; ii++) {
+            if ((ctx->neighs[ii].ip_addr.version != version) || (ctx->neighs[ii].neigh_data.rif != sx_rif)) {
+                continue;
+            }
+
+            key = mlnx_object_key_list_next(ctx->keys);
+            if (!key) {
+                continue;
+            }
+
+            key->key.neighbor_entry.switch_id = ctx->switch_id;
+            key->key.neighbor_entry.rif_id = rif_oid;
+            status = mlnx_translate_sdk_ip_address_to_sai(&ctx->neighs[ii].ip_addr,
+                                                          &key->key.neighbor_entry.ip_address);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+        }
+
+        if (neighs_count < MLNX_OBJECT_KEY_SDK_PAGE_SIZE) {
+            break;
+        }
+
+        ip_key = ctx->neighs[neighs_count - 1].ip_addr;
+        cmd = SX_ACCESS_CMD_GETNEXT;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_neighbor_rif_keys_fill(_In_ sx_router_interface_t sx_rif,
+                                                _In_ sai_object_id_t       rif_oid,
+                                                _In_ void                 *ctx)
+{
+    sai_status_t status;
+
+    status = mlnx_neighbor_rif_key_list_get(sx_rif, rif_oid, SX_IP_VERSION_IPV4, ctx);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return mlnx_neighbor_rif_key_list_get(sx_rif, rif_oid, SX_IP_VERSION_IPV6, ctx);
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_neighbor_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    mlnx_neighbor_key_list_ctx_t ctx;
+    sai_status_t                 status;
+
+    assert(keys);
+
+    ctx.switch_id = switch_id;
+    ctx.keys = keys;
+    ctx.neighs = calloc(MLNX_OBJECT_KEY_SDK_PAGE_SIZE, sizeof(*ctx.neighs));
+    if (!ctx.neighs) {
+        SX_LOG_ERR("Failed to allocate memory for neighbors\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    status = mlnx_rif_db_iterate(mlnx_neighbor_rif_keys_fill, &ctx);
+
+    free(ctx.neighs);
+    return status;
+}
+
+static sai_status_t fill_neighbor_cache(mlnx_neighbor_cache_t      *neighbor_cache,
+                                        const sai_neighbor_entry_t *neighbor_entry)
+{
+    sai_status_t status;
+
+    if (neighbor_cache->neigh_cache_set) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    status = mlnx_get_neighbor(neighbor_entry, &neighbor_cache->neigh_get_entry);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    neighbor_cache->neigh_cache_set = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+typedef struct _mlnx_neighbor_bulk_key_t {
+    struct {
+        sx_router_interface_t rif;
+        sx_ip_addr_t          ip;
+    } key;
+    uint32_t idx;
+} mlnx_neighbor_bulk_key_t;
+
+/* Orders the keys by RIF and then as SDK orders the neighbors of a RIF */
+static int mlnx_neighbor_bulk_key_cmp(const void *a, const void *b)
+{
+    const mlnx_neighbor_bulk_key_t *key_a = a, *key_b = b;
+
+    if (key_a->key.rif != key_b->key.rif) {
+        return (key_a->key.rif < key_b->key.rif) ? -1 : 1;
+    }
+
+    return mlnx_sdk_ip_addr_cmp(&key_a->key.ip, &key_b->key.ip);
+}
+
+static void mlnx_neighbor_bulk_key_set(_In_ sx_router_interface_t      rif,
+                                       _In_ const sx_ip_addr_t        *ip,
+                                       _Out_ mlnx_neighbor_bulk_key_t *key)
+{
+    memset(key, 0, sizeof(*key));
+
+    key->key.rif = rif;
+    key->key.ip.version = ip->version;
+    if (SX_IP_VERSION_IPV4 == ip->version) {
+        key->key.ip.addr.ipv4 = ip->addr.ipv4;
+    } else {
+        key->key.ip.addr.ipv6 = ip->addr.ipv6;
+    }
+}
+
+/*
+ * Fills the neighbor caches of the bulk get by walking the SDK neighbor table of each requested RIF and IP version
+ * page by page, instead of a separate SDK get per neighbor.
+ * The walk starts at the lowest requested neighbor and stops past the highest one, SDK returns the neighbors of a
+ * RIF ordered by IP. The neighbors that are not found are left uncached and are read by the getters.
+ */
+sai_status_t mlnx_neighbor_bulk_cache_fill(_In_ uint32_t                object_count,
+                                           _In_ const sai_object_key_t *object_key,
+                                           _Inout_ vendor_cache_t      *caches)
+{
+    mlnx_neighbor_bulk_key_t *keys = NULL, *found, lookup;
+    sx_neigh_get_entry_t     *neighs = NULL;
+    mlnx_neighbor_cache_t    *neighbor_cache;
+    sx_neigh_filter_t         filter;
+    sx_router_interface_t     sx_rif;
+    sx_ip_addr_t              ip_addr;
+    sx_ip_version_t           version;
+    sx_access_cmd_t           cmd;
+    sx_status_t               sx_status;
+    sai_status_t              status = SAI_STATUS_SUCCESS;
+    uint32_t                  keys_count = 0, group_start, group_end, group_left, neighs_count, ii;
+    bool                      is_past_last;
+
+    assert(object_key);
+    assert(caches);
+
+    keys = calloc(object_count, sizeof(*keys));
+    neighs = calloc(MLNX_OBJECT_KEY_SDK_PAGE_SIZE, sizeof(*neighs));
+    if (!keys || !neighs) {
+        SX_LOG_ERR("Failed to allocate memory for neighbor bulk get\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        memset(&ip_addr, 0, sizeof(ip_addr));
+
+        /* Invalid keys are reported by the getters */
+        if (SAI_ERR(mlnx_translate_sai_neighbor_entry_to_sdk(&object_key[ii].key.neighbor_entry, &ip_addr))) {
+            continue;
+        }
+
+        if (SAI_ERR(mlnx_rif_oid_to_sdk_rif_id(object_key[ii].key.neighbor_entry.rif_id, &sx_rif))) {
+            continue;
+        }
+
+        mlnx_neighbor_bulk_key_set(sx_rif, &ip_addr, &keys[keys_count]);
+        keys[keys_count].idx = ii;
+        keys_count++;
+    }
+
+    qsort(keys, keys_count, sizeof(*keys), mlnx_neighbor_bulk_key_cmp);
+
+    memset(&filter, 0, sizeof(filter));
+
+    for (group_start = 0; group_start < keys_count; group_start = group_end) {
+        sx_rif = keys[group_start].key.rif;
+        version = keys[group_start].key.ip.version;
+
+        for (group_end = group_start + 1; group_end < keys_count; group_end++) {
+            if ((keys[group_end].key.rif != sx_rif) || (keys[group_end].key.ip.version != version)) {
+                break;
+            }
+        }
+
+        group_left = group_end - group_start;
+        is_past_last = false;
+
+        /* GET of the first neighbor, then GETNEXT from it */
+        ip_addr = keys[group_start].key.ip;
+        cmd = SX_ACCESS_CMD_GET;
+
+        while ((group_left > 0) && !is_past_last) {
+            neighs_count = (SX_ACCESS_CMD_GET == cmd) ? 1 : MLNX_OBJECT_KEY_SDK_PAGE_SIZE;
+
+            sx_status = sx_api_router_neigh_get(gh_sdk, cmd, sx_rif, &ip_addr, &filter, neighs, &neighs_count);
+            if (SX_STATUS_ENTRY_NOT_FOUND == sx_status) {
+                if (SX_ACCESS_CMD_GET != cmd) {
+                    break;
+                }
+                neighs_count = 0;
+            } else if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed to get neighbors of rif %u - %s\n", sx_rif, SX_STATUS_MSG(sx_status));
+                status = sdk_to_sai(sx_status);
+                goto out;
+            }
+
+            for (ii = 0; ii < neighs_count; ii++) {
+                if ((neighs[ii].ip_addr.version != version) || (neighs[ii].neigh_data.rif != sx_rif)) {
+                    continue;
+                }
+
+                mlnx_neighbor_bulk_key_set(sx_rif, &neighs[ii].ip_addr, &lookup);
+
+                /* Past the last requested neighbor, the rest of the table is not needed */
+                if (mlnx_neighbor_bulk_key_cmp(&lookup, &keys[group_end - 1]) > 0) {
+                    is_past_last = true;
+                    break;
+                }
+
+                found = bsearch(&lookup, &keys[group_start], group_end - group_start, sizeof(*keys),
+                                mlnx_neighbor_bulk_key_cmp);
+                if (!found) {
+                    continue;
+                }
+
+                /* The same neighbor can be requested more than once */
+                while ((found > &keys[group_start]) && (0 == mlnx_neighbor_bulk_key_cmp(found - 1, &lookup))) {
+                    found--;
+                }
+
+                for (; (found < &keys[group_end]) && (0 == mlnx_neighbor_bulk_key_cmp(found, &lookup)); found++) {
+                    neighbor_cache = &caches[found->idx].neighbor_cache;
+                    neighbor_cache->neigh_get_entry = neighs[ii];
+                    neighbor_cache->neigh_cache_set = true;
+                    group_left--;
+                }
+            }
+
+            if (SX_ACCESS_CMD_GET == cmd) {
+                cmd = SX_ACCESS_CMD_GETNEXT;
+                continue;
+            }
+
+            if (neighs_count < MLNX_OBJECT_KEY_SDK_PAGE_SIZE) {
+                break;
+            }
+
+            ip_addr = neighs[neighs_count - 1].ip_addr;
+        }
+    }
+
+out:
+    free(neighs);
+    free(keys);
+    return status;
+}
+
 /* Destination mac address for the neighbor [sai_mac_t] */
 static sai_status_t mlnx_neighbor_mac_get(_In_ const sai_object_key_t   *key,
                                           _Inout_ sai_attribute_value_t *value,
@@ -442,15 +735,16 @@ static sai_status_t mlnx_neighbor_mac_get(_In_ const sai_object_key_t   *key,
 {
     sai_status_t                status;
     const sai_neighbor_entry_t* neighbor_entry = &key->key.neighbor_entry;
-    sx_neigh_get_entry_t        neigh_entry;
+    mlnx_neighbor_cache_t      *neighbor_cache = &cache->neighbor_cache;
+    sx_neigh_get_entry_t       *neigh_entry = &neighbor_cache->neigh_get_entry;
 
     SX_LOG_ENTER();
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_get_neighbor(neighbor_entry, &neigh_entry))) {
+    if (SAI_STATUS_SUCCESS != (status = fill_neighbor_cache(neighbor_cache, neighbor_entry))) {
         return status;
     }
 
-    memcpy(value->mac, &neigh_entry.neigh_data.mac_addr, sizeof(value->mac));
+    memcpy(value->mac, &neigh_entry->neigh_data.mac_addr, sizeof(value->mac));
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -465,17 +759,18 @@ static sai_status_t mlnx_neighbor_action_get(_In_ const sai_object_key_t   *key,
 {
     sai_status_t                status;
     const sai_neighbor_entry_t* neighbor_entry = &key->key.neighbor_entry;
-    sx_neigh_get_entry_t        neigh_entry;
+    mlnx_neighbor_cache_t      *neighbor_cache = &cache->neighbor_cache;
+    sx_neigh_get_entry_t       *neigh_entry = &neighbor_cache->neigh_get_entry;
     sai_packet_action_t         packet_action;
 
     SX_LOG_ENTER();
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_get_neighbor(neighbor_entry, &neigh_entry))) {
+    if (SAI_STATUS_SUCCESS != (status = fill_neighbor_cache(neighbor_cache, neighbor_entry))) {
         return status;
     }
 
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_translate_sdk_router_action_to_sai(neigh_entry.neigh_data.action, &packet_action))) {
+        (status = mlnx_translate_sdk_router_action_to_sai(neigh_entry->neigh_data.action, &packet_action))) {
         return status;
     }
 
@@ -495,15 +790,16 @@ static sai_status_t mlnx_neighbor_no_host_get(_In_ const sai_object_key_t   *key
 {
     sai_status_t                status;
     const sai_neighbor_entry_t* neighbor_entry = &key->key.neighbor_entry;
-    sx_neigh_get_entry_t        neigh_entry;
+    mlnx_neighbor_cache_t      *neighbor_cache = &cache->neighbor_cache;
+    sx_neigh_get_entry_t       *neigh_entry = &neighbor_cache->neigh_get_entry;
 
     SX_LOG_ENTER();
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_get_neighbor(neighbor_entry, &neigh_entry))) {
+    if (SAI_STATUS_SUCCESS != (status = fill_neighbor_cache(neighbor_cache, neighbor_entry))) {
         return status;
     }
 
-    value->booldata = neigh_entry.neigh_data.is_software_only;
+    value->booldata = neigh_entry->neigh_data.is_software_only;
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -662,28 +958,29 @@ static sai_status_t mlnx_neighbor_trap_get(_In_ const sai_object_key_t   *key,
 {
     sai_status_t                status;
     const sai_neighbor_entry_t* neighbor_entry = &key->key.neighbor_entry;
-    sx_neigh_get_entry_t        neigh_entry;
+    mlnx_neighbor_cache_t      *neighbor_cache = &cache->neighbor_cache;
+    sx_neigh_get_entry_t       *neigh_entry = &neighbor_cache->neigh_get_entry;
     sai_packet_action_t         packet_action;
 
-    status = mlnx_get_neighbor(neighbor_entry, &neigh_entry);
+    status = fill_neighbor_cache(neighbor_cache, neighbor_entry);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to get neighbor data\n");
         return status;
     }
 
-    status = mlnx_translate_sdk_router_action_to_sai(neigh_entry.neigh_data.action, &packet_action);
+    status = mlnx_translate_sdk_router_action_to_sai(neigh_entry->neigh_data.action, &packet_action);
     if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to translate SDK router action %d to SAI\n", neigh_entry.neigh_data.action);
+        SX_LOG_ERR("Failed to translate SDK router action %d to SAI\n", neigh_entry->neigh_data.action);
         return status;
     }
 
     sai_db_read_lock();
     if (is_action_trap(packet_action)) {
         status = mlnx_get_user_defined_trap_by_prio(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
-                                                    neigh_entry.neigh_data.trap_attr.prio,
+                                                    neigh_entry->neigh_data.trap_attr.prio,
                                                     &value->oid);
         if (SAI_ERR(status)) {
-            SX_LOG_ERR("Failed to lookup trap oid by trap prio %d\n", neigh_entry.neigh_data.trap_attr.prio);
+            SX_LOG_ERR("Failed to lookup trap oid by trap prio %d\n", neigh_entry->neigh_data.trap_attr.prio);
             goto out;
         }
     } else {
@@ -886,9 +1183,27 @@ sai_status_t mlnx_neighbor_log_set(sx_verbosity_level_t level)
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_create_neighbor_entry_timed(_In_ const sai_neighbor_entry_t* neighbor_entry,
+                                                     _In_ uint32_t                    attr_count,
+                                                     _In_ const sai_attribute_t      *attr_list)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, MLNX_API_STATS_OP_CREATE,
+                                mlnx_create_neighbor_entry(neighbor_entry, attr_count, attr_list));
+}
+
+static sai_status_t mlnx_remove_neighbor_entry_timed(_In_ const sai_neighbor_entry_t* neighbor_entry)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, MLNX_API_STATS_OP_REMOVE,
+                                mlnx_remove_neighbor_entry(neighbor_entry));
+}
+
 const sai_neighbor_api_t mlnx_neighbor_api = {
-    mlnx_create_neighbor_entry,
-    mlnx_remove_neighbor_entry,
+    mlnx_create_neighbor_entry_timed,
+    mlnx_remove_neighbor_entry_timed,
     mlnx_set_neighbor_attribute,
     mlnx_get_neighbor_attribute,
     mlnx_remove_all_neighbor_entries,
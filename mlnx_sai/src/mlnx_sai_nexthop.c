@@ -1961,9 +1961,28 @@ sai_status_t mlnx_nexthop_log_set(sx_verbosity_level_t level)
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_create_next_hop_timed(_Out_ sai_object_id_t      *next_hop_id,
+                                               _In_ sai_object_id_t        switch_id,
+                                               _In_ uint32_t               attr_count,
+                                               _In_ const sai_attribute_t *attr_list)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_NEXT_HOP, MLNX_API_STATS_OP_CREATE,
+                                mlnx_create_next_hop(next_hop_id, switch_id, attr_count, attr_list));
+}
+
+static sai_status_t mlnx_remove_next_hop_timed(_In_ sai_object_id_t next_hop_id)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_NEXT_HOP, MLNX_API_STATS_OP_REMOVE,
+                                mlnx_remove_next_hop(next_hop_id));
+}
+
 const sai_next_hop_api_t mlnx_next_hop_api = {
-    mlnx_create_next_hop,
-    mlnx_remove_next_hop,
+    mlnx_create_next_hop_timed,
+    mlnx_remove_next_hop_timed,
     mlnx_set_next_hop_attribute,
     mlnx_get_next_hop_attribute
 };
@@ -386,6 +386,12 @@ sai_status_t mlnx_nhg_oid_create(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ sai_obj
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_nhg_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    return mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_NHG, mlnx_nhg_oid_create);
+}
+
 
 static sai_status_t mlnx_nhgm_db_entry_alloc(_Out_ mlnx_nhgm_db_entry_t   **nhgm_db_entry,
                                              _Out_ mlnx_shm_rm_array_idx_t *idx)
@@ -496,6 +502,12 @@ sai_status_t mlnx_nhgm_oid_create(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ sai_ob
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_nhgm_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    return mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_NHG_MEMBER, mlnx_nhgm_oid_create);
+}
+
 static sai_status_t mlnx_sdk_nhop_by_ecmp_id_get(sx_ecmp_id_t sdk_ecmp_id, sx_next_hop_t *sx_next_hop)
 {
     uint32_t    sdk_next_hop_cnt = 1;
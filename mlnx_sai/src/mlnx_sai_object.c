@@ -34,6 +34,121 @@ sai_status_t mlnx_utils_attrs_is_resource_check(_In_ sai_object_type_t      obje
 extern const mlnx_availability_get_fn        mlnx_availability_get_fns[SAI_OBJECT_TYPE_MAX];
 extern const mlnx_bulk_object_get_stats_fn   mlnx_bulk_object_get_stats_fns[SAI_OBJECT_TYPE_MAX];
 extern const mlnx_bulk_object_clear_stats_fn mlnx_bulk_object_clear_stats_fns[SAI_OBJECT_TYPE_MAX];
+extern const mlnx_object_key_list_get_fn     mlnx_object_key_list_get_fns[SAI_OBJECT_TYPE_MAX];
+extern const mlnx_bulk_get_cache_fill_fn     mlnx_bulk_get_cache_fill_fns[SAI_OBJECT_TYPE_MAX];
+
+/* Returns the next free slot of the list or NULL if only counting (or the list is full), counts the object */
+sai_object_key_t* mlnx_object_key_list_next(_Inout_ mlnx_object_key_list_t *keys)
+{
+    sai_object_key_t *key = NULL;
+
+    assert(keys);
+
+    if (keys->list && (keys->count < keys->size)) {
+        key = &keys->list[keys->count];
+        memset(key, 0, sizeof(*key));
+    }
+
+    keys->count++;
+
+    return key;
+}
+
+sai_status_t mlnx_object_key_list_oid_add(_Inout_ mlnx_object_key_list_t *keys, _In_ sai_object_id_t oid)
+{
+    sai_object_key_t *key;
+
+    key = mlnx_object_key_list_next(keys);
+    if (key) {
+        key->key.object_id = oid;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_object_key_list_rm_array_fill(_Inout_ mlnx_object_key_list_t *keys,
+                                                _In_ mlnx_shm_rm_array_type_t type,
+                                                _In_ mlnx_shm_rm_oid_create_fn oid_create)
+{
+    const mlnx_shm_array_hdr_t *array_hdr;
+    mlnx_shm_rm_array_idx_t     idx;
+    sai_object_key_t           *key;
+    sai_status_t                status;
+    void                       *elem;
+    uint32_t                    ii, size;
+
+    assert(keys);
+    assert(oid_create);
+
+    size = mlnx_shm_rm_array_size_get(type);
+
+    for (ii = 0; ii < size; ii++) {
+        idx.type = type;
+        idx.idx = ii;
+
+        status = mlnx_shm_rm_array_idx_to_ptr(idx, &elem);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        array_hdr = elem;
+        if (!array_hdr->is_used) {
+            continue;
+        }
+
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = oid_create(idx, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Enumerates all the objects of the type in a single pass over the DB (or the SDK table)
+ * and fills as many keys as fit in the list.
+ */
+static sai_status_t mlnx_object_key_list_get(_In_ sai_object_id_t            switch_id,
+                                             _In_ sai_object_type_t          object_type,
+                                             _Inout_ mlnx_object_key_list_t *keys)
+{
+    sai_status_t                  status;
+    const sai_object_type_info_t *obj_type_info;
+
+    if (!gh_sdk) {
+        MLNX_SAI_LOG_ERR("Can't get object keys before creating a switch\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    obj_type_info = sai_metadata_get_object_type_info(object_type);
+    if (!obj_type_info) {
+        SX_LOG_ERR("Invalid object type - %d\n", object_type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!mlnx_object_key_list_get_fns[object_type]) {
+        SX_LOG_NTC("Object key list for object type %s is not implemented\n", obj_type_info->objecttypename);
+        return SAI_STATUS_NOT_IMPLEMENTED;
+    }
+
+    sai_db_read_lock();
+
+    status = mlnx_object_key_list_get_fns[object_type](switch_id, keys);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to get object keys of type %s\n", obj_type_info->objecttypename);
+    }
+
+    sai_db_unlock();
+
+    return status;
+}
 
 /**
  * @brief Get maximum number of attributes for an object type
@@ -64,7 +179,27 @@ sai_status_t sai_get_object_count(_In_ sai_object_id_t   switch_id,
                                   _In_ sai_object_type_t object_type,
                                   _Inout_ uint32_t      *count)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    mlnx_object_key_list_t keys = {0};
+    sai_status_t           status;
+
+    SX_LOG_ENTER();
+
+    if (NULL == count) {
+        SX_LOG_ERR("NULL count param\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    status = mlnx_object_key_list_get(switch_id, object_type, &keys);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    *count = keys.count;
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
 }
 
 /**
@@ -82,7 +217,65 @@ sai_status_t sai_get_object_key(_In_ sai_object_id_t      switch_id,
                                 _Inout_ uint32_t         *object_count,
                                 _Inout_ sai_object_key_t *object_list)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    mlnx_object_key_list_t keys = {0};
+    sai_status_t           status;
+
+    SX_LOG_ENTER();
+
+    if (NULL == object_count) {
+        SX_LOG_ERR("NULL object_count param\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if ((*object_count > 0) && (NULL == object_list)) {
+        SX_LOG_ERR("object_count > 0 but object_list is NULL\n");
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    keys.list = object_list;
+    keys.size = *object_count;
+
+    status = mlnx_object_key_list_get(switch_id, object_type, &keys);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    *object_count = keys.count;
+
+    if (keys.count > keys.size) {
+        SX_LOG_NTC("Object list size %u is too small, %u objects of type %s exist\n",
+                   keys.size, keys.count, SAI_TYPE_STR(object_type));
+        SX_LOG_EXIT();
+        return SAI_STATUS_BUFFER_OVERFLOW;
+    }
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * The cache fill reads at most the whole SDK table page by page, so it pays off once the bulk has as many objects
+ * as the table has pages. The fixed minimum covers the small tables.
+ */
+static bool mlnx_bulk_get_cache_fill_is_needed(_In_ sai_object_type_t object_type, _In_ uint32_t object_count)
+{
+    sai_status_t status;
+    uint32_t     table_entries;
+
+    if (!mlnx_bulk_get_cache_fill_fns[object_type] || (object_count < MLNX_BULK_GET_CACHE_FILL_MIN_OBJECTS)) {
+        return false;
+    }
+
+    status = mlnx_switch_table_used_entries_get(object_type, &table_entries);
+    if (SAI_ERR(status)) {
+        /* Only the fixed minimum is applied */
+        return true;
+    }
+
+    return object_count >= (table_entries / MLNX_OBJECT_KEY_SDK_PAGE_SIZE);
 }
 
 /**
@@ -122,7 +315,78 @@ sai_status_t sai_bulk_get_attribute(_In_ sai_object_id_t         switch_id,
                                     _Inout_ sai_attribute_t    **attrs,
                                     _Inout_ sai_status_t        *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    vendor_cache_t *caches = NULL;
+    sai_status_t    status;
+
+    SX_LOG_ENTER();
+
+    if (!gh_sdk) {
+        MLNX_SAI_LOG_ERR("Can't get object attributes before creating a switch\n");
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    if (!sai_metadata_is_object_type_valid(object_type)) {
+        SX_LOG_ERR("Invalid object type - %d\n", object_type);
+        status = SAI_STATUS_INVALID_PARAMETER;
+        goto out;
+    }
+
+    if (0 == object_count) {
+        SX_LOG_ERR("object_count is 0\n");
+        status = SAI_STATUS_INVALID_PARAMETER;
+        goto out;
+    }
+
+    if (NULL == object_key) {
+        SX_LOG_ERR("NULL object_key param\n");
+        status = SAI_STATUS_INVALID_PARAMETER;
+        goto out;
+    }
+
+    if (NULL == attr_count) {
+        SX_LOG_ERR("NULL attr_count param\n");
+        status = SAI_STATUS_INVALID_PARAMETER;
+        goto out;
+    }
+
+    if (NULL == attrs) {
+        SX_LOG_ERR("NULL attrs param\n");
+        status = SAI_STATUS_INVALID_PARAMETER;
+        goto out;
+    }
+
+    if (NULL == object_statuses) {
+        SX_LOG_ERR("NULL object_statuses param\n");
+        status = SAI_STATUS_INVALID_PARAMETER;
+        goto out;
+    }
+
+    caches = calloc(object_count, sizeof(*caches));
+    if (!caches) {
+        SX_LOG_ERR("Failed to allocate memory for %u getter caches\n", object_count);
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    if (mlnx_bulk_get_cache_fill_is_needed(object_type, object_count)) {
+        status = mlnx_bulk_get_cache_fill_fns[object_type](object_count, object_key, caches);
+        if (SAI_ERR(status)) {
+            /* Not fatal, the getters will read the entries one by one */
+            SX_LOG_WRN("Failed to pre-fill %s caches, falling back to per object get\n", SAI_TYPE_STR(object_type));
+            memset(caches, 0, object_count * sizeof(*caches));
+        }
+    }
+
+    status = sai_bulk_get_attributes(object_type, object_count, object_key, attr_count, attrs, caches,
+                                     object_statuses);
+
+    mlnx_bulk_statuses_print(SAI_TYPE_STR(object_type), object_statuses, object_count, SAI_COMMON_API_BULK_GET);
+
+out:
+    free(caches);
+    SX_LOG_EXIT();
+    return status;
 }
 
 /**
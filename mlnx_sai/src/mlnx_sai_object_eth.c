@@ -129,6 +129,91 @@ const mlnx_availability_get_fn mlnx_availability_get_fns[SAI_OBJECT_TYPE_MAX] =
     [SAI_OBJECT_TYPE_DEBUG_COUNTER] = mlnx_debug_counter_availability_get,
 };
 
+sai_status_t mlnx_port_key_list_get(_In_ sai_object_id_t            switch_id,
+                                    _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_lag_key_list_get(_In_ sai_object_id_t            switch_id,
+                                   _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_virtual_router_key_list_get(_In_ sai_object_id_t            switch_id,
+                                              _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_rif_key_list_get(_In_ sai_object_id_t            switch_id,
+                                   _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_nhg_key_list_get(_In_ sai_object_id_t            switch_id,
+                                   _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_route_key_list_get(_In_ sai_object_id_t            switch_id,
+                                     _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_neighbor_key_list_get(_In_ sai_object_id_t            switch_id,
+                                        _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_fdb_key_list_get(_In_ sai_object_id_t            switch_id,
+                                   _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_policer_key_list_get(_In_ sai_object_id_t            switch_id,
+                                       _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_tunnel_key_list_get(_In_ sai_object_id_t            switch_id,
+                                      _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_bridge_key_list_get(_In_ sai_object_id_t            switch_id,
+                                      _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_bridge_port_key_list_get(_In_ sai_object_id_t            switch_id,
+                                           _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_bfd_session_key_list_get(_In_ sai_object_id_t            switch_id,
+                                           _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_counter_key_list_get(_In_ sai_object_id_t            switch_id,
+                                       _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_nhgm_key_list_get(_In_ sai_object_id_t            switch_id,
+                                    _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_debug_counter_key_list_get(_In_ sai_object_id_t            switch_id,
+                                             _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_vlan_key_list_get(_In_ sai_object_id_t            switch_id,
+                                    _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_vlan_member_key_list_get(_In_ sai_object_id_t            switch_id,
+                                           _Inout_ mlnx_object_key_list_t *keys);
+sai_status_t mlnx_hostif_key_list_get(_In_ sai_object_id_t            switch_id,
+                                      _Inout_ mlnx_object_key_list_t *keys);
+
+/*
+ * Types without a handler return SAI_STATUS_NOT_IMPLEMENTED. Excluded on purpose:
+ * - NEXT_HOP - an IP next hop is only an SDK ECMP container (the OID keeps the ECMP id), there is no
+ *   SAI DB entry to walk and the SDK ECMP containers of the next hop groups and of the encap next hops
+ *   can't be told apart from it
+ * - ACL_TABLE, ACL_ENTRY, ACL_COUNTER, ACL_RANGE, ACL_TABLE_GROUP, ACL_TABLE_GROUP_MEMBER - the ACL DB
+ *   is guarded by its own lock, not by the SAI DB lock the handlers are called with
+ */
+const mlnx_object_key_list_get_fn mlnx_object_key_list_get_fns[SAI_OBJECT_TYPE_MAX] = {
+    [SAI_OBJECT_TYPE_PORT] = mlnx_port_key_list_get,
+    [SAI_OBJECT_TYPE_LAG] = mlnx_lag_key_list_get,
+    [SAI_OBJECT_TYPE_VIRTUAL_ROUTER] = mlnx_virtual_router_key_list_get,
+    [SAI_OBJECT_TYPE_ROUTER_INTERFACE] = mlnx_rif_key_list_get,
+    [SAI_OBJECT_TYPE_NEXT_HOP_GROUP] = mlnx_nhg_key_list_get,
+    [SAI_OBJECT_TYPE_ROUTE_ENTRY] = mlnx_route_key_list_get,
+    [SAI_OBJECT_TYPE_NEIGHBOR_ENTRY] = mlnx_neighbor_key_list_get,
+    [SAI_OBJECT_TYPE_FDB_ENTRY] = mlnx_fdb_key_list_get,
+    [SAI_OBJECT_TYPE_POLICER] = mlnx_policer_key_list_get,
+    [SAI_OBJECT_TYPE_TUNNEL] = mlnx_tunnel_key_list_get,
+    [SAI_OBJECT_TYPE_BRIDGE] = mlnx_bridge_key_list_get,
+    [SAI_OBJECT_TYPE_BRIDGE_PORT] = mlnx_bridge_port_key_list_get,
+    [SAI_OBJECT_TYPE_BFD_SESSION] = mlnx_bfd_session_key_list_get,
+    [SAI_OBJECT_TYPE_COUNTER] = mlnx_counter_key_list_get,
+    [SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER] = mlnx_nhgm_key_list_get,
+    [SAI_OBJECT_TYPE_DEBUG_COUNTER] = mlnx_debug_counter_key_list_get,
+    [SAI_OBJECT_TYPE_VLAN] = mlnx_vlan_key_list_get,
+    [SAI_OBJECT_TYPE_VLAN_MEMBER] = mlnx_vlan_member_key_list_get,
+    [SAI_OBJECT_TYPE_HOSTIF] = mlnx_hostif_key_list_get,
+};
+
+sai_status_t mlnx_route_bulk_cache_fill(_In_ uint32_t                object_count,
+                                        _In_ const sai_object_key_t *object_key,
+                                        _Inout_ vendor_cache_t      *caches);
+sai_status_t mlnx_neighbor_bulk_cache_fill(_In_ uint32_t                object_count,
+                                           _In_ const sai_object_key_t *object_key,
+                                           _Inout_ vendor_cache_t      *caches);
+sai_status_t mlnx_fdb_bulk_cache_fill(_In_ uint32_t                object_count,
+                                      _In_ const sai_object_key_t *object_key,
+                                      _Inout_ vendor_cache_t      *caches);
+
+const mlnx_bulk_get_cache_fill_fn mlnx_bulk_get_cache_fill_fns[SAI_OBJECT_TYPE_MAX] = {
+    [SAI_OBJECT_TYPE_ROUTE_ENTRY] = mlnx_route_bulk_cache_fill,
+    [SAI_OBJECT_TYPE_NEIGHBOR_ENTRY] = mlnx_neighbor_bulk_cache_fill,
+    [SAI_OBJECT_TYPE_FDB_ENTRY] = mlnx_fdb_bulk_cache_fill,
+};
+
 sai_status_t mlnx_sai_bulk_queue_stats_get(_In_ sai_object_id_t         switch_id,
                                            _In_ uint32_t                object_count,
                                            _In_ const sai_object_key_t *object_key,
@@ -45,6 +45,7 @@
 #include "mlnx_sai.h"
 #include "assert.h"
 #include <limits.h>
+#include <stddef.h>
 #include <math.h>
 
 
@@ -507,6 +508,12 @@ sai_status_t mlnx_policer_oid_create(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ sai
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_policer_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    return mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_POLICER, mlnx_policer_oid_create);
+}
+
 static sai_status_t sai_policer_mode_get(_In_ const sai_object_key_t   *key,
                                          _Inout_ sai_attribute_value_t *value,
                                          _In_ uint32_t                  attr_index,
@@ -1880,31 +1887,173 @@ void db_reset_policer_entry(_In_ mlnx_policer_db_entry_t* policers_entry_p)
     SX_LOG_EXIT();
 }
 
-uint32_t mlnx_policer_db_free_entries_count(bool is_hostif)
+/*
+ * sx policer id hash - sx_policer_id_trap and sx_policer_id_acl of the used entries, chained from the
+ * mlnx_policer_sx_hash_db buckets through the entry *_next fields.
+ * A link is (policer db idx << 1 | is acl) + 1, 0 ends the chain.
+ */
+#define MLNX_POLICER_SX_HASH_LINK(db_idx, is_acl) ((((db_idx) << 1) | (is_acl)) + 1)
+#define MLNX_POLICER_SX_HASH_LINK_IDX(link)       (((link) - 1) >> 1)
+#define MLNX_POLICER_SX_HASH_LINK_IS_ACL(link)    (((link) - 1) & 1)
+
+static uint32_t mlnx_policer_sx_hash_bucket(_In_ sx_policer_id_t sx_policer)
+{
+    uint64_t key = (uint64_t)sx_policer;
+
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return (uint32_t)(key % mlnx_shm_table_size(MLNX_SHM_TABLE_TYPE_POLICER_SX_HASH));
+}
+
+/* Returns the sx policer id field of the link and its next link field */
+static sx_policer_id_t mlnx_policer_sx_hash_link_get(_In_ uint32_t link, _Out_ uint32_t **next)
 {
-    uint32_t                        ii, rm_limit, policers_created = 0, hostif_policers_created = 0;
     mlnx_policer_shm_array_entry_t *policer_array;
 
-    for (ii = 0; ii < mlnx_shm_rm_array_size_get(MLNX_SHM_RM_ARRAY_TYPE_POLICER); ii++) {
-        mlnx_shm_rm_array_idx_t idx;
-        idx.type = MLNX_SHM_RM_ARRAY_TYPE_POLICER;
-        idx.idx = ii;
-        if (SAI_ERR(mlnx_policer_db_idx_to_data(idx, &policer_array))) {
-            SX_LOG_ERR("get policer array item failed \n");
-            return 0;
+    if (SAI_ERR(mlnx_shm_rm_array_type_idx_to_ptr(MLNX_SHM_RM_ARRAY_TYPE_POLICER,
+                                                  MLNX_POLICER_SX_HASH_LINK_IDX(link),
+                                                  (void**)&policer_array))) {
+        *next = NULL;
+        return SX_POLICER_ID_INVALID;
+    }
+
+    if (MLNX_POLICER_SX_HASH_LINK_IS_ACL(link)) {
+        *next = &policer_array->data.sx_policer_id_acl_next;
+        return policer_array->data.sx_policer_id_acl;
+    }
+
+    *next = &policer_array->data.sx_policer_id_trap_next;
+    return policer_array->data.sx_policer_id_trap;
+}
+
+/* Link of the trap or ACL sx policer of the entry, 0 for the other sx policers */
+static uint32_t mlnx_policer_sx_hash_link_by_field(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                                   _In_ const sx_policer_id_t         *sx_policer)
+{
+    mlnx_shm_rm_array_idx_t idx;
+    const uint8_t          *entry;
+
+    if ((sx_policer != &policer_entry->sx_policer_id_trap) && (sx_policer != &policer_entry->sx_policer_id_acl)) {
+        return 0;
+    }
+
+    entry = (const uint8_t*)policer_entry - offsetof(mlnx_policer_shm_array_entry_t, data);
+    if (SAI_ERR(mlnx_shm_rm_array_type_ptr_to_idx(MLNX_SHM_RM_ARRAY_TYPE_POLICER, entry, &idx))) {
+        return 0;
+    }
+
+    return MLNX_POLICER_SX_HASH_LINK(idx.idx, sx_policer == &policer_entry->sx_policer_id_acl);
+}
+
+/* DB write lock is needed */
+static void mlnx_policer_sx_hash_add(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                     _In_ const sx_policer_id_t         *sx_policer)
+{
+    uint32_t *head, *next;
+    uint32_t  link;
+
+    link = mlnx_policer_sx_hash_link_by_field(policer_entry, sx_policer);
+    if (!link) {
+        return;
+    }
+
+    head = &mlnx_policer_sx_hash_db[mlnx_policer_sx_hash_bucket(*sx_policer)];
+    mlnx_policer_sx_hash_link_get(link, &next);
+    *next = *head;
+    *head = link;
+}
+
+/* DB write lock is needed */
+static void mlnx_policer_sx_hash_del(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                     _In_ const sx_policer_id_t         *sx_policer)
+{
+    uint32_t *prev, *next;
+    uint32_t  link;
+
+    link = mlnx_policer_sx_hash_link_by_field(policer_entry, sx_policer);
+    if (!link) {
+        return;
+    }
+
+    prev = &mlnx_policer_sx_hash_db[mlnx_policer_sx_hash_bucket(*sx_policer)];
+    while (*prev && (*prev != link)) {
+        mlnx_policer_sx_hash_link_get(*prev, &next);
+        if (!next) {
+            break;
         }
-        if (policer_array->array_hdr.is_used) {
-            if (policer_array->data.sx_policer_id_trap != SX_POLICER_ID_INVALID) {
-                hostif_policers_created++;
-            }
+        prev = next;
+    }
 
-            if ((policer_array->data.sx_policer_id_acl != SX_POLICER_ID_INVALID) ||
-                (policer_array->data.sx_policer_id_acl_mirror != SX_POLICER_ID_INVALID)) {
-                policers_created++;
-            }
+    if (*prev != link) {
+        SX_LOG_ERR("sx policer 0x%" PRIx64 " is not in the sx policer id hash\n", *sx_policer);
+        return;
+    }
+
+    mlnx_policer_sx_hash_link_get(link, &next);
+    *prev = *next;
+    *next = 0;
+}
+
+/* DB write lock is needed. sx_policer points to the field of policer_entry that got a new sx policer */
+void mlnx_policer_db_sx_policer_created(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                        _In_ const sx_policer_id_t         *sx_policer)
+{
+    assert(policer_entry);
+    assert(sx_policer);
+
+    mlnx_policer_sx_hash_add(policer_entry, sx_policer);
+
+    if (sx_policer == &policer_entry->sx_policer_id_trap) {
+        g_sai_db_ptr->policers_sx_trap_created++;
+    } else if (sx_policer == &policer_entry->sx_policer_id_acl) {
+        if (policer_entry->sx_policer_id_acl_mirror == SX_POLICER_ID_INVALID) {
+            g_sai_db_ptr->policers_sx_acl_created++;
         }
+    } else if (sx_policer == &policer_entry->sx_policer_id_acl_mirror) {
+        if (policer_entry->sx_policer_id_acl == SX_POLICER_ID_INVALID) {
+            g_sai_db_ptr->policers_sx_acl_created++;
+        }
+    }
+}
+
+/* DB write lock is needed. Must be called before the field is reset to SX_POLICER_ID_INVALID */
+void mlnx_policer_db_sx_policer_destroyed(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                          _In_ const sx_policer_id_t         *sx_policer)
+{
+    assert(policer_entry);
+    assert(sx_policer);
+
+    if (*sx_policer == SX_POLICER_ID_INVALID) {
+        return;
     }
 
+    mlnx_policer_sx_hash_del(policer_entry, sx_policer);
+
+    if (sx_policer == &policer_entry->sx_policer_id_trap) {
+        assert(g_sai_db_ptr->policers_sx_trap_created > 0);
+        g_sai_db_ptr->policers_sx_trap_created--;
+    } else if (sx_policer == &policer_entry->sx_policer_id_acl) {
+        if (policer_entry->sx_policer_id_acl_mirror == SX_POLICER_ID_INVALID) {
+            assert(g_sai_db_ptr->policers_sx_acl_created > 0);
+            g_sai_db_ptr->policers_sx_acl_created--;
+        }
+    } else if (sx_policer == &policer_entry->sx_policer_id_acl_mirror) {
+        if (policer_entry->sx_policer_id_acl == SX_POLICER_ID_INVALID) {
+            assert(g_sai_db_ptr->policers_sx_acl_created > 0);
+            g_sai_db_ptr->policers_sx_acl_created--;
+        }
+    }
+}
+
+uint32_t mlnx_policer_db_free_entries_count(bool is_hostif)
+{
+    uint32_t rm_limit, policers_created, hostif_policers_created;
+
+    policers_created = g_sai_db_ptr->policers_sx_acl_created;
+    hostif_policers_created = g_sai_db_ptr->policers_sx_trap_created;
+
     if (is_hostif) {
         rm_limit = g_resource_limits.policer_host_ifc_pool_size;
     } else {
@@ -1966,46 +2115,97 @@ sai_status_t db_init_sai_policer_data(_In_ sx_policer_attributes_t * policer_att
 
 sai_status_t db_find_sai_policer_entry_ind(_In_ sx_policer_id_t sx_policer, _Out_ mlnx_shm_rm_array_idx_t* idx_p)
 {
-    sai_status_t                    status;
-    uint32_t                        policer_entry_ind;
-    uint32_t                        policer_entry_cnt = mlnx_shm_rm_array_size_get(MLNX_SHM_RM_ARRAY_TYPE_POLICER);
+    uint32_t *next;
+    uint32_t  link;
+
+    if (NULL == idx_p) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (sx_policer == SX_POLICER_ID_INVALID) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    for (link = mlnx_policer_sx_hash_db[mlnx_policer_sx_hash_bucket(sx_policer)]; link; link = *next) {
+        if (mlnx_policer_sx_hash_link_get(link, &next) == sx_policer) {
+            idx_p->type = MLNX_SHM_RM_ARRAY_TYPE_POLICER;
+            idx_p->idx = MLNX_POLICER_SX_HASH_LINK_IDX(link);
+            return SAI_STATUS_SUCCESS;
+        }
+
+        if (!next) {
+            SX_LOG_ERR("Invalid link %u in the sx policer id hash\n", link);
+            return SAI_STATUS_FAILURE;
+        }
+    }
+
+    return SAI_STATUS_ITEM_NOT_FOUND;
+}
+
+/*
+ * Verifies the sx policer id hash against the policer DB:
+ *   sx_policers - trap and ACL sx policers of the used entries
+ *   hashed      - links in the hash
+ *   missing     - sx policers not found in the hash or found under another entry
+ *   stale       - links of the hash not matching a used entry (hashed - (sx_policers - missing))
+ */
+void mlnx_policer_sx_hash_check(_Out_ uint32_t *sx_policers,
+                                _Out_ uint32_t *hashed,
+                                _Out_ uint32_t *missing,
+                                _Out_ uint32_t *stale)
+{
     mlnx_policer_shm_array_entry_t *policer_array;
     mlnx_shm_rm_array_idx_t         idx;
+    const sx_policer_id_t          *ids[2];
+    uint32_t                        policer_entry_cnt = mlnx_shm_rm_array_size_get(MLNX_SHM_RM_ARRAY_TYPE_POLICER);
+    uint32_t                        buckets = mlnx_shm_table_size(MLNX_SHM_TABLE_TYPE_POLICER_SX_HASH);
+    uint32_t                        ii, jj, link, *next;
 
-    idx.type = MLNX_SHM_RM_ARRAY_TYPE_POLICER;
+    assert(sx_policers && hashed && missing && stale);
 
-    if (NULL == idx_p) {
-        return SAI_STATUS_INVALID_PARAMETER;
+    *sx_policers = *hashed = *missing = *stale = 0;
+
+    for (ii = 0; ii < buckets; ii++) {
+        for (link = mlnx_policer_sx_hash_db[ii]; link && (*hashed <= 2 * policer_entry_cnt); link = *next) {
+            mlnx_policer_sx_hash_link_get(link, &next);
+            (*hashed)++;
+            if (!next) {
+                break;
+            }
+        }
     }
 
-    for (policer_entry_ind = 0; policer_entry_ind < policer_entry_cnt; policer_entry_ind++) {
-        idx.idx = policer_entry_ind;
-        if (SAI_ERR(status = mlnx_policer_db_idx_to_data(idx, &policer_array))) {
-            SX_LOG_ERR("get Policer array item failed \n");
-            return status;
+    for (ii = 0; ii < policer_entry_cnt; ii++) {
+        if (SAI_ERR(mlnx_shm_rm_array_type_idx_to_ptr(MLNX_SHM_RM_ARRAY_TYPE_POLICER, ii,
+                                                      (void**)&policer_array))) {
+            continue;
         }
+
         if (!policer_array->array_hdr.is_used) {
             continue;
         }
-        if (sx_policer == policer_array->data.sx_policer_id_trap) {
-            break;
-        }
-        if (sx_policer == policer_array->data.sx_policer_id_acl) {
-            break;
+
+        ids[0] = &policer_array->data.sx_policer_id_trap;
+        ids[1] = &policer_array->data.sx_policer_id_acl;
+
+        for (jj = 0; jj < ARRAY_SIZE(ids); jj++) {
+            if (*ids[jj] == SX_POLICER_ID_INVALID) {
+                continue;
+            }
+
+            (*sx_policers)++;
+
+            if (SAI_ERR(db_find_sai_policer_entry_ind(*ids[jj], &idx)) || (idx.idx != ii)) {
+                (*missing)++;
+            }
         }
     }
 
-    if (policer_entry_ind == policer_entry_cnt) {
-        status = SAI_STATUS_ITEM_NOT_FOUND;
-    } else {
-        *idx_p = idx;
-        status = SAI_STATUS_SUCCESS;
+    if (*hashed > *sx_policers - *missing) {
+        *stale = *hashed - (*sx_policers - *missing);
     }
-
-    return status;
 }
 
-
 static sai_status_t mlnx_sai_create_policer(_Out_ sai_object_id_t      *policer_id,
                                             _In_ sai_object_id_t        switch_id,
                                             _In_ uint32_t               attr_count,
@@ -2148,6 +2348,7 @@ static sai_status_t mlnx_sai_remove_policer(_In_ sai_object_id_t sai_policer_id)
             sai_status = sdk_to_sai(sx_status);
             goto exit;
         }
+        mlnx_policer_db_sx_policer_destroyed(policer_db_data, &policer_db_data->sx_policer_id_acl);
         policer_db_data->sx_policer_id_acl = SX_POLICER_ID_INVALID;
     }
     if (policer_db_data->sx_policer_id_trap != SX_POLICER_ID_INVALID) {
@@ -2163,6 +2364,7 @@ static sai_status_t mlnx_sai_remove_policer(_In_ sai_object_id_t sai_policer_id)
             sai_status = sdk_to_sai(sx_status);
             goto exit;
         }
+        mlnx_policer_db_sx_policer_destroyed(policer_db_data, &policer_db_data->sx_policer_id_trap);
         policer_db_data->sx_policer_id_trap = SX_POLICER_ID_INVALID;
     }
     if (policer_db_data->sx_policer_id_acl_mirror != SX_POLICER_ID_INVALID) {
@@ -2178,6 +2380,7 @@ static sai_status_t mlnx_sai_remove_policer(_In_ sai_object_id_t sai_policer_id)
             sai_status = sdk_to_sai(sx_status);
             goto exit;
         }
+        mlnx_policer_db_sx_policer_destroyed(policer_db_data, &policer_db_data->sx_policer_id_acl_mirror);
         policer_db_data->sx_policer_id_acl_mirror = SX_POLICER_ID_INVALID;
     }
     if (policer_db_data->sx_policer_id_span_session != SX_POLICER_ID_INVALID) {
@@ -2933,6 +3136,7 @@ static sai_status_t mlnx_sai_get_or_create_sx_policer_for_bind(_In_ sai_object_i
             SX_LOG_EXIT();
             return sdk_to_sai(sx_status);
         }
+        mlnx_policer_db_sx_policer_created(policer_data, new_sx_policer);
         SX_LOG_NTC(
             "Created sx policer :0x%" PRIx64 " is_host_if_policer:%d, under sai_policer:0x%" PRIx64 ". reason - for binding\n",
             *new_sx_policer,
@@ -3019,6 +3223,8 @@ sai_status_t mlnx_sai_get_or_create_acl_mirror_sx_policer_for_bind(_In_ sai_obje
             return sdk_to_sai(sx_status);
         }
 
+        mlnx_policer_db_sx_policer_created(policer_data, sx_mirror_policer);
+
         SX_LOG_NTC("Created sx policer :0x%" PRIx64 " under sai_policer:0x%" PRIx64 ". reason - for mirror session\n",
                    *sx_mirror_policer, sai_policer);
     }
@@ -4454,14 +4454,22 @@ static sai_status_t db_port_qos_map_id_set(_In_ const sai_object_id_t port_id,
         }
     }
 
+    mlnx_qos_map_port_ref_set(port->qos_maps[qos_map_type], port, false);
     port->qos_maps[qos_map_type] = qos_map_id;
+    mlnx_qos_map_port_ref_set(qos_map_id, port, true);
     return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_port_qos_params_clear(_In_ mlnx_port_config_t *port_config)
 {
+    uint32_t ii;
+
     assert(port_config);
 
+    for (ii = 0; ii < MLNX_QOS_MAP_TYPES_MAX; ii++) {
+        mlnx_qos_map_port_ref_set(port_config->qos_maps[ii], port_config, false);
+    }
+
     memset(port_config->qos_maps, 0, sizeof(port_config->qos_maps));
 
     return SAI_STATUS_SUCCESS;
@@ -4903,6 +4911,40 @@ static sai_status_t mlnx_port_qos_map_assign_tc_to_pg(sx_port_log_id_t port_id,
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * The port already has a map with the same content as qos_map_id applied, so only its map id is changed.
+ * LAG members (the map is applied on the LAG or on the member by type) and DSCP remapping (it depends on
+ * the map id) always re-apply.
+ *
+ * db read lock is needed
+ */
+static bool mlnx_port_qos_map_content_is_applied(_In_ sai_object_id_t    port,
+                                                 _In_ sai_object_id_t    qos_map_id,
+                                                 _In_ sai_qos_map_type_t qos_map_type)
+{
+    mlnx_port_config_t *port_cfg;
+    sx_port_log_id_t    port_id;
+    uint32_t            qos_map_idx;
+
+    if ((qos_map_id == SAI_NULL_OBJECT_ID) || mlnx_tunnel_dscp_remapping_enabled()) {
+        return false;
+    }
+
+    if (SAI_ERR(mlnx_object_to_type(qos_map_id, SAI_OBJECT_TYPE_QOS_MAP, &qos_map_idx, NULL))) {
+        return false;
+    }
+
+    if (SAI_ERR(mlnx_object_to_log_port(port, &port_id))) {
+        return false;
+    }
+
+    if (SAI_ERR(mlnx_port_by_log_id(port_id, &port_cfg)) || mlnx_port_is_lag_member(port_cfg)) {
+        return false;
+    }
+
+    return mlnx_qos_map_content_is_identical(port_cfg->qos_maps[qos_map_type], qos_map_idx);
+}
+
 static sai_status_t mlnx_port_qos_map_id_set_impl(_In_ sai_object_id_t    port,
                                                   _In_ sai_object_id_t    qos_map_id,
                                                   _In_ sai_qos_map_type_t qos_map_type)
@@ -4911,9 +4953,13 @@ static sai_status_t mlnx_port_qos_map_id_set_impl(_In_ sai_object_id_t    port,
 
     assert(qos_map_type < MLNX_QOS_MAP_TYPES_MAX);
 
-    status = mlnx_port_qos_map_apply(port, qos_map_id, qos_map_type);
-    if (SAI_ERR(status)) {
-        return status;
+    if (mlnx_port_qos_map_content_is_applied(port, qos_map_id, qos_map_type)) {
+        SX_LOG_DBG("Port %" PRIx64 " already has the content of QoS map %" PRIx64 " applied\n", port, qos_map_id);
+    } else {
+        status = mlnx_port_qos_map_apply(port, qos_map_id, qos_map_type);
+        if (SAI_ERR(status)) {
+            return status;
+        }
     }
 
     status = db_port_qos_map_id_set(port, qos_map_type, qos_map_id);
@@ -4924,22 +4970,10 @@ static sai_status_t mlnx_port_qos_map_id_set_impl(_In_ sai_object_id_t    port,
     return status;
 }
 
-/*
- * Routine Description:
- *   Apply QoS params on the port (db read lock is needed).
- *
- * Arguments:
- *    [in] port - Port Id
- *    [in] qos_map_id - QoS Map Id
- *    [in] qos_map_type QoS Map Type
- *
- * Return Values:
- *    SAI_STATUS_SUCCESS on success
- *    Failure status code on error
- */
-sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
-                                     _In_ const sai_object_id_t    qos_map_id,
-                                     _In_ const sai_qos_map_type_t qos_map_type)
+static sai_status_t mlnx_port_qos_map_apply_impl(_In_ const sai_object_id_t    port,
+                                                 _In_ const sai_object_id_t    qos_map_id,
+                                                 _In_ const sai_qos_map_type_t qos_map_type,
+                                                 _In_ bool                     trust_level_set)
 {
     bool                is_map_enabled = true;
     mlnx_qos_map_t      default_map;
@@ -5021,7 +5055,9 @@ sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
             return status;
         }
 
-        status = mlnx_port_qos_map_trust_level_set(port_id, qos_map, is_map_enabled);
+        if (trust_level_set) {
+            status = mlnx_port_qos_map_trust_level_set(port_id, qos_map, is_map_enabled);
+        }
         break;
 
     case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
@@ -5031,7 +5067,9 @@ sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
             return status;
         }
 
-        status = mlnx_port_qos_map_trust_level_set(port_id, qos_map, is_map_enabled);
+        if (trust_level_set) {
+            status = mlnx_port_qos_map_trust_level_set(port_id, qos_map, is_map_enabled);
+        }
         break;
 
     case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
@@ -5080,6 +5118,47 @@ sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
     return status;
 }
 
+/*
+ * Routine Description:
+ *   Apply QoS params on the port (db read lock is needed).
+ *
+ * Arguments:
+ *    [in] port - Port Id
+ *    [in] qos_map_id - QoS Map Id
+ *    [in] qos_map_type QoS Map Type
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
+                                     _In_ const sai_object_id_t    qos_map_id,
+                                     _In_ const sai_qos_map_type_t qos_map_type)
+{
+    return mlnx_port_qos_map_apply_impl(port, qos_map_id, qos_map_type, true);
+}
+
+/*
+ * Routine Description:
+ *   Re-apply the changed content of the QoS map which is already applied on the port (db read lock is needed).
+ *   The port already trusts the map, so the trust level is not read and set again.
+ *
+ * Arguments:
+ *    [in] port - Port Id
+ *    [in] qos_map_id - QoS Map Id
+ *    [in] qos_map_type QoS Map Type
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+sai_status_t mlnx_port_qos_map_update(_In_ const sai_object_id_t    port,
+                                      _In_ const sai_object_id_t    qos_map_id,
+                                      _In_ const sai_qos_map_type_t qos_map_type)
+{
+    return mlnx_port_qos_map_apply_impl(port, qos_map_id, qos_map_type, false);
+}
+
 /*
  * Routine Description:
  *   Set default traffic class on the port
@@ -6768,6 +6847,10 @@ sai_status_t mlnx_get_port_stats_ext(_In_ sai_object_id_t      port_id,
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
+    if (mlnx_stats_cache_lookup(SAI_OBJECT_TYPE_PORT, port_id, number_of_counters, counter_ids, mode, counters)) {
+        return SAI_STATUS_SUCCESS;
+    }
+
     status = mlnx_translate_sai_stats_mode_to_sdk(mode, &cmd);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to convert mode.\n");
@@ -6855,6 +6938,9 @@ out2:
     }
 
 out:
+    if (SAI_STATS_MODE_READ_AND_CLEAR == mode) {
+        mlnx_stats_cache_invalidate(port_id);
+    }
     return status;
 }
 
@@ -6872,12 +6958,24 @@ out:
  *    SAI_STATUS_SUCCESS on success
  *    Failure status code on error
  */
+static sai_status_t mlnx_get_port_stats_ext_timed(_In_ sai_object_id_t      port_id,
+                                                  _In_ uint32_t             number_of_counters,
+                                                  _In_ const sai_stat_id_t *counter_ids,
+                                                  _In_ sai_stats_mode_t     mode,
+                                                  _Out_ uint64_t           *counters)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_PORT, MLNX_API_STATS_OP_GET_STATS,
+                                mlnx_get_port_stats_ext(port_id, number_of_counters, counter_ids, mode, counters));
+}
+
 static sai_status_t mlnx_get_port_stats(_In_ sai_object_id_t      port_id,
                                         _In_ uint32_t             number_of_counters,
                                         _In_ const sai_stat_id_t *counter_ids,
                                         _Out_ uint64_t           *counters)
 {
-    return mlnx_get_port_stats_ext(port_id, number_of_counters, counter_ids, SAI_STATS_MODE_READ, counters);
+    return mlnx_get_port_stats_ext_timed(port_id, number_of_counters, counter_ids, SAI_STATS_MODE_READ, counters);
 }
 
 /*
@@ -6930,6 +7028,8 @@ static sai_status_t mlnx_clear_port_all_stats(_In_ sai_object_id_t port_id)
         return sdk_to_sai(status);
     }
 
+    mlnx_stats_cache_invalidate(port_id);
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -7038,6 +7138,36 @@ sai_status_t mlnx_port_by_log_id(sx_port_log_id_t log_id, mlnx_port_config_t **p
     return status;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_port_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    const mlnx_port_config_t *port;
+    uint32_t                  ii;
+
+    assert(keys);
+
+    mlnx_port_phy_foreach(port, ii) {
+        mlnx_object_key_list_oid_add(keys, port->saiport);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_lag_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    const mlnx_port_config_t *lag;
+    uint32_t                  ii;
+
+    assert(keys);
+
+    mlnx_lag_foreach(lag, ii) {
+        mlnx_object_key_list_oid_add(keys, lag->saiport);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /* DB read lock is needed */
 sai_status_t mlnx_lag_by_log_id(sx_port_log_id_t log_id, mlnx_port_config_t **lag)
 {
@@ -7161,6 +7291,12 @@ bool mlnx_port_is_sdk_lag_member_not_sai(const mlnx_port_config_t *port)
     return !!port->before_issu_lag_id && !port->lag_id;
 }
 
+/* LAG members are skipped on binding a QoS profile (WRED, scheduler) to ports, the profile is bound to the LAG */
+bool mlnx_port_is_profile_bind_target(const mlnx_port_config_t *port)
+{
+    return (port->is_present || port->sdk_port_added) && !mlnx_port_is_lag_member(port);
+}
+
 bool mlnx_log_port_is_cpu(sx_port_log_id_t log_id)
 {
     return log_id == CPU_PORT;
@@ -9313,6 +9449,7 @@ sai_status_t mlnx_port_config_uninit(mlnx_port_config_t *port)
         memset(&port->sched_hierarchy, 0, sizeof(port->sched_hierarchy));
         memset(port->qos_maps, 0, sizeof(port->qos_maps));
         port->scheduler_id = SAI_NULL_OBJECT_ID;
+        mlnx_sched_refs_port_sync(port);
 
         port->internal_ingress_samplepacket_obj_idx = MLNX_INVALID_SAMPLEPACKET_SESSION;
         port->internal_egress_samplepacket_obj_idx = MLNX_INVALID_SAMPLEPACKET_SESSION;
@@ -9349,7 +9486,7 @@ sai_status_t mlnx_port_config_uninit(mlnx_port_config_t *port)
         /* Reset port's queues */
         port_queues_foreach(port, queue, ii) {
             queue->buffer_id = SAI_NULL_OBJECT_ID;
-            queue->wred_id = SAI_NULL_OBJECT_ID;
+            mlnx_wred_queue_wred_id_set(queue, SAI_NULL_OBJECT_ID);
         }
     }
 
@@ -10335,6 +10472,8 @@ sai_status_t mlnx_remove_port(_In_ sai_object_id_t port_id)
         g_sai_db_ptr->ar_db.ar_port_list[ar_port_index].port_id = SX_INVALID_PORT;
     }
 
+    mlnx_stats_cache_unregister(port_id);
+
 out_unlock:
     sai_db_unlock();
 out:
@@ -11593,7 +11732,7 @@ const sai_port_api_t mlnx_port_api = {
     mlnx_set_port_attribute,
     mlnx_get_port_attribute,
     mlnx_get_port_stats,
-    mlnx_get_port_stats_ext,
+    mlnx_get_port_stats_ext_timed,
     mlnx_clear_port_stats,
     mlnx_clear_port_all_stats,
     mlnx_create_port_pool,
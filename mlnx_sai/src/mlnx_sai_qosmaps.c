@@ -81,6 +81,40 @@ static mlnx_qos_map_t * db_qos_map_get(uint32_t id)
     return &g_sai_db_ptr->qos_maps_db[id - 1];
 }
 
+/* db read lock is needed */
+static mlnx_qos_map_refs_t * db_qos_map_refs_get(uint32_t id)
+{
+    return &g_sai_db_ptr->qos_map_refs[id - 1];
+}
+
+/* db write lock is needed */
+void mlnx_qos_map_port_ref_set(_In_ uint32_t qos_map_idx, _In_ const mlnx_port_config_t *port, _In_ bool ref)
+{
+    mlnx_qos_map_refs_t *refs;
+    uint32_t             port_idx;
+
+    assert(port);
+
+    if (!qos_map_idx || (qos_map_idx > MAX_QOS_MAPS)) {
+        return;
+    }
+
+    refs = db_qos_map_refs_get(qos_map_idx);
+    port_idx = mlnx_port_idx_get(port);
+
+    if (ref == (bool)array_bit_test(refs->ports, port_idx)) {
+        return;
+    }
+
+    if (ref) {
+        array_bit_set(refs->ports, port_idx);
+        refs->ports_count++;
+    } else {
+        array_bit_clear(refs->ports, port_idx);
+        refs->ports_count--;
+    }
+}
+
 /* db read lock is needed */
 static sai_status_t db_qos_map_check_if_exist(uint32_t id)
 {
@@ -98,22 +132,95 @@ static sai_status_t db_qos_map_check_if_exist(uint32_t id)
     return SAI_STATUS_SUCCESS;
 }
 
-/* db read/write lock is needed */
-static sai_status_t db_qos_map_alloc(uint32_t *id)
+/* The map content, the entries after count are kept zeroed */
+static uint32_t db_qos_map_hash(const mlnx_qos_map_t *qos_map)
+{
+    uint32_t hash = MLNX_FNV1A_HASH_INIT;
+    uint32_t type = qos_map->type;
+
+    hash = mlnx_fnv1a_hash(hash, &type, sizeof(type));
+    hash = mlnx_fnv1a_hash(hash, &qos_map->count, sizeof(qos_map->count));
+    hash = mlnx_fnv1a_hash(hash, &qos_map->from, sizeof(qos_map->from));
+    hash = mlnx_fnv1a_hash(hash, &qos_map->to, sizeof(qos_map->to));
+
+    return hash;
+}
+
+static bool db_qos_map_content_equal(const mlnx_qos_map_t *a, const mlnx_qos_map_t *b)
+{
+    return (a->type == b->type) && (a->count == b->count) &&
+           !memcmp(&a->from, &b->from, sizeof(a->from)) && !memcmp(&a->to, &b->to, sizeof(a->to));
+}
+
+/* db write lock is needed */
+static void db_qos_map_hash_update(uint32_t id)
+{
+    db_qos_map_refs_get(id)->hash = db_qos_map_hash(db_qos_map_get(id));
+}
+
+/*
+ * Both maps are used and have the same content, the stored content hash rejects most of the different maps.
+ * db read lock is needed
+ */
+bool mlnx_qos_map_content_is_identical(_In_ uint32_t qos_map_idx, _In_ uint32_t other_idx)
+{
+    if (!qos_map_idx || (qos_map_idx > MAX_QOS_MAPS) || !other_idx || (other_idx > MAX_QOS_MAPS)) {
+        return false;
+    }
+
+    if (!db_qos_map_get(qos_map_idx)->is_used || !db_qos_map_get(other_idx)->is_used) {
+        return false;
+    }
+
+    if (qos_map_idx == other_idx) {
+        return true;
+    }
+
+    return (db_qos_map_refs_get(qos_map_idx)->hash == db_qos_map_refs_get(other_idx)->hash) &&
+           db_qos_map_content_equal(db_qos_map_get(qos_map_idx), db_qos_map_get(other_idx));
+}
+
+/*
+ * The free maps are linked through mlnx_qos_map_refs_t.next, lowest index first.
+ * The maps which are already used (PFC caches) are skipped.
+ */
+void mlnx_qos_maps_db_init(void)
 {
     uint32_t ii;
 
-    for (ii = 1; ii <= MAX_QOS_MAPS; ii++) {
-        mlnx_qos_map_t *qos_map = db_qos_map_get(ii);
+    memset(g_sai_db_ptr->qos_map_refs, 0, sizeof(g_sai_db_ptr->qos_map_refs));
+    g_sai_db_ptr->qos_maps_free_head = 0;
 
-        if (!qos_map->is_used) {
-            *id = ii;
-            qos_map->is_used = true;
-            return SAI_STATUS_SUCCESS;
+    for (ii = MAX_QOS_MAPS; ii > 0; ii--) {
+        if (db_qos_map_get(ii)->is_used) {
+            continue;
         }
+
+        db_qos_map_refs_get(ii)->next = g_sai_db_ptr->qos_maps_free_head;
+        g_sai_db_ptr->qos_maps_free_head = ii;
     }
+}
+
+/* db read/write lock is needed */
+static sai_status_t db_qos_map_alloc(uint32_t *id)
+{
+    mlnx_qos_map_refs_t *refs;
+    uint32_t             free_id = g_sai_db_ptr->qos_maps_free_head;
+
+    if (!free_id) {
+        return SAI_STATUS_TABLE_FULL;
+    }
+
+    assert(!db_qos_map_get(free_id)->is_used);
+
+    refs = db_qos_map_refs_get(free_id);
+    g_sai_db_ptr->qos_maps_free_head = refs->next;
+    refs->next = 0;
 
-    return SAI_STATUS_TABLE_FULL;
+    db_qos_map_get(free_id)->is_used = true;
+    *id = free_id;
+
+    return SAI_STATUS_SUCCESS;
 }
 
 /* db read/write lock is needed */
@@ -127,6 +234,11 @@ static sai_status_t db_qos_map_free(uint32_t id)
     }
 
     memset(db_qos_map_get(id), 0, sizeof(mlnx_qos_map_t));
+    memset(db_qos_map_refs_get(id), 0, sizeof(mlnx_qos_map_refs_t));
+
+    db_qos_map_refs_get(id)->next = g_sai_db_ptr->qos_maps_free_head;
+    g_sai_db_ptr->qos_maps_free_head = id;
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -653,15 +765,22 @@ out:
 }
 
 /* QoS Mapping List [sai_qos_map_list_t] */
+/*
+ * Only the ports and LAGs in the map reverse index (and the ports using it as the switch default) are updated.
+ * They already trust the map, so only the mapping itself is pushed to them in one pass.
+ */
 static sai_status_t mlnx_qos_map_list_set(_In_ const sai_object_key_t      *key,
                                           _In_ const sai_attribute_value_t *value,
                                           void                             *arg)
 {
-    mlnx_port_config_t *port;
-    mlnx_qos_map_t     *qos_map;
-    uint32_t            qos_map_idx;
-    sai_status_t        status;
-    uint32_t            port_idx;
+    mlnx_port_config_t  *port;
+    mlnx_qos_map_t      *qos_map;
+    mlnx_qos_map_t       new_qos_map;
+    mlnx_qos_map_refs_t *refs;
+    uint32_t             qos_map_idx;
+    sai_status_t         status;
+    uint32_t             port_idx, word, bits;
+    uint32_t             ports_updated = 0;
 
     SX_LOG_ENTER();
 
@@ -678,26 +797,73 @@ static sai_status_t mlnx_qos_map_list_set(_In_ const sai_object_key_t      *key,
         goto out;
     }
 
-    status = db_qos_map_fill_params(qos_map, &value->qosmap);
+    /* Filled from scratch so the entries after the new count stay zeroed for the content hash */
+    memset(&new_qos_map, 0, sizeof(new_qos_map));
+    new_qos_map.type = qos_map->type;
+
+    status = db_qos_map_fill_params(&new_qos_map, &value->qosmap);
     if (status != SAI_STATUS_SUCCESS) {
         SX_LOG_ERR("Error while fill QoS params\n");
         goto out;
     }
 
-    mlnx_port_not_in_lag_foreach(port, port_idx) {
-        if (port->qos_maps[qos_map->type] != qos_map_idx) {
-            continue;
-        }
+    /* The same content is already applied on the ports */
+    if (db_qos_map_content_equal(&new_qos_map, qos_map)) {
+        SX_LOG_NTC("QoS map [DB:%u] content is not changed\n", qos_map_idx);
+        goto out;
+    }
 
-        status = mlnx_port_qos_map_apply(port->saiport, key->key.object_id, qos_map->type);
-        if (status != SAI_STATUS_SUCCESS) {
-            SX_LOG_ERR("Failed to update port %" PRIx64 " with new QoS map\n", port->saiport);
-            goto out;
+    qos_map->from = new_qos_map.from;
+    qos_map->to = new_qos_map.to;
+    qos_map->count = new_qos_map.count;
+    db_qos_map_hash_update(qos_map_idx);
+
+    refs = db_qos_map_refs_get(qos_map_idx);
+
+    for (word = 0; word < MLNX_U32BITARRAY_SIZE(MAX_PORTS_DB * 2); word++) {
+        for (bits = refs->ports[word]; bits; bits &= bits - 1) {
+            port_idx = word * 32 + (uint32_t)__builtin_ctz(bits);
+            port = &mlnx_ports_db[port_idx];
+
+            if (port->qos_maps[qos_map->type] != qos_map_idx) {
+                SX_LOG_WRN("Port %" PRIx64 " doesn't use QoS map [DB:%u], removing it from the map index\n",
+                           port->saiport, qos_map_idx);
+                mlnx_qos_map_port_ref_set(qos_map_idx, port, false);
+                continue;
+            }
+
+            status = mlnx_port_qos_map_update(port->saiport, key->key.object_id, qos_map->type);
+            if (status != SAI_STATUS_SUCCESS) {
+                SX_LOG_ERR("Failed to update port %" PRIx64 " with new QoS map\n", port->saiport);
+                goto out;
+            }
+
+            ports_updated++;
         }
+    }
+
+    if (g_sai_db_ptr->switch_qos_maps[qos_map->type] == qos_map_idx) {
+        mlnx_port_not_in_lag_foreach(port, port_idx) {
+            if (port->qos_maps[qos_map->type]) {
+                continue;
+            }
+
+            status = mlnx_port_qos_map_update(port->saiport, key->key.object_id, qos_map->type);
+            if (status != SAI_STATUS_SUCCESS) {
+                SX_LOG_ERR("Failed to update port %" PRIx64 " with new switch QoS map\n", port->saiport);
+                goto out;
+            }
 
-        SX_LOG_NTC("Port %" PRIx64 " was updated with new QoS map\n", port->saiport);
+            ports_updated++;
+        }
     }
 
+    refs->updates++;
+    refs->last_update_ports = ports_updated;
+    refs->update_ports_total += ports_updated;
+
+    SX_LOG_NTC("QoS map [DB:%u] update was applied to %u ports\n", qos_map_idx, ports_updated);
+
 out:
     sai_db_sync();
     sai_db_unlock();
@@ -774,6 +940,8 @@ static sai_status_t mlnx_create_qos_map(_Out_ sai_object_id_t     * qos_map_id,
         goto out;
     }
 
+    db_qos_map_hash_update(new_id);
+
     status = mlnx_create_object(SAI_OBJECT_TYPE_QOS_MAP, new_id, NULL, qos_map_id);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to create mlnx object id\n");
@@ -195,6 +195,106 @@ sai_status_t mlnx_rif_availability_get(_In_ sai_object_id_t        switch_id,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_rif_default_oid_create(_In_ mlnx_shm_rm_array_idx_t idx, _Out_ sai_object_id_t *oid)
+{
+    return mlnx_rif_oid_create(MLNX_RIF_TYPE_DEFAULT, NULL, idx, oid);
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_rif_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    const mlnx_bridge_rif_t *bridge_rif;
+    sai_object_key_t        *key;
+    sai_status_t             status;
+    uint32_t                 ii;
+
+    assert(keys);
+
+    status = mlnx_object_key_list_rm_array_fill(keys, MLNX_SHM_RM_ARRAY_TYPE_RIF, mlnx_rif_default_oid_create);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    for (ii = 0; ii < MAX_BRIDGE_RIFS; ii++) {
+        bridge_rif = &g_sai_db_ptr->bridge_rifs_db[ii];
+        if (!bridge_rif->is_used) {
+            continue;
+        }
+
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_rif_oid_create(MLNX_RIF_TYPE_BRIDGE, bridge_rif, MLNX_SHM_RM_ARRAY_IDX_UNINITIALIZED,
+                                     &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_rif_db_iterate(_In_ mlnx_rif_iter_fn fn, _In_ void *ctx)
+{
+    const mlnx_bridge_rif_t *bridge_rif;
+    mlnx_shm_rm_array_idx_t  idx;
+    mlnx_rif_db_t           *rif_db;
+    sai_object_id_t          rif_oid;
+    sai_status_t             status;
+    void                    *elem;
+    uint32_t                 ii, size;
+
+    assert(fn);
+
+    size = mlnx_shm_rm_array_size_get(MLNX_SHM_RM_ARRAY_TYPE_RIF);
+    for (ii = 0; ii < size; ii++) {
+        idx.type = MLNX_SHM_RM_ARRAY_TYPE_RIF;
+        idx.idx = ii;
+
+        status = mlnx_shm_rm_array_idx_to_ptr(idx, &elem);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        rif_db = elem;
+        if (!rif_db->mlnx_array.is_used) {
+            continue;
+        }
+
+        status = mlnx_rif_oid_create(MLNX_RIF_TYPE_DEFAULT, NULL, idx, &rif_oid);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        status = fn(rif_db->sx_data.rif_id, rif_oid, ctx);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    for (ii = 0; ii < MAX_BRIDGE_RIFS; ii++) {
+        bridge_rif = &g_sai_db_ptr->bridge_rifs_db[ii];
+        if (!bridge_rif->is_used || !bridge_rif->is_created) {
+            continue;
+        }
+
+        status = mlnx_rif_oid_create(MLNX_RIF_TYPE_BRIDGE, bridge_rif, MLNX_SHM_RM_ARRAY_IDX_UNINITIALIZED, &rif_oid);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        status = fn(bridge_rif->sx_data.rif_id, rif_oid, ctx);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static sai_status_t mlnx_rif_db_alloc(_Out_ mlnx_rif_db_t **rif_data, _Out_ mlnx_shm_rm_array_idx_t  *idx)
 {
     sai_status_t status;
@@ -1327,6 +1427,9 @@ static sai_status_t mlnx_remove_router_interface(_In_ sai_object_id_t rif_id)
 
 out:
     sai_db_unlock();
+    if (SAI_OK(status)) {
+        mlnx_stats_cache_unregister(rif_id);
+    }
     SX_LOG_EXIT();
     return status;
 }
@@ -1859,6 +1962,12 @@ static sai_status_t mlnx_get_router_interface_stats_ext(_In_ sai_object_id_t
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
+    if (mlnx_stats_cache_lookup(SAI_OBJECT_TYPE_ROUTER_INTERFACE, router_interface_id, number_of_counters,
+                                counter_ids, mode, counters)) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
+    }
+
     sx_cmd = (mode == SAI_STATS_MODE_READ) ? SX_ACCESS_CMD_READ : SX_ACCESS_CMD_READ_CLEAR;
 
     sai_db_read_lock();
@@ -1881,6 +1990,10 @@ static sai_status_t mlnx_get_router_interface_stats_ext(_In_ sai_object_id_t
 
     sai_db_unlock();
 
+    if (SAI_STATS_MODE_READ_AND_CLEAR == mode) {
+        mlnx_stats_cache_invalidate(router_interface_id);
+    }
+
     for (ii = 0; ii < number_of_counters; ii++) {
         switch (counter_ids[ii]) {
         case SAI_ROUTER_INTERFACE_STAT_IN_OCTETS:
@@ -2013,6 +2126,8 @@ static sai_status_t mlnx_clear_router_interface_stats(_In_ sai_object_id_t
         goto out;
     }
 
+    mlnx_stats_cache_invalidate(router_interface_id);
+
 out:
     sai_db_unlock();
     SX_LOG_EXIT();
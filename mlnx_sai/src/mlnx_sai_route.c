@@ -105,6 +105,110 @@ static size_t route_entry_info_print(_In_ const sai_object_key_t *key, _Out_ cha
 {
     return sai_ipprefix_to_str(key->key.route_entry.destination, max_len, str);
 }
+
+static sai_status_t mlnx_route_vrid_key_list_get(_In_ sai_object_id_t            switch_id,
+                                                 _In_ sx_router_id_t             vrid,
+                                                 _In_ sx_ip_version_t            version,
+                                                 _Inout_ sx_uc_route_get_entry_t *routes,
+                                                 _Inout_ mlnx_object_key_list_t *keys)
+{
+    sx_status_t              sx_status;
+    sai_status_t             status;
+    sai_object_id_t          vr_oid;
+    sai_object_key_t        *key;
+    sx_ip_prefix_t           key_prefix;
+    sx_uc_route_key_filter_t filter;
+    sx_access_cmd_t          cmd = SX_ACCESS_CMD_GET_FIRST;
+    uint32_t                 routes_count, ii;
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, vrid, NULL, &vr_oid);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    memset(&key_prefix, 0, sizeof(key_prefix));
+    memset(&filter, 0, sizeof(filter));
+    key_prefix.version = version;
+
+    while (true) {
+        routes_count = MLNX_OBJECT_KEY_SDK_PAGE_SIZE;
+
+        sx_status = sx_api_router_uc_route_get(gh_sdk, cmd, vrid, &key_prefix, &filter, routes, &routes_count);
+        if (SX_STATUS_ENTRY_NOT_FOUND == sx_status) {
+            break;
+        }
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get routes of vrid %u - %s\n", vrid, SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
+
+        for (ii = 0; ii < routes_count; ii++) {
+            if (routes[ii].network_addr.version != version) {
+                continue;
+            }
+
+            key = mlnx_object_key_list_next(keys);
+            if (!key) {
+                continue;
+            }
+
+            key->key.route_entry.switch_id = switch_id;
+            key->key.route_entry.vr_id = vr_oid;
+            status = mlnx_translate_sdk_ip_prefix_to_sai(&routes[ii].network_addr, &key->key.route_entry.destination);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+        }
+
+        if (routes_count < MLNX_OBJECT_KEY_SDK_PAGE_SIZE) {
+            break;
+        }
+
+        key_prefix = routes[routes_count - 1].network_addr;
+        cmd = SX_ACCESS_CMD_GETNEXT;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Walks the SDK route table page by page, one pass per vrid and IP version */
+sai_status_t mlnx_route_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    sx_uc_route_get_entry_t *routes = NULL;
+    sx_router_id_t          *vrids = NULL;
+    sai_status_t             status;
+    uint32_t                 vrids_count = 0, ii;
+
+    assert(keys);
+
+    routes = calloc(MLNX_OBJECT_KEY_SDK_PAGE_SIZE, sizeof(*routes));
+    if (!routes) {
+        SX_LOG_ERR("Failed to allocate memory for routes\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    status = mlnx_router_vrid_list_get(&vrids, &vrids_count);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    for (ii = 0; ii < vrids_count; ii++) {
+        status = mlnx_route_vrid_key_list_get(switch_id, vrids[ii], SX_IP_VERSION_IPV4, routes, keys);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+
+        status = mlnx_route_vrid_key_list_get(switch_id, vrids[ii], SX_IP_VERSION_IPV6, routes, keys);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+    }
+
+out:
+    free(vrids);
+    free(routes);
+    return status;
+}
 const mlnx_obj_type_attrs_info_t mlnx_route_obj_type_info =
 { route_vendor_attribs, OBJ_ATTRS_ENUMS_INFO(route_enum_info), OBJ_STAT_CAP_INFO_EMPTY(), route_entry_info_print};
 
@@ -767,6 +871,194 @@ static sai_status_t mlnx_get_route(const sai_route_entry_t* route_entry,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t fill_route_cache(mlnx_route_cache_t *route_cache, const sai_route_entry_t *route_entry)
+{
+    sai_status_t status;
+
+    if (route_cache->route_cache_set) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    status = mlnx_get_route(route_entry, &route_cache->route_get_entry, &route_cache->vrid);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    route_cache->route_cache_set = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+typedef struct _mlnx_route_bulk_key_t {
+    struct {
+        sx_router_id_t vrid;
+        sx_ip_prefix_t prefix;
+    } key;
+    uint32_t idx;
+} mlnx_route_bulk_key_t;
+
+/* Orders the keys by VR and then as SDK orders the routes of a VR */
+static int mlnx_route_bulk_key_cmp(const void *a, const void *b)
+{
+    const mlnx_route_bulk_key_t *key_a = a, *key_b = b;
+
+    if (key_a->key.vrid != key_b->key.vrid) {
+        return (key_a->key.vrid < key_b->key.vrid) ? -1 : 1;
+    }
+
+    return mlnx_sdk_ip_prefix_cmp(&key_a->key.prefix, &key_b->key.prefix);
+}
+
+static void mlnx_route_bulk_key_set(_In_ sx_router_id_t         vrid,
+                                    _In_ const sx_ip_prefix_t *prefix,
+                                    _Out_ mlnx_route_bulk_key_t *key)
+{
+    memset(key, 0, sizeof(*key));
+
+    key->key.vrid = vrid;
+    key->key.prefix.version = prefix->version;
+    if (SX_IP_VERSION_IPV4 == prefix->version) {
+        key->key.prefix.prefix.ipv4 = prefix->prefix.ipv4;
+    } else {
+        key->key.prefix.prefix.ipv6 = prefix->prefix.ipv6;
+    }
+}
+
+/*
+ * Fills the route caches of the bulk get by walking the SDK route table of each requested VR and IP version
+ * page by page, instead of a separate SDK get per route.
+ * The walk starts at the lowest requested route and stops past the highest one, SDK returns the routes of a VR
+ * ordered by prefix. The routes that are not found are left uncached and are read by the getters.
+ */
+sai_status_t mlnx_route_bulk_cache_fill(_In_ uint32_t                object_count,
+                                        _In_ const sai_object_key_t *object_key,
+                                        _Inout_ vendor_cache_t      *caches)
+{
+    mlnx_route_bulk_key_t   *keys = NULL, *found, lookup;
+    sx_uc_route_get_entry_t *routes = NULL;
+    sx_uc_route_key_filter_t filter;
+    mlnx_route_cache_t      *route_cache;
+    sx_ip_prefix_t           prefix;
+    sx_ip_version_t          version;
+    sx_router_id_t           vrid;
+    sx_access_cmd_t          cmd;
+    sx_status_t              sx_status;
+    sai_status_t             status = SAI_STATUS_SUCCESS;
+    uint32_t                 keys_count = 0, group_start, group_end, group_left, routes_count, ii;
+    bool                     is_past_last;
+
+    assert(object_key);
+    assert(caches);
+
+    keys = calloc(object_count, sizeof(*keys));
+    routes = calloc(MLNX_OBJECT_KEY_SDK_PAGE_SIZE, sizeof(*routes));
+    if (!keys || !routes) {
+        SX_LOG_ERR("Failed to allocate memory for route bulk get\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < object_count; ii++) {
+        memset(&prefix, 0, sizeof(prefix));
+
+        /* Invalid keys are reported by the getters */
+        if (SAI_ERR(mlnx_translate_sai_route_entry_to_sdk(&object_key[ii].key.route_entry, &prefix, &vrid))) {
+            continue;
+        }
+
+        mlnx_route_bulk_key_set(vrid, &prefix, &keys[keys_count]);
+        keys[keys_count].idx = ii;
+        keys_count++;
+    }
+
+    qsort(keys, keys_count, sizeof(*keys), mlnx_route_bulk_key_cmp);
+
+    memset(&filter, 0, sizeof(filter));
+
+    for (group_start = 0; group_start < keys_count; group_start = group_end) {
+        vrid = keys[group_start].key.vrid;
+        version = keys[group_start].key.prefix.version;
+
+        for (group_end = group_start + 1; group_end < keys_count; group_end++) {
+            if ((keys[group_end].key.vrid != vrid) || (keys[group_end].key.prefix.version != version)) {
+                break;
+            }
+        }
+
+        group_left = group_end - group_start;
+        is_past_last = false;
+
+        /* GET of the first route, then GETNEXT from it */
+        prefix = keys[group_start].key.prefix;
+        cmd = SX_ACCESS_CMD_GET;
+
+        while ((group_left > 0) && !is_past_last) {
+            routes_count = (SX_ACCESS_CMD_GET == cmd) ? 1 : MLNX_OBJECT_KEY_SDK_PAGE_SIZE;
+
+            sx_status = sx_api_router_uc_route_get(gh_sdk, cmd, vrid, &prefix, &filter, routes, &routes_count);
+            if (SX_STATUS_ENTRY_NOT_FOUND == sx_status) {
+                if (SX_ACCESS_CMD_GET != cmd) {
+                    break;
+                }
+                routes_count = 0;
+            } else if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed to get routes of vrid %u - %s\n", vrid, SX_STATUS_MSG(sx_status));
+                status = sdk_to_sai(sx_status);
+                goto out;
+            }
+
+            for (ii = 0; ii < routes_count; ii++) {
+                if (routes[ii].network_addr.version != version) {
+                    continue;
+                }
+
+                mlnx_route_bulk_key_set(vrid, &routes[ii].network_addr, &lookup);
+
+                /* Past the last requested route, the rest of the table is not needed */
+                if (mlnx_route_bulk_key_cmp(&lookup, &keys[group_end - 1]) > 0) {
+                    is_past_last = true;
+                    break;
+                }
+
+                found = bsearch(&lookup, &keys[group_start], group_end - group_start, sizeof(*keys),
+                                mlnx_route_bulk_key_cmp);
+                if (!found) {
+                    continue;
+                }
+
+                /* The same route can be requested more than once */
+                while ((found > &keys[group_start]) && (0 == mlnx_route_bulk_key_cmp(found - 1, &lookup))) {
+                    found--;
+                }
+
+                for (; (found < &keys[group_end]) && (0 == mlnx_route_bulk_key_cmp(found, &lookup)); found++) {
+                    route_cache = &caches[found->idx].route_cache;
+                    route_cache->route_get_entry = routes[ii];
+                    route_cache->vrid = vrid;
+                    route_cache->route_cache_set = true;
+                    group_left--;
+                }
+            }
+
+            if (SX_ACCESS_CMD_GET == cmd) {
+                cmd = SX_ACCESS_CMD_GETNEXT;
+                continue;
+            }
+
+            if (routes_count < MLNX_OBJECT_KEY_SDK_PAGE_SIZE) {
+                break;
+            }
+
+            prefix = routes[routes_count - 1].network_addr;
+        }
+    }
+
+out:
+    free(routes);
+    free(keys);
+    return status;
+}
+
 /* Packet action [sai_packet_action_t] */
 static sai_status_t mlnx_route_packet_action_get(_In_ const sai_object_key_t   *key,
                                                  _Inout_ sai_attribute_value_t *value,
@@ -776,18 +1068,18 @@ static sai_status_t mlnx_route_packet_action_get(_In_ const sai_object_key_t   *
 {
     sai_status_t             status;
     const sai_route_entry_t* route_entry = &key->key.route_entry;
-    sx_uc_route_get_entry_t  route_get_entry;
-    sx_router_id_t           vrid;
+    mlnx_route_cache_t      *route_cache = &cache->route_cache;
+    sx_uc_route_get_entry_t *route_get_entry = &route_cache->route_get_entry;
     sai_packet_action_t      packet_action;
 
     SX_LOG_ENTER();
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_get_route(route_entry, &route_get_entry, &vrid))) {
+    if (SAI_STATUS_SUCCESS != (status = fill_route_cache(route_cache, route_entry))) {
         return status;
     }
 
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_translate_sdk_router_action_to_sai(route_get_entry.route_data.action, &packet_action))) {
+        (status = mlnx_translate_sdk_router_action_to_sai(route_get_entry->route_data.action, &packet_action))) {
         return status;
     }
 
@@ -805,21 +1097,21 @@ static sai_status_t mlnx_route_trap_id_get(_In_ const sai_object_key_t   *key,
 {
     sai_status_t             status;
     const sai_route_entry_t* route_entry = &key->key.route_entry;
-    sx_uc_route_get_entry_t  route_get_entry;
-    sx_router_id_t           vrid;
+    mlnx_route_cache_t      *route_cache = &cache->route_cache;
+    sx_uc_route_get_entry_t *route_get_entry = &route_cache->route_get_entry;
     sai_packet_action_t      packet_action;
 
     SX_LOG_ENTER();
 
-    status = mlnx_get_route(route_entry, &route_get_entry, &vrid);
+    status = fill_route_cache(route_cache, route_entry);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to get route\n");
         return status;
     }
 
-    status = mlnx_translate_sdk_router_action_to_sai(route_get_entry.route_data.action, &packet_action);
+    status = mlnx_translate_sdk_router_action_to_sai(route_get_entry->route_data.action, &packet_action);
     if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to translate SDK router %d action to SAI\n", route_get_entry.route_data.action);
+        SX_LOG_ERR("Failed to translate SDK router %d action to SAI\n", route_get_entry->route_data.action);
         return status;
     }
 
@@ -827,9 +1119,9 @@ static sai_status_t mlnx_route_trap_id_get(_In_ const sai_object_key_t   *key,
 
     if (is_action_trap(packet_action)) {
         status = mlnx_get_user_defined_trap_by_prio(SAI_OBJECT_TYPE_ROUTE_ENTRY,
-                                                    route_get_entry.route_data.trap_attr.prio, &value->oid);
+                                                    route_get_entry->route_data.trap_attr.prio, &value->oid);
         if (SAI_ERR(status)) {
-            SX_LOG_ERR("Failed to lookup trap oid by trap prio %d\n", route_get_entry.route_data.trap_attr.prio);
+            SX_LOG_ERR("Failed to lookup trap oid by trap prio %d\n", route_get_entry->route_data.trap_attr.prio);
             goto out;
         }
     } else {
@@ -963,26 +1255,26 @@ static sai_status_t mlnx_route_next_hop_id_get(_In_ const sai_object_key_t   *ke
 {
     sai_status_t             status;
     const sai_route_entry_t *route_entry = &key->key.route_entry;
-    sx_uc_route_get_entry_t  route_get_entry;
-    sx_router_id_t           vrid;
+    mlnx_route_cache_t      *route_cache = &cache->route_cache;
+    sx_uc_route_get_entry_t *route_get_entry = &route_cache->route_get_entry;
 
     SX_LOG_ENTER();
 
-    status = mlnx_get_route(route_entry, &route_get_entry, &vrid);
+    status = fill_route_cache(route_cache, route_entry);
     if (SAI_ERR(status)) {
         return status;
     }
 
-    if (SX_UC_ROUTE_TYPE_LOCAL == route_get_entry.route_data.type) {
-        status = mlnx_rif_sx_to_sai_oid(route_get_entry.route_data.uc_route_param.
+    if (SX_UC_ROUTE_TYPE_LOCAL == route_get_entry->route_data.type) {
+        status = mlnx_rif_sx_to_sai_oid(route_get_entry->route_data.uc_route_param.
                                         local_egress_rif,
                                         &value->oid);
         if (SAI_ERR(status)) {
             return status;
         }
-    } else if (SX_UC_ROUTE_TYPE_NEXT_HOP == route_get_entry.route_data.type) {
-        if (SX_ROUTER_ECMP_ID_INVALID != route_get_entry.route_data.uc_route_param.ecmp_id) {
-            status = mlnx_route_next_hop_id_get_ext(route_get_entry.route_data.uc_route_param.ecmp_id,
+    } else if (SX_UC_ROUTE_TYPE_NEXT_HOP == route_get_entry->route_data.type) {
+        if (SX_ROUTER_ECMP_ID_INVALID != route_get_entry->route_data.uc_route_param.ecmp_id) {
+            status = mlnx_route_next_hop_id_get_ext(route_get_entry->route_data.uc_route_param.ecmp_id,
                                                     &value->oid);
             if (SAI_ERR(status)) {
                 return status;
@@ -990,13 +1282,13 @@ static sai_status_t mlnx_route_next_hop_id_get(_In_ const sai_object_key_t   *ke
         } else {
             value->oid = SAI_NULL_OBJECT_ID;
         }
-    } else if (SX_UC_ROUTE_TYPE_IP2ME == route_get_entry.route_data.type) {
+    } else if (SX_UC_ROUTE_TYPE_IP2ME == route_get_entry->route_data.type) {
         status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, CPU_PORT, NULL, &value->oid);
         if (SAI_ERR(status)) {
             return status;
         }
     } else {
-        SX_LOG_ERR("Unexpected sx route type %u\n", route_get_entry.route_data.type);
+        SX_LOG_ERR("Unexpected sx route type %u\n", route_get_entry->route_data.type);
         return SAI_STATUS_FAILURE;
     }
 
@@ -1361,18 +1653,19 @@ static sai_status_t mlnx_route_counter_id_get(_In_ const sai_object_key_t   *key
 {
     sai_status_t             status;
     const sai_route_entry_t* route_entry = &key->key.route_entry;
-    sx_uc_route_get_entry_t  route_get_entry;
-    sx_router_id_t           vrid;
+    mlnx_route_cache_t      *route_cache = &cache->route_cache;
+    sx_uc_route_get_entry_t *route_get_entry = &route_cache->route_get_entry;
     sx_status_t              sx_status;
     sx_flow_counter_id_t     flow_counter;
 
     SX_LOG_ENTER();
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_get_route(route_entry, &route_get_entry, &vrid))) {
+    if (SAI_STATUS_SUCCESS != (status = fill_route_cache(route_cache, route_entry))) {
         return status;
     }
 
-    sx_status = sx_api_router_uc_route_counter_bind_get(gh_sdk, vrid, &route_get_entry.network_addr, &flow_counter);
+    sx_status = sx_api_router_uc_route_counter_bind_get(gh_sdk, route_cache->vrid, &route_get_entry->network_addr,
+                                                        &flow_counter);
     if (SX_ERR(sx_status)) {
         SX_LOG_ERR("Failed to get route counter - %s\n", SX_STATUS_MSG(sx_status));
         return sdk_to_sai(sx_status);
@@ -1616,9 +1909,27 @@ sai_status_t sai_fx_uninitialize(void)
     return sdk_to_sai(fx_default_handle_free());
 }
 
+static sai_status_t mlnx_create_route_timed(_In_ const sai_route_entry_t* route_entry,
+                                            _In_ uint32_t                 attr_count,
+                                            _In_ const sai_attribute_t   *attr_list)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_ROUTE_ENTRY, MLNX_API_STATS_OP_CREATE,
+                                mlnx_create_route(route_entry, attr_count, attr_list));
+}
+
+static sai_status_t mlnx_remove_route_timed(_In_ const sai_route_entry_t* route_entry)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, SAI_OBJECT_TYPE_ROUTE_ENTRY, MLNX_API_STATS_OP_REMOVE,
+                                mlnx_remove_route(route_entry));
+}
+
 const sai_route_api_t mlnx_route_api = {
-    mlnx_create_route,
-    mlnx_remove_route,
+    mlnx_create_route_timed,
+    mlnx_remove_route_timed,
     mlnx_set_route_attribute,
     mlnx_get_route_attribute,
     mlnx_bulk_create_route_entry,
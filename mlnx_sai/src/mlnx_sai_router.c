@@ -99,6 +99,79 @@ sai_status_t mlnx_virtual_router_availability_get(_In_ sai_object_id_t        sw
     return SAI_STATUS_SUCCESS;
 }
 
+/* Returns the list of existing SDK vrids, the list is allocated by the function and must be freed by the caller */
+sai_status_t mlnx_router_vrid_list_get(_Out_ sx_router_id_t **vrids, _Out_ uint32_t *vrids_count)
+{
+    sx_status_t     sx_status;
+    sx_router_id_t *list = NULL;
+    uint32_t        count = 0;
+
+    assert(vrids);
+    assert(vrids_count);
+
+    *vrids = NULL;
+    *vrids_count = 0;
+
+    sx_status = sx_api_router_vrid_iter_get(gh_sdk, SX_ACCESS_CMD_GET, 0, NULL, NULL, &count);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get count of virtual routers - %s\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    if (count == 0) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    list = calloc(count, sizeof(*list));
+    if (!list) {
+        SX_LOG_ERR("Failed to allocate memory for vrid list\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    sx_status = sx_api_router_vrid_iter_get(gh_sdk, SX_ACCESS_CMD_GET_FIRST, 0, NULL, list, &count);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get list of virtual routers - %s\n", SX_STATUS_MSG(sx_status));
+        free(list);
+        return sdk_to_sai(sx_status);
+    }
+
+    *vrids = list;
+    *vrids_count = count;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t mlnx_virtual_router_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    sx_router_id_t   *vrids = NULL;
+    sai_object_key_t *key;
+    sai_status_t      status;
+    uint32_t          vrids_count = 0, ii;
+
+    assert(keys);
+
+    status = mlnx_router_vrid_list_get(&vrids, &vrids_count);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    for (ii = 0; ii < vrids_count; ii++) {
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_create_object(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, vrids[ii], NULL, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+    }
+
+out:
+    free(vrids);
+    return status;
+}
+
 /*
  * Routine Description:
  *    Set virtual router attribute Value
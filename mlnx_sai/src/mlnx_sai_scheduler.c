@@ -110,6 +110,137 @@ static sai_status_t sched_db_entry_get(sai_object_id_t oid, mlnx_sched_profile_t
     return SAI_STATUS_SUCCESS;
 }
 
+static mlnx_sched_refs_t * sched_refs_get(sai_object_id_t scheduler_id)
+{
+    uint32_t idx;
+
+    if (SAI_ERR(mlnx_object_to_type(scheduler_id, SAI_OBJECT_TYPE_SCHEDULER, &idx, NULL)) || (idx >= MAX_SCHED)) {
+        return NULL;
+    }
+
+    return &g_sai_qos_db_ptr->sched_refs[idx];
+}
+
+/* Number of the port, groups and queues of the port DB entry using the profile */
+static uint32_t sched_port_uses_count(mlnx_port_config_t *port, sai_object_id_t scheduler_id)
+{
+    mlnx_qos_queue_config_t *queue;
+    uint32_t                 lvl, ii, count = 0;
+
+    if (port->scheduler_id == scheduler_id) {
+        count++;
+    }
+
+    for (lvl = 0; lvl < MAX_SCHED_LEVELS; lvl++) {
+        for (ii = 0; ii < MAX_SCHED_CHILD_GROUPS; ii++) {
+            if (port->sched_hierarchy.groups[lvl][ii].scheduler_id == scheduler_id) {
+                count++;
+            }
+        }
+    }
+
+    port_queues_foreach(port, queue, ii) {
+        if (queue->sched_obj.scheduler_id == scheduler_id) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Keep the ports of the profiles up to date after an object of the port DB entry is moved
+ * from old_id to new_id. Called after the DB is updated.
+ */
+static void sched_refs_update(mlnx_port_config_t *port, sai_object_id_t old_id, sai_object_id_t new_id)
+{
+    mlnx_sched_refs_t *refs;
+
+    if (old_id == new_id) {
+        return;
+    }
+
+    if (old_id != SAI_NULL_OBJECT_ID) {
+        refs = sched_refs_get(old_id);
+        if (refs && array_bit_test(refs->ports, port->index) && !sched_port_uses_count(port, old_id)) {
+            array_bit_clear(refs->ports, port->index);
+            refs->ports_count--;
+        }
+    }
+
+    if (new_id != SAI_NULL_OBJECT_ID) {
+        refs = sched_refs_get(new_id);
+        if (refs && !array_bit_test(refs->ports, port->index)) {
+            array_bit_set(refs->ports, port->index);
+            refs->ports_count++;
+        }
+    }
+}
+
+/* Re-build the profile refs of the port DB entry after its scheduler config is copied or reset */
+void mlnx_sched_refs_port_sync(_In_ mlnx_port_config_t *port)
+{
+    mlnx_qos_queue_config_t *queue;
+    mlnx_sched_refs_t       *refs;
+    sai_object_id_t          scheduler_id;
+    uint32_t                 ii, lvl;
+
+    assert(port);
+
+    for (ii = 0; ii < MAX_SCHED; ii++) {
+        refs = &g_sai_qos_db_ptr->sched_refs[ii];
+        if (!array_bit_test(refs->ports, port->index)) {
+            continue;
+        }
+
+        if (SAI_ERR(mlnx_create_object(SAI_OBJECT_TYPE_SCHEDULER, ii, NULL, &scheduler_id)) ||
+            !sched_port_uses_count(port, scheduler_id)) {
+            array_bit_clear(refs->ports, port->index);
+            refs->ports_count--;
+        }
+    }
+
+    sched_refs_update(port, SAI_NULL_OBJECT_ID, port->scheduler_id);
+
+    for (lvl = 0; lvl < MAX_SCHED_LEVELS; lvl++) {
+        for (ii = 0; ii < MAX_SCHED_CHILD_GROUPS; ii++) {
+            sched_refs_update(port, SAI_NULL_OBJECT_ID, port->sched_hierarchy.groups[lvl][ii].scheduler_id);
+        }
+    }
+
+    port_queues_foreach(port, queue, ii) {
+        sched_refs_update(port, SAI_NULL_OBJECT_ID, queue->sched_obj.scheduler_id);
+    }
+}
+
+/* DB read lock is needed */
+void mlnx_sched_refs_count_get(_In_ uint32_t sched_idx, _Out_ uint32_t *ports_count, _Out_ uint32_t *bindings_count)
+{
+    const mlnx_sched_refs_t *refs;
+    sai_object_id_t          scheduler_id;
+    uint32_t                 ii;
+
+    assert(ports_count);
+    assert(bindings_count);
+
+    *ports_count = 0;
+    *bindings_count = 0;
+
+    if ((sched_idx >= MAX_SCHED) ||
+        SAI_ERR(mlnx_create_object(SAI_OBJECT_TYPE_SCHEDULER, sched_idx, NULL, &scheduler_id))) {
+        return;
+    }
+
+    refs = &g_sai_qos_db_ptr->sched_refs[sched_idx];
+    *ports_count = refs->ports_count;
+
+    for (ii = 0; ii < MAX_PORTS * 2; ii++) {
+        if (array_bit_test(refs->ports, ii)) {
+            *bindings_count += sched_port_uses_count(&mlnx_ports_db[ii], scheduler_id);
+        }
+    }
+}
+
 static sai_status_t mlnx_sched_attr_getter(_In_ const sai_object_key_t   *key,
                                            _Inout_ sai_attribute_value_t *value,
                                            _In_ uint32_t                  attr_index,
@@ -240,64 +371,64 @@ static void ets_element_dump(sx_port_log_id_t port_log_id, sx_cos_ets_element_co
                ets->next_element_index);
 }
 
-static sai_status_t ets_element_update(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets, char *name)
+/* Next element index is not changed by the scheduler, it is taken from the port ETS list */
+static sai_status_t ets_elements_update(sx_port_log_id_t             port_log_id,
+                                        sx_cos_ets_element_config_t *ets,
+                                        uint32_t                     count,
+                                        char                        *name)
 {
     sx_cos_ets_element_config_t *ets_list;
-    uint32_t                     max_ets_count = MAX_ETS_ELEMENTS;
+    uint32_t                     ets_count, ii, jj;
     sai_status_t                 status;
-    uint32_t                     ii;
-
-    ets_list = (sx_cos_ets_element_config_t*)malloc(sizeof(*ets_list) * MAX_ETS_ELEMENTS);
-    if (!ets_list) {
-        SX_LOG_ERR("Failed to allocate ETS list\n");
-        return SAI_STATUS_NO_MEMORY;
-    }
 
-    status = sx_api_cos_port_ets_element_get(gh_sdk, port_log_id, ets_list, &max_ets_count);
-    if (status != SX_STATUS_SUCCESS) {
-        SX_LOG_ERR("Failed get ETS list - %s\n", SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
+    status = mlnx_port_ets_list_get(port_log_id, &ets_list, &ets_count);
+    if (SAI_ERR(status)) {
+        return status;
     }
 
-    for (ii = 0; ii < MAX_ETS_ELEMENTS; ii++) {
-        if ((ets_list[ii].element_index == ets->element_index) &&
-            (ets_list[ii].element_hierarchy == ets->element_hierarchy)) {
-            ets->next_element_index = ets_list[ii].next_element_index;
-            break;
+    for (ii = 0; ii < count; ii++) {
+        for (jj = 0; jj < ets_count; jj++) {
+            if ((ets_list[jj].element_index == ets[ii].element_index) &&
+                (ets_list[jj].element_hierarchy == ets[ii].element_hierarchy)) {
+                ets[ii].next_element_index = ets_list[jj].next_element_index;
+                break;
+            }
         }
-    }
 
-    ets_element_dump(port_log_id, ets);
-
-    status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                             port_log_id, ets, 1);
+        ets_element_dump(port_log_id, &ets[ii]);
+    }
 
-    if (status != SX_STATUS_SUCCESS) {
-        SX_LOG_ERR("Failed to apply scheduler on %s - %s.\n",
-                   name, SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
+    status = mlnx_port_ets_elements_set(port_log_id, ets, count);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to apply scheduler on %s (port log id=0x%x)\n", name, port_log_id);
     }
 
-out:
-    free(ets_list);
     return status;
 }
 
-static sai_status_t queue_update_ets(sx_port_log_id_t             port_log_id,
-                                     sx_cos_ets_element_config_t *ets,
-                                     mlnx_sched_obj_t            *obj)
+static sai_status_t ets_element_update(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets, char *name)
+{
+    return ets_elements_update(port_log_id, ets, 1, name);
+}
+
+static void queue_ets_fill(sx_cos_ets_element_config_t *ets, mlnx_sched_obj_t *obj)
 {
     ets->element_hierarchy = obj->ets_type;
     ets->element_index = obj->index;
     ets->min_shaper_enable = TRUE;
     ets->max_shaper_enable = TRUE;
+}
+
+static sai_status_t queue_update_ets(sx_port_log_id_t             port_log_id,
+                                     sx_cos_ets_element_config_t *ets,
+                                     mlnx_sched_obj_t            *obj)
+{
+    queue_ets_fill(ets, obj);
 
     return ets_element_update(port_log_id, ets, "queue");
 }
 
-static sai_status_t port_update_ets(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets)
+static sai_status_t port_ets_fill(sx_cos_ets_element_config_t *ets)
 {
     if (ets->min_shaper_rate > 0) {
         SX_LOG_ERR("Min bandwidth rate can't be used on the port\n");
@@ -312,13 +443,22 @@ static sai_status_t port_update_ets(sx_port_log_id_t port_log_id, sx_cos_ets_ele
     ets->dwrr = FALSE;
     ets->dwrr_enable = FALSE;
 
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t port_update_ets(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets)
+{
+    sai_status_t status;
+
+    status = port_ets_fill(ets);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
     return ets_element_update(port_log_id, ets, "port");
 }
 
-static sai_status_t group_update_ets(sx_port_log_id_t             port_log_id,
-                                     sx_cos_ets_element_config_t *ets,
-                                     uint8_t                      level,
-                                     uint8_t                      index)
+static void group_ets_fill(sx_cos_ets_element_config_t *ets, uint8_t level, uint8_t index)
 {
     ets->element_hierarchy = level + 1;
     ets->element_index = index;
@@ -328,10 +468,19 @@ static sai_status_t group_update_ets(sx_port_log_id_t             port_log_id,
         ets->min_shaper_enable = FALSE;
         ets->max_shaper_enable = FALSE;
     }
+}
+
+static sai_status_t group_update_ets(sx_port_log_id_t             port_log_id,
+                                     sx_cos_ets_element_config_t *ets,
+                                     uint8_t                      level,
+                                     uint8_t                      index)
+{
+    group_ets_fill(ets, level, index);
+
     return ets_element_update(port_log_id, ets, "group");
 }
 
-/* DB read lock is required */
+/* DB write lock is needed */
 static sai_status_t scheduler_to_group_apply(sai_object_id_t  scheduler_id,
                                              sx_port_log_id_t port_id,
                                              uint8_t          level,
@@ -364,29 +513,59 @@ static sai_status_t scheduler_to_group_apply(sai_object_id_t  scheduler_id,
     return group_update_ets(port_id, &ets, level, index);
 }
 
-static mlnx_iter_ret_t sched_profile_update_groups(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
+/* ETS elements of a port using the scheduler profile */
+typedef struct _sched_profile_ets_t {
+    sai_object_id_t                    scheduler_id;
+    const sx_cos_ets_element_config_t *profile_ets;
+    sx_cos_ets_element_config_t       *ets_list;
+    uint32_t                           count;
+} sched_profile_ets_t;
+
+static sx_cos_ets_element_config_t * sched_profile_ets_add(sched_profile_ets_t *profile)
 {
-    mlnx_sched_iter_ctx_t *ctx = arg;
-    sai_object_id_t        scheduler_id;
+    sx_cos_ets_element_config_t *ets;
+
+    if (profile->count >= MAX_ETS_ELEMENTS) {
+        SX_LOG_ERR("Port has more than %u ETS elements\n", MAX_ETS_ELEMENTS);
+        return NULL;
+    }
+
+    ets = &profile->ets_list[profile->count++];
+    memcpy(ets, profile->profile_ets, sizeof(*ets));
+
+    return ets;
+}
+
+static mlnx_iter_ret_t sched_profile_collect_groups(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
+{
+    mlnx_sched_iter_ctx_t       *ctx = arg;
+    sched_profile_ets_t         *profile;
+    sx_cos_ets_element_config_t *ets;
 
     assert(port != NULL);
     assert(ctx != NULL);
     assert(ctx->arg != NULL);
 
-    scheduler_id = *(sai_object_id_t*)ctx->arg;
+    profile = (sched_profile_ets_t*)ctx->arg;
 
-    if (obj->type != MLNX_SCHED_OBJ_GROUP) {
+    if ((obj->type != MLNX_SCHED_OBJ_GROUP) || (obj->scheduler_id != profile->scheduler_id)) {
         return ITER_NEXT;
     }
 
-    if (scheduler_id == obj->scheduler_id) {
-        ctx->sai_status = scheduler_to_group_apply(scheduler_id, port->logical, obj->level,
-                                                   obj->index);
-        if (SAI_ERR(ctx->sai_status)) {
-            return ITER_STOP;
-        }
+    if ((obj->level == 0) && (profile->profile_ets->dwrr == TRUE) && (profile->profile_ets->dwrr_enable == TRUE)) {
+        SX_LOG_ERR("DWRR alg type is not supported for groups on level 1\n");
+        ctx->sai_status = SAI_STATUS_INVALID_PARAMETER;
+        return ITER_STOP;
+    }
+
+    ets = sched_profile_ets_add(profile);
+    if (!ets) {
+        ctx->sai_status = SAI_STATUS_FAILURE;
+        return ITER_STOP;
     }
 
+    group_ets_fill(ets, obj->level, obj->index);
+
     return ITER_NEXT;
 }
 
@@ -398,7 +577,9 @@ static sai_status_t mlnx_sched_attr_setter(_In_ const sai_object_key_t      *key
     mlnx_sched_profile_t       *sched;
     mlnx_port_config_t         *port;
     mlnx_qos_queue_config_t    *queue;
-    sx_cos_ets_element_config_t ets;
+    sx_cos_ets_element_config_t ets, *port_ets;
+    sched_profile_ets_t         profile = { .ets_list = NULL };
+    mlnx_sched_refs_t          *refs;
     sai_status_t                status;
     uint32_t                    ii, qi;
     mlnx_sched_iter_ctx_t       ctx;
@@ -463,38 +644,79 @@ static sai_status_t mlnx_sched_attr_setter(_In_ const sai_object_key_t      *key
         break;
     }
 
+    refs = sched_refs_get(key->key.object_id);
+    if (!refs || !refs->ports_count) {
+        goto out;
+    }
+
     memcpy(&ets, &sched->ets, sizeof(ets));
     sai_to_sdk_rate(sched->min_rate, sched->max_rate, &ets);
 
-    mlnx_port_not_in_lag_foreach(port, ii) {
+    profile.scheduler_id = key->key.object_id;
+    profile.profile_ets = &ets;
+    profile.ets_list = (sx_cos_ets_element_config_t*)malloc(sizeof(*profile.ets_list) * MAX_ETS_ELEMENTS);
+    if (!profile.ets_list) {
+        SX_LOG_ERR("Failed to allocate ETS list\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    /* All the elements of a port using the profile are applied with one SDK call */
+    for (ii = 0; ii < MAX_PORTS * 2; ii++) {
+        if (!array_bit_test(refs->ports, ii)) {
+            continue;
+        }
+
+        port = &mlnx_ports_db[ii];
+        if (!mlnx_port_is_profile_bind_target(port)) {
+            continue;
+        }
+
+        profile.count = 0;
+
         if (port->scheduler_id == key->key.object_id) {
-            status = port_update_ets(port->logical, &ets);
+            port_ets = sched_profile_ets_add(&profile);
+            assert(port_ets != NULL);
 
-            if (status != SAI_STATUS_SUCCESS) {
+            status = port_ets_fill(port_ets);
+            if (SAI_ERR(status)) {
                 goto out;
             }
         }
 
         port_queues_foreach(port, queue, qi) {
             if (queue->sched_obj.scheduler_id == key->key.object_id) {
-                status = queue_update_ets(port->logical, &ets, &queue->sched_obj);
-
-                if (status != SAI_STATUS_SUCCESS) {
+                port_ets = sched_profile_ets_add(&profile);
+                if (!port_ets) {
+                    status = SAI_STATUS_FAILURE;
                     goto out;
                 }
+
+                queue_ets_fill(port_ets, &queue->sched_obj);
             }
         }
 
         ctx.sai_status = SAI_STATUS_SUCCESS;
-        ctx.arg = (void*)&key->key.object_id;
+        ctx.arg = &profile;
 
-        status = mlnx_sched_hierarchy_foreach(port, sched_profile_update_groups, &ctx);
-        if (status != SAI_STATUS_SUCCESS) {
+        status = mlnx_sched_hierarchy_foreach(port, sched_profile_collect_groups, &ctx);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+
+        if (!profile.count) {
+            continue;
+        }
+
+        status = ets_elements_update(port->logical, profile.ets_list, profile.count, "port elements");
+        if (SAI_ERR(status)) {
             goto out;
         }
     }
 
 out:
+    free(profile.ets_list);
+
     if (status == SAI_STATUS_SUCCESS) {
         sai_qos_db_sync();
     }
@@ -645,6 +867,7 @@ static sai_status_t mlnx_create_scheduler_profile(_Out_ sai_object_id_t      *sc
         SX_LOG_NTC("Allocated scheduler with index=%u\n", ii);
 
         memcpy(&sai_qos_sched_db[ii], &sched, sizeof(sched));
+        memset(&g_sai_qos_db_ptr->sched_refs[ii], 0, sizeof(g_sai_qos_db_ptr->sched_refs[ii]));
 
         break;
     }
@@ -772,6 +995,7 @@ static sai_status_t mlnx_get_scheduler_attribute(_In_ sai_object_id_t     schedu
 
 sai_status_t mlnx_scheduler_to_port_apply_unlocked(sai_object_id_t scheduler_id, sai_object_id_t port_id)
 {
+    sai_object_id_t             old_scheduler_id;
     sx_port_log_id_t            port_log_id;
     sai_status_t                status;
     mlnx_sched_profile_t       *sched;
@@ -824,7 +1048,9 @@ sai_status_t mlnx_scheduler_to_port_apply_unlocked(sai_object_id_t scheduler_id,
         return status;
     }
 
+    old_scheduler_id = port->scheduler_id;
     port->scheduler_id = scheduler_id;
+    sched_refs_update(port, old_scheduler_id, scheduler_id);
 
     return SAI_STATUS_SUCCESS;
 }
@@ -850,6 +1076,7 @@ out:
 /* DB write lock is required */
 sai_status_t mlnx_scheduler_to_group_apply(sai_object_id_t scheduler_id, sai_object_id_t group_id)
 {
+    sai_object_id_t     old_scheduler_id;
     sx_port_log_id_t    port_id;
     sai_status_t        status;
     uint8_t             level;
@@ -885,11 +1112,14 @@ sai_status_t mlnx_scheduler_to_group_apply(sai_object_id_t scheduler_id, sai_obj
             return status;
         }
     }
+    old_scheduler_id = port->sched_hierarchy.groups[level][index].scheduler_id;
     port->sched_hierarchy.groups[level][index].scheduler_id = scheduler_id;
+    sched_refs_update(port, old_scheduler_id, scheduler_id);
+
     return status;
 }
 
-/* DB read/write lock is needed */
+/* DB write lock is needed */
 sai_status_t __mlnx_scheduler_to_queue_apply(sai_object_id_t   scheduler_id,
                                              sx_port_log_id_t  port_log_id,
                                              mlnx_sched_obj_t *obj)
@@ -928,6 +1158,7 @@ sai_status_t __mlnx_scheduler_to_queue_apply(sai_object_id_t   scheduler_id,
 sai_status_t mlnx_scheduler_to_queue_apply(sai_object_id_t scheduler_id, sai_object_id_t queue_id)
 {
     uint8_t                  ext_data[EXTENDED_DATA_SIZE] = {0};
+    sai_object_id_t          old_scheduler_id;
     uint32_t                 queue_index;
     sx_port_log_id_t         port_log_id;
     mlnx_qos_queue_config_t *queue;
@@ -973,7 +1204,10 @@ sai_status_t mlnx_scheduler_to_queue_apply(sai_object_id_t scheduler_id, sai_obj
         goto out;
     }
 
+    old_scheduler_id = queue->sched_obj.scheduler_id;
     queue->sched_obj.scheduler_id = scheduler_id;
+    sched_refs_update(&mlnx_ports_db[(queue - g_sai_qos_db_ptr->queue_db) / MAX_QUEUES], old_scheduler_id,
+                      scheduler_id);
 
 out:
     return status;
@@ -997,6 +1231,9 @@ sai_status_t mlnx_scheduler_port_hierarchy_db_clear(_In_ mlnx_port_config_t *por
         queue_cfg->sched_obj.scheduler_id = SAI_NULL_OBJECT_ID;
     }
 
+    mlnx_port_ets_shadow_invalidate(port);
+    mlnx_sched_refs_port_sync(port);
+
     return SAI_STATUS_SUCCESS;
 }
 
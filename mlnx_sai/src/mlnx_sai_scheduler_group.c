@@ -139,20 +139,32 @@ static sx_cos_ets_element_config_t * sched_obj_to_ets(mlnx_sched_obj_t *obj, sx_
     return ets;
 }
 
-static sai_status_t ets_lookup(sx_cos_ets_element_config_t  *ets_list,
-                               mlnx_sched_obj_t             *sch_obj,
-                               sx_cos_ets_element_config_t **ets)
+static sx_cos_ets_element_config_t * ets_element_find(sx_cos_ets_element_config_t *ets_list,
+                                                      uint32_t                     count,
+                                                      uint32_t                     hierarchy,
+                                                      uint32_t                     index)
 {
     uint32_t ii;
 
-    for (ii = 0; ii < MAX_ETS_ELEMENTS; ii++) {
-        if ((ets_list[ii].element_hierarchy == sch_obj->ets_type) &&
-            (ets_list[ii].element_index == sch_obj->index)) {
-            *ets = &ets_list[ii];
-            return SAI_STATUS_SUCCESS;
+    for (ii = 0; ii < count; ii++) {
+        if ((ets_list[ii].element_hierarchy == hierarchy) && (ets_list[ii].element_index == index)) {
+            return &ets_list[ii];
         }
     }
 
+    return NULL;
+}
+
+static sai_status_t ets_lookup(sx_cos_ets_element_config_t  *ets_list,
+                               uint32_t                      count,
+                               mlnx_sched_obj_t             *sch_obj,
+                               sx_cos_ets_element_config_t **ets)
+{
+    *ets = ets_element_find(ets_list, count, sch_obj->ets_type, sch_obj->index);
+    if (*ets) {
+        return SAI_STATUS_SUCCESS;
+    }
+
     SX_LOG_ERR("Failed lookup ETS element by level %u and index %u\n",
                sch_obj->level, sch_obj->index);
 
@@ -238,31 +250,106 @@ static sai_status_t groups_child_foreach(mlnx_port_config_t    *port,
     return ctx->sai_status;
 }
 
-static sai_status_t ets_list_load(sx_port_log_id_t port_id, sx_cos_ets_element_config_t **ets)
+static mlnx_port_ets_shadow_t * ets_shadow_get(sx_port_log_id_t port_id, sx_cos_ets_element_config_t **ets_list)
 {
-    uint32_t     max_ets_count = MAX_ETS_ELEMENTS;
-    sai_status_t status;
+    mlnx_port_config_t *port;
+    sai_status_t        status;
+
+    status = mlnx_port_by_log_id_soft(port_id, &port);
+    if (SAI_ERR(status)) {
+        return NULL;
+    }
+
+    *ets_list = &g_sai_qos_db_ptr->ets_db[(size_t)port->index * MAX_ETS_ELEMENTS];
+
+    return &g_sai_qos_db_ptr->ets_shadow[port->index];
+}
+
+/* DB write lock is needed */
+void mlnx_port_ets_shadow_invalidate(_In_ const mlnx_port_config_t *port)
+{
+    assert(port);
+
+    g_sai_qos_db_ptr->ets_shadow[port->index].is_valid = false;
+}
+
+/* DB write lock is needed, the list is the port ETS shadow and is changed only by mlnx_port_ets_elements_set() */
+sai_status_t mlnx_port_ets_list_get(_In_ sx_port_log_id_t               port_id,
+                                    _Out_ sx_cos_ets_element_config_t **ets_list,
+                                    _Out_ uint32_t                     *count)
+{
+    mlnx_port_ets_shadow_t *shadow;
+    uint32_t                max_ets_count = MAX_ETS_ELEMENTS;
+    sx_status_t             sx_status;
+
+    assert(ets_list != NULL);
+    assert(count != NULL);
+
+    shadow = ets_shadow_get(port_id, ets_list);
+    if (!shadow) {
+        SX_LOG_ERR("Failed lookup port config by log id 0x%x\n", port_id);
+        return SAI_STATUS_INVALID_PORT_NUMBER;
+    }
+
+    /* The SDK list is read once and then kept up to date by the writes made by SAI */
+    if (!shadow->is_valid || (shadow->logical != port_id)) {
+        sx_status = sx_api_cos_port_ets_element_get(gh_sdk, port_id, *ets_list, &max_ets_count);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed get ETS list - %s\n", SX_STATUS_MSG(sx_status));
+            shadow->is_valid = false;
+            return sdk_to_sai(sx_status);
+        }
+
+        shadow->logical = port_id;
+        shadow->count = max_ets_count;
+        shadow->is_valid = true;
+    }
+
+    *count = shadow->count;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB write lock is needed */
+sai_status_t mlnx_port_ets_elements_set(_In_ sx_port_log_id_t             port_id,
+                                        _In_ sx_cos_ets_element_config_t *ets,
+                                        _In_ uint32_t                     count)
+{
+    sx_cos_ets_element_config_t *ets_list, *shadow_ets;
+    mlnx_port_ets_shadow_t      *shadow;
+    sx_status_t                  sx_status;
+    uint32_t                     ii;
 
     assert(ets != NULL);
 
-    *ets = (sx_cos_ets_element_config_t*)malloc(sizeof(**ets) * max_ets_count);
-    if (!*ets) {
-        SX_LOG_ERR("Failed allocate memory for ETS list\n");
-        return SAI_STATUS_NO_MEMORY;
+    if (!count) {
+        return SAI_STATUS_SUCCESS;
     }
 
-    status = sx_api_cos_port_ets_element_get(gh_sdk, port_id, *ets, &max_ets_count);
-    if (status != SX_STATUS_SUCCESS) {
-        SX_LOG_ERR("Failed get ETS list - %s\n", SX_STATUS_MSG(status));
+    sx_status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT, port_id, ets, count);
+
+    shadow = ets_shadow_get(port_id, &ets_list);
+    if (!shadow || !shadow->is_valid || (shadow->logical != port_id)) {
+        return sdk_to_sai(sx_status);
     }
 
-    status = sdk_to_sai(status);
-    if (status != SAI_STATUS_SUCCESS) {
-        free(*ets);
-        *ets = NULL;
+    /* The part of the elements which is applied on failure is unknown, the list is read again on the next use */
+    if (SX_ERR(sx_status)) {
+        shadow->is_valid = false;
+        return sdk_to_sai(sx_status);
     }
 
-    return status;
+    for (ii = 0; ii < count; ii++) {
+        shadow_ets = ets_element_find(ets_list, shadow->count, ets[ii].element_hierarchy, ets[ii].element_index);
+        if (!shadow_ets) {
+            shadow->is_valid = false;
+            break;
+        }
+
+        memcpy(shadow_ets, &ets[ii], sizeof(*shadow_ets));
+    }
+
+    return SAI_STATUS_SUCCESS;
 }
 
 static mlnx_iter_ret_t groups_child_counter(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
@@ -680,48 +767,47 @@ static sai_status_t mlnx_sched_objlist_to_ets_update(sx_port_log_id_t  port_id,
                                                      mlnx_sched_obj_t *sch_objlist,
                                                      uint32_t          count)
 {
-    sx_cos_ets_element_config_t *ets_list = NULL;
-    sx_status_t                  sx_status;
+    sx_cos_ets_element_config_t *ets_list, *ets, *ets_update = NULL;
     sai_status_t                 status;
-    uint32_t                     ii;
+    uint32_t                     ets_count, ii;
 
     assert(sch_objlist != NULL);
 
-    status = ets_list_load(port_id, &ets_list);
+    status = mlnx_port_ets_list_get(port_id, &ets_list, &ets_count);
     if (SAI_ERR(status)) {
         goto out;
     }
 
-    for (ii = 0; ii < count; ii++) {
-        sx_cos_ets_element_config_t *ets;
+    ets_update = (sx_cos_ets_element_config_t*)malloc(sizeof(*ets_update) * count);
+    if (!ets_update) {
+        SX_LOG_ERR("Failed allocate memory for ETS list\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
 
-        status = ets_lookup(ets_list, &sch_objlist[ii], &ets);
+    for (ii = 0; ii < count; ii++) {
+        status = ets_lookup(ets_list, ets_count, &sch_objlist[ii], &ets);
         if (SAI_ERR(status)) {
             goto out;
         }
 
-        sched_obj_to_ets(&sch_objlist[ii], ets);
+        memcpy(&ets_update[ii], ets, sizeof(ets_update[ii]));
+        sched_obj_to_ets(&sch_objlist[ii], &ets_update[ii]);
 
         SX_LOG_DBG("Changed ETS element (type %u index %u) next index %u -> %u\n",
                    ets->element_hierarchy,
-                   sch_objlist[ii].next_index,
+                   ets->element_index,
                    ets->next_element_index,
-                   ets->element_index);
+                   ets_update[ii].next_element_index);
     }
 
-    sx_status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                                port_id, ets_list, MAX_ETS_ELEMENTS);
-
-    status = sdk_to_sai(sx_status);
+    status = mlnx_port_ets_elements_set(port_id, ets_update, count);
     if (SAI_ERR(status)) {
-        SX_LOG_ERR("Failed to update ETS elements on log port id 0x%x - %s\n",
-                   port_id, SX_STATUS_MSG(sx_status));
+        SX_LOG_ERR("Failed to update ETS elements on log port id 0x%x\n", port_id);
     }
 
 out:
-    if (ets_list) {
-        free(ets_list);
-    }
+    free(ets_update);
     return status;
 }
 
@@ -1401,19 +1487,28 @@ sai_status_t mlnx_scheduler_group_log_set(sx_verbosity_level_t level)
     return SAI_STATUS_SUCCESS;
 }
 
-/* DB read lock is needed */
+/* DB write lock is needed - the port sched objects and ETS shadow are written */
 sai_status_t mlnx_sched_group_port_init(mlnx_port_config_t *port, bool is_warmboot_init_stage)
 {
-    sx_cos_ets_element_config_t *ets_list = NULL, *ets;
-    uint32_t                     level, ii;
+    sx_cos_ets_element_config_t *ets_list, *ets, *ets_update;
+    uint32_t                     level, ii, ets_count, update_count = 0;
     mlnx_qos_queue_config_t     *queue;
     sai_status_t                 status;
 
-    status = ets_list_load(port->logical, &ets_list);
+    /* The port may be re-created with the same DB entry, ETS list is read from SDK again */
+    mlnx_port_ets_shadow_invalidate(port);
+
+    status = mlnx_port_ets_list_get(port->logical, &ets_list, &ets_count);
     if (SAI_ERR(status)) {
         return status;
     }
 
+    ets_update = (sx_cos_ets_element_config_t*)malloc(sizeof(*ets_update) * ets_count);
+    if (!ets_update) {
+        SX_LOG_ERR("Failed allocate memory for ETS list\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
     for (level = 0; level < MAX_SCHED_LEVELS; level++) {
         for (ii = 0; ii < level_max_groups(level); ii++) {
             mlnx_sched_obj_t *obj = group_get(port, level, ii);
@@ -1430,28 +1525,20 @@ sai_status_t mlnx_sched_group_port_init(mlnx_port_config_t *port, bool is_warmbo
                 status = mlnx_create_sched_group(port->logical, level - 1, obj->next_index, &obj->parent_id);
                 if (SAI_ERR(status)) {
                     SX_LOG_ERR("Failed create of parent oid\n");
+                    free(ets_update);
                     return status;
                 }
             } else {
                 obj->parent_id = port->saiport;
             }
 
-            status = ets_lookup(ets_list, obj, &ets);
+            status = ets_lookup(ets_list, ets_count, obj, &ets);
             if (SAI_ERR(status)) {
                 goto out;
             }
 
-            if (!is_warmboot_init_stage) {
-                status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                                         port->logical,
-                                                         sched_obj_to_ets(obj, ets),
-                                                         1);
-
-                status = sdk_to_sai(status);
-                if (SAI_ERR(status)) {
-                    goto out;
-                }
-            }
+            memcpy(&ets_update[update_count], ets, sizeof(*ets));
+            sched_obj_to_ets(obj, &ets_update[update_count++]);
 
             port->sched_hierarchy.groups_count[level]++;
         }
@@ -1471,31 +1558,28 @@ sai_status_t mlnx_sched_group_port_init(mlnx_port_config_t *port, bool is_warmbo
                                          &queue->sched_obj.parent_id);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed create parent oid for queue\n");
+            free(ets_update);
             return status;
         }
 
-        status = ets_lookup(ets_list, &queue->sched_obj, &ets);
+        status = ets_lookup(ets_list, ets_count, &queue->sched_obj, &ets);
         if (SAI_ERR(status)) {
             goto out;
         }
 
-        if (!is_warmboot_init_stage) {
-            status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                                     port->logical,
-                                                     sched_obj_to_ets(&queue->sched_obj, ets),
-                                                     1);
+        memcpy(&ets_update[update_count], ets, sizeof(*ets));
+        sched_obj_to_ets(&queue->sched_obj, &ets_update[update_count++]);
+    }
 
-            status = sdk_to_sai(status);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
+    if (!is_warmboot_init_stage) {
+        status = mlnx_port_ets_elements_set(port->logical, ets_update, update_count);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to update ETS elements on log port id 0x%x\n", port->logical);
         }
     }
 
 out:
-    if (ets_list) {
-        free(ets_list);
-    }
+    free(ets_update);
     port->sched_hierarchy.is_default = true;
 
     return SAI_STATUS_SUCCESS;
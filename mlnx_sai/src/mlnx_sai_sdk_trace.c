@@ -0,0 +1,253 @@
+/*
+ *  Copyright (c) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "sai_windows.h"
+#include "sai.h"
+#include "mlnx_sai.h"
+#include "assert.h"
+#include <errno.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#undef  __MODULE__
+#define __MODULE__ SAI_SDK_TRACE
+
+/*
+ * SDK call tracer.
+ *
+ * When the library is built with --enable-sdk-trace the SDK calls in MLNX_SDK_TRACE_CALLS are
+ * wrapped (see mlnx_sai.h) and, if SAI_SDK_TRACE_FILE is set, every call is recorded to a ring of
+ * fixed size records in a memory mapped file. A record holds the call, the access cmd, the SDK
+ * status, the start time and duration, the thread and the SAI API call in progress on the thread.
+ * The slot of a record is reserved with an atomic increment of the header head, the record seq is
+ * stored last so a reader (sdktracetool.py) can skip the records which were being written.
+ * The file is self describing - the names of the calls, access cmds, SAI object types and ops are
+ * stored in it so the records can be analyzed offline without the SDK and SAI headers.
+ * The arguments of the calls are not recorded and the SDK calls which are not in MLNX_SDK_TRACE_CALLS
+ * are not traced, so the trace can be analyzed (call counts, redundant get/set pairs, batching) but
+ * not replayed.
+ */
+
+#ifdef _WIN32
+#define MLNX_SDK_TRACE_TLS __declspec(thread)
+#else
+#define MLNX_SDK_TRACE_TLS __thread
+#endif
+
+static sx_verbosity_level_t         LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
+bool                                g_mlnx_sdk_trace_enabled = false;
+static mlnx_sdk_trace_file_hdr_t   *sdk_trace_hdr;
+static mlnx_sdk_trace_record_t     *sdk_trace_records;
+static size_t                       sdk_trace_size;
+static MLNX_SDK_TRACE_TLS uint64_t  sdk_trace_start_us;
+static MLNX_SDK_TRACE_TLS uint32_t  sdk_trace_tid;
+
+#define MLNX_SDK_TRACE_CALL_NAME(name) #name,
+static const char * const mlnx_sdk_trace_call_names[MLNX_SDK_TRACE_CALL_MAX] = {
+    MLNX_SDK_TRACE_CALLS(MLNX_SDK_TRACE_CALL_NAME)
+};
+
+sai_status_t mlnx_sdk_trace_log_set(sx_verbosity_level_t level)
+{
+    LOG_VAR_NAME(__MODULE__) = level;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_sdk_trace_names_fill(_In_ uint32_t offset, _In_ uint32_t idx, _In_ const char *name)
+{
+    char *table = (char*)sdk_trace_hdr + offset;
+
+    if (!name) {
+        return;
+    }
+
+    strncpy(table + (size_t)idx * MLNX_SDK_TRACE_NAME_LEN, name, MLNX_SDK_TRACE_NAME_LEN - 1);
+}
+
+sai_status_t mlnx_sdk_trace_init(_In_ const char *path, _In_ uint32_t records_max)
+{
+    mlnx_sdk_trace_file_hdr_t hdr;
+    sai_object_type_t         object_type;
+    uint32_t                  ii;
+    void                     *base;
+    int                       fd;
+
+    assert(path);
+
+    if (g_mlnx_sdk_trace_enabled) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /* Mapping of the previous switch instance, no SDK calls are made until the switch is initialized */
+    if (sdk_trace_hdr) {
+        munmap(sdk_trace_hdr, sdk_trace_size);
+        sdk_trace_hdr = NULL;
+        sdk_trace_records = NULL;
+    }
+
+    if (!records_max) {
+        records_max = MLNX_SDK_TRACE_RECORDS_DEF;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = MLNX_SDK_TRACE_MAGIC;
+    hdr.version = MLNX_SDK_TRACE_VERSION;
+    hdr.hdr_size = sizeof(hdr);
+    hdr.record_size = sizeof(mlnx_sdk_trace_record_t);
+    hdr.records_max = records_max;
+    hdr.name_len = MLNX_SDK_TRACE_NAME_LEN;
+    hdr.call_names_offset = sizeof(hdr);
+    hdr.call_names_count = MLNX_SDK_TRACE_CALL_MAX;
+    hdr.object_type_names_offset = hdr.call_names_offset + hdr.call_names_count * MLNX_SDK_TRACE_NAME_LEN;
+    hdr.object_type_names_count = SAI_OBJECT_TYPE_MAX;
+    hdr.op_names_offset = hdr.object_type_names_offset + hdr.object_type_names_count * MLNX_SDK_TRACE_NAME_LEN;
+    hdr.op_names_count = MLNX_API_STATS_OP_MAX;
+    hdr.cmd_names_offset = hdr.op_names_offset + hdr.op_names_count * MLNX_SDK_TRACE_NAME_LEN;
+    hdr.cmd_names_count = SX_ACCESS_CMD_MAX + 1;
+    hdr.records_offset = hdr.cmd_names_offset + hdr.cmd_names_count * MLNX_SDK_TRACE_NAME_LEN;
+    /* Keep the records 8 bytes aligned for the atomic seq access */
+    hdr.records_offset = (hdr.records_offset + 7) & ~7U;
+
+    sdk_trace_size = hdr.records_offset + (size_t)records_max * sizeof(mlnx_sdk_trace_record_t);
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        SX_LOG_ERR("Failed to open SDK trace file %s - %s\n", path, strerror(errno));
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (ftruncate(fd, sdk_trace_size) == -1) {
+        SX_LOG_ERR("Failed to resize SDK trace file %s to %zu - %s\n", path, sdk_trace_size, strerror(errno));
+        close(fd);
+        return SAI_STATUS_FAILURE;
+    }
+
+    base = mmap(NULL, sdk_trace_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        SX_LOG_ERR("Failed to map SDK trace file %s - %s\n", path, strerror(errno));
+        return SAI_STATUS_FAILURE;
+    }
+
+    sdk_trace_hdr = base;
+    memcpy(sdk_trace_hdr, &hdr, sizeof(hdr));
+    sdk_trace_records = (mlnx_sdk_trace_record_t*)((char*)base + hdr.records_offset);
+
+    for (ii = 0; ii < MLNX_SDK_TRACE_CALL_MAX; ii++) {
+        mlnx_sdk_trace_names_fill(hdr.call_names_offset, ii, mlnx_sdk_trace_call_names[ii]);
+    }
+    for (object_type = SAI_OBJECT_TYPE_NULL; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        mlnx_sdk_trace_names_fill(hdr.object_type_names_offset, object_type, SAI_TYPE_STR(object_type));
+    }
+    for (ii = 0; ii < MLNX_API_STATS_OP_MAX; ii++) {
+        mlnx_sdk_trace_names_fill(hdr.op_names_offset, ii, mlnx_api_stats_op_str(ii));
+    }
+    for (ii = 0; ii < hdr.cmd_names_count; ii++) {
+        mlnx_sdk_trace_names_fill(hdr.cmd_names_offset, ii, SX_ACCESS_CMD_STR(ii));
+    }
+
+    __atomic_store_n(&g_mlnx_sdk_trace_enabled, true, __ATOMIC_RELEASE);
+
+#ifndef SDK_TRACE
+    SX_LOG_WRN("SDK trace file %s is set but the library is built without --enable-sdk-trace\n", path);
+#endif
+    SX_LOG_NTC("SDK trace to %s, %u records\n", path, records_max);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+void mlnx_sdk_trace_deinit(void)
+{
+    if (!g_mlnx_sdk_trace_enabled) {
+        return;
+    }
+
+    __atomic_store_n(&g_mlnx_sdk_trace_enabled, false, __ATOMIC_RELEASE);
+
+    SX_LOG_NTC("SDK trace stopped, %" PRIu64 " calls recorded\n",
+               __atomic_load_n(&sdk_trace_hdr->head, __ATOMIC_RELAXED));
+
+    /* Calls in progress may still write a record, the mapping is released on the next init */
+    msync(sdk_trace_hdr, sdk_trace_size, MS_SYNC);
+}
+
+/* The SDK calls are also timed for the API stats */
+void mlnx_sdk_trace_begin(void)
+{
+    sdk_trace_start_us = (g_mlnx_sdk_trace_enabled || g_mlnx_api_stats_enabled) ? time_us_get() : 0;
+}
+
+sx_status_t mlnx_sdk_trace_end(_In_ mlnx_sdk_trace_call_t call, _In_ uint32_t cmd, _In_ sx_status_t status)
+{
+    const mlnx_api_stats_ctx_t *api_call;
+    mlnx_sdk_trace_record_t    *record;
+    uint64_t                    seq, end_us;
+
+    if (!sdk_trace_start_us) {
+        return status;
+    }
+
+    end_us = time_us_get();
+    mlnx_api_stats_sdk_time_add(end_us - sdk_trace_start_us);
+
+    if (!g_mlnx_sdk_trace_enabled) {
+        sdk_trace_start_us = 0;
+        return status;
+    }
+
+    if (!sdk_trace_tid) {
+#ifdef _WIN32
+        sdk_trace_tid = (uint32_t)GetCurrentThreadId();
+#else
+        sdk_trace_tid = (uint32_t)syscall(SYS_gettid);
+#endif
+    }
+
+    seq = __atomic_fetch_add(&sdk_trace_hdr->head, 1, __ATOMIC_RELAXED);
+    record = &sdk_trace_records[seq % sdk_trace_hdr->records_max];
+
+    __atomic_store_n(&record->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    record->start_us = sdk_trace_start_us;
+    record->duration_us = (uint32_t)MIN(end_us - sdk_trace_start_us, UINT32_MAX);
+    record->tid = sdk_trace_tid;
+    record->status = (int32_t)status;
+    record->cmd = cmd;
+    record->call = (uint16_t)call;
+
+    api_call = mlnx_api_stats_current_get();
+    if (api_call) {
+        record->sai_call_seq = api_call->call_seq;
+        record->sai_object_type = (uint16_t)api_call->object_type;
+        record->sai_op = (uint8_t)api_call->op;
+    } else {
+        record->sai_call_seq = 0;
+        record->sai_object_type = SAI_OBJECT_TYPE_NULL;
+        record->sai_op = MLNX_SDK_TRACE_NO_OP;
+    }
+
+    __atomic_store_n(&record->seq, seq + 1, __ATOMIC_RELEASE);
+
+    sdk_trace_start_us = 0;
+
+    return status;
+}
@@ -0,0 +1,585 @@
+/*
+ *  Copyright (c) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "sai_windows.h"
+#include "sai.h"
+#include "mlnx_sai.h"
+#include "assert.h"
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#undef  __MODULE__
+#define __MODULE__ SAI_STATS_CACHE
+
+/*
+ * Counter snapshot service.
+ *
+ * Registered objects are refreshed by a background thread every g_stats_cache.interval_ms.
+ * The values are kept in two buffers, the thread fills the buffer which is not published and
+ * then flips the generation (the published buffer is generation & 1).
+ * Readers never take a lock - they validate that the generation and the entry stamp did not
+ * change while the values were copied, and fall back to the SDK otherwise.
+ * Clearing the counters of an object bumps the entry clear_seq, a buffer is served only if it was
+ * filled by a refresh which started after the last clear.
+ * The callers hold the cache through mlnx_stats_cache_enter/exit, the deinit unpublishes g_stats_cache
+ * and frees it only after the callers which already hold it are gone.
+ */
+
+#define MLNX_STATS_CACHE_MAX_AGE_FACTOR (3)
+#define MLNX_STATS_CACHE_READ_RETRIES   (3)
+
+typedef struct _mlnx_stats_cache_entry_t {
+    bool              is_used;
+    sai_object_type_t object_type;
+    sai_object_id_t   oid;
+    uint32_t          counters_count;
+    sai_stat_id_t     counter_ids[MLNX_STATS_CACHE_COUNTERS_MAX];
+    uint64_t          clear_seq;
+    /* generation the buffer was filled in, 0 - buffer is not valid */
+    uint64_t stamp[2];
+    uint64_t buf_clear_seq[2];
+    uint64_t timestamp_ms[2];
+    uint64_t values[2][MLNX_STATS_CACHE_COUNTERS_MAX];
+} mlnx_stats_cache_entry_t;
+
+typedef struct _mlnx_stats_cache_t {
+    bool                     is_enabled;
+    uint32_t                 interval_ms;
+    uint64_t                 generation;
+    uint32_t                 entries_hwm;
+    uint64_t                 hits;
+    uint64_t                 misses;
+    mlnx_stats_cache_entry_t entries[MLNX_STATS_CACHE_ENTRIES_MAX];
+} mlnx_stats_cache_t;
+
+static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
+static mlnx_stats_cache_t  *g_stats_cache = NULL;
+static cl_thread_t          stats_cache_thread;
+static bool                 stats_cache_thread_asked_to_stop = false;
+static uint32_t             stats_cache_users = 0;
+#ifndef _WIN32
+static pthread_mutex_t stats_cache_reg_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+sai_status_t mlnx_stats_cache_log_set(sx_verbosity_level_t level)
+{
+    LOG_VAR_NAME(__MODULE__) = level;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static bool mlnx_stats_cache_is_refresh_thread(void)
+{
+#ifndef _WIN32
+    return pthread_equal(pthread_self(), stats_cache_thread.osd.id);
+#else
+    return false;
+#endif
+}
+
+/* Returns the cache if it is enabled, it is not freed until mlnx_stats_cache_exit */
+static mlnx_stats_cache_t* mlnx_stats_cache_enter(void)
+{
+    mlnx_stats_cache_t *cache;
+
+    __atomic_add_fetch(&stats_cache_users, 1, __ATOMIC_SEQ_CST);
+
+    cache = __atomic_load_n(&g_stats_cache, __ATOMIC_SEQ_CST);
+    if (!cache || !__atomic_load_n(&cache->is_enabled, __ATOMIC_ACQUIRE)) {
+        __atomic_sub_fetch(&stats_cache_users, 1, __ATOMIC_RELEASE);
+        return NULL;
+    }
+
+    return cache;
+}
+
+static void mlnx_stats_cache_exit(void)
+{
+    __atomic_sub_fetch(&stats_cache_users, 1, __ATOMIC_RELEASE);
+}
+
+static sai_status_t mlnx_stats_cache_object_read(_In_ sai_object_type_t     object_type,
+                                                 _In_ sai_object_id_t       oid,
+                                                 _In_ uint32_t              number_of_counters,
+                                                 _In_ const sai_stat_id_t  *counter_ids,
+                                                 _Out_ uint64_t            *counters)
+{
+    switch (object_type) {
+    case SAI_OBJECT_TYPE_PORT:
+        return mlnx_port_api.get_port_stats_ext(oid, number_of_counters, counter_ids,
+                                                SAI_STATS_MODE_READ, counters);
+
+    case SAI_OBJECT_TYPE_ROUTER_INTERFACE:
+        return mlnx_router_interface_api.get_router_interface_stats_ext(oid, number_of_counters, counter_ids,
+                                                                        SAI_STATS_MODE_READ, counters);
+
+    case SAI_OBJECT_TYPE_BUFFER_POOL:
+        return mlnx_buffer_api.get_buffer_pool_stats_ext(oid, number_of_counters, counter_ids,
+                                                         SAI_STATS_MODE_READ, counters);
+
+    case SAI_OBJECT_TYPE_COUNTER:
+        return mlnx_counter_api.get_counter_stats_ext(oid, number_of_counters, counter_ids,
+                                                      SAI_STATS_MODE_READ, counters);
+
+    default:
+        SX_LOG_ERR("Object type %s is not supported by the stats cache\n", SAI_TYPE_STR(object_type));
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static void mlnx_stats_cache_refresh(_In_ mlnx_stats_cache_t *cache)
+{
+    mlnx_stats_cache_entry_t *entry;
+    sai_status_t              status;
+    uint64_t                  next_gen, now, clear_seq;
+    uint32_t                  ii, buf, entries_hwm;
+
+    next_gen = __atomic_load_n(&cache->generation, __ATOMIC_ACQUIRE) + 1;
+    buf = (uint32_t)(next_gen & 1);
+    entries_hwm = __atomic_load_n(&cache->entries_hwm, __ATOMIC_ACQUIRE);
+
+    for (ii = 0; ii < entries_hwm; ii++) {
+        entry = &cache->entries[ii];
+
+        if (!__atomic_load_n(&entry->is_used, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+
+        /* invalidate the buffer before overwriting it */
+        __atomic_store_n(&entry->stamp[buf], 0, __ATOMIC_RELEASE);
+        clear_seq = __atomic_load_n(&entry->clear_seq, __ATOMIC_ACQUIRE);
+
+        status = mlnx_stats_cache_object_read(entry->object_type, entry->oid, entry->counters_count,
+                                              entry->counter_ids, entry->values[buf]);
+        if (SAI_ERR(status)) {
+            /* Object is most likely removed, the next reader will register it again if needed */
+            SX_LOG_NTC("Failed to refresh stats of object 0x%" PRIx64 ", dropping it from the cache\n", entry->oid);
+            __atomic_store_n(&entry->is_used, false, __ATOMIC_RELEASE);
+            continue;
+        }
+
+        now = time_ms_get();
+        entry->timestamp_ms[buf] = now;
+        entry->buf_clear_seq[buf] = clear_seq;
+        __atomic_store_n(&entry->stamp[buf], next_gen, __ATOMIC_RELEASE);
+    }
+
+    __atomic_store_n(&cache->generation, next_gen, __ATOMIC_RELEASE);
+}
+
+/* The cache is freed only after the thread is joined */
+static void mlnx_stats_cache_thread_func(void *context)
+{
+    mlnx_stats_cache_t *cache = context;
+    uint64_t            start_ms, elapsed_ms;
+
+    SX_LOG_NTC("Stats cache thread started, refresh interval %u ms\n", cache->interval_ms);
+
+    while (!stats_cache_thread_asked_to_stop) {
+        start_ms = time_ms_get();
+
+        mlnx_stats_cache_refresh(cache);
+
+        elapsed_ms = time_ms_get() - start_ms;
+        if (elapsed_ms > cache->interval_ms) {
+            SX_LOG_NTC("Stats cache refresh took %" PRIu64 " ms, longer than interval %u ms\n",
+                       elapsed_ms, cache->interval_ms);
+            continue;
+        }
+
+        cl_thread_suspend((uint32_t)(cache->interval_ms - elapsed_ms));
+    }
+
+    SX_LOG_NTC("Closing stats cache thread\n");
+}
+
+static mlnx_stats_cache_entry_t* mlnx_stats_cache_entry_find(_In_ mlnx_stats_cache_t    *cache,
+                                                             _In_ sai_object_id_t       oid,
+                                                             _In_ uint32_t              number_of_counters,
+                                                             _In_ const sai_stat_id_t  *counter_ids,
+                                                             _Out_ uint32_t            *positions)
+{
+    mlnx_stats_cache_entry_t *entry;
+    uint32_t                  ii, jj, kk, entries_hwm;
+
+    entries_hwm = __atomic_load_n(&cache->entries_hwm, __ATOMIC_ACQUIRE);
+
+    for (ii = 0; ii < entries_hwm; ii++) {
+        entry = &cache->entries[ii];
+
+        if (!__atomic_load_n(&entry->is_used, __ATOMIC_ACQUIRE) || (entry->oid != oid)) {
+            continue;
+        }
+
+        for (jj = 0; jj < number_of_counters; jj++) {
+            for (kk = 0; kk < entry->counters_count; kk++) {
+                if (entry->counter_ids[kk] == counter_ids[jj]) {
+                    break;
+                }
+            }
+
+            if (kk == entry->counters_count) {
+                break;
+            }
+
+            positions[jj] = kk;
+        }
+
+        if (jj == number_of_counters) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static sai_status_t mlnx_stats_cache_get_impl(_In_ mlnx_stats_cache_t    *cache,
+                                              _In_ sai_object_id_t       oid,
+                                              _In_ uint32_t              number_of_counters,
+                                              _In_ const sai_stat_id_t  *counter_ids,
+                                              _Out_ uint64_t            *counters,
+                                              _Out_ uint64_t            *age_ms)
+{
+    mlnx_stats_cache_entry_t *entry;
+    uint32_t                  positions[MLNX_STATS_CACHE_COUNTERS_MAX];
+    uint64_t                  gen, timestamp_ms, now, clear_seq;
+    uint32_t                  ii, retry, buf;
+
+    assert(counter_ids);
+    assert(counters);
+    assert(age_ms);
+
+    if (number_of_counters > MLNX_STATS_CACHE_COUNTERS_MAX) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    entry = mlnx_stats_cache_entry_find(cache, oid, number_of_counters, counter_ids, positions);
+    if (!entry) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    for (retry = 0; retry < MLNX_STATS_CACHE_READ_RETRIES; retry++) {
+        gen = __atomic_load_n(&cache->generation, __ATOMIC_ACQUIRE);
+        buf = (uint32_t)(gen & 1);
+
+        if ((gen == 0) || (__atomic_load_n(&entry->stamp[buf], __ATOMIC_ACQUIRE) != gen)) {
+            return SAI_STATUS_ITEM_NOT_FOUND;
+        }
+
+        for (ii = 0; ii < number_of_counters; ii++) {
+            counters[ii] = entry->values[buf][positions[ii]];
+        }
+        timestamp_ms = entry->timestamp_ms[buf];
+        clear_seq = entry->buf_clear_seq[buf];
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        /* Counters were cleared after the snapshot was taken */
+        if (clear_seq != __atomic_load_n(&entry->clear_seq, __ATOMIC_ACQUIRE)) {
+            return SAI_STATUS_ITEM_NOT_FOUND;
+        }
+
+        if ((__atomic_load_n(&cache->generation, __ATOMIC_ACQUIRE) == gen) &&
+            (__atomic_load_n(&entry->stamp[buf], __ATOMIC_ACQUIRE) == gen) &&
+            (entry->oid == oid)) {
+            now = time_ms_get();
+            *age_ms = (now > timestamp_ms) ? now - timestamp_ms : 0;
+
+            /* Refresh thread is stuck, don't serve stale data */
+            if (*age_ms > (uint64_t)cache->interval_ms * MLNX_STATS_CACHE_MAX_AGE_FACTOR) {
+                return SAI_STATUS_ITEM_NOT_FOUND;
+            }
+
+            return SAI_STATUS_SUCCESS;
+        }
+    }
+
+    return SAI_STATUS_ITEM_NOT_FOUND;
+}
+
+/*
+ * Returns the counters from the last published snapshot and the snapshot age.
+ * SAI_STATUS_ITEM_NOT_FOUND - the object/counters are not registered or the snapshot is not valid.
+ */
+sai_status_t mlnx_stats_cache_get(_In_ sai_object_id_t       oid,
+                                  _In_ uint32_t              number_of_counters,
+                                  _In_ const sai_stat_id_t  *counter_ids,
+                                  _Out_ uint64_t            *counters,
+                                  _Out_ uint64_t            *age_ms)
+{
+    mlnx_stats_cache_t *cache;
+    sai_status_t        status;
+
+    cache = mlnx_stats_cache_enter();
+    if (!cache) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    status = mlnx_stats_cache_get_impl(cache, oid, number_of_counters, counter_ids, counters, age_ms);
+
+    mlnx_stats_cache_exit();
+    return status;
+}
+
+static sai_status_t mlnx_stats_cache_register_impl(_In_ mlnx_stats_cache_t    *cache,
+                                                   _In_ sai_object_type_t     object_type,
+                                                   _In_ sai_object_id_t       oid,
+                                                   _In_ uint32_t              number_of_counters,
+                                                   _In_ const sai_stat_id_t  *counter_ids)
+{
+    mlnx_stats_cache_entry_t *entry = NULL;
+    uint32_t                  positions[MLNX_STATS_CACHE_COUNTERS_MAX];
+    sai_status_t              status = SAI_STATUS_SUCCESS;
+    uint32_t                  ii;
+
+    if ((number_of_counters == 0) || (number_of_counters > MLNX_STATS_CACHE_COUNTERS_MAX)) {
+        SX_LOG_DBG("Number of counters %u is not supported by the stats cache\n", number_of_counters);
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&stats_cache_reg_mutex);
+#endif
+
+    if (mlnx_stats_cache_entry_find(cache, oid, number_of_counters, counter_ids, positions)) {
+        goto out;
+    }
+
+    for (ii = 0; ii < MLNX_STATS_CACHE_ENTRIES_MAX; ii++) {
+        if (!__atomic_load_n(&cache->entries[ii].is_used, __ATOMIC_ACQUIRE)) {
+            entry = &cache->entries[ii];
+            break;
+        }
+    }
+
+    if (!entry) {
+        SX_LOG_DBG("Stats cache is full\n");
+        status = SAI_STATUS_INSUFFICIENT_RESOURCES;
+        goto out;
+    }
+
+    /* Invalidate the old snapshots first - a reader of the previous owner of the slot will detect it */
+    __atomic_add_fetch(&entry->clear_seq, 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&entry->stamp[0], 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&entry->stamp[1], 0, __ATOMIC_RELEASE);
+
+    entry->object_type = object_type;
+    entry->oid = oid;
+    entry->counters_count = number_of_counters;
+    memcpy(entry->counter_ids, counter_ids, number_of_counters * sizeof(*counter_ids));
+
+    __atomic_store_n(&entry->is_used, true, __ATOMIC_RELEASE);
+
+    if (ii >= cache->entries_hwm) {
+        __atomic_store_n(&cache->entries_hwm, ii + 1, __ATOMIC_RELEASE);
+    }
+
+out:
+#ifndef _WIN32
+    pthread_mutex_unlock(&stats_cache_reg_mutex);
+#endif
+    return status;
+}
+
+sai_status_t mlnx_stats_cache_register(_In_ sai_object_type_t     object_type,
+                                       _In_ sai_object_id_t       oid,
+                                       _In_ uint32_t              number_of_counters,
+                                       _In_ const sai_stat_id_t  *counter_ids)
+{
+    mlnx_stats_cache_t *cache;
+    sai_status_t        status;
+
+    cache = mlnx_stats_cache_enter();
+    if (!cache) {
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    status = mlnx_stats_cache_register_impl(cache, object_type, oid, number_of_counters, counter_ids);
+
+    mlnx_stats_cache_exit();
+    return status;
+}
+
+/*
+ * Invalidates the snapshots of the object, to be called after its counters are cleared
+ * (clear stats or READ_AND_CLEAR), the next READ goes to the SDK.
+ */
+void mlnx_stats_cache_invalidate(_In_ sai_object_id_t oid)
+{
+    mlnx_stats_cache_entry_t *entry;
+    mlnx_stats_cache_t       *cache;
+    uint32_t                  ii, entries_hwm;
+
+    cache = mlnx_stats_cache_enter();
+    if (!cache) {
+        return;
+    }
+
+    entries_hwm = __atomic_load_n(&cache->entries_hwm, __ATOMIC_ACQUIRE);
+
+    for (ii = 0; ii < entries_hwm; ii++) {
+        entry = &cache->entries[ii];
+
+        if (__atomic_load_n(&entry->is_used, __ATOMIC_ACQUIRE) && (entry->oid == oid)) {
+            __atomic_add_fetch(&entry->clear_seq, 1, __ATOMIC_RELEASE);
+        }
+    }
+
+    mlnx_stats_cache_exit();
+}
+
+/*
+ * Drops the object from the cache, to be called when the object is removed so the refresh
+ * thread stops polling it.
+ */
+void mlnx_stats_cache_unregister(_In_ sai_object_id_t oid)
+{
+    mlnx_stats_cache_entry_t *entry;
+    mlnx_stats_cache_t       *cache;
+    uint32_t                  ii, entries_hwm;
+
+    cache = mlnx_stats_cache_enter();
+    if (!cache) {
+        return;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&stats_cache_reg_mutex);
+#endif
+
+    entries_hwm = __atomic_load_n(&cache->entries_hwm, __ATOMIC_ACQUIRE);
+
+    for (ii = 0; ii < entries_hwm; ii++) {
+        entry = &cache->entries[ii];
+
+        if (!__atomic_load_n(&entry->is_used, __ATOMIC_ACQUIRE) || (entry->oid != oid)) {
+            continue;
+        }
+
+        __atomic_store_n(&entry->is_used, false, __ATOMIC_RELEASE);
+        __atomic_add_fetch(&entry->clear_seq, 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&entry->stamp[0], 0, __ATOMIC_RELEASE);
+        __atomic_store_n(&entry->stamp[1], 0, __ATOMIC_RELEASE);
+    }
+
+#ifndef _WIN32
+    pthread_mutex_unlock(&stats_cache_reg_mutex);
+#endif
+
+    mlnx_stats_cache_exit();
+}
+
+/*
+ * Serves stats READ from the cache when enabled. On a miss the object is registered so
+ * the following polls of the same counters are served from the snapshot.
+ * Returns true if counters are filled.
+ */
+bool mlnx_stats_cache_lookup(_In_ sai_object_type_t     object_type,
+                             _In_ sai_object_id_t       oid,
+                             _In_ uint32_t              number_of_counters,
+                             _In_ const sai_stat_id_t  *counter_ids,
+                             _In_ sai_stats_mode_t      mode,
+                             _Out_ uint64_t            *counters)
+{
+    mlnx_stats_cache_t *cache;
+    sai_status_t        status;
+    uint64_t            age_ms = 0;
+
+    if ((mode != SAI_STATS_MODE_READ) || mlnx_stats_cache_is_refresh_thread()) {
+        return false;
+    }
+
+    cache = mlnx_stats_cache_enter();
+    if (!cache) {
+        return false;
+    }
+
+    status = mlnx_stats_cache_get_impl(cache, oid, number_of_counters, counter_ids, counters, &age_ms);
+    if (SAI_OK(status)) {
+        __atomic_add_fetch(&cache->hits, 1, __ATOMIC_RELAXED);
+        SX_LOG_DBG("Stats of object 0x%" PRIx64 " served from cache, age %" PRIu64 " ms\n", oid, age_ms);
+        mlnx_stats_cache_exit();
+        return true;
+    }
+
+    __atomic_add_fetch(&cache->misses, 1, __ATOMIC_RELAXED);
+    mlnx_stats_cache_register_impl(cache, object_type, oid, number_of_counters, counter_ids);
+
+    mlnx_stats_cache_exit();
+    return false;
+}
+
+sai_status_t mlnx_stats_cache_init(_In_ uint32_t interval_ms)
+{
+    mlnx_stats_cache_t *cache;
+    cl_status_t         cl_err;
+
+    if (interval_ms == 0) {
+        SX_LOG_NTC("Stats cache is disabled\n");
+        return SAI_STATUS_SUCCESS;
+    }
+
+    cache = calloc(1, sizeof(*cache));
+    if (!cache) {
+        SX_LOG_ERR("Failed to allocate stats cache\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    cache->interval_ms = interval_ms;
+    cache->is_enabled = true;
+
+    stats_cache_thread_asked_to_stop = false;
+
+    cl_err = cl_thread_init(&stats_cache_thread, mlnx_stats_cache_thread_func, cache, NULL);
+    if (cl_err) {
+        SX_LOG_ERR("Failed to create stats cache thread\n");
+        free(cache);
+        return SAI_STATUS_FAILURE;
+    }
+
+    /* Published when it is ready to be used */
+    __atomic_store_n(&g_stats_cache, cache, __ATOMIC_SEQ_CST);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+void mlnx_stats_cache_deinit(void)
+{
+    mlnx_stats_cache_t *cache = g_stats_cache;
+
+    if (!cache) {
+        return;
+    }
+
+    /* The new callers see no cache and fall back to the SDK */
+    __atomic_store_n(&cache->is_enabled, false, __ATOMIC_RELEASE);
+    __atomic_store_n(&g_stats_cache, NULL, __ATOMIC_SEQ_CST);
+
+    stats_cache_thread_asked_to_stop = true;
+    cl_thread_destroy(&stats_cache_thread);
+    stats_cache_thread_asked_to_stop = false;
+
+    /* The callers which got the cache before it was unpublished */
+    while (__atomic_load_n(&stats_cache_users, __ATOMIC_SEQ_CST)) {
+        cl_thread_suspend(1);
+    }
+
+    SX_LOG_NTC("Stats cache hits %" PRIu64 ", misses %" PRIu64 "\n", cache->hits, cache->misses);
+
+    free(cache);
+}
@@ -26,7 +26,10 @@
 #include <netinet/ether.h>
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/vfs.h>
+#include <sys/resource.h>
 #include <pthread.h>
 #endif
 #include <complib/cl_mem.h>
@@ -35,6 +38,7 @@
 #include <complib/cl_thread.h>
 #include <math.h>
 #include <limits.h>
+#include <stddef.h>
 #include <sx/sdk/sx_api_rm.h>
 #include <sx/utils/dbg_utils.h>
 #include "meta/saimetadata.h"
@@ -122,7 +126,6 @@ sx_log_cb_t sai_log_cb = NULL;
     ((MLNX_SHM_RM_ARRAY_TYPE_MIN <= (type)) && \
      ((type) <= MLNX_SHM_RM_ARRAY_TYPE_MAX))
 #define MLNX_SHM_RM_ARRAY_HDR_IS_VALID(type, array_hdr) ((array_hdr)->canary == MLNX_SHM_RM_ARRAY_CANARY(type))
-#define MLNX_SHM_RM_ARRAY_BASE_PTR ((uint8_t*)g_sai_db_ptr->array_info + sizeof(g_sai_db_ptr->array_info))
 
 typedef struct _sx_pool_info {
     uint32_t           pool_id;
@@ -409,6 +412,11 @@ static sai_status_t mlnx_switch_type_get(_In_ const sai_object_key_t   *key,
                                          _In_ uint32_t                  attr_index,
                                          _Inout_ vendor_cache_t        *cache,
                                          void                          *arg);
+static sai_status_t mlnx_switch_api_latency_stats_get(_In_ const sai_object_key_t   *key,
+                                                      _Inout_ sai_attribute_value_t *value,
+                                                      _In_ uint32_t                  attr_index,
+                                                      _Inout_ vendor_cache_t        *cache,
+                                                      void                          *arg);
 static sai_status_t mlnx_switch_mode_set_impl(_In_ sai_switch_switching_mode_t switching_mode);
 static sai_status_t mlnx_switch_mode_set(_In_ const sai_object_key_t      *key,
                                          _In_ const sai_attribute_value_t *value,
@@ -1293,6 +1301,11 @@ static const sai_vendor_attribute_entry_t switch_vendor_attribs[] = {
       { true, false, false, true },
       mlnx_switch_type_get, NULL,
       NULL, NULL },
+    { SAI_SWITCH_ATTR_API_LATENCY_STATS,
+      { false, false, false, true },
+      { false, false, false, true },
+      mlnx_switch_api_latency_stats_get, NULL,
+      NULL, NULL },
     { END_FUNCTIONALITY_ATTRIBS_ID,
       { false, false, false, false },
       { false, false, false, false },
@@ -2560,14 +2573,19 @@ static sai_status_t mlnx_switch_bfd_attribute_get(_In_ const sai_object_key_t
 static sai_status_t mlnx_sai_db_initialize(const char *config_file, sx_chip_types_t chip_type)
 {
     sai_status_t status = SAI_STATUS_FAILURE;
+    uint64_t     start_us = time_us_get();
+
+    mlnx_shm_huge_pages_init();
 
     if (SAI_STATUS_SUCCESS != (status = sai_db_create())) {
         return status;
     }
+    start_us = mlnx_boot_trace_mark("sai_db_create", "shm", start_us);
 
     if (SAI_STATUS_SUCCESS != (status = sai_qos_db_create())) {
         return status;
     }
+    start_us = mlnx_boot_trace_mark("sai_qos_db_create", "shm", start_us);
 
     sai_db_values_init();
 
@@ -2576,21 +2594,26 @@ static sai_status_t mlnx_sai_db_initialize(const char *config_file, sx_chip_type
     if (SAI_STATUS_SUCCESS != (status = mlnx_parse_config(config_file))) {
         return status;
     }
+    start_us = mlnx_boot_trace_mark("mlnx_parse_config", "config", start_us);
 
     if (SAI_STATUS_SUCCESS != (status = sai_buffer_db_create())) {
         return status;
     }
     sai_buffer_db_values_init();
+    start_us = mlnx_boot_trace_mark("sai_buffer_db_create", "shm", start_us);
 
     if (SAI_STATUS_SUCCESS != (status = sai_acl_db_create())) {
         return status;
     }
     sai_acl_db_init();
+    start_us = mlnx_boot_trace_mark("sai_acl_db_create", "shm", start_us);
 
     if (SAI_STATUS_SUCCESS != (status = sai_tunnel_db_create())) {
         return status;
     }
     sai_tunnel_db_init();
+    mlnx_tunnel_db_index_init();
+    start_us = mlnx_boot_trace_mark("sai_tunnel_db_create", "shm", start_us);
 
     status = mlnx_sai_rm_db_init();
     if (SAI_ERR(status)) {
@@ -2601,6 +2624,7 @@ static sai_status_t mlnx_sai_db_initialize(const char *config_file, sx_chip_type
     if (SAI_ERR(status)) {
         return status;
     }
+    mlnx_boot_trace_mark("rm and debug counter db init", "db", start_us);
 
     if (!mlnx_chip_is_spc()) {
         const char *ar_config_file = g_mlnx_services.profile_get_value(g_profile_id,
@@ -3121,6 +3145,7 @@ static sai_status_t mlnx_chassis_mng_stage(mlnx_sai_boot_type_t boot_type,
     sx_access_cmd_t                transaction_mode_cmd = SX_ACCESS_CMD_NONE;
     const char                    *issu_path;
     sx_log_verbosity_target_attr_t log_verbosity_target_attr = { 0 };
+    uint64_t                       sdk_start_us;
 
     if (NULL == ku_profile) {
         return SAI_STATUS_FAILURE;
@@ -3129,10 +3154,12 @@ static sai_status_t mlnx_chassis_mng_stage(mlnx_sai_boot_type_t boot_type,
     memset(&sdk_init_params, 0, sizeof(sdk_init_params));
 
     /* Open an handle */
+    sdk_start_us = time_us_get();
     if (SX_STATUS_SUCCESS != (status = sx_api_open(sai_log_cb, &gh_sdk))) {
         MLNX_SAI_LOG_ERR("Can't open connection to SDK - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
+    sdk_start_us = mlnx_boot_trace_mark("sx_api_open", "sdk", sdk_start_us);
     log_verbosity_target_attr.verbosity_target = SX_LOG_VERBOSITY_BOTH;
     log_verbosity_target_attr.enable = 1;
     if (SX_STATUS_SUCCESS !=
@@ -3140,6 +3167,7 @@ static sai_status_t mlnx_chassis_mng_stage(mlnx_sai_boot_type_t boot_type,
         SX_LOG_ERR("Set system log func severity failed - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
+    mlnx_boot_trace_mark("sx_api_system_log_enter_func_severity_set", "sdk", sdk_start_us);
     sx_log_funcs_severity_set(true);
 
     sdk_init_params.app_id = htonl(*((uint32_t*)"SDK1"));
@@ -3282,22 +3310,26 @@ static sai_status_t mlnx_chassis_mng_stage(mlnx_sai_boot_type_t boot_type,
 
     SX_LOG_INF("SDK init set start\n");
     test_sx_api_init_set_ms = time_ms_get();
+    sdk_start_us = time_us_get();
     if (SX_STATUS_SUCCESS != (status = sx_api_sdk_init_set(gh_sdk, &sdk_init_params))) {
         SX_LOG_ERR("Failed to initialize SDK (%s)\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
+    mlnx_boot_trace_mark("sx_api_sdk_init_set", "sdk", sdk_start_us);
 
     SX_LOG_NTC("SDK initialized successfully\n");
 
     /* transaction mode is disabled by default */
     if (transaction_mode_enable) {
         transaction_mode_cmd = SX_ACCESS_CMD_ENABLE;
+        sdk_start_us = time_us_get();
         if (SX_STATUS_SUCCESS !=
             (status = sx_api_transaction_mode_set(gh_sdk, transaction_mode_cmd))) {
             MLNX_SAI_LOG_ERR("Failed to set transaction mode to %d: %s\n", transaction_mode_cmd,
                              SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
+        mlnx_boot_trace_mark("sx_api_transaction_mode_set", "sdk", sdk_start_us);
     }
 
     status = mlnx_sai_log_levels_post_init();
@@ -3910,7 +3942,6 @@ static void sai_db_values_init()
     g_sai_db_ptr->ports_configured = 0;
     g_sai_db_ptr->ports_number = 0;
     memset(g_sai_db_ptr->ports_db, 0, sizeof(g_sai_db_ptr->ports_db));
-    memset(g_sai_db_ptr->hostif_db, 0, sizeof(g_sai_db_ptr->hostif_db));
     g_sai_db_ptr->default_trap_group = SAI_NULL_OBJECT_ID;
     g_sai_db_ptr->default_vrid = SAI_NULL_OBJECT_ID;
     memset(&g_sai_db_ptr->callback_channel, 0, sizeof(g_sai_db_ptr->callback_channel));
@@ -3919,6 +3950,7 @@ static void sai_db_values_init()
     memset(g_sai_db_ptr->qos_maps_db, 0, sizeof(g_sai_db_ptr->qos_maps_db));
     g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_PG_INDEX].is_used = 1;
     g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_QUEUE_INDEX].is_used = 1;
+    mlnx_qos_maps_db_init();
     g_sai_db_ptr->switch_default_tc = 0;
     memset(g_sai_db_ptr->port_pg9_defaults, 0, sizeof(g_sai_db_ptr->port_pg9_defaults));
     memset(&g_sai_db_ptr->port_queue_defaults, 0, sizeof(g_sai_db_ptr->port_queue_defaults));
@@ -3981,6 +4013,10 @@ static void sai_db_values_init()
     memset(g_sai_qos_db_ptr->queue_db, 0,
            sizeof(mlnx_qos_queue_config_t) * (g_resource_limits.cos_port_ets_traffic_class_max + 1) * MAX_PORTS * 2);
     memset(g_sai_qos_db_ptr->sched_db, 0, sizeof(mlnx_sched_profile_t) * MAX_SCHED);
+    memset(g_sai_qos_db_ptr->wred_refs, 0, sizeof(mlnx_wred_refs_t) * g_resource_limits.cos_redecn_profiles_max);
+    memset(g_sai_qos_db_ptr->ets_shadow, 0, sizeof(mlnx_port_ets_shadow_t) * MAX_PORTS * 2);
+    memset(g_sai_qos_db_ptr->ets_db, 0, sizeof(sx_cos_ets_element_config_t) * MAX_ETS_ELEMENTS * MAX_PORTS * 2);
+    memset(g_sai_qos_db_ptr->sched_refs, 0, sizeof(mlnx_sched_refs_t) * MAX_SCHED);
 
     for (ii = 0; ii < MAX_PORTS * 2; ii++) {
         mlnx_port_config_t *port = &g_sai_db_ptr->ports_db[ii];
@@ -4001,20 +4037,261 @@ static void sai_db_values_init()
     cl_plock_release(&g_sai_db_ptr->p_lock);
 }
 
+#ifndef HUGETLBFS_MAGIC
+#define HUGETLBFS_MAGIC 0x958458f6
+#endif
+
+/*
+ * Shared memory DBs.
+ * With SAI_DB_HUGE_PAGES the DB files are created on hugetlbfs (SAI_DB_HUGE_PAGES_DIR), if it is not available
+ * the regular POSIX shared memory is used with transparent huge pages advised. Every process prefaults and
+ * locks its mapping of the DBs so the lookups don't take page faults and fewer TLB misses on the big tables.
+ * The processes which connect to the switch don't follow their own profile, they use the hugetlbfs file if
+ * the switch created one, so the huge pages directory has to be the same in all the profiles.
+ */
+static bool                mlnx_shm_huge_pages;
+static char                mlnx_shm_huge_pages_dir[PATH_MAX] = MLNX_SHM_DB_HUGE_PAGES_DIR_DEF;
+static mlnx_shm_db_stats_t mlnx_shm_db_stats[MLNX_SHM_DB_MAX];
+
+static void mlnx_shm_huge_pages_init(void)
+{
+    const char *huge_pages, *huge_pages_dir;
+
+    huge_pages = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_DB_HUGE_PAGES);
+    mlnx_shm_huge_pages = (NULL != huge_pages) && (atoi(huge_pages) > 0);
+
+    huge_pages_dir = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_DB_HUGE_PAGES_DIR);
+    snprintf(mlnx_shm_huge_pages_dir, sizeof(mlnx_shm_huge_pages_dir), "%s",
+             huge_pages_dir ? huge_pages_dir : MLNX_SHM_DB_HUGE_PAGES_DIR_DEF);
+
+    if (mlnx_shm_huge_pages) {
+        SX_LOG_NTC("SAI DBs are backed by huge pages (%s)\n", mlnx_shm_huge_pages_dir);
+    }
+}
+
+static void mlnx_shm_huge_path_get(_In_ const char *name, _Out_ char *path, _In_ size_t len)
+{
+    snprintf(path, len, "%s%s", mlnx_shm_huge_pages_dir, name);
+}
+
+static bool mlnx_shm_is_hugetlbfs(_In_ int shmid, _Out_ size_t *page_size)
+{
+    struct statfs fs;
+
+    if ((fstatfs(shmid, &fs) == 0) && ((uint32_t)fs.f_type == HUGETLBFS_MAGIC)) {
+        *page_size = fs.f_bsize;
+        return true;
+    }
+
+    *page_size = (size_t)sysconf(_SC_PAGESIZE);
+    return false;
+}
+
+static size_t mlnx_shm_size_align(_In_ int shmid, _In_ size_t size)
+{
+    size_t page_size;
+
+    if (!mlnx_shm_is_hugetlbfs(shmid, &page_size)) {
+        return size;
+    }
+
+    return (size + page_size - 1) / page_size * page_size;
+}
+
+/* Same as cl_shm_create(), errno is EEXIST if the shared memory already exists */
+static cl_status_t mlnx_shm_create(_In_ const char *name, _Out_ int *shmid)
+{
+    char   path[PATH_MAX];
+    size_t page_size;
+    int    fd;
+
+    if (mlnx_shm_huge_pages) {
+        mlnx_shm_huge_path_get(name, path, sizeof(path));
+
+        fd = open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd != -1) {
+            if (mlnx_shm_is_hugetlbfs(fd, &page_size)) {
+                *shmid = fd;
+                return CL_SUCCESS;
+            }
+
+            SX_LOG_WRN("%s is not on hugetlbfs, using regular shared memory for %s\n", path, name);
+            close(fd);
+            unlink(path);
+        } else if (errno == EEXIST) {
+            return CL_ERROR;
+        } else {
+            SX_LOG_WRN("Failed to create %s - %s, using regular shared memory for %s\n", path, strerror(errno), name);
+        }
+    } else {
+        /* A file left by a previous run with huge pages would be opened instead of the new DB */
+        mlnx_shm_huge_path_get(name, path, sizeof(path));
+        unlink(path);
+    }
+
+    return cl_shm_create(name, shmid);
+}
+
+/* The DB is on hugetlbfs if the switch created it there, whatever the profile of this process says */
+static cl_status_t mlnx_shm_open(_In_ const char *name, _Out_ int *shmid)
+{
+    char   path[PATH_MAX];
+    size_t page_size;
+    int    fd;
+
+    mlnx_shm_huge_path_get(name, path, sizeof(path));
+
+    fd = open(path, O_RDWR);
+    if (fd != -1) {
+        if (mlnx_shm_is_hugetlbfs(fd, &page_size)) {
+            *shmid = fd;
+            return CL_SUCCESS;
+        }
+
+        close(fd);
+    }
+
+    return cl_shm_open(name, shmid);
+}
+
+static void mlnx_shm_destroy(_In_ const char *name)
+{
+    char path[PATH_MAX];
+
+    /* Regardless of the profile, the DB may have been created on hugetlbfs by a previous run */
+    mlnx_shm_huge_path_get(name, path, sizeof(path));
+    unlink(path);
+
+    cl_shm_destroy(name);
+}
+
+static int mlnx_shm_truncate(_In_ int shmid, _In_ size_t size)
+{
+    return ftruncate(shmid, mlnx_shm_size_align(shmid, size));
+}
+
+static mlnx_shm_db_stats_t* mlnx_shm_db_stats_entry_get(_In_ const char *name)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < MLNX_SHM_DB_MAX; ii++) {
+        if (mlnx_shm_db_stats[ii].name && (0 == strcmp(mlnx_shm_db_stats[ii].name, name))) {
+            return &mlnx_shm_db_stats[ii];
+        }
+    }
+
+    for (ii = 0; ii < MLNX_SHM_DB_MAX; ii++) {
+        if (!mlnx_shm_db_stats[ii].name) {
+            return &mlnx_shm_db_stats[ii];
+        }
+    }
+
+    return NULL;
+}
+
+/* Maps the whole shared memory, returns MAP_FAILED on error */
+static void* mlnx_shm_map(_In_ const char *name, _In_ int shmid, _In_ size_t size)
+{
+    mlnx_shm_db_stats_t *stats;
+    struct rusage        usage;
+    uint64_t             minflt, start_us;
+    size_t               page_size, offset;
+    void                *ptr;
+    bool                 hugetlbfs;
+
+    hugetlbfs = mlnx_shm_is_hugetlbfs(shmid, &page_size);
+    size = mlnx_shm_size_align(shmid, size);
+
+    ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    if (ptr == MAP_FAILED) {
+        return MAP_FAILED;
+    }
+
+    stats = mlnx_shm_db_stats_entry_get(name);
+    if (!stats) {
+        return ptr;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->name = name;
+    stats->ptr = ptr;
+    stats->size = size;
+    stats->page_size = page_size;
+    stats->hugetlbfs = hugetlbfs;
+
+    if (!mlnx_shm_huge_pages) {
+        return ptr;
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (!hugetlbfs) {
+        stats->thp_advised = (madvise(ptr, size, MADV_HUGEPAGE) == 0);
+    }
+#endif
+
+    getrusage(RUSAGE_SELF, &usage);
+    minflt = usage.ru_minflt;
+    start_us = time_us_get();
+
+    /* mlock() faults in the whole range, touch the pages if the locked memory limit is too low */
+    stats->locked = (mlock(ptr, size) == 0);
+    if (!stats->locked) {
+        SX_LOG_WRN("Failed to lock %zu bytes of %s - %s, prefaulting only\n", size, name, strerror(errno));
+        for (offset = 0; offset < size; offset += page_size) {
+            (void)((volatile uint8_t*)ptr)[offset];
+        }
+    }
+
+    getrusage(RUSAGE_SELF, &usage);
+    stats->prefault_faults = usage.ru_minflt - minflt;
+    stats->prefault_us = time_us_get() - start_us;
+    stats->prefaulted = true;
+
+    SX_LOG_NTC("Mapped %s - %zu bytes, %s %zu KB pages, %" PRIu64 " faults in %" PRIu64 " us\n",
+               name, size, hugetlbfs ? "hugetlbfs" : (stats->thp_advised ? "THP advised" : "shm"), page_size / 1024,
+               stats->prefault_faults, stats->prefault_us);
+
+    return ptr;
+}
+
+static int mlnx_shm_unmap(_In_ void *ptr, _In_ size_t size)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < MLNX_SHM_DB_MAX; ii++) {
+        if (mlnx_shm_db_stats[ii].name && (mlnx_shm_db_stats[ii].ptr == ptr)) {
+            size = mlnx_shm_db_stats[ii].size;
+            memset(&mlnx_shm_db_stats[ii], 0, sizeof(mlnx_shm_db_stats[ii]));
+            break;
+        }
+    }
+
+    return munmap(ptr, size);
+}
+
+void mlnx_shm_db_stats_get(_In_ uint32_t idx, _Out_ mlnx_shm_db_stats_t *stats)
+{
+    assert(stats);
+    assert(idx < MLNX_SHM_DB_MAX);
+
+    *stats = mlnx_shm_db_stats[idx];
+}
+
 static sai_status_t sai_db_unload(boolean_t erase_db)
 {
     int          err = 0;
     sai_status_t status = SAI_STATUS_SUCCESS;
 
     if (erase_db == TRUE) {
-        cl_shm_destroy(SAI_PATH);
+        mlnx_shm_destroy(SAI_PATH);
         if (g_sai_db_ptr != NULL) {
+            cl_plock_destroy(&g_sai_db_ptr->bfd_lock);
             cl_plock_destroy(&g_sai_db_ptr->p_lock);
         }
     }
 
     if (g_sai_db_ptr != NULL) {
-        err = munmap(g_sai_db_ptr, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
+        err = mlnx_shm_unmap(g_sai_db_ptr, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
         if (err == -1) {
             SX_LOG_ERR("Failed to unmap the shared memory of the SAI DB\n");
             status = SAI_STATUS_FAILURE;
@@ -4095,29 +4372,121 @@ static mlnx_shm_rm_array_init_info_t mlnx_shm_array_info[MLNX_SHM_RM_ARRAY_TYPE_
                                         0},
 };
 
+static sai_status_t mlnx_shm_table_bridge_port_size_get(_Out_ size_t *size)
+{
+    const char *value;
+    size_t      sub_ports;
+
+    /* Sub-ports of the 1D bridges - up to a sub-port per port of the chip in every bridge */
+    sub_ports = (size_t)MIN(MAX_BRIDGES_1D, g_resource_limits.bridge_num_max) * MIN(MAX_PORTS_DB, MAX_PORTS);
+
+    value = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_BRIDGE_SUB_PORTS_MAX);
+    if (value) {
+        sub_ports = MIN(strtoul(value, NULL, 0), MAX_VPORTS);
+    }
+
+    *size = MAX_BRIDGE_1Q_PORTS + MAX_BRIDGE_RIFS + sub_ports;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_shm_table_l2mc_group_member_size_get(_Out_ size_t *size)
+{
+    const char *value;
+
+    *size = MLNX_L2MC_GROUP_MEMBER_DB_SIZE_DEF;
+
+    value = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_L2MC_GROUP_MEMBERS_MAX);
+    if (value) {
+        *size = strtoul(value, NULL, 0);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_shm_table_hostif_size_get(_Out_ size_t *size)
+{
+    const char *value;
+
+    /* A hostif per port and LAG of the chip and some spare, up to the previous fixed size */
+    *size = MIN(MAX_HOSTIFS,
+                (size_t)MIN(MAX_PORTS_DB, MAX_PORTS) + g_resource_limits.lag_num_max + MLNX_HOSTIF_DB_SPARE);
+
+    value = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_HOSTIFS_MAX);
+    if (value) {
+        /* The hostif DB index is kept in the hostif table entry OID */
+        *size = MIN(strtoul(value, NULL, 0), 1 << (HOSTIF_TABLE_ENTRY_HOSTIF_IDX_BITS - 1));
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static mlnx_shm_rm_array_init_info_t mlnx_shm_table_info[MLNX_SHM_TABLE_TYPE_SIZE] = {
+    [MLNX_SHM_TABLE_TYPE_BRIDGE_PORT] = {sizeof(mlnx_bridge_port_t),
+                                         mlnx_shm_table_bridge_port_size_get,
+                                         0},
+    [MLNX_SHM_TABLE_TYPE_L2MC_GROUP_MEMBER] = {sizeof(mlnx_l2mc_group_member_t),
+                                               mlnx_shm_table_l2mc_group_member_size_get,
+                                               0},
+    /* Bucket heads of the sx policer id hash, a bucket per policer */
+    [MLNX_SHM_TABLE_TYPE_POLICER_SX_HASH] = {sizeof(uint32_t),
+                                             mlnx_shm_rm_policer_size_get,
+                                             0},
+    [MLNX_SHM_TABLE_TYPE_HOSTIF] = {sizeof(sai_netdev_t),
+                                    mlnx_shm_table_hostif_size_get,
+                                    0},
+};
+
+static sai_status_t mlnx_shm_init_info_elem_count_init(_Inout_ mlnx_shm_rm_array_init_info_t *init_info)
+{
+    sai_status_t status;
+    size_t       elem_count = 0;
+
+    if (init_info->elem_count != 0) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    if (!init_info->elem_count_fn) {
+        return SAI_STATUS_FAILURE;
+    }
+
+    status = init_info->elem_count_fn(&elem_count);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    init_info->elem_count = elem_count;
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static size_t mlnx_sai_rm_db_size_get(void)
 {
     sai_status_t                   status;
-    size_t                         total_size = 0, elem_count;
+    size_t                         total_size = 0;
     mlnx_shm_rm_array_type_t       type;
+    mlnx_shm_table_type_t          table;
     mlnx_shm_rm_array_init_info_t *init_info;
 
     for (type = MLNX_SHM_RM_ARRAY_TYPE_MIN; type <= MLNX_SHM_RM_ARRAY_TYPE_MAX; type++) {
         init_info = &mlnx_shm_array_info[type];
-        if (!init_info->elem_count_fn && (init_info->elem_count == 0)) {
-            SX_LOG_ERR("Failed to get elem count for %d - elem_count_fn == NULL\n", type);
+
+        status = mlnx_shm_init_info_elem_count_init(init_info);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to get elem count for %d\n", type);
             return 0;
         }
 
-        if (init_info->elem_count == 0) {
-            elem_count = 0;
-            status = init_info->elem_count_fn(&elem_count);
-            if (SAI_ERR(status)) {
-                SX_LOG_ERR("Failed to get elem count for %d\n", type);
-                return 0;
-            }
+        total_size += init_info->elem_count * init_info->elem_size;
+    }
+
+    for (table = 0; table < MLNX_SHM_TABLE_TYPE_SIZE; table++) {
+        init_info = &mlnx_shm_table_info[table];
 
-            init_info->elem_count = elem_count;
+        status = mlnx_shm_init_info_elem_count_init(init_info);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to get elem count for table %d\n", table);
+            return 0;
         }
 
         total_size += init_info->elem_count * init_info->elem_size;
@@ -4132,12 +4501,12 @@ static sai_status_t sai_db_create()
     int         shmid;
     cl_status_t cl_err;
 
-    cl_err = cl_shm_create(SAI_PATH, &shmid);
+    cl_err = mlnx_shm_create(SAI_PATH, &shmid);
     if (cl_err) {
         if (errno == EEXIST) { /* one retry is allowed */
             MLNX_SAI_LOG_NTC("Shared memory of the SAI already exists, destroying it and re-creating\n");
-            cl_shm_destroy(SAI_PATH);
-            cl_err = cl_shm_create(SAI_PATH, &shmid);
+            mlnx_shm_destroy(SAI_PATH);
+            cl_err = mlnx_shm_create(SAI_PATH, &shmid);
         }
 
         if (cl_err) {
@@ -4147,31 +4516,89 @@ static sai_status_t sai_db_create()
     }
 
     g_mlnx_shm_rm_size = (uint32_t)mlnx_sai_rm_db_size_get();
+    if (g_mlnx_shm_rm_size == 0) {
+        mlnx_shm_destroy(SAI_PATH);
+        return SAI_STATUS_FAILURE;
+    }
 
-    if (ftruncate(shmid, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size) == -1) {
+    if (mlnx_shm_truncate(shmid, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size) == -1) {
         MLNX_SAI_LOG_ERR("Failed to set shared memory size for the SAI DB\n");
-        cl_shm_destroy(SAI_PATH);
+        mlnx_shm_destroy(SAI_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_db_ptr =
-        mmap(NULL, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_db_ptr = mlnx_shm_map(SAI_PATH, shmid, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
     if (g_sai_db_ptr == MAP_FAILED) {
         MLNX_SAI_LOG_ERR("Failed to map the shared memory of the SAI DB\n");
         g_sai_db_ptr = NULL;
-        cl_shm_destroy(SAI_PATH);
+        mlnx_shm_destroy(SAI_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
     cl_err = cl_plock_init_pshared(&g_sai_db_ptr->p_lock);
     if (cl_err) {
         MLNX_SAI_LOG_ERR("Failed to initialize the SAI DB rwlock\n");
-        err = munmap(g_sai_db_ptr, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
+        err = mlnx_shm_unmap(g_sai_db_ptr, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
+        if (err == -1) {
+            MLNX_SAI_LOG_ERR("Failed to unmap the shared memory of the SAI DB\n");
+        }
+        g_sai_db_ptr = NULL;
+        mlnx_shm_destroy(SAI_PATH);
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    cl_err = cl_plock_init_pshared(&g_sai_db_ptr->bfd_lock);
+    if (cl_err) {
+        MLNX_SAI_LOG_ERR("Failed to initialize the SAI BFD DB rwlock\n");
+        cl_plock_destroy(&g_sai_db_ptr->p_lock);
+        err = mlnx_shm_unmap(g_sai_db_ptr, sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size);
         if (err == -1) {
             MLNX_SAI_LOG_ERR("Failed to unmap the shared memory of the SAI DB\n");
         }
         g_sai_db_ptr = NULL;
-        cl_shm_destroy(SAI_PATH);
+        mlnx_shm_destroy(SAI_PATH);
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    g_sai_db_ptr->db_version = MLNX_SAI_DB_VERSION;
+    g_sai_db_ptr->db_hdr_size = sizeof(*g_sai_db_ptr);
+    g_sai_db_ptr->db_size = sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size;
+
+    MLNX_SAI_LOG_NTC("SAI DB size %" PRIu64 " bytes, %u bridge ports, %u L2MC group members, %u hostifs\n",
+                     g_sai_db_ptr->db_size,
+                     (uint32_t)mlnx_shm_table_info[MLNX_SHM_TABLE_TYPE_BRIDGE_PORT].elem_count,
+                     (uint32_t)mlnx_shm_table_info[MLNX_SHM_TABLE_TYPE_L2MC_GROUP_MEMBER].elem_count,
+                     (uint32_t)mlnx_shm_table_info[MLNX_SHM_TABLE_TYPE_HOSTIF].elem_count);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Maps the SAI DB created by another process, the layout is taken from the DB itself */
+static sai_status_t sai_db_map(_In_ int shmid)
+{
+    uint32_t db_version, db_hdr_size;
+    uint64_t db_size;
+
+    /* The header is read rather than mapped, a partial mapping can't be unmapped on hugetlbfs */
+    if ((pread(shmid, &db_version, sizeof(db_version), offsetof(sai_db_t, db_version)) != sizeof(db_version)) ||
+        (pread(shmid, &db_hdr_size, sizeof(db_hdr_size), offsetof(sai_db_t, db_hdr_size)) != sizeof(db_hdr_size)) ||
+        (pread(shmid, &db_size, sizeof(db_size), offsetof(sai_db_t, db_size)) != sizeof(db_size))) {
+        SX_LOG_ERR("Failed to read the header of the SAI DB - %s\n", strerror(errno));
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    if ((db_version != MLNX_SAI_DB_VERSION) || (db_hdr_size != sizeof(*g_sai_db_ptr))) {
+        SX_LOG_ERR("SAI DB layout version %u (header %u bytes) doesn't match the library version %u (%zu bytes)\n",
+                   db_version, db_hdr_size, MLNX_SAI_DB_VERSION, sizeof(*g_sai_db_ptr));
+        return SAI_STATUS_FAILURE;
+    }
+
+    g_mlnx_shm_rm_size = (uint32_t)(db_size - sizeof(*g_sai_db_ptr));
+
+    g_sai_db_ptr = mlnx_shm_map(SAI_PATH, shmid, db_size);
+    if (g_sai_db_ptr == MAP_FAILED) {
+        SX_LOG_ERR("Failed to map the shared memory of the SAI DB\n");
+        g_sai_db_ptr = NULL;
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -4218,8 +4645,10 @@ static void mlnx_sai_rm_array_canary_init(mlnx_shm_rm_array_type_t type)
 static sai_status_t mlnx_sai_rm_db_init(void)
 {
     mlnx_shm_rm_array_type_t             type;
+    mlnx_shm_table_type_t                table;
     const mlnx_shm_rm_array_init_info_t *init_info;
     mlnx_shm_rm_array_info_t            *info;
+    mlnx_shm_table_info_t               *table_info;
     uint8_t                             *shm_rm_ptr, *shm_rm_base_ptr;
 
     shm_rm_base_ptr = shm_rm_ptr = MLNX_SHM_RM_ARRAY_BASE_PTR;
@@ -4230,11 +4659,21 @@ static sai_status_t mlnx_sai_rm_db_init(void)
         info->elem_count = init_info->elem_count;
         info->elem_size = init_info->elem_size;
         info->offset_to_head = shm_rm_ptr - shm_rm_base_ptr;
+        info->used_count = 0;
         shm_rm_ptr += info->elem_size * info->elem_count;
 
         mlnx_sai_rm_array_canary_init(type);
     }
 
+    for (table = 0; table < MLNX_SHM_TABLE_TYPE_SIZE; table++) {
+        init_info = &mlnx_shm_table_info[table];
+        table_info = &g_sai_db_ptr->table_info[table];
+        table_info->elem_count = init_info->elem_count;
+        table_info->elem_size = init_info->elem_size;
+        table_info->offset_to_head = shm_rm_ptr - shm_rm_base_ptr;
+        shm_rm_ptr += table_info->elem_size * table_info->elem_count;
+    }
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -4285,7 +4724,7 @@ sai_status_t mlnx_shm_rm_array_alloc(_In_ mlnx_shm_rm_array_type_t  type,
         }
 
         if (!array_hdr->is_used) {
-            array_hdr->is_used = true;
+            mlnx_shm_rm_array_hdr_used_set(type, array_hdr, true);
             idx->type = type;
             idx->idx = ii;
             *elem = (void*)array_hdr;
@@ -4321,37 +4760,48 @@ sai_status_t mlnx_shm_rm_array_free(_In_ mlnx_shm_rm_array_idx_t idx)
         return SAI_STATUS_FAILURE;
     }
 
-    array_hdr->is_used = false;
+    mlnx_shm_rm_array_hdr_used_set(idx.type, array_hdr, false);
 
     return SAI_STATUS_SUCCESS;
 }
 
-uint32_t mlnx_shm_rm_array_free_entries_count(_In_ mlnx_shm_rm_array_type_t type)
+/* Marks the element as used/free and keeps the used counter of the array in sync.
+ * Must be used by modules that manage the is_used flag of the array elements on their own */
+void mlnx_shm_rm_array_hdr_used_set(_In_ mlnx_shm_rm_array_type_t type,
+                                    _Inout_ mlnx_shm_array_hdr_t  *array_hdr,
+                                    _In_ bool                      is_used)
 {
-    const mlnx_shm_rm_array_info_t *info;
-    mlnx_shm_array_hdr_t           *array_hdr;
-    uint32_t                        ii, free = 0;
+    mlnx_shm_rm_array_info_t *info;
 
     assert(MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(type));
+    assert(array_hdr);
+
+    if (array_hdr->is_used == is_used) {
+        return;
+    }
 
     info = &g_sai_db_ptr->array_info[type];
 
-    for (ii = 0; ii < info->elem_count; ii++) {
-        array_hdr = mlnx_rm_array_elem_by_idx(info, ii);
-        assert(array_hdr);
+    if (is_used) {
+        assert(info->used_count < info->elem_count);
+        info->used_count++;
+    } else {
+        assert(info->used_count > 0);
+        info->used_count--;
+    }
 
-        if (!MLNX_SHM_RM_ARRAY_HDR_IS_VALID(type, array_hdr)) {
-            SX_LOG_ERR("array_hdr for type %d idx %d is corrupted (canary is %x, not %x)\n",
-                       type, ii, array_hdr->canary, MLNX_SHM_RM_ARRAY_CANARY(type));
-            return SAI_STATUS_FAILURE;
-        }
+    array_hdr->is_used = is_used;
+}
 
-        if (!array_hdr->is_used) {
-            free++;
-        }
-    }
+uint32_t mlnx_shm_rm_array_free_entries_count(_In_ mlnx_shm_rm_array_type_t type)
+{
+    const mlnx_shm_rm_array_info_t *info;
+
+    assert(MLNX_SHM_RM_ARRAY_TYPE_IS_VALID(type));
 
-    return free;
+    info = &g_sai_db_ptr->array_info[type];
+
+    return (uint32_t)(info->elem_count - info->used_count);
 }
 
 sai_status_t mlnx_shm_rm_array_find(_In_ mlnx_shm_rm_array_type_t  type,
@@ -4506,11 +4956,12 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
 {
     sai_bfd_session_state_notification_t info = {0};
     mlnx_shm_rm_array_idx_t              bfd_session_db_index;
-    mlnx_bfd_session_db_entry_t         *bfd_data;
+    mlnx_bfd_session_db_entry_t         *bfd_data = NULL;
     sai_status_t                         status;
     mlnx_bfd_packet_t                   *bfd_p;
     int                                  need_update_rx = 0;
     bool                                 negotiation = false;
+    bool                                 notify = false;
     char                                 dst_ip_str[MAX_IP_STR_LEN];
     sai_bfd_session_state_t              bfd_session_state, bfd_pkt_state;
 
@@ -4525,32 +4976,34 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
 
     bfd_session_db_index = *(mlnx_shm_rm_array_idx_t*)&packet->opaque_data;
 
-    sai_db_write_lock();
+    sai_bfd_db_write_lock();
     status = mlnx_shm_rm_idx_validate(bfd_session_db_index);
     if (SAI_ERR(status)) {
-        sai_db_unlock();
-        return SAI_STATUS_FAILURE;
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     status = mlnx_bfd_session_oid_create(bfd_session_db_index, &info.bfd_session_id);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("BFD OID create failed\n");
-        sai_db_unlock();
-        return SAI_STATUS_FAILURE;
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     status = mlnx_shm_rm_array_idx_to_ptr(bfd_session_db_index, (void **)&bfd_data);
     if (SAI_ERR(status)) {
-        sai_db_unlock();
-        return SAI_STATUS_FAILURE;
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     if (!bfd_data->array_hdr.is_used) {
         SX_LOG_INF("BFD session oid 0x%x is removed\n", info.bfd_session_id);
-        sai_db_unlock();
-        return SAI_STATUS_SUCCESS;
+        status = SAI_STATUS_SUCCESS;
+        goto out;
     }
 
+    bfd_data->data.rx_events++;
+
     SX_LOG_DBG("incoming BFD packet %x:%x.\n", ntohl(bfd_p->my_disc), ntohl(bfd_p->your_disc));
     SX_LOG_DBG("BFD session entry found in DB %x:%x.\n",
                bfd_data->data.local_discriminator,
@@ -4573,8 +5026,8 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
     if (!bfd_data->data.multihop && (packet->ttl != 255)) {
         SX_LOG_NTC("TTL mismatch, expected 0xFF, got %u, drop packet from %s\n",
                    packet->ttl, dst_ip_str);
-        sai_db_unlock();
-        return SAI_STATUS_SUCCESS;
+        status = SAI_STATUS_SUCCESS;
+        goto out;
     }
 
     if (!bfd_p->your_disc) {
@@ -4588,8 +5041,8 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
         SX_LOG_NTC("my_disc mismatch, expected %u, got %u, drop packet from %s\n",
                    bfd_data->data.local_discriminator,
                    ntohl(bfd_p->your_disc), dst_ip_str);
-        sai_db_unlock();
-        return SAI_STATUS_SUCCESS;
+        status = SAI_STATUS_SUCCESS;
+        goto out;
     }
 
     if (!bfd_data->data.remote_discriminator) {
@@ -4601,8 +5054,8 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
         SX_LOG_NTC("remote_disc mismatch, expected %u, got %u, drop packet from %s\n",
                    bfd_data->data.remote_discriminator,
                    ntohl(bfd_p->my_disc), dst_ip_str);
-        sai_db_unlock();
-        return SAI_STATUS_SUCCESS;
+        status = SAI_STATUS_SUCCESS;
+        goto out;
     }
 
     if ((bfd_data->data.remote_multiplier != bfd_p->mult) ||
@@ -4627,14 +5080,11 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
         status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("BFD offload tx failed \n");
-            sai_db_unlock();
-            return status;
+            goto out;
         }
         info.session_state = SAI_BFD_SESSION_STATE_ADMIN_DOWN;
         SX_LOG_NTC("Notify: BFD peer [%s] is manually down\n", dst_ip_str);
-        if (g_notification_callbacks.on_bfd_session_state_change) {
-            g_notification_callbacks.on_bfd_session_state_change(1, &info);
-        }
+        notify = true;
     }
 
     switch (bfd_session_state) {
@@ -4647,8 +5097,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
             status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("BFD offload tx failed \n");
-                sai_db_unlock();
-                return status;
+                goto out;
             }
         }
         if (bfd_pkt_state == SAI_BFD_SESSION_STATE_UP) {
@@ -4661,8 +5110,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
                 status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
                 if (SAI_ERR(status)) {
                     SX_LOG_ERR("BFD offload tx failed \n");
-                    sai_db_unlock();
-                    return status;
+                    goto out;
                 }
             }
             if (bfd_pkt_is_final(bfd_p)
@@ -4672,8 +5120,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
                 status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
                 if (SAI_ERR(status)) {
                     SX_LOG_ERR("BFD offload tx failed \n");
-                    sai_db_unlock();
-                    return status;
+                    goto out;
                 }
             }
             SX_LOG_DBG("it is a UP BFD packet in UP state, rx sess id is %d\n",
@@ -4685,8 +5132,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
                                                          SX_ACCESS_CMD_EDIT);
                 if (SAI_ERR(status)) {
                     SX_LOG_ERR("BFD offload rx update failed \n");
-                    sai_db_unlock();
-                    return status;
+                    goto out;
                 }
             }
         }
@@ -4704,8 +5150,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
                                                      bfd_data->data.tx_session ? SX_ACCESS_CMD_EDIT : SX_ACCESS_CMD_CREATE);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("BFD offload tx failed \n");
-                sai_db_unlock();
-                return status;
+                goto out;
             }
             SX_LOG_DBG("BFD reset finish, rewrite remote id for rx\n");
             status = mlnx_set_offload_bfd_rx_session(&bfd_data->data,
@@ -4713,15 +5158,12 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
                                                      SX_ACCESS_CMD_EDIT);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("BFD offload rx update failed \n");
-                sai_db_unlock();
-                return status;
+                goto out;
             }
 
             info.session_state = SAI_BFD_SESSION_STATE_UP;
             SX_LOG_NTC("BFD peer [%s] is UP\n", dst_ip_str);
-            if (g_notification_callbacks.on_bfd_session_state_change) {
-                g_notification_callbacks.on_bfd_session_state_change(1, &info);
-            }
+            notify = true;
         } else {
             SX_LOG_DBG("get packet [%d] in [%d] state, ignore it\n", bfd_pkt_state, bfd_session_state);
         }
@@ -4737,8 +5179,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
             status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("update offload tx session failed \n");
-                sai_db_unlock();
-                return status;
+                goto out;
             }
             SX_LOG_DBG("expecting UP packet rx sess id is %d\n",
                        bfd_data->data.rx_session);
@@ -4747,14 +5188,11 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
                                                      SX_ACCESS_CMD_EDIT);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("BFD offload rx update failed \n");
-                sai_db_unlock();
-                return status;
+                goto out;
             }
             SX_LOG_NTC("BFD peer [%s] is UP\n", dst_ip_str);
             info.session_state = SAI_BFD_SESSION_STATE_UP;
-            if (g_notification_callbacks.on_bfd_session_state_change) {
-                g_notification_callbacks.on_bfd_session_state_change(1, &info);
-            }
+            notify = true;
         } else if (negotiation
                    && (bfd_pkt_state == SAI_BFD_SESSION_STATE_DOWN)) {
             SX_LOG_NTC("get negotiation packet [%d] in [%d] state, need to update tx\n",
@@ -4763,8 +5201,7 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
             status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("update offload tx session failed \n");
-                sai_db_unlock();
-                return status;
+                goto out;
             }
         } else {
             SX_LOG_DBG("get packet [%d] in [%d] state, ignore it\n", bfd_pkt_state, bfd_session_state);
@@ -4775,8 +5212,19 @@ static sai_status_t mlnx_switch_bfd_packet_handle(const struct bfd_packet_event
         SX_LOG_DBG("get packet [%d] in [%d] state, ignore it\n", bfd_pkt_state, bfd_session_state);
         break;
     }
-    sai_db_unlock();
-    return SAI_STATUS_SUCCESS;
+    status = SAI_STATUS_SUCCESS;
+
+out:
+    if (notify) {
+        bfd_data->data.state_changes++;
+    }
+    sai_bfd_db_unlock();
+
+    /* The session state is committed, the callback may call back into the SAI API */
+    if (notify && g_notification_callbacks.on_bfd_session_state_change) {
+        g_notification_callbacks.on_bfd_session_state_change(1, &info);
+    }
+    return status;
 }
 
 static sai_status_t mlnx_switch_bfd_event_handle(_In_ sx_trap_id_t event, _In_ uint64_t opaque_data)
@@ -4784,38 +5232,39 @@ static sai_status_t mlnx_switch_bfd_event_handle(_In_ sx_trap_id_t event, _In_ u
     sai_bfd_session_state_notification_t info = {0};
     mlnx_shm_rm_array_idx_t              bfd_session_db_index;
     sai_status_t                         status;
-    mlnx_bfd_session_db_entry_t         *bfd_data;
+    mlnx_bfd_session_db_entry_t         *bfd_data = NULL;
+    bool                                 notify = false;
 
     assert(event == SX_TRAP_ID_BFD_TIMEOUT_EVENT);
 
     bfd_session_db_index = *(mlnx_shm_rm_array_idx_t*)&opaque_data;
 
-    sai_db_write_lock();
+    sai_bfd_db_write_lock();
     status = mlnx_shm_rm_idx_validate(bfd_session_db_index);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("BFD DB index is invalid (opaque_data=%" PRIu64 ")\n", opaque_data);
-        sai_db_unlock();
-        return SAI_STATUS_FAILURE;
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     status = mlnx_shm_rm_array_idx_to_ptr(bfd_session_db_index, (void **)&bfd_data);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("BFD db data get failed (opaque_data=%" PRIu64 ")\n", opaque_data);
-        sai_db_unlock();
-        return SAI_STATUS_FAILURE;
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     status = mlnx_bfd_session_oid_create(bfd_session_db_index, &info.bfd_session_id);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("BFD OID create failed (opaque_data=%" PRIu64 ")\n", opaque_data);
-        sai_db_unlock();
-        return SAI_STATUS_FAILURE;
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     if (!bfd_data->array_hdr.is_used) {
         SX_LOG_INF("BFD session oid 0x%x is removed\n", info.bfd_session_id);
-        sai_db_unlock();
-        return SAI_STATUS_SUCCESS;
+        status = SAI_STATUS_SUCCESS;
+        goto out;
     }
 
     if (bfd_data->data.bfd_session_state != SAI_BFD_SESSION_STATE_DOWN) {
@@ -4830,9 +5279,7 @@ static sai_status_t mlnx_switch_bfd_event_handle(_In_ sx_trap_id_t event, _In_ u
         bfd_data->data.bfd_session_state = SAI_BFD_SESSION_STATE_DOWN;
 
         info.session_state = SAI_BFD_SESSION_STATE_DOWN;
-        if (g_notification_callbacks.on_bfd_session_state_change) {
-            g_notification_callbacks.on_bfd_session_state_change(1, &info);
-        }
+        notify = true;
 
         SX_LOG_DBG("send BFD DOWN packet to peer [%s]"
                    " to reset session, tx sess id is %d\n",
@@ -4841,12 +5288,22 @@ static sai_status_t mlnx_switch_bfd_event_handle(_In_ sx_trap_id_t event, _In_ u
         status = mlnx_set_offload_bfd_tx_session(&bfd_data->data, SX_ACCESS_CMD_EDIT);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("update offload tx session failed \n");
-            sai_db_unlock();
-            return status;
+            goto out;
         }
     }
-    sai_db_unlock();
-    return SAI_STATUS_SUCCESS;
+    status = SAI_STATUS_SUCCESS;
+
+out:
+    if (notify) {
+        bfd_data->data.state_changes++;
+    }
+    sai_bfd_db_unlock();
+
+    /* The session state is committed, the callback may call back into the SAI API */
+    if (notify && g_notification_callbacks.on_bfd_session_state_change) {
+        g_notification_callbacks.on_bfd_session_state_change(1, &info);
+    }
+    return status;
 }
 
 static sai_status_t mlnx_switch_dump_health_event_prepare_stage_dir(_In_ const char *stage_dir)
@@ -5366,6 +5823,61 @@ out:
     }
 }
 
+typedef enum _mlnx_dvs_port_step_t {
+    MLNX_DVS_PORT_STEP_INIT_MANDATORY,
+    MLNX_DVS_PORT_STEP_CONFIG_INIT,
+    MLNX_DVS_PORT_STEP_SPEED_BITMAP,
+    MLNX_DVS_PORT_STEP_PG9_BUFFER,
+    MLNX_DVS_PORT_STEP_FEC,
+    MLNX_DVS_PORT_STEP_MAX
+} mlnx_dvs_port_step_t;
+
+static const char * const mlnx_dvs_port_step_str[MLNX_DVS_PORT_STEP_MAX] = {
+    [MLNX_DVS_PORT_STEP_INIT_MANDATORY] = "port init mandatory",
+    [MLNX_DVS_PORT_STEP_CONFIG_INIT] = "port config init",
+    [MLNX_DVS_PORT_STEP_SPEED_BITMAP] = "port speed bitmap",
+    [MLNX_DVS_PORT_STEP_PG9_BUFFER] = "port PG9 buffer",
+    [MLNX_DVS_PORT_STEP_FEC] = "port FEC",
+};
+
+static void mlnx_boot_stage_time_log(_In_ const char *stage, _Inout_ uint64_t *stage_start_us)
+{
+    uint64_t now_us = time_us_get();
+
+    SX_LOG_NTC("Boot stage %s took %" PRIu64 " ms\n", stage, (now_us - *stage_start_us) / 1000);
+    mlnx_boot_trace_add(stage, "dvs", *stage_start_us, now_us);
+    *stage_start_us = now_us;
+}
+
+/* Accumulates the time of one per-port step, returns the start time for the next step */
+static uint64_t mlnx_dvs_port_step_done(_Inout_ uint64_t          *step_us,
+                                        _Inout_ uint32_t          *step_ports,
+                                        _In_ mlnx_dvs_port_step_t step,
+                                        _In_ uint64_t             step_start_us)
+{
+    uint64_t now_us = time_us_get();
+
+    step_us[step] += now_us - step_start_us;
+    step_ports[step]++;
+
+    return now_us;
+}
+
+static void mlnx_dvs_port_steps_time_log(_In_ const uint64_t *step_us, _In_ const uint32_t *step_ports)
+{
+    mlnx_dvs_port_step_t step;
+
+    for (step = 0; step < MLNX_DVS_PORT_STEP_MAX; step++) {
+        if (!step_ports[step]) {
+            continue;
+        }
+
+        SX_LOG_NTC("Boot stage %s: %u ports, %" PRIu64 " ms total, %" PRIu64 " us per port\n",
+                   mlnx_dvs_port_step_str[step], step_ports[step], step_us[step] / 1000,
+                   step_us[step] / step_ports[step]);
+    }
+}
+
 static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_object_id_t switch_id)
 {
     sx_status_t           sx_status;
@@ -5381,6 +5893,11 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
     uint32_t              ports_to_map, nve_port_idx;
     sxd_status_t          sxd_ret = SXD_STATUS_SUCCESS;
     const bool            is_warmboot = (BOOT_TYPE_WARM == boot_type);
+    uint64_t              dvs_start_us, stage_start_us, step_start_us;
+    uint64_t              step_us[MLNX_DVS_PORT_STEP_MAX] = {0};
+    uint32_t              step_ports[MLNX_DVS_PORT_STEP_MAX] = {0};
+
+    dvs_start_us = stage_start_us = time_us_get();
 
     cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
 
@@ -5416,6 +5933,8 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
         goto out;
     }
 
+    mlnx_boot_stage_time_log("swid netdev setup", &stage_start_us);
+
     port_attributes_p = (sx_port_attributes_t*)calloc((1 + MAX_PORTS), sizeof(*port_attributes_p));
     if (NULL == port_attributes_p) {
         SX_LOG_ERR("Can't allocate port attributes\n");
@@ -5481,6 +6000,8 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
 
     g_sai_db_ptr->sx_nve_log_port = port_attributes_p[nve_port_idx].log_port;
 
+    mlnx_boot_stage_time_log("port device set", &stage_start_us);
+
     dev_info.dev_id = SX_DEVICE_ID;
     dev_info.node_type = SX_DEV_NODE_TYPE_LEAF_LOCAL;
     dev_info.unicast_arr_len = 0;
@@ -5526,6 +6047,8 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
         g_notification_callbacks.on_switch_state_change(switch_id, SAI_SWITCH_OPER_STATUS_UP);
     }
 
+    mlnx_boot_stage_time_log("topo device set", &stage_start_us);
+
     ports_to_map = 0;
     for (ii = 0; ii < MAX_PORTS; ii++) {
         if (!g_sai_db_ptr->ports_db[ii].is_present) {
@@ -5575,6 +6098,8 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
         }
     }
 
+    mlnx_boot_stage_time_log("port mapping", &stage_start_us);
+
     status = mlnx_stp_preinitialize();
     if (SAI_ERR(status)) {
         goto out;
@@ -5592,6 +6117,8 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
         goto out;
     }
 
+    mlnx_boot_stage_time_log("STP and buffer preinit", &stage_start_us);
+
     /* Need to read SDK port list twice:
      * First time: SDK port list only contains all physical ports
      * Do sx_api_port_init_set to initialize SDK ports, SDK will update LAG information
@@ -5603,16 +6130,25 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
         }
     }
 
+    /* The per port init below is not batched nor spread over threads:
+     * - SDK has no multi port variant of the calls it makes (swid bind, port init, loopback, state, pvid,
+     *   ingress filter, forwarding mode, STP state, FEC, buffers), each takes a single log port
+     * - the port helpers use the global gh_sdk handle and update the SAI DB, which is write locked here
+     * - on warmboot the DPT access control is switched RO/RW around single port calls, that is a device
+     *   wide setting and can't be interleaved with other ports
+     * The per step time is logged instead, to show which step is worth a multi port SDK call */
     for (ii = 0; ii < MAX_PORTS; ii++) {
         port = &mlnx_ports_db[ii];
         if (port->logical &&
             ((is_warmboot && port->sdk_port_added) ||
              (!is_warmboot && port->is_present))) {
+            step_start_us = time_us_get();
             status = mlnx_port_config_init_mandatory(port);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("Failed initialize port oid %" PRIx64 " config\n", port->saiport);
                 goto out;
             }
+            mlnx_dvs_port_step_done(step_us, step_ports, MLNX_DVS_PORT_STEP_INIT_MANDATORY, step_start_us);
         }
     }
 
@@ -5625,17 +6161,22 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
 
     mlnx_port_phy_foreach(port, ii) {
         if (!is_warmboot || (port->is_present && port->sdk_port_added)) {
+            step_start_us = time_us_get();
             status = mlnx_port_config_init(port);
             if (SAI_ERR(status)) {
                 SX_LOG_ERR("Failed initialize port oid %" PRIx64 " config\n", port->saiport);
                 goto out;
             }
+            step_start_us = mlnx_dvs_port_step_done(step_us, step_ports, MLNX_DVS_PORT_STEP_CONFIG_INIT,
+                                                    step_start_us);
 
             if (!is_warmboot) {
                 status = mlnx_port_speed_bitmap_apply(port);
                 if (SAI_ERR(status)) {
                     goto out;
                 }
+                step_start_us = mlnx_dvs_port_step_done(step_us, step_ports, MLNX_DVS_PORT_STEP_SPEED_BITMAP,
+                                                        step_start_us);
             }
 
             /* on warmboot control priority group buffer is handled just before issu end */
@@ -5650,6 +6191,8 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
                     SX_LOG_ERR("Failed to update control PG headroom size on init.\n");
                     goto out;
                 }
+                step_start_us = mlnx_dvs_port_step_done(step_us, step_ports, MLNX_DVS_PORT_STEP_PG9_BUFFER,
+                                                        step_start_us);
             }
 
             if ((!is_warmboot) && (mlnx_chip_is_spc2())) {
@@ -5657,10 +6200,14 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
                 if (SAI_ERR(status)) {
                     goto out;
                 }
+                mlnx_dvs_port_step_done(step_us, step_ports, MLNX_DVS_PORT_STEP_FEC, step_start_us);
             }
         }
     }
 
+    mlnx_boot_stage_time_log("port init", &stage_start_us);
+    mlnx_dvs_port_steps_time_log(step_us, step_ports);
+
     if (is_warmboot) {
         sxd_ret = sxd_dpt_set_access_control(SX_DEVICE_ID, READ_WRITE);
         if (SXD_CHECK_FAIL(sxd_ret)) {
@@ -5674,6 +6221,9 @@ static sai_status_t mlnx_dvs_mng_stage(mlnx_sai_boot_type_t boot_type, sai_objec
         goto out;
     }
 
+    mlnx_boot_stage_time_log("WRED init", &stage_start_us);
+    SX_LOG_NTC("Boot DVS stage took %" PRIu64 " ms\n", (time_us_get() - dvs_start_us) / 1000);
+
 out:
     sai_db_unlock();
     if (NULL != port_attributes_p) {
@@ -6303,6 +6853,10 @@ out:
  *  array for all wred profiles
  *  array of port qos config
  *  array of all queues for all ports
+ *  array of the ports using each wred profile
+ *  array of the ETS list shadows for all ports
+ *  array of the ETS elements for all ports
+ *  array of the ports using each scheduler profile
  */
 static void sai_qos_db_init()
 {
@@ -6314,6 +6868,22 @@ static void sai_qos_db_init()
 
     g_sai_qos_db_ptr->queue_db = (mlnx_qos_queue_config_t*)((uint8_t*)g_sai_qos_db_ptr->sched_db +
                                                             sizeof(mlnx_sched_profile_t) * MAX_SCHED);
+
+    g_sai_qos_db_ptr->wred_refs = (mlnx_wred_refs_t*)((uint8_t*)g_sai_qos_db_ptr->queue_db +
+                                                      sizeof(mlnx_qos_queue_config_t) *
+                                                      (g_resource_limits.cos_port_ets_traffic_class_max + 1) *
+                                                      MAX_PORTS * 2);
+
+    g_sai_qos_db_ptr->ets_shadow = (mlnx_port_ets_shadow_t*)((uint8_t*)g_sai_qos_db_ptr->wred_refs +
+                                                             sizeof(mlnx_wred_refs_t) *
+                                                             g_resource_limits.cos_redecn_profiles_max);
+
+    g_sai_qos_db_ptr->ets_db = (sx_cos_ets_element_config_t*)((uint8_t*)g_sai_qos_db_ptr->ets_shadow +
+                                                              sizeof(mlnx_port_ets_shadow_t) * MAX_PORTS * 2);
+
+    g_sai_qos_db_ptr->sched_refs = (mlnx_sched_refs_t*)((uint8_t*)g_sai_qos_db_ptr->ets_db +
+                                                        sizeof(sx_cos_ets_element_config_t) *
+                                                        MAX_ETS_ELEMENTS * MAX_PORTS * 2);
 }
 
 static sai_status_t sai_qos_db_unload(boolean_t erase_db)
@@ -6322,7 +6892,7 @@ static sai_status_t sai_qos_db_unload(boolean_t erase_db)
     sai_status_t status = SAI_STATUS_SUCCESS;
 
     if (erase_db == TRUE) {
-        cl_shm_destroy(SAI_QOS_PATH);
+        mlnx_shm_destroy(SAI_QOS_PATH);
     }
 
     if (g_sai_qos_db_ptr == NULL) {
@@ -6330,7 +6900,7 @@ static sai_status_t sai_qos_db_unload(boolean_t erase_db)
     }
 
     if (g_sai_qos_db_ptr->db_base_ptr != NULL) {
-        err = munmap(g_sai_qos_db_ptr->db_base_ptr, g_sai_qos_db_size);
+        err = mlnx_shm_unmap(g_sai_qos_db_ptr->db_base_ptr, g_sai_qos_db_size);
         if (err == -1) {
             SX_LOG_ERR("Failed to unmap the shared memory of the SAI QOS DB\n");
             status = SAI_STATUS_FAILURE;
@@ -6348,7 +6918,11 @@ static uint32_t sai_qos_db_size_get()
     return ((sizeof(mlnx_wred_profile_t) * g_resource_limits.cos_redecn_profiles_max) +
             (((sizeof(mlnx_qos_queue_config_t) *
                (g_resource_limits.cos_port_ets_traffic_class_max + 1))) * MAX_PORTS * 2) +
-            sizeof(mlnx_sched_profile_t) * MAX_SCHED);
+            sizeof(mlnx_sched_profile_t) * MAX_SCHED +
+            sizeof(mlnx_wred_refs_t) * g_resource_limits.cos_redecn_profiles_max +
+            sizeof(mlnx_port_ets_shadow_t) * MAX_PORTS * 2 +
+            sizeof(sx_cos_ets_element_config_t) * MAX_ETS_ELEMENTS * MAX_PORTS * 2 +
+            sizeof(mlnx_sched_refs_t) * MAX_SCHED);
 }
 
 /* g_resource_limits must be initialized before we call create,
@@ -6358,12 +6932,12 @@ static sai_status_t sai_qos_db_create()
     int         shmid;
     cl_status_t cl_err;
 
-    cl_err = cl_shm_create(SAI_QOS_PATH, &shmid);
+    cl_err = mlnx_shm_create(SAI_QOS_PATH, &shmid);
     if (cl_err) {
         if (errno == EEXIST) { /* one retry is allowed */
             MLNX_SAI_LOG_NTC("Shared memory of the SAI QOS already exists, destroying it and re-creating\n");
-            cl_shm_destroy(SAI_QOS_PATH);
-            cl_err = cl_shm_create(SAI_QOS_PATH, &shmid);
+            mlnx_shm_destroy(SAI_QOS_PATH);
+            cl_err = mlnx_shm_create(SAI_QOS_PATH, &shmid);
         }
 
         if (cl_err) {
@@ -6374,9 +6948,9 @@ static sai_status_t sai_qos_db_create()
 
     g_sai_qos_db_size = sai_qos_db_size_get();
 
-    if (ftruncate(shmid, g_sai_qos_db_size) == -1) {
+    if (mlnx_shm_truncate(shmid, g_sai_qos_db_size) == -1) {
         MLNX_SAI_LOG_ERR("Failed to set shared memory size for the SAI QOS DB\n");
-        cl_shm_destroy(SAI_QOS_PATH);
+        mlnx_shm_destroy(SAI_QOS_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6386,11 +6960,11 @@ static sai_status_t sai_qos_db_create()
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_qos_db_ptr->db_base_ptr = mmap(NULL, g_sai_qos_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_qos_db_ptr->db_base_ptr = mlnx_shm_map(SAI_QOS_PATH, shmid, g_sai_qos_db_size);
     if (g_sai_qos_db_ptr->db_base_ptr == MAP_FAILED) {
         MLNX_SAI_LOG_ERR("Failed to map the shared memory of the SAI QOS DB\n");
         g_sai_qos_db_ptr->db_base_ptr = NULL;
-        cl_shm_destroy(SAI_QOS_PATH);
+        mlnx_shm_destroy(SAI_QOS_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6416,7 +6990,7 @@ static sai_status_t sai_buffer_db_switch_connect_init(int shmid)
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_buffer_db_ptr->db_base_ptr = mmap(NULL, g_sai_buffer_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_buffer_db_ptr->db_base_ptr = mlnx_shm_map(SAI_BUFFER_PATH, shmid, g_sai_buffer_db_size);
     if (g_sai_buffer_db_ptr->db_base_ptr == MAP_FAILED) {
         SX_LOG_ERR("Failed to map the shared memory of the SAI buffer DB\n");
         g_sai_buffer_db_ptr->db_base_ptr = NULL;
@@ -6456,7 +7030,7 @@ static sai_status_t sai_buffer_db_unload(boolean_t erase_db)
     sai_status_t status = SAI_STATUS_SUCCESS;
 
     if (erase_db == TRUE) {
-        cl_shm_destroy(SAI_BUFFER_PATH);
+        mlnx_shm_destroy(SAI_BUFFER_PATH);
     }
 
     if (g_sai_buffer_db_ptr == NULL) {
@@ -6464,7 +7038,7 @@ static sai_status_t sai_buffer_db_unload(boolean_t erase_db)
     }
 
     if (g_sai_buffer_db_ptr->db_base_ptr != NULL) {
-        err = munmap(g_sai_buffer_db_ptr->db_base_ptr, g_sai_buffer_db_size);
+        err = mlnx_shm_unmap(g_sai_buffer_db_ptr->db_base_ptr, g_sai_buffer_db_size);
         if (err == -1) {
             SX_LOG_ERR("Failed to unmap the shared memory of the SAI buffer DB\n");
             status = SAI_STATUS_FAILURE;
@@ -6506,12 +7080,12 @@ static sai_status_t sai_buffer_db_create()
 
     init_buffer_resource_limits();
 
-    cl_err = cl_shm_create(SAI_BUFFER_PATH, &shmid);
+    cl_err = mlnx_shm_create(SAI_BUFFER_PATH, &shmid);
     if (cl_err) {
         if (errno == EEXIST) { /* one retry is allowed */
             MLNX_SAI_LOG_NTC("Shared memory of the SAI buffer already exists, destroying it and re-creating\n");
-            cl_shm_destroy(SAI_BUFFER_PATH);
-            cl_err = cl_shm_create(SAI_BUFFER_PATH, &shmid);
+            mlnx_shm_destroy(SAI_BUFFER_PATH);
+            cl_err = mlnx_shm_create(SAI_BUFFER_PATH, &shmid);
         }
 
         if (cl_err) {
@@ -6522,9 +7096,9 @@ static sai_status_t sai_buffer_db_create()
 
     g_sai_buffer_db_size = sai_buffer_db_size_get();
 
-    if (ftruncate(shmid, g_sai_buffer_db_size) == -1) {
+    if (mlnx_shm_truncate(shmid, g_sai_buffer_db_size) == -1) {
         MLNX_SAI_LOG_ERR("Failed to set shared memory size for the SAI buffer DB\n");
-        cl_shm_destroy(SAI_BUFFER_PATH);
+        mlnx_shm_destroy(SAI_BUFFER_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6534,11 +7108,11 @@ static sai_status_t sai_buffer_db_create()
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_buffer_db_ptr->db_base_ptr = mmap(NULL, g_sai_buffer_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_buffer_db_ptr->db_base_ptr = mlnx_shm_map(SAI_BUFFER_PATH, shmid, g_sai_buffer_db_size);
     if (g_sai_buffer_db_ptr->db_base_ptr == MAP_FAILED) {
         MLNX_SAI_LOG_ERR("Failed to map the shared memory of the SAI buffer DB\n");
         g_sai_buffer_db_ptr->db_base_ptr = NULL;
-        cl_shm_destroy(SAI_BUFFER_PATH);
+        mlnx_shm_destroy(SAI_BUFFER_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
     return SAI_STATUS_SUCCESS;
@@ -6669,12 +7243,12 @@ static sai_status_t sai_acl_db_create()
     int         shmid;
     cl_status_t cl_err;
 
-    cl_err = cl_shm_create(SAI_ACL_PATH, &shmid);
+    cl_err = mlnx_shm_create(SAI_ACL_PATH, &shmid);
     if (cl_err) {
         if (errno == EEXIST) {
             MLNX_SAI_LOG_NTC("Shared memory of the SAI ACL already exists, destroying it and re-creating\n");
-            cl_shm_destroy(SAI_ACL_PATH);
-            cl_err = cl_shm_create(SAI_ACL_PATH, &shmid);
+            mlnx_shm_destroy(SAI_ACL_PATH);
+            cl_err = mlnx_shm_create(SAI_ACL_PATH, &shmid);
         }
 
         if (cl_err) {
@@ -6685,9 +7259,9 @@ static sai_status_t sai_acl_db_create()
 
     g_sai_acl_db_size = sai_acl_db_size_get();
 
-    if (ftruncate(shmid, g_sai_acl_db_size) == -1) {
+    if (mlnx_shm_truncate(shmid, g_sai_acl_db_size) == -1) {
         MLNX_SAI_LOG_ERR("Failed to set shared memory size for the SAI ACL DB\n");
-        cl_shm_destroy(SAI_ACL_PATH);
+        mlnx_shm_destroy(SAI_ACL_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6697,11 +7271,11 @@ static sai_status_t sai_acl_db_create()
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_acl_db_ptr->db_base_ptr = mmap(NULL, g_sai_acl_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_acl_db_ptr->db_base_ptr = mlnx_shm_map(SAI_ACL_PATH, shmid, g_sai_acl_db_size);
     if (g_sai_acl_db_ptr->db_base_ptr == MAP_FAILED) {
         MLNX_SAI_LOG_ERR("Failed to map the shared memory of the SAI ACL DB\n");
         g_sai_acl_db_ptr->db_base_ptr = NULL;
-        cl_shm_destroy(SAI_ACL_PATH);
+        mlnx_shm_destroy(SAI_ACL_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6716,7 +7290,7 @@ static sai_status_t sai_acl_db_unload(boolean_t erase_db)
     sai_status_t status = SAI_STATUS_SUCCESS;
 
     if (erase_db == TRUE) {
-        cl_shm_destroy(SAI_ACL_PATH);
+        mlnx_shm_destroy(SAI_ACL_PATH);
     }
 
     if (g_sai_acl_db_ptr == NULL) {
@@ -6724,7 +7298,7 @@ static sai_status_t sai_acl_db_unload(boolean_t erase_db)
     }
 
     if (g_sai_acl_db_ptr->db_base_ptr != NULL) {
-        err = munmap(g_sai_acl_db_ptr->db_base_ptr, g_sai_acl_db_size);
+        err = mlnx_shm_unmap(g_sai_acl_db_ptr->db_base_ptr, g_sai_acl_db_size);
         if (err == -1) {
             SX_LOG_ERR("Failed to unmap the shared memory of the SAI ACL DB\n");
             status = SAI_STATUS_FAILURE;
@@ -6744,7 +7318,10 @@ static uint32_t sai_tunnel_db_size_get()
             sizeof(mlnx_tunnel_map_t) * MLNX_TUNNEL_MAP_MAX +
             sizeof(mlnx_tunnel_map_entry_t) * MLNX_TUNNEL_MAP_ENTRY_MAX +
             sizeof(mlnx_bmtor_bridge_t) * MLNX_BMTOR_BRIDGE_MAX +
-            sizeof(mlnx_dscp_remapping_t));
+            sizeof(mlnx_dscp_remapping_t) +
+            sizeof(mlnx_tunnel_map_entry_hash_t) +
+            sizeof(mlnx_tunnel_db_index_t) +
+            sizeof(mlnx_tunnel_db_index_entry_t) * MAX_TUNNEL_DB_SIZE);
 }
 
 static void sai_tunnel_db_init()
@@ -6771,6 +7348,18 @@ static void sai_tunnel_db_init()
         (mlnx_dscp_remapping_t*)((uint8_t*)g_sai_tunnel_db_ptr->bmtor_bridge_db +
                                  sizeof(mlnx_bmtor_bridge_t) *
                                  MLNX_BMTOR_BRIDGE_MAX);
+
+    g_sai_tunnel_db_ptr->tunnel_map_entry_hash =
+        (mlnx_tunnel_map_entry_hash_t*)((uint8_t*)g_sai_tunnel_db_ptr->dscp_remapping_db +
+                                        sizeof(mlnx_dscp_remapping_t));
+
+    g_sai_tunnel_db_ptr->tunnel_db_index =
+        (mlnx_tunnel_db_index_t*)((uint8_t*)g_sai_tunnel_db_ptr->tunnel_map_entry_hash +
+                                  sizeof(mlnx_tunnel_map_entry_hash_t));
+
+    g_sai_tunnel_db_ptr->tunnel_db_index_entries =
+        (mlnx_tunnel_db_index_entry_t*)((uint8_t*)g_sai_tunnel_db_ptr->tunnel_db_index +
+                                        sizeof(mlnx_tunnel_db_index_t));
 }
 
 static sai_status_t sai_tunnel_db_create()
@@ -6778,12 +7367,12 @@ static sai_status_t sai_tunnel_db_create()
     int         shmid;
     cl_status_t cl_err;
 
-    cl_err = cl_shm_create(SAI_TUNNEL_PATH, &shmid);
+    cl_err = mlnx_shm_create(SAI_TUNNEL_PATH, &shmid);
     if (cl_err) {
         if (errno == EEXIST) {
             MLNX_SAI_LOG_NTC("Shared memory of the SAI TUNNEL already exists, destroying it and re-creating\n");
-            cl_shm_destroy(SAI_TUNNEL_PATH);
-            cl_err = cl_shm_create(SAI_TUNNEL_PATH, &shmid);
+            mlnx_shm_destroy(SAI_TUNNEL_PATH);
+            cl_err = mlnx_shm_create(SAI_TUNNEL_PATH, &shmid);
         }
 
         if (cl_err) {
@@ -6794,9 +7383,9 @@ static sai_status_t sai_tunnel_db_create()
 
     g_sai_tunnel_db_size = sai_tunnel_db_size_get();
 
-    if (ftruncate(shmid, g_sai_tunnel_db_size) == -1) {
+    if (mlnx_shm_truncate(shmid, g_sai_tunnel_db_size) == -1) {
         MLNX_SAI_LOG_ERR("Failed to set shared memory size for the SAI TUNNEL DB\n");
-        cl_shm_destroy(SAI_TUNNEL_PATH);
+        mlnx_shm_destroy(SAI_TUNNEL_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6806,11 +7395,11 @@ static sai_status_t sai_tunnel_db_create()
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_tunnel_db_ptr->db_base_ptr = mmap(NULL, g_sai_tunnel_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_tunnel_db_ptr->db_base_ptr = mlnx_shm_map(SAI_TUNNEL_PATH, shmid, g_sai_tunnel_db_size);
     if (g_sai_tunnel_db_ptr->db_base_ptr == MAP_FAILED) {
         MLNX_SAI_LOG_ERR("Failed to map the shared memory of the SAI TUNNEL DB\n");
         g_sai_tunnel_db_ptr->db_base_ptr = NULL;
-        cl_shm_destroy(SAI_TUNNEL_PATH);
+        mlnx_shm_destroy(SAI_TUNNEL_PATH);
         return SAI_STATUS_NO_MEMORY;
     }
 
@@ -6825,7 +7414,7 @@ static sai_status_t sai_tunnel_db_unload(boolean_t erase_db)
     sai_status_t status = SAI_STATUS_SUCCESS;
 
     if (erase_db == TRUE) {
-        cl_shm_destroy(SAI_TUNNEL_PATH);
+        mlnx_shm_destroy(SAI_TUNNEL_PATH);
     }
 
     if (g_sai_tunnel_db_ptr == NULL) {
@@ -6833,7 +7422,7 @@ static sai_status_t sai_tunnel_db_unload(boolean_t erase_db)
     }
 
     if (g_sai_tunnel_db_ptr->db_base_ptr != NULL) {
-        err = munmap(g_sai_tunnel_db_ptr->db_base_ptr, g_sai_tunnel_db_size);
+        err = mlnx_shm_unmap(g_sai_tunnel_db_ptr->db_base_ptr, g_sai_tunnel_db_size);
         if (err == -1) {
             SX_LOG_ERR("Failed to unmap the shared memory of the SAI TUNNEL DB\n");
             status = SAI_STATUS_FAILURE;
@@ -6855,7 +7444,7 @@ static sai_status_t sai_tunnel_db_switch_connect_init(int shmid)
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_tunnel_db_ptr->db_base_ptr = mmap(NULL, g_sai_tunnel_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_tunnel_db_ptr->db_base_ptr = mlnx_shm_map(SAI_TUNNEL_PATH, shmid, g_sai_tunnel_db_size);
     if (g_sai_tunnel_db_ptr->db_base_ptr == MAP_FAILED) {
         SX_LOG_ERR("Failed to map the shared memory of the SAI Tunnel DB\n");
         g_sai_tunnel_db_ptr->db_base_ptr = NULL;
@@ -6876,7 +7465,7 @@ static sai_status_t sai_acl_db_switch_connect_init(int shmid)
         return SAI_STATUS_NO_MEMORY;
     }
 
-    g_sai_acl_db_ptr->db_base_ptr = mmap(NULL, g_sai_acl_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+    g_sai_acl_db_ptr->db_base_ptr = mlnx_shm_map(SAI_ACL_PATH, shmid, g_sai_acl_db_size);
     if (g_sai_acl_db_ptr->db_base_ptr == MAP_FAILED) {
         SX_LOG_ERR("Failed to map the shared memory of the SAI ACL DB\n");
         g_sai_acl_db_ptr->db_base_ptr = NULL;
@@ -6915,6 +7504,31 @@ static sai_status_t mlnx_cb_table_init(void)
     return status;
 }
 
+static sai_status_t mlnx_sai_rm_chip_initialize(const char *config_file, sx_chip_types_t chip_type)
+{
+    sai_status_t status;
+
+    MLNX_SAI_LOG_DBG("Chip type - %s\n", SX_CHIP_TYPE_STR(chip_type));
+
+    status = rm_chip_limits_get(chip_type, &g_resource_limits);
+    if (SX_ERR(status)) {
+        MLNX_SAI_LOG_ERR("Failed to get chip resources - %s.\n", SX_STATUS_MSG(status));
+        return sdk_to_sai(status);
+    }
+
+    status = mlnx_sai_db_initialize(config_file, chip_type);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_cb_table_init();
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static sai_status_t mlnx_sai_rm_initialize(const char *config_file)
 {
     sai_status_t    status;
@@ -6926,26 +7540,92 @@ static sai_status_t mlnx_sai_rm_initialize(const char *config_file)
         return SAI_STATUS_FAILURE;
     }
 
-    MLNX_SAI_LOG_DBG("Chip type - %s\n", SX_CHIP_TYPE_STR(chip_type));
+    return mlnx_sai_rm_chip_initialize(config_file, chip_type);
+}
 
-    status = rm_chip_limits_get(chip_type, &g_resource_limits);
-    if (SX_ERR(status)) {
-        MLNX_SAI_LOG_ERR("Failed to get chip resources - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+#ifdef SAI_BENCH
+/*
+ * Offline switch init for sai_bench - the SAI DB is created from the XML config for the given
+ * chip type, the SDK calls go to the stub SDK linked into sai_bench.
+ * Only the default .1Q bridge with the bridge ports and the default virtual router are created,
+ * the rest of mlnx_initialize_switch (ACL, hostif, buffers, ...) is not done.
+ */
+sai_status_t mlnx_bench_switch_init(_In_ const char *config_file, _In_ sx_chip_types_t chip_type)
+{
+    sai_status_t status;
+    sx_status_t  sx_status;
+
+    assert(config_file);
+
+    sx_status = sx_api_open(sai_log_cb, &gh_sdk);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Can't open connection to SDK - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
     }
 
-    status = mlnx_sai_db_initialize(config_file, chip_type);
+    status = mlnx_sai_rm_chip_initialize(config_file, chip_type);
     if (SAI_ERR(status)) {
         return status;
     }
 
-    status = mlnx_cb_table_init();
+    status = mlnx_bridge_init();
     if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed initialize default bridge\n");
         return status;
     }
 
-    return SAI_STATUS_SUCCESS;
+    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    status = mlnx_create_object(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, DEFAULT_VRID, NULL, &g_sai_db_ptr->default_vrid);
+    cl_plock_release(&g_sai_db_ptr->p_lock);
+
+    return status;
+}
+
+sai_status_t mlnx_bench_fdb_event_parse(_In_ uint8_t                             *p_packet,
+                                        _Out_ sai_fdb_event_notification_data_t *fdb_events,
+                                        _Out_ uint32_t                          *event_count,
+                                        _Out_ sai_attribute_t                   *attr_list)
+{
+    return mlnx_switch_parse_fdb_event(p_packet, NULL, fdb_events, event_count, attr_list);
+}
+
+/* BFD packet and timeout events as delivered by the event thread for the session */
+sai_status_t mlnx_bench_bfd_packet_handle(_In_ sai_object_id_t          bfd_session_id,
+                                          _In_ const mlnx_bfd_packet_t *bfd_packet,
+                                          _In_ uint8_t                  ttl)
+{
+    struct bfd_packet_event event;
+    mlnx_object_id_t        mlnx_oid;
+    sai_status_t            status;
+
+    assert(bfd_packet);
+
+    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_BFD_SESSION, bfd_session_id, &mlnx_oid);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    memset(&event, 0, sizeof(event));
+    memcpy(&event.packet, bfd_packet, sizeof(*bfd_packet));
+    event.opaque_data = *(uint32_t*)&mlnx_oid.id.bfd_db_idx;
+    event.ttl = ttl;
+
+    return mlnx_switch_bfd_packet_handle(&event);
+}
+
+sai_status_t mlnx_bench_bfd_timeout_handle(_In_ sai_object_id_t bfd_session_id)
+{
+    mlnx_object_id_t mlnx_oid;
+    sai_status_t     status;
+
+    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_BFD_SESSION, bfd_session_id, &mlnx_oid);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return mlnx_switch_bfd_event_handle(SX_TRAP_ID_BFD_TIMEOUT_EVENT, *(uint32_t*)&mlnx_oid.id.bfd_db_idx);
 }
+#endif /* SAI_BENCH */
 
 static sai_status_t validate_kvd_keys(const char           *key_size,
                                       const char           *key_min_size,
@@ -7436,7 +8116,10 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
     sxd_status_t                sxd_ret = SXD_STATUS_SUCCESS;
     mlnx_port_config_t         *port;
     bool                        is_warmboot_init_stage;
-    const char                 *additional_mac_enabled, *reduced_rif_counter;
+    const char                 *additional_mac_enabled, *reduced_rif_counter, *stats_cache_interval;
+    const char                 *api_stats_enabled, *sdk_trace_file, *sdk_trace_records;
+    uint64_t                    phase_start_us = time_us_get();
+    uint64_t                    sdk_start_us;
 
     memset(&span_init_params, 0, sizeof(sx_span_init_params_t));
 
@@ -7460,6 +8143,16 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         return SAI_STATUS_FAILURE;
     }
 
+    sdk_trace_file = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_SDK_TRACE_FILE);
+    if (NULL != sdk_trace_file) {
+        sdk_trace_records = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_SDK_TRACE_RECORDS);
+        sai_status = mlnx_sdk_trace_init(sdk_trace_file,
+                                         sdk_trace_records ? (uint32_t)strtoul(sdk_trace_records, NULL, 0) : 0);
+        if (SAI_ERR(sai_status)) {
+            return sai_status;
+        }
+    }
+
     boot_type_char = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_BOOT_TYPE);
     if (NULL != boot_type_char) {
         boot_type = (uint8_t)atoi(boot_type_char);
@@ -7494,20 +8187,24 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         MLNX_SAI_LOG_ERR("Boot type %d not recognized, must be 0 (cold) or 1 (warm) or 2 (fast)\n", boot_type);
         return SAI_STATUS_INVALID_PARAMETER;
     }
+    phase_start_us = mlnx_boot_trace_mark("sxdkernel start", "phase", phase_start_us);
 
     sai_status = mlnx_sai_rm_initialize(config_file);
     if (SAI_ERR(sai_status)) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_sai_rm_initialize", "phase", phase_start_us);
 
     sai_status = mlnx_sdk_start(boot_type);
     if (SAI_ERR(sai_status)) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_sdk_start", "phase", phase_start_us);
 
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_resource_mng_stage(warm_recover, boot_type))) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_resource_mng_stage", "phase", phase_start_us);
 
     if ((BOOT_TYPE_FAST == boot_type) && (!(*transaction_mode_enable))) {
         MLNX_SAI_LOG_ERR("Transaction mode should be enabled, enabling now\n");
@@ -7570,31 +8267,37 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
                                                                    ku_profile))) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_chassis_mng_stage", "phase", phase_start_us);
 
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_sai_issu_init_impl(g_profile_id, boot_type))) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_sai_issu_init_impl", "phase", phase_start_us);
 
     /* initialize the per-port IP counter */
     if (mlnx_perport_ipcnt_is_enable_nolock()) {
         if (SAI_STATUS_SUCCESS != (sai_status = mlnx_perport_ipcnt_init(g_sai_db_ptr->ports_number))) {
             return sai_status;
         }
+        phase_start_us = mlnx_boot_trace_mark("mlnx_perport_ipcnt_init", "phase", phase_start_us);
     }
 
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_dvs_mng_stage(boot_type, switch_id))) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_dvs_mng_stage", "phase", phase_start_us);
 
     if (SAI_STATUS_SUCCESS != (sai_status = switch_open_traps())) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("switch_open_traps", "phase", phase_start_us);
 
     cl_err = cl_thread_init(&event_thread, event_thread_func, (const void*const)switch_id, NULL);
     if (cl_err) {
         SX_LOG_ERR("Failed to create event thread\n");
         return SAI_STATUS_FAILURE;
     }
+    phase_start_us = mlnx_boot_trace_mark("event thread start", "thread", phase_start_us);
 
 #ifndef _WIN32
     if (0 != sem_init(&g_sai_db_ptr->dfw_sem, 1, 0)) {
@@ -7708,15 +8411,19 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
     router_attr.uc_default_rule_action = SX_ROUTER_ACTION_DROP;
     router_attr.mc_default_rule_action = SX_ROUTER_ACTION_DROP;
 
+    phase_start_us = time_us_get();
     if (SX_STATUS_SUCCESS != (sdk_status = sx_api_router_init_set(gh_sdk, &general_param, &resources_param))) {
         SX_LOG_ERR("Router init failed - %s.\n", SX_STATUS_MSG(sdk_status));
         return sdk_to_sai(sdk_status);
     }
+    phase_start_us = mlnx_boot_trace_mark("sx_api_router_init_set", "sdk", phase_start_us);
 
+    sdk_start_us = phase_start_us;
     if (SX_STATUS_SUCCESS != (sdk_status = sx_api_router_set(gh_sdk, SX_ACCESS_CMD_ADD, &router_attr, &vrid))) {
         SX_LOG_ERR("Failed to add default router - %s.\n", SX_STATUS_MSG(sdk_status));
         return sdk_to_sai(sdk_status);
     }
+    mlnx_boot_trace_mark("sx_api_router_set", "sdk", sdk_start_us);
 
     /* Update route/neighbor table size to default value if no setting in profile.
      * SDK counts v4 and v6 on same HW table KVD HASH, so init for available resource
@@ -7744,20 +8451,25 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
     }
 
     /* Set default aging time - 0 (disabled) */
+    sdk_start_us = time_us_get();
     if (SX_STATUS_SUCCESS !=
         (sdk_status = sx_api_fdb_age_time_set(gh_sdk, DEFAULT_ETH_SWID, SX_FDB_AGE_TIME_MAX))) {
         SX_LOG_ERR("Failed to set fdb age time - %s.\n", SX_STATUS_MSG(sdk_status));
         return sdk_to_sai(sdk_status);
     }
+    mlnx_boot_trace_mark("sx_api_fdb_age_time_set", "sdk", sdk_start_us);
+    phase_start_us = mlnx_boot_trace_mark("default router and fdb setup", "phase", phase_start_us);
 
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_hash_initialize())) {
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_hash_initialize", "phase", phase_start_us);
 
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_acl_init())) {
         SX_LOG_ERR("Failed to init acl DB\n");
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_acl_init", "phase", phase_start_us);
 
     sai_status = mlnx_bulk_counter_init();
     if (SAI_ERR(sai_status)) {
@@ -7767,21 +8479,26 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
 
     span_init_params.version = SX_SPAN_MIRROR_HEADER_VERSION_1;
 
+    sdk_start_us = time_us_get();
     if (SX_STATUS_SUCCESS !=
         (sdk_status = sx_api_span_init_set(gh_sdk, &span_init_params))) {
         SX_LOG_ERR("Failed to init SPAN: %s\n", SX_STATUS_MSG(sdk_status));
         return sdk_to_sai(sdk_status);
     }
+    mlnx_boot_trace_mark("sx_api_span_init_set", "sdk", sdk_start_us);
+    phase_start_us = mlnx_boot_trace_mark("bulk counter and SPAN init", "phase", phase_start_us);
 
     if (BOOT_TYPE_WARM != boot_type) {
         sx_vlan_id[0] = DEFAULT_VLAN;
         sx_vlan_cnt = 1;
+        sdk_start_us = time_us_get();
         sdk_status = sx_api_vlan_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID, sx_vlan_id, &sx_vlan_cnt);
         if (SX_ERR(sdk_status)) {
             SX_LOG_ERR("Error adding vlan %hu: %s\n", sx_vlan_id[0], SX_STATUS_MSG(sdk_status));
             sai_status = sdk_to_sai(sdk_status);
             return sai_status;
         }
+        mlnx_boot_trace_mark("sx_api_vlan_set", "sdk", sdk_start_us);
     } else {
         for (ii = 0; ii < MAX_VLANS - 1; ii++) {
             sx_vlan_id[ii] = ii + 1;
@@ -7794,12 +8511,14 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
             return SAI_STATUS_FAILURE;
         }
 
+        sdk_start_us = time_us_get();
         sdk_status = sx_api_vlan_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID, sx_vlan_id, &sx_vlan_cnt);
         if (SX_ERR(sdk_status)) {
             SX_LOG_ERR("Error adding %d vlans: %s\n", sx_vlan_cnt, SX_STATUS_MSG(sdk_status));
             sai_status = sdk_to_sai(sdk_status);
             return sai_status;
         }
+        mlnx_boot_trace_mark("sx_api_vlan_set", "sdk", sdk_start_us);
 
         sxd_ret = sxd_dpt_set_access_control(SX_DEVICE_ID, READ_WRITE);
         if (SXD_CHECK_FAIL(sxd_ret)) {
@@ -7813,6 +8532,7 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         SX_LOG_ERR("Failed initialize default bridge\n");
         return sai_status;
     }
+    phase_start_us = mlnx_boot_trace_mark("default VLAN and bridge init", "phase", phase_start_us);
 
     sai_status = mlnx_default_vlan_flood_ctrl_init();
     if (SAI_ERR(sai_status)) {
@@ -7837,6 +8557,8 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         }
     }
 
+    phase_start_us = mlnx_boot_trace_mark("flood control and internal ACLs init", "phase", phase_start_us);
+
     dscp_remapping_enabled = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_DSCP_REMAPPING_ENABLED);
     if ((NULL != dscp_remapping_enabled) && (atoi(dscp_remapping_enabled) > 0)) {
         SX_LOG_NTC("DSCP remapping is enabled.\n");
@@ -7862,6 +8584,7 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         }
         MLNX_SAI_LOG_NTC("Adaptive routing init done.\n");
     }
+    phase_start_us = mlnx_boot_trace_mark("mlnx_ar_init", "phase", phase_start_us);
 
     cl_err = cl_thread_init(&dfw_thread, mlnx_switch_dfw_thread_func, (const void*const)switch_id, NULL);
     if (cl_err) {
@@ -7874,6 +8597,22 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         SX_LOG_ERR("Failed to create monitor SDK thread\n");
         return SAI_STATUS_FAILURE;
     }
+    phase_start_us = mlnx_boot_trace_mark("DFW and SDK monitor threads start", "thread", phase_start_us);
+
+    api_stats_enabled = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_API_STATS_ENABLED);
+    if ((NULL != api_stats_enabled) && (atoi(api_stats_enabled) > 0)) {
+        SX_LOG_NTC("API stats are enabled.\n");
+        g_mlnx_api_stats_enabled = true;
+    }
+
+    stats_cache_interval = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_STATS_CACHE_INTERVAL_MS);
+    if ((NULL != stats_cache_interval) && (atoi(stats_cache_interval) > 0)) {
+        sai_status = mlnx_stats_cache_init((uint32_t)atoi(stats_cache_interval));
+        if (SAI_ERR(sai_status)) {
+            return sai_status;
+        }
+        mlnx_boot_trace_mark("mlnx_stats_cache_init", "thread", phase_start_us);
+    }
 
     return SAI_STATUS_SUCCESS;
 }
@@ -7913,6 +8652,7 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
     int                            err, shmid;
     sx_chip_types_t                chip_type;
     sx_status_t                    status;
+    sai_status_t                   sai_status;
     sxd_status_t                   sxd_status;
     sx_log_verbosity_target_attr_t log_verbosity_target_attr = { 0 };
 
@@ -7952,27 +8692,20 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
             return sdk_to_sai(status);
         }
 
-        g_mlnx_shm_rm_size = (uint32_t)mlnx_sai_rm_db_size_get();
+        mlnx_shm_huge_pages_init();
 
-        err = cl_shm_open(SAI_PATH, &shmid);
+        err = mlnx_shm_open(SAI_PATH, &shmid);
         if (err) {
             SX_LOG_ERR("Failed to open shared memory of SAI DB %s\n", strerror(errno));
             return SAI_STATUS_NO_MEMORY;
         }
 
-        g_sai_db_ptr = mmap(NULL,
-                            sizeof(*g_sai_db_ptr) + g_mlnx_shm_rm_size,
-                            PROT_READ | PROT_WRITE,
-                            MAP_SHARED,
-                            shmid,
-                            0);
-        if (g_sai_db_ptr == MAP_FAILED) {
-            SX_LOG_ERR("Failed to map the shared memory of the SAI DB\n");
-            g_sai_db_ptr = NULL;
-            return SAI_STATUS_NO_MEMORY;
+        sai_status = sai_db_map(shmid);
+        if (SAI_ERR(sai_status)) {
+            return sai_status;
         }
 
-        err = cl_shm_open(SAI_QOS_PATH, &shmid);
+        err = mlnx_shm_open(SAI_QOS_PATH, &shmid);
         if (err) {
             SX_LOG_ERR("Failed to open shared memory of SAI QOS DB %s\n", strerror(errno));
             return SAI_STATUS_NO_MEMORY;
@@ -7985,7 +8718,7 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
             return SAI_STATUS_NO_MEMORY;
         }
 
-        g_sai_qos_db_ptr->db_base_ptr = mmap(NULL, g_sai_qos_db_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmid, 0);
+        g_sai_qos_db_ptr->db_base_ptr = mlnx_shm_map(SAI_QOS_PATH, shmid, g_sai_qos_db_size);
         if (g_sai_qos_db_ptr->db_base_ptr == MAP_FAILED) {
             SX_LOG_ERR("Failed to map the shared memory of the SAI QOS DB\n");
             g_sai_qos_db_ptr->db_base_ptr = NULL;
@@ -7994,7 +8727,7 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
 
         sai_qos_db_init();
 
-        err = cl_shm_open(SAI_BUFFER_PATH, &shmid);
+        err = mlnx_shm_open(SAI_BUFFER_PATH, &shmid);
         if (err) {
             SX_LOG_ERR("Failed to open shared memory of SAI Buffers DB %s\n", strerror(errno));
             return SAI_STATUS_NO_MEMORY;
@@ -8006,7 +8739,7 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
             return status;
         }
 
-        err = cl_shm_open(SAI_ACL_PATH, &shmid);
+        err = mlnx_shm_open(SAI_ACL_PATH, &shmid);
         if (err) {
             SX_LOG_ERR("Failed to open shared memory of SAI ACL DB %s\n", strerror(errno));
             return SAI_STATUS_NO_MEMORY;
@@ -8018,7 +8751,7 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
             return status;
         }
 
-        err = cl_shm_open(SAI_TUNNEL_PATH, &shmid);
+        err = mlnx_shm_open(SAI_TUNNEL_PATH, &shmid);
         if (err) {
             SX_LOG_ERR("Failed to open shared memory of SAI Tunnel DB %s\n", strerror(errno));
             return SAI_STATUS_NO_MEMORY;
@@ -8051,6 +8784,110 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * The ports are reconfigured once for all the ECMP and LAG hash attributes.
+ * The DB write lock is held from begin to commit, so no other hash config change is deferred with these.
+ */
+static sai_status_t mlnx_switch_hash_attrs_set(_In_ uint32_t attr_count, _In_ const sai_attribute_t *attr_list)
+{
+    const sai_attribute_value_t *attr_val = NULL;
+    uint32_t                     attr_idx;
+    sai_status_t                 status, commit_status;
+
+    sai_db_write_lock();
+    mlnx_hash_config_defer_begin();
+
+    status = find_attrib_in_list(attr_count,
+                                 attr_list,
+                                 SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_SEED,
+                                 &attr_val,
+                                 &attr_idx);
+    if (!SAI_ERR(status)) {
+        status = mlnx_switch_ecmp_hash_param_set_impl(SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_SEED, attr_val);
+        if (SAI_STATUS_SUCCESS != status) {
+            MLNX_SAI_LOG_ERR("Failed setting ECMP default hash seed\n");
+            goto out;
+        }
+    }
+
+    status = find_attrib_in_list(attr_count,
+                                 attr_list,
+                                 SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_ALGORITHM,
+                                 &attr_val,
+                                 &attr_idx);
+    if (!SAI_ERR(status)) {
+        status = mlnx_switch_ecmp_hash_param_set_impl(SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_ALGORITHM, attr_val);
+        if (SAI_STATUS_SUCCESS != status) {
+            MLNX_SAI_LOG_ERR("Failed setting ECMP default hash algorithm\n");
+            goto out;
+        }
+    }
+
+    status = find_attrib_in_list(attr_count,
+                                 attr_list,
+                                 SAI_SWITCH_ATTR_ECMP_DEFAULT_SYMMETRIC_HASH,
+                                 &attr_val,
+                                 &attr_idx);
+    if (!SAI_ERR(status)) {
+        status = mlnx_switch_ecmp_hash_param_set_impl(SAI_SWITCH_ATTR_ECMP_DEFAULT_SYMMETRIC_HASH, attr_val);
+        if (SAI_STATUS_SUCCESS != status) {
+            MLNX_SAI_LOG_ERR("Failed setting ECMP default symmetric hash\n");
+            goto out;
+        }
+    }
+
+    status =
+        find_attrib_in_list(attr_count, attr_list, SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_SEED, &attr_val, &attr_idx);
+    if (!SAI_ERR(status)) {
+        status = mlnx_switch_lag_hash_attr_set_impl(SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_SEED, attr_val);
+        if (SAI_STATUS_SUCCESS != status) {
+            MLNX_SAI_LOG_ERR("Failed setting LAG default hash seed\n");
+            goto out;
+        }
+    }
+
+    status = find_attrib_in_list(attr_count,
+                                 attr_list,
+                                 SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_ALGORITHM,
+                                 &attr_val,
+                                 &attr_idx);
+    if (!SAI_ERR(status)) {
+        status = mlnx_switch_lag_hash_attr_set_impl(SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_ALGORITHM, attr_val);
+        if (SAI_STATUS_SUCCESS != status) {
+            MLNX_SAI_LOG_ERR("Failed setting LAG default hash algorithm\n");
+            goto out;
+        }
+    }
+
+    status = find_attrib_in_list(attr_count,
+                                 attr_list,
+                                 SAI_SWITCH_ATTR_LAG_DEFAULT_SYMMETRIC_HASH,
+                                 &attr_val,
+                                 &attr_idx);
+    if (!SAI_ERR(status)) {
+        status = mlnx_switch_lag_hash_attr_set_impl(SAI_SWITCH_ATTR_LAG_DEFAULT_SYMMETRIC_HASH, attr_val);
+        if (SAI_STATUS_SUCCESS != status) {
+            MLNX_SAI_LOG_ERR("Failed setting LAG default symmetric hash\n");
+            goto out;
+        }
+    }
+
+    status = SAI_STATUS_SUCCESS;
+
+out:
+    commit_status = mlnx_hash_config_defer_commit();
+    sai_db_unlock();
+
+    if (SAI_ERR(commit_status)) {
+        MLNX_SAI_LOG_ERR("Failed to apply hash config\n");
+        if (SAI_OK(status)) {
+            status = commit_status;
+        }
+    }
+
+    return status;
+}
+
 /**
  * @brief Create switch
  *
@@ -8073,6 +8910,7 @@ static sai_status_t mlnx_create_switch(_Out_ sai_object_id_t     * switch_id,
     sai_status_t                 status;
     uint32_t                     attr_idx;
     bool                         transaction_mode_enable = false, crc_check_enable = true, crc_recalc_enable = true;
+    uint64_t                     create_start_us = 0;
 
     if (NULL == switch_id) {
         MLNX_SAI_LOG_ERR("NULL switch_id id param\n");
@@ -8172,6 +9010,8 @@ static sai_status_t mlnx_create_switch(_Out_ sai_object_id_t     * switch_id,
     }
     if (mlnx_switch_id.id.is_created) {
         is_create_switch_process = true;
+        mlnx_boot_trace_reset();
+        create_start_us = time_us_get();
         status = mlnx_initialize_switch(*switch_id, &transaction_mode_enable);
     } else {
         status = mlnx_connect_switch(*switch_id);
@@ -8233,79 +9073,9 @@ static sai_status_t mlnx_create_switch(_Out_ sai_object_id_t     * switch_id,
         }
     }
 
-    status = find_attrib_in_list(attr_count,
-                                 attr_list,
-                                 SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_SEED,
-                                 &attr_val,
-                                 &attr_idx);
-    if (!SAI_ERR(status)) {
-        status = mlnx_switch_ecmp_hash_param_set_impl(SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_SEED, attr_val);
-        if (SAI_STATUS_SUCCESS != status) {
-            MLNX_SAI_LOG_ERR("Failed setting ECMP default hash seed\n");
-            return status;
-        }
-    }
-
-    status = find_attrib_in_list(attr_count,
-                                 attr_list,
-                                 SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_ALGORITHM,
-                                 &attr_val,
-                                 &attr_idx);
-    if (!SAI_ERR(status)) {
-        status = mlnx_switch_ecmp_hash_param_set_impl(SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_ALGORITHM, attr_val);
-        if (SAI_STATUS_SUCCESS != status) {
-            MLNX_SAI_LOG_ERR("Failed setting ECMP default hash algorithm\n");
-            return status;
-        }
-    }
-
-    status = find_attrib_in_list(attr_count,
-                                 attr_list,
-                                 SAI_SWITCH_ATTR_ECMP_DEFAULT_SYMMETRIC_HASH,
-                                 &attr_val,
-                                 &attr_idx);
-    if (!SAI_ERR(status)) {
-        status = mlnx_switch_ecmp_hash_param_set_impl(SAI_SWITCH_ATTR_ECMP_DEFAULT_SYMMETRIC_HASH, attr_val);
-        if (SAI_STATUS_SUCCESS != status) {
-            MLNX_SAI_LOG_ERR("Failed setting ECMP default symmetric hash\n");
-            return status;
-        }
-    }
-
-    status =
-        find_attrib_in_list(attr_count, attr_list, SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_SEED, &attr_val, &attr_idx);
-    if (!SAI_ERR(status)) {
-        status = mlnx_switch_lag_hash_attr_set_impl(SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_SEED, attr_val);
-        if (SAI_STATUS_SUCCESS != status) {
-            MLNX_SAI_LOG_ERR("Failed setting LAG default hash seed\n");
-            return status;
-        }
-    }
-
-    status = find_attrib_in_list(attr_count,
-                                 attr_list,
-                                 SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_ALGORITHM,
-                                 &attr_val,
-                                 &attr_idx);
-    if (!SAI_ERR(status)) {
-        status = mlnx_switch_lag_hash_attr_set_impl(SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_ALGORITHM, attr_val);
-        if (SAI_STATUS_SUCCESS != status) {
-            MLNX_SAI_LOG_ERR("Failed setting LAG default hash algorithm\n");
-            return status;
-        }
-    }
-
-    status = find_attrib_in_list(attr_count,
-                                 attr_list,
-                                 SAI_SWITCH_ATTR_LAG_DEFAULT_SYMMETRIC_HASH,
-                                 &attr_val,
-                                 &attr_idx);
-    if (!SAI_ERR(status)) {
-        status = mlnx_switch_lag_hash_attr_set_impl(SAI_SWITCH_ATTR_LAG_DEFAULT_SYMMETRIC_HASH, attr_val);
-        if (SAI_STATUS_SUCCESS != status) {
-            MLNX_SAI_LOG_ERR("Failed setting LAG default symmetric hash\n");
-            return status;
-        }
+    status = mlnx_switch_hash_attrs_set(attr_count, attr_list);
+    if (SAI_ERR(status)) {
+        return status;
     }
 
     status = find_attrib_in_list(attr_count, attr_list, SAI_SWITCH_ATTR_QOS_DEFAULT_TC, &attr_val, &attr_idx);
@@ -8319,6 +9089,12 @@ static sai_status_t mlnx_create_switch(_Out_ sai_object_id_t     * switch_id,
 
     status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_SWITCH, &mlnx_switch_id, switch_id);
 
+    if (mlnx_switch_id.id.is_created) {
+        mlnx_boot_trace_mark("create_switch", "total", create_start_us);
+        /* The trace is best effort, failing to write it does not fail the switch creation */
+        mlnx_boot_trace_dump(g_sai_db_ptr->dump_configuration.path);
+    }
+
     MLNX_LOG_OID_CREATED(*switch_id);
 
     return status;
@@ -8348,7 +9124,10 @@ static sai_status_t switch_open_traps(void)
 
     cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
 
-    g_sai_db_ptr->trap_group_valid[DEFAULT_TRAP_GROUP_ID] = true;
+    if (!g_sai_db_ptr->trap_group_valid[DEFAULT_TRAP_GROUP_ID]) {
+        g_sai_db_ptr->trap_group_valid[DEFAULT_TRAP_GROUP_ID] = true;
+        g_sai_db_ptr->trap_groups_used++;
+    }
 
     if (SAI_STATUS_SUCCESS !=
         (status = mlnx_create_object(SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP, DEFAULT_TRAP_GROUP_ID, NULL,
@@ -8412,6 +9191,8 @@ static sai_status_t mlnx_shutdown_switch(void)
         }
     }
 
+    mlnx_stats_cache_deinit();
+
     event_thread_asked_to_stop = true;
     dfw_thread_asked_to_stop = true;
     sdk_monitor_asked_to_stop = true;
@@ -8478,6 +9259,8 @@ static sai_status_t mlnx_shutdown_switch(void)
         SX_LOG_ERR("API close failed.\n");
     }
 
+    mlnx_sdk_trace_deinit();
+
     memset(&g_notification_callbacks, 0, sizeof(g_notification_callbacks));
 #ifdef SDK_VALGRIND
     system_err = system("killall -w memcheck-amd64-");
@@ -8777,6 +9560,7 @@ static sai_status_t mlnx_switch_fdb_flood_ctrl_set(_In_ const sai_object_key_t
     return status;
 }
 
+/* SAI DB write lock is needed */
 static sai_status_t mlnx_switch_ecmp_hash_param_set_impl(_In_ long attr_id, _In_ const sai_attribute_value_t *value)
 {
     sai_status_t                       status;
@@ -8786,8 +9570,6 @@ static sai_status_t mlnx_switch_ecmp_hash_param_set_impl(_In_ long attr_id, _In_
            (attr_id == SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_ALGORITHM) ||
            (attr_id == SAI_SWITCH_ATTR_ECMP_DEFAULT_SYMMETRIC_HASH));
 
-    sai_db_write_lock();
-
     port_hash_param = &g_sai_db_ptr->port_ecmp_hash_params;
 
     switch (attr_id) {
@@ -8816,7 +9598,6 @@ static sai_status_t mlnx_switch_ecmp_hash_param_set_impl(_In_ long attr_id, _In_
     }
 
 out:
-    sai_db_unlock();
     return status;
 }
 
@@ -8831,7 +9612,9 @@ static sai_status_t mlnx_switch_ecmp_hash_param_set(_In_ const sai_object_key_t
 
     SX_LOG_ENTER();
 
+    sai_db_write_lock();
     status = mlnx_switch_ecmp_hash_param_set_impl(attr_id, value);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return status;
@@ -8863,6 +9646,7 @@ static sai_status_t mlnx_switch_counter_refresh_set(_In_ const sai_object_key_t
     return SAI_STATUS_NOT_IMPLEMENTED;
 }
 
+/* SAI DB write lock is needed */
 static sai_status_t mlnx_switch_lag_hash_attr_set_impl(_In_ long attr_id, _In_ const sai_attribute_value_t *value)
 {
     sai_status_t               status;
@@ -8872,8 +9656,6 @@ static sai_status_t mlnx_switch_lag_hash_attr_set_impl(_In_ long attr_id, _In_ c
            (attr_id == SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_ALGORITHM) ||
            (attr_id == SAI_SWITCH_ATTR_LAG_DEFAULT_SYMMETRIC_HASH));
 
-    sai_db_write_lock();
-
     lag_hash_params = &g_sai_db_ptr->lag_hash_params;
 
     switch (attr_id) {
@@ -8901,7 +9683,6 @@ static sai_status_t mlnx_switch_lag_hash_attr_set_impl(_In_ long attr_id, _In_ c
     }
 
 out:
-    sai_db_unlock();
     return status;
 }
 
@@ -8915,7 +9696,9 @@ static sai_status_t mlnx_switch_lag_hash_attr_set(_In_ const sai_object_key_t
 
     SX_LOG_ENTER();
 
+    sai_db_write_lock();
     status = mlnx_switch_lag_hash_attr_set_impl(attr_id, value);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return status;
@@ -10176,6 +10959,86 @@ static sai_status_t mlnx_switch_available_get_impl(_In_ sai_switch_attr_t attr_i
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_switch_table_used_get(_In_ sai_switch_attr_t attr_id,
+                                               _In_ uint32_t          table_size,
+                                               _Out_ uint32_t        *count)
+{
+    sai_status_t status;
+    uint32_t     free_entries;
+
+    status = mlnx_switch_available_get_impl(attr_id, &free_entries);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    *count = (table_size > free_entries) ? (table_size - free_entries) : 0;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Upper bound of the number of entries in the SDK table of the route, neighbor or FDB entries - the table size
+ * less the free entries. The free entries of the shared KVD are also taken by the other tables, so the number
+ * can be bigger than the real one.
+ */
+sai_status_t mlnx_switch_table_used_entries_get(_In_ sai_object_type_t object_type, _Out_ uint32_t *count)
+{
+    sai_switch_attr_t v4_attr, v6_attr;
+    sai_status_t      status;
+    uint32_t          v4_size, v6_size, v4_used, v6_used;
+
+    assert(count);
+
+    switch (object_type) {
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        v4_attr = SAI_SWITCH_ATTR_AVAILABLE_IPV4_ROUTE_ENTRY;
+        v6_attr = SAI_SWITCH_ATTR_AVAILABLE_IPV6_ROUTE_ENTRY;
+        v4_size = g_sai_db_ptr->ipv4_route_table_size;
+        v6_size = g_sai_db_ptr->ipv6_route_table_size;
+        if (!v4_size) {
+            v4_size = g_sai_db_ptr->route_table_size;
+        }
+        if (!v6_size) {
+            v6_size = g_sai_db_ptr->route_table_size;
+        }
+        break;
+
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        v4_attr = SAI_SWITCH_ATTR_AVAILABLE_IPV4_NEIGHBOR_ENTRY;
+        v6_attr = SAI_SWITCH_ATTR_AVAILABLE_IPV6_NEIGHBOR_ENTRY;
+        v4_size = g_sai_db_ptr->ipv4_neighbor_table_size;
+        v6_size = g_sai_db_ptr->ipv6_neighbor_table_size;
+        if (!v4_size) {
+            v4_size = g_sai_db_ptr->neighbor_table_size;
+        }
+        if (!v6_size) {
+            v6_size = g_sai_db_ptr->neighbor_table_size;
+        }
+        break;
+
+    case SAI_OBJECT_TYPE_FDB_ENTRY:
+        return mlnx_switch_table_used_get(SAI_SWITCH_ATTR_AVAILABLE_FDB_ENTRY, g_sai_db_ptr->fdb_table_size, count);
+
+    default:
+        SX_LOG_ERR("Unexpected object type %d\n", object_type);
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    status = mlnx_switch_table_used_get(v4_attr, v4_size, &v4_used);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_switch_table_used_get(v6_attr, v6_size, &v6_used);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    *count = v4_used + v6_used;
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static sai_status_t mlnx_switch_available_get(_In_ const sai_object_key_t   *key,
                                               _Inout_ sai_attribute_value_t *value,
                                               _In_ uint32_t                  attr_index,
@@ -10361,18 +11224,16 @@ static sai_status_t mlnx_switch_availability_acl_get_common(_In_ sai_object_type
         return sdk_to_sai(sx_status);
     }
 
-    acl_global_lock();
+    /* ACL DB keeps the allocated counters up to date, a single counter read doesn't need the ACL lock */
     status = mlnx_acl_db_free_entries_get(object_type, &free_db_entries);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to get a number of free entries in ACL DB for resource type %d\n", object_type);
-        goto out;
+        return status;
     }
 
     *count = (uint64_t)MIN(free_acls, free_db_entries);
 
-out:
-    acl_global_unlock();
-    return status;
+    return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mlnx_switch_next_hop_availability_get(_In_ sai_object_id_t        switch_id,
@@ -10412,9 +11273,8 @@ sai_status_t mlnx_switch_bfd_session_availability_get(_In_ sai_object_id_t
 {
     assert(count);
 
-    sai_db_read_lock();
+    /* sai_object_type_get_availability() already holds the DB read lock */
     *count = (uint64_t)mlnx_shm_rm_array_free_entries_count(MLNX_SHM_RM_ARRAY_TYPE_BFD_SESSION);
-    sai_db_unlock();
 
     return SAI_STATUS_SUCCESS;
 }
@@ -11413,6 +12273,22 @@ static sai_status_t mlnx_switch_type_get(_In_ const sai_object_key_t   *key,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_switch_api_latency_stats_get(_In_ const sai_object_key_t   *key,
+                                                      _Inout_ sai_attribute_value_t *value,
+                                                      _In_ uint32_t                  attr_index,
+                                                      _Inout_ vendor_cache_t        *cache,
+                                                      void                          *arg)
+{
+    sai_status_t status;
+
+    SX_LOG_ENTER();
+
+    status = mlnx_api_stats_u32list_fill(&value->u32list);
+
+    SX_LOG_EXIT();
+    return status;
+}
+
 /**
  * @brief Remove/disconnect Switch
  *   Release all resources associated with currently opened switch
@@ -642,7 +642,7 @@ sai_status_t mlnx_tunnel_availability_get(_In_ sai_object_id_t        switch_id,
     sx_status_t        sx_status;
     sai_tunnel_type_t  tunnel_type;
     sx_tunnel_filter_t sx_tunnel_filter;
-    uint32_t           ii, sai_db_idx_start, sai_db_idx_end, specific_tunnel_type_count;
+    uint32_t           specific_tunnel_type_count;
     uint64_t           tunnels_available_sai = 0, tunnels_available_sx = 0;
     const int         *sx_tunnel_types = NULL;
 
@@ -663,15 +663,14 @@ sai_status_t mlnx_tunnel_availability_get(_In_ sai_object_id_t        switch_id,
     switch (tunnel_type) {
     case SAI_TUNNEL_TYPE_IPINIP:
     case SAI_TUNNEL_TYPE_IPINIP_GRE:
-        sai_db_idx_start = MLNX_MAX_TUNNEL_NVE;
-        sai_db_idx_end = MAX_TUNNEL_DB_SIZE;
+        tunnels_available_sai = (MAX_TUNNEL_DB_SIZE - MLNX_MAX_TUNNEL_NVE) -
+                                g_sai_tunnel_db_ptr->tunnel_db_index->used_counts[1];
         tunnels_available_sx = MLNX_MAX_TUNNEL_IPINIP;
         sx_tunnel_types = ipinip_sx_tunnel_types;
         break;
 
     case SAI_TUNNEL_TYPE_VXLAN:
-        sai_db_idx_start = 0;
-        sai_db_idx_end = MLNX_MAX_TUNNEL_NVE;
+        tunnels_available_sai = MLNX_MAX_TUNNEL_NVE - g_sai_tunnel_db_ptr->tunnel_db_index->used_counts[0];
         tunnels_available_sx = MLNX_MAX_TUNNEL_NVE;
         sx_tunnel_types = nve_sx_tunnel_types;
         break;
@@ -708,13 +707,35 @@ sai_status_t mlnx_tunnel_availability_get(_In_ sai_object_id_t        switch_id,
         tunnels_available_sx -= (uint64_t)specific_tunnel_type_count;
     }
 
-    for (ii = sai_db_idx_start; ii < sai_db_idx_end; ++ii) {
+    *count = (uint64_t)MIN(tunnels_available_sai, tunnels_available_sx);
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_tunnel_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    sai_object_key_t *key;
+    sai_status_t      status;
+    uint32_t          ii;
+
+    assert(keys);
+
+    for (ii = 0; ii < MAX_TUNNEL_DB_SIZE; ii++) {
         if (!g_sai_tunnel_db_ptr->tunnel_entry_db[ii].is_used) {
-            ++tunnels_available_sai;
+            continue;
+        }
+
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_create_object(SAI_OBJECT_TYPE_TUNNEL, ii, NULL, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
         }
     }
 
-    *count = (uint64_t)MIN(tunnels_available_sai, tunnels_available_sx);
     return SAI_STATUS_SUCCESS;
 }
 
@@ -3176,19 +3197,188 @@ static sai_status_t mlnx_convert_sx_tunneltable_type_to_sai(_In_ sx_tunnel_decap
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Tunnel DB index.
+ * The free VXLAN and IP in IP entries are kept on two free lists, so an entry is reserved without
+ * a scan of the tunnel DB. The created SDK tunnels of the used entries are hashed by the SDK tunnel
+ * id, P2P tunnels share the SDK tunnel of their main tunnel so an id may map to several entries.
+ * The hash chains link nodes - entry index * 2, + 1 for the IPv6 SDK tunnel. Free list entries and
+ * chain nodes are stored + 1, 0 is the end of a list.
+ */
+#define MLNX_TUNNEL_SX_NODE(idx, family) ((idx) * 2 + (family) + 1)
+#define MLNX_TUNNEL_SX_NODE_IDX(node)    (((node) - 1) / 2)
+#define MLNX_TUNNEL_SX_NODE_FAMILY(node) (((node) - 1) % 2)
+
+static mlnx_tunnel_db_index_entry_t* mlnx_tunnel_db_index_entry_get(_In_ uint32_t tunnel_db_idx)
+{
+    assert(tunnel_db_idx < MAX_TUNNEL_DB_SIZE);
+
+    return &g_sai_tunnel_db_ptr->tunnel_db_index_entries[tunnel_db_idx];
+}
+
+static uint32_t* mlnx_tunnel_free_head_get(_In_ bool is_nve)
+{
+    return &g_sai_tunnel_db_ptr->tunnel_db_index->free_heads[is_nve ? 0 : 1];
+}
+
+static uint32_t* mlnx_tunnel_used_count_get(_In_ bool is_nve)
+{
+    return &g_sai_tunnel_db_ptr->tunnel_db_index->used_counts[is_nve ? 0 : 1];
+}
+
+static uint32_t* mlnx_tunnel_sx_head_get(_In_ sx_tunnel_id_t sx_tunnel_id)
+{
+    uint32_t hash = mlnx_fnv1a_hash(MLNX_FNV1A_HASH_INIT, &sx_tunnel_id, sizeof(sx_tunnel_id));
+
+    return &g_sai_tunnel_db_ptr->tunnel_db_index->sx_heads[hash % MLNX_TUNNEL_SX_HASH_SIZE];
+}
+
+static uint32_t* mlnx_tunnel_sx_link_get(_In_ uint32_t node)
+{
+    return &mlnx_tunnel_db_index_entry_get(MLNX_TUNNEL_SX_NODE_IDX(node))->next_sx[MLNX_TUNNEL_SX_NODE_FAMILY(node)];
+}
+
+/*
+ *  Callers need to lock around this method
+ */
+static void mlnx_tunnel_free_list_add(_In_ uint32_t tunnel_db_idx)
+{
+    uint32_t *head = mlnx_tunnel_free_head_get(tunnel_db_idx < MLNX_MAX_TUNNEL_NVE);
+
+    mlnx_tunnel_db_index_entry_get(tunnel_db_idx)->next_free = *head;
+    *head = tunnel_db_idx + 1;
+}
+
+/*
+ *  Callers need to lock around this method
+ */
+static void mlnx_tunnel_free_list_del(_In_ uint32_t tunnel_db_idx)
+{
+    mlnx_tunnel_db_index_entry_t *index = mlnx_tunnel_db_index_entry_get(tunnel_db_idx);
+    uint32_t                     *link = mlnx_tunnel_free_head_get(tunnel_db_idx < MLNX_MAX_TUNNEL_NVE);
+
+    /* The reserved entry is the head, the walk is only for the entries marked used directly */
+    while (*link && (*link != tunnel_db_idx + 1)) {
+        link = &mlnx_tunnel_db_index_entry_get(*link - 1)->next_free;
+    }
+
+    if (*link) {
+        *link = index->next_free;
+    }
+
+    index->next_free = 0;
+}
+
+/*
+ *  Callers need to lock around this method.
+ *  Links the created SDK tunnels of a used entry to the SDK tunnel id hash and unlinks the
+ *  destroyed ones, to be called after the SDK tunnel ids or the created flags are changed.
+ */
+static void mlnx_tunnel_sx_index_sync(_In_ uint32_t tunnel_db_idx)
+{
+    const mlnx_tunnel_entry_t    *tunnel = &g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx];
+    mlnx_tunnel_db_index_entry_t *index = mlnx_tunnel_db_index_entry_get(tunnel_db_idx);
+    sx_tunnel_id_t                sx_tunnel_id[2];
+    bool                          created[2];
+    uint32_t                      family, node;
+    uint32_t                     *link;
+
+    sx_tunnel_id[0] = tunnel->sx_tunnel_id_ipv4;
+    sx_tunnel_id[1] = tunnel->sx_tunnel_id_ipv6;
+    created[0] = tunnel->is_used && tunnel->ipv4_created;
+    created[1] = tunnel->is_used && tunnel->ipv6_created;
+
+    for (family = 0; family < 2; family++) {
+        node = MLNX_TUNNEL_SX_NODE(tunnel_db_idx, family);
+
+        if (index->sx_linked[family] && (!created[family] || (index->sx_tunnel_id[family] != sx_tunnel_id[family]))) {
+            link = mlnx_tunnel_sx_head_get(index->sx_tunnel_id[family]);
+            while (*link && (*link != node)) {
+                link = mlnx_tunnel_sx_link_get(*link);
+            }
+
+            assert(*link);
+            *link = index->next_sx[family];
+            index->next_sx[family] = 0;
+            index->sx_linked[family] = false;
+        }
+
+        if (created[family] && !index->sx_linked[family]) {
+            link = mlnx_tunnel_sx_head_get(sx_tunnel_id[family]);
+            index->next_sx[family] = *link;
+            *link = node;
+            index->sx_tunnel_id[family] = sx_tunnel_id[family];
+            index->sx_linked[family] = true;
+        }
+    }
+}
+
+/* Called on the switch init when the tunnel DB is created, it is kept in the shared memory */
+void mlnx_tunnel_db_index_init(void)
+{
+    uint32_t ii;
+
+    memset(g_sai_tunnel_db_ptr->tunnel_db_index, 0, sizeof(*g_sai_tunnel_db_ptr->tunnel_db_index));
+    memset(g_sai_tunnel_db_ptr->tunnel_db_index_entries, 0,
+           sizeof(*g_sai_tunnel_db_ptr->tunnel_db_index_entries) * MAX_TUNNEL_DB_SIZE);
+
+    /* Lowest index first, as the entries used to be reserved */
+    for (ii = MAX_TUNNEL_DB_SIZE; ii > 0; ii--) {
+        if (g_sai_tunnel_db_ptr->tunnel_entry_db[ii - 1].is_used) {
+            (*mlnx_tunnel_used_count_get(ii - 1 < MLNX_MAX_TUNNEL_NVE))++;
+            mlnx_tunnel_sx_index_sync(ii - 1);
+            continue;
+        }
+
+        mlnx_tunnel_free_list_add(ii - 1);
+    }
+}
+
+/*
+ * Iterates over the tunnel DB entries with a created SDK tunnel sx_tunnel_id.
+ * *node is 0 on the first call, returns false when there are no more entries.
+ */
+bool mlnx_tunnel_db_idx_by_sx_tunnel_next(_In_ sx_tunnel_id_t sx_tunnel_id,
+                                          _Inout_ uint32_t   *node,
+                                          _Out_ uint32_t     *tunnel_db_idx)
+{
+    const mlnx_tunnel_db_index_entry_t *index;
+    uint32_t                            next;
+
+    assert(node);
+    assert(tunnel_db_idx);
+
+    next = *node ? *mlnx_tunnel_sx_link_get(*node) : *mlnx_tunnel_sx_head_get(sx_tunnel_id);
+
+    for (; next; next = *mlnx_tunnel_sx_link_get(next)) {
+        index = mlnx_tunnel_db_index_entry_get(MLNX_TUNNEL_SX_NODE_IDX(next));
+        if (index->sx_tunnel_id[MLNX_TUNNEL_SX_NODE_FAMILY(next)] == sx_tunnel_id) {
+            *node = next;
+            *tunnel_db_idx = MLNX_TUNNEL_SX_NODE_IDX(next);
+            return true;
+        }
+    }
+
+    *node = 0;
+    return false;
+}
+
 sai_status_t mlnx_translate_sdk_tunnel_id_to_sai_tunnel_id(_In_ const sx_tunnel_id_t sdk_tunnel_id,
                                                            _Out_ sai_object_id_t    *sai_tunnel_id)
 {
     sai_status_t sai_status = SAI_STATUS_FAILURE;
-    uint32_t     tunnel_idx = 0;
+    uint32_t     tunnel_idx = MAX_TUNNEL_DB_SIZE;
+    uint32_t     node = 0;
+    uint32_t     ii;
 
     SX_LOG_ENTER();
 
     sai_db_read_lock();
 
-    for (tunnel_idx = 0; tunnel_idx < MAX_TUNNEL_DB_SIZE; tunnel_idx++) {
-        if (sdk_tunnel_id == g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sx_tunnel_id_ipv4) {
-            break;
+    /* Lowest index tunnel with the IPv4 SDK tunnel */
+    while (mlnx_tunnel_db_idx_by_sx_tunnel_next(sdk_tunnel_id, &node, &ii)) {
+        if ((0 == MLNX_TUNNEL_SX_NODE_FAMILY(node)) && (ii < tunnel_idx)) {
+            tunnel_idx = ii;
         }
     }
 
@@ -3804,6 +3994,47 @@ static sai_status_t mlnx_sai_get_tunnel_ttl_data(_In_ sai_object_id_t        sai
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ *  Callers need to lock around this method
+ */
+static void mlnx_tunnel_db_entry_used_set(_In_ uint32_t tunnel_db_idx, _In_ bool is_used)
+{
+    mlnx_tunnel_entry_t *tunnel_entry;
+    uint32_t            *used_count;
+
+    assert(tunnel_db_idx < MAX_TUNNEL_DB_SIZE);
+
+    tunnel_entry = &g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx];
+    if (tunnel_entry->is_used == is_used) {
+        return;
+    }
+
+    used_count = mlnx_tunnel_used_count_get(tunnel_db_idx < MLNX_MAX_TUNNEL_NVE);
+
+    if (is_used) {
+        (*used_count)++;
+        mlnx_tunnel_free_list_del(tunnel_db_idx);
+    } else {
+        assert(*used_count > 0);
+        (*used_count)--;
+        mlnx_tunnel_free_list_add(tunnel_db_idx);
+    }
+
+    tunnel_entry->is_used = is_used;
+
+    mlnx_tunnel_sx_index_sync(tunnel_db_idx);
+}
+
+/*
+ *  Callers need to lock around this method
+ */
+static void mlnx_tunnel_db_entry_release(_In_ uint32_t tunnel_db_idx)
+{
+    mlnx_tunnel_db_entry_used_set(tunnel_db_idx, false);
+
+    memset(&g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx], 0, sizeof(mlnx_tunnel_entry_t));
+}
+
 /*
  *  Callers need to lock around this method
  */
@@ -3811,8 +4042,7 @@ static sai_status_t mlnx_sai_reserve_tunnel_db_item(_In_ sai_tunnel_type_t sai_t
                                                     _Out_ uint32_t        *tunnel_db_idx)
 {
     uint32_t ii;
-    uint32_t idx_start = 0;
-    uint32_t idx_end = MAX_TUNNEL_DB_SIZE;
+    uint32_t free_head = 0;
 
     SX_LOG_ENTER();
 
@@ -3825,13 +4055,11 @@ static sai_status_t mlnx_sai_reserve_tunnel_db_item(_In_ sai_tunnel_type_t sai_t
     switch (sai_tunnel_type) {
     case SAI_TUNNEL_TYPE_IPINIP:
     case SAI_TUNNEL_TYPE_IPINIP_GRE:
-        idx_start = MLNX_MAX_TUNNEL_NVE;
-        idx_end = MAX_TUNNEL_DB_SIZE;
+        free_head = *mlnx_tunnel_free_head_get(false);
         break;
 
     case SAI_TUNNEL_TYPE_VXLAN:
-        idx_start = 0;
-        idx_end = MLNX_MAX_TUNNEL_NVE;
+        free_head = *mlnx_tunnel_free_head_get(true);
         break;
 
     default:
@@ -3840,17 +4068,19 @@ static sai_status_t mlnx_sai_reserve_tunnel_db_item(_In_ sai_tunnel_type_t sai_t
         return SAI_STATUS_FAILURE;
     }
 
-    for (ii = idx_start; ii < idx_end; ii++) {
-        if (!g_sai_tunnel_db_ptr->tunnel_entry_db[ii].is_used) {
-            g_sai_tunnel_db_ptr->tunnel_entry_db[ii].is_used = true;
-            *tunnel_db_idx = ii;
-            SX_LOG_DBG("tunnel db: reserved slot:%d\n", ii);
-            SX_LOG_EXIT();
-            return SAI_STATUS_SUCCESS;
-        }
+    if (!free_head) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_TABLE_FULL;
     }
+
+    ii = free_head - 1;
+    assert(!g_sai_tunnel_db_ptr->tunnel_entry_db[ii].is_used);
+
+    mlnx_tunnel_db_entry_used_set(ii, true);
+    *tunnel_db_idx = ii;
+    SX_LOG_DBG("tunnel db: reserved slot:%d\n", ii);
     SX_LOG_EXIT();
-    return SAI_STATUS_TABLE_FULL;
+    return SAI_STATUS_SUCCESS;
 }
 
 /*
@@ -4708,6 +4938,7 @@ static sai_status_t mlnx_sdk_fill_ipinip_p2p_attrib(_In_ uint32_t
                 g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv6_created
                     = g_sai_tunnel_db_ptr->tunnel_entry_db[ii].ipv6_created;
                 g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].is_main_tunnel = false;
+                mlnx_tunnel_sx_index_sync(tunnel_db_idx);
                 g_sai_tunnel_db_ptr->tunnel_entry_db[ii].ipip_tunnel_p2p_refcnt++;
                 *main_tunnel_found = true;
                 SX_LOG_NTC("found ip-in-ip P2P tunnel, just return \n");
@@ -4993,6 +5224,203 @@ static sai_status_t mlnx_sai_fill_sx_ipinip_p2p_tunnel_data(_In_ uint32_t
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * The in use tunnel map entries are indexed by (map type, key) and by (map type, value) so the
+ * VNI <-> VRF / VLAN / bridge resolutions probe one hash chain instead of scanning the entry DB.
+ * The key and value are create only, an entry is linked when it is set in use and unlinked
+ * before it is cleared.
+ */
+static void mlnx_tunnel_map_entry_key_value_get(_In_ const mlnx_tunnel_map_entry_t *entry,
+                                                _Out_ uint64_t                     *key,
+                                                _Out_ uint64_t                     *value)
+{
+    switch (entry->tunnel_map_type) {
+    case SAI_TUNNEL_MAP_TYPE_OECN_TO_UECN:
+        *key = entry->oecn_key;
+        *value = entry->uecn_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_UECN_OECN_TO_OECN:
+        *key = ((uint64_t)entry->uecn_key << 8) | entry->oecn_key;
+        *value = entry->oecn_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_VLAN_ID:
+        *key = entry->vni_id_key;
+        *value = entry->vlan_id_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_VLAN_ID_TO_VNI:
+        *key = entry->vlan_id_key;
+        *value = entry->vni_id_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF:
+        *key = entry->vni_id_key;
+        *value = entry->bridge_id_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI:
+        *key = entry->bridge_id_key;
+        *value = entry->vni_id_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID:
+        *key = entry->vni_id_key;
+        *value = entry->vr_id_value;
+        break;
+
+    case SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI:
+        *key = entry->vr_id_key;
+        *value = entry->vni_id_value;
+        break;
+
+    default:
+        *key = 0;
+        *value = 0;
+        break;
+    }
+}
+
+/* The map type and the key or value */
+static uint32_t mlnx_tunnel_map_entry_hash(_In_ sai_tunnel_map_type_t type, _In_ uint64_t field)
+{
+    uint32_t hash = MLNX_FNV1A_HASH_INIT;
+    uint32_t type_u32 = type;
+
+    hash = mlnx_fnv1a_hash(hash, &type_u32, sizeof(type_u32));
+    hash = mlnx_fnv1a_hash(hash, &field, sizeof(field));
+
+    return hash % MLNX_TUNNEL_MAP_ENTRY_HASH_SIZE;
+}
+
+static uint32_t* mlnx_tunnel_map_entry_hash_head_get(_In_ sai_tunnel_map_type_t type,
+                                                     _In_ uint64_t              field,
+                                                     _In_ bool                  is_key)
+{
+    mlnx_tunnel_map_entry_hash_t *hash = g_sai_tunnel_db_ptr->tunnel_map_entry_hash;
+
+    return is_key ? &hash->key_heads[mlnx_tunnel_map_entry_hash(type, field)] :
+           &hash->value_heads[mlnx_tunnel_map_entry_hash(type, field)];
+}
+
+static uint32_t* mlnx_tunnel_map_entry_hash_link_get(_In_ uint32_t idx, _In_ bool is_key)
+{
+    mlnx_tunnel_map_entry_t *entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx];
+
+    return is_key ? &entry->next_key_hash_idx : &entry->next_value_hash_idx;
+}
+
+/* DB write lock is needed */
+static void mlnx_tunnel_map_entry_hash_add(_In_ uint32_t idx)
+{
+    const mlnx_tunnel_map_entry_t *entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx];
+    uint64_t                       key, value;
+    uint32_t                      *head;
+
+    assert((MLNX_TUNNEL_MAP_ENTRY_MIN <= idx) && (MLNX_TUNNEL_MAP_ENTRY_MAX > idx));
+
+    mlnx_tunnel_map_entry_key_value_get(entry, &key, &value);
+
+    head = mlnx_tunnel_map_entry_hash_head_get(entry->tunnel_map_type, key, true);
+    *mlnx_tunnel_map_entry_hash_link_get(idx, true) = *head;
+    *head = idx;
+
+    head = mlnx_tunnel_map_entry_hash_head_get(entry->tunnel_map_type, value, false);
+    *mlnx_tunnel_map_entry_hash_link_get(idx, false) = *head;
+    *head = idx;
+}
+
+static void mlnx_tunnel_map_entry_hash_chain_del(_In_ uint32_t              idx,
+                                                 _In_ sai_tunnel_map_type_t type,
+                                                 _In_ uint64_t              field,
+                                                 _In_ bool                  is_key)
+{
+    uint32_t *link = mlnx_tunnel_map_entry_hash_head_get(type, field, is_key);
+
+    while ((MLNX_TUNNEL_MAP_ENTRY_INVALID != *link) && (idx != *link)) {
+        link = mlnx_tunnel_map_entry_hash_link_get(*link, is_key);
+    }
+
+    /* Not linked if the entry is released on create before it is set */
+    if (MLNX_TUNNEL_MAP_ENTRY_INVALID != *link) {
+        *link = *mlnx_tunnel_map_entry_hash_link_get(idx, is_key);
+    }
+
+    *mlnx_tunnel_map_entry_hash_link_get(idx, is_key) = MLNX_TUNNEL_MAP_ENTRY_INVALID;
+}
+
+/* DB write lock is needed */
+static void mlnx_tunnel_map_entry_hash_del(_In_ uint32_t idx)
+{
+    const mlnx_tunnel_map_entry_t *entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx];
+    uint64_t                       key, value;
+
+    assert((MLNX_TUNNEL_MAP_ENTRY_MIN <= idx) && (MLNX_TUNNEL_MAP_ENTRY_MAX > idx));
+
+    mlnx_tunnel_map_entry_key_value_get(entry, &key, &value);
+
+    mlnx_tunnel_map_entry_hash_chain_del(idx, entry->tunnel_map_type, key, true);
+    mlnx_tunnel_map_entry_hash_chain_del(idx, entry->tunnel_map_type, value, false);
+}
+
+/*
+ * DB read lock is needed.
+ * Next in use entry of the map type with the key (is_key) or the value after idx on its hash chain,
+ * the first one for MLNX_TUNNEL_MAP_ENTRY_INVALID. Returns MLNX_TUNNEL_MAP_ENTRY_INVALID at the end.
+ */
+static uint32_t mlnx_tunnel_map_entry_hash_next(_In_ uint32_t              idx,
+                                                _In_ sai_tunnel_map_type_t type,
+                                                _In_ uint64_t              field,
+                                                _In_ bool                  is_key)
+{
+    const mlnx_tunnel_map_entry_t *entry;
+    uint64_t                       key, value;
+
+    if (MLNX_TUNNEL_MAP_ENTRY_INVALID == idx) {
+        idx = *mlnx_tunnel_map_entry_hash_head_get(type, field, is_key);
+    } else {
+        idx = *mlnx_tunnel_map_entry_hash_link_get(idx, is_key);
+    }
+
+    for (; MLNX_TUNNEL_MAP_ENTRY_INVALID != idx; idx = *mlnx_tunnel_map_entry_hash_link_get(idx, is_key)) {
+        entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[idx];
+        if (!entry->in_use || (type != entry->tunnel_map_type)) {
+            continue;
+        }
+
+        mlnx_tunnel_map_entry_key_value_get(entry, &key, &value);
+        if (field == (is_key ? key : value)) {
+            return idx;
+        }
+    }
+
+    return MLNX_TUNNEL_MAP_ENTRY_INVALID;
+}
+
+/*
+ * DB read lock is needed.
+ * Lowest index in use entry of the map type with the key (is_key) or the value - the entry the
+ * scan of the entry DB used to find. Returns MLNX_TUNNEL_MAP_ENTRY_INVALID if there is none.
+ */
+static uint32_t mlnx_tunnel_map_entry_hash_find(_In_ sai_tunnel_map_type_t type,
+                                                _In_ uint64_t              field,
+                                                _In_ bool                  is_key)
+{
+    uint32_t found = MLNX_TUNNEL_MAP_ENTRY_INVALID;
+    uint32_t idx;
+
+    for (idx = mlnx_tunnel_map_entry_hash_next(MLNX_TUNNEL_MAP_ENTRY_INVALID, type, field, is_key);
+         MLNX_TUNNEL_MAP_ENTRY_INVALID != idx;
+         idx = mlnx_tunnel_map_entry_hash_next(idx, type, field, is_key)) {
+        if ((MLNX_TUNNEL_MAP_ENTRY_INVALID == found) || (idx < found)) {
+            found = idx;
+        }
+    }
+
+    return found;
+}
+
 /* This function needs to be guarded by lock */
 static sai_status_t mlnx_sai_tunnel_1Qbridge_get(_Out_ sx_bridge_id_t *sx_bridge_id)
 {
@@ -5128,25 +5556,14 @@ sai_status_t mlnx_vrid_to_br_rif_get(_In_ sx_router_id_t          sx_vrid,
     }
 
     /* Get VR ID to VNI map */
-    for (ii = 0; ii < MLNX_TUNNEL_MAP_ENTRY_MAX; ii++) {
-        curr_tunnel_map_entry = &(g_sai_tunnel_db_ptr->tunnel_map_entry_db[ii]);
-        if (NULL == curr_tunnel_map_entry) {
-            SX_LOG_ERR("Tunnel map entry %d is empty\n", ii);
-            SX_LOG_EXIT();
-            return SAI_STATUS_FAILURE;
-        }
-        if (curr_tunnel_map_entry->in_use &&
-            (SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI == curr_tunnel_map_entry->tunnel_map_type) &&
-            (vr_oid == curr_tunnel_map_entry->vr_id_key)) {
-            vni_id = curr_tunnel_map_entry->vni_id_value;
-            break;
-        }
-    }
-    if (MLNX_TUNNEL_MAP_ENTRY_MAX == ii) {
+    ii = mlnx_tunnel_map_entry_hash_find(SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI, vr_oid, true);
+    if (MLNX_TUNNEL_MAP_ENTRY_INVALID == ii) {
         SX_LOG_ERR("Failed to find vr oid key %" PRIx64 " in SAI tunnel map entry db\n", vr_oid);
         SX_LOG_EXIT();
         return SAI_STATUS_FAILURE;
     }
+    curr_tunnel_map_entry = &(g_sai_tunnel_db_ptr->tunnel_map_entry_db[ii]);
+    vni_id = curr_tunnel_map_entry->vni_id_value;
 
     sai_status = mlnx_is_tunnel_map_entry_bound_to_tunnel(sx_vxlan_tunnel,
                                                           ii,
@@ -5514,15 +5931,18 @@ static sai_status_t mlnx_sai_tunnel_map_entry_find_pair(_In_ uint32_t   tunnel_m
                                                         _Out_ bool     *pair_exist,
                                                         _Out_ uint32_t *pair_map_idx)
 {
-    mlnx_tunnel_map_entry_t curr_tunnel_map_entry;
-    mlnx_tunnel_map_entry_t pair_tunnel_map_entry;
-    mlnx_tunnel_map_t       curr_tunnel_map;
-    sai_status_t            sai_status;
-    uint32_t                opposite_dir_tunnel_map_cnt = 0;
-    sai_object_id_t        *opposite_dir_tunnel_map_array;
-    uint32_t                ii = 0;
-    uint32_t                jj = 0;
-    sai_object_id_t         tunnel_map_oid;
+    mlnx_tunnel_map_entry_t        curr_tunnel_map_entry;
+    const mlnx_tunnel_map_entry_t *pair_tunnel_map_entry;
+    sai_tunnel_map_type_t          pair_tunnel_map_type;
+    uint64_t                       key, value, pair_key, pair_value;
+    uint32_t                       opposite_dir_tunnel_map_cnt = 0;
+    sai_object_id_t               *opposite_dir_tunnel_map_array;
+    uint32_t                       pair_map_pos = MLNX_TUNNEL_MAP_MAX;
+    uint32_t                       pair_map_matches = 0;
+    uint32_t                       tunnel_map_idx = 0;
+    sai_status_t                   sai_status;
+    uint32_t                       ii = 0;
+    uint32_t                       jj = 0;
 
     SX_LOG_ENTER();
 
@@ -5536,17 +5956,27 @@ static sai_status_t mlnx_sai_tunnel_map_entry_find_pair(_In_ uint32_t   tunnel_m
 
     switch (curr_tunnel_map_entry.tunnel_map_type) {
     case SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF:
+        pair_tunnel_map_type = SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI;
+        break;
+
     case SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID:
+        pair_tunnel_map_type = SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI;
+        break;
+
     case SAI_TUNNEL_MAP_TYPE_VNI_TO_VLAN_ID:
-        opposite_dir_tunnel_map_cnt = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_encap_cnt;
-        opposite_dir_tunnel_map_array = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_encap_id_array;
+        pair_tunnel_map_type = SAI_TUNNEL_MAP_TYPE_VLAN_ID_TO_VNI;
         break;
 
     case SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI:
+        pair_tunnel_map_type = SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF;
+        break;
+
     case SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI:
+        pair_tunnel_map_type = SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID;
+        break;
+
     case SAI_TUNNEL_MAP_TYPE_VLAN_ID_TO_VNI:
-        opposite_dir_tunnel_map_cnt = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_decap_cnt;
-        opposite_dir_tunnel_map_array = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_decap_id_array;
+        pair_tunnel_map_type = SAI_TUNNEL_MAP_TYPE_VNI_TO_VLAN_ID;
         break;
 
     default:
@@ -5558,73 +5988,82 @@ static sai_status_t mlnx_sai_tunnel_map_entry_find_pair(_In_ uint32_t   tunnel_m
         return SAI_STATUS_SUCCESS;
     }
 
-    for (ii = 0; ii < opposite_dir_tunnel_map_cnt; ii++) {
-        tunnel_map_oid = opposite_dir_tunnel_map_array[ii];
+    switch (curr_tunnel_map_entry.tunnel_map_type) {
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF:
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID:
+    case SAI_TUNNEL_MAP_TYPE_VNI_TO_VLAN_ID:
+        opposite_dir_tunnel_map_cnt = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_encap_cnt;
+        opposite_dir_tunnel_map_array = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_encap_id_array;
+        break;
 
-        if (SAI_STATUS_SUCCESS !=
-            (sai_status = mlnx_tunnel_map_db_param_get(tunnel_map_oid, &curr_tunnel_map))) {
-            SX_LOG_ERR("Fail to get mlnx tunnel map for tunnel map obj id %" PRIx64 "\n", tunnel_map_oid);
-            SX_LOG_EXIT();
-            return sai_status;
+    default:
+        opposite_dir_tunnel_map_cnt = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_decap_cnt;
+        opposite_dir_tunnel_map_array = g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_idx].sai_tunnel_map_decap_id_array;
+        break;
+    }
+
+    /* The pair maps the value of the entry back to its key */
+    mlnx_tunnel_map_entry_key_value_get(&curr_tunnel_map_entry, &key, &value);
+
+    for (jj = mlnx_tunnel_map_entry_hash_next(MLNX_TUNNEL_MAP_ENTRY_INVALID, pair_tunnel_map_type, value, true);
+         MLNX_TUNNEL_MAP_ENTRY_INVALID != jj;
+         jj = mlnx_tunnel_map_entry_hash_next(jj, pair_tunnel_map_type, value, true)) {
+        pair_tunnel_map_entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj];
+        mlnx_tunnel_map_entry_key_value_get(pair_tunnel_map_entry, &pair_key, &pair_value);
+        if (key != pair_value) {
+            continue;
         }
-        for (jj = curr_tunnel_map.tunnel_map_entry_head_idx;
-             jj != MLNX_TUNNEL_MAP_ENTRY_INVALID;
-             jj = g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj].next_tunnel_map_entry_idx) {
-            memcpy(&pair_tunnel_map_entry, &g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj],
-                   sizeof(pair_tunnel_map_entry));
-            assert(pair_tunnel_map_entry.in_use);
-
-            if (SAI_TUNNEL_MAP_TYPE_VNI_TO_BRIDGE_IF == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.bridge_id_value == pair_tunnel_map_entry.bridge_id_key) &&
-                    (curr_tunnel_map_entry.vni_id_key == pair_tunnel_map_entry.vni_id_value)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
-            } else if (SAI_TUNNEL_MAP_TYPE_BRIDGE_IF_TO_VNI == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.bridge_id_key == pair_tunnel_map_entry.bridge_id_value) &&
-                    (curr_tunnel_map_entry.vni_id_value == pair_tunnel_map_entry.vni_id_key)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
-            } else if (SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.vr_id_value == pair_tunnel_map_entry.vr_id_key) &&
-                    (curr_tunnel_map_entry.vni_id_key == pair_tunnel_map_entry.vni_id_value)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
-            } else if (SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.vr_id_key == pair_tunnel_map_entry.vr_id_value) &&
-                    (curr_tunnel_map_entry.vni_id_value == pair_tunnel_map_entry.vni_id_key)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
-            } else if (SAI_TUNNEL_MAP_TYPE_VNI_TO_VLAN_ID == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.vlan_id_value == pair_tunnel_map_entry.vlan_id_key) &&
-                    (curr_tunnel_map_entry.vni_id_key == pair_tunnel_map_entry.vni_id_value)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
-            } else if (SAI_TUNNEL_MAP_TYPE_VLAN_ID_TO_VNI == curr_tunnel_map_entry.tunnel_map_type) {
-                if ((curr_tunnel_map_entry.vlan_id_key == pair_tunnel_map_entry.vlan_id_value) &&
-                    (curr_tunnel_map_entry.vni_id_value == pair_tunnel_map_entry.vni_id_key)) {
-                    *pair_map_idx = jj;
-                    *pair_exist = true;
-                    SX_LOG_EXIT();
-                    return SAI_STATUS_SUCCESS;
-                }
+
+        /* The first pair in the order of the opposite direction maps */
+        for (ii = 0; ii < opposite_dir_tunnel_map_cnt; ii++) {
+            if (opposite_dir_tunnel_map_array[ii] == pair_tunnel_map_entry->tunnel_map_id) {
+                break;
             }
         }
+        if ((ii == opposite_dir_tunnel_map_cnt) || (ii > pair_map_pos)) {
+            continue;
+        }
+
+        if (ii == pair_map_pos) {
+            pair_map_matches++;
+            continue;
+        }
+
+        pair_map_pos = ii;
+        pair_map_matches = 1;
+        *pair_map_idx = jj;
+        *pair_exist = true;
     }
+
+    if (pair_map_matches <= 1) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /* Several pairs in the same map - the first one in the entry list of the map (creation order) */
+    sai_status = mlnx_get_sai_tunnel_map_db_idx(opposite_dir_tunnel_map_array[pair_map_pos], &tunnel_map_idx);
+    if (SAI_ERR(sai_status)) {
+        SX_LOG_ERR("Error getting tunnel map idx from tunnel map oid %" PRIx64 "\n",
+                   opposite_dir_tunnel_map_array[pair_map_pos]);
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+
+    for (jj = g_sai_tunnel_db_ptr->tunnel_map_db[tunnel_map_idx].tunnel_map_entry_head_idx;
+         MLNX_TUNNEL_MAP_ENTRY_INVALID != jj;
+         jj = g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj].next_tunnel_map_entry_idx) {
+        pair_tunnel_map_entry = &g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj];
+        if (pair_tunnel_map_type != pair_tunnel_map_entry->tunnel_map_type) {
+            continue;
+        }
+
+        mlnx_tunnel_map_entry_key_value_get(pair_tunnel_map_entry, &pair_key, &pair_value);
+        if ((value == pair_key) && (key == pair_value)) {
+            *pair_map_idx = jj;
+            break;
+        }
+    }
+
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -6760,6 +7199,7 @@ static sai_status_t mlnx_create_sdk_tunnel(_In_ sai_object_id_t      sai_tunnel_
 
     g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv4_created = true;
     g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].sx_tunnel_id_ipv4 = sx_tunnel_id_ipv4;
+    mlnx_tunnel_sx_index_sync(tunnel_db_idx);
     g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].is_main_tunnel = true;
     g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipip_tunnel_p2p_refcnt++;
     sdk_tunnel_ipv4_created = true;
@@ -7020,6 +7460,7 @@ static sai_status_t mlnx_create_sdk_tunnel(_In_ sai_object_id_t      sai_tunnel_
             g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].sx_overlay_rif_ipv6 = sx_overlay_rif_ipv6;
         }
     }
+    mlnx_tunnel_sx_index_sync(tunnel_db_idx);
 
 
     SX_LOG_EXIT();
@@ -7066,6 +7507,7 @@ cleanup:
         }
 
         g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv6_created = false;
+        mlnx_tunnel_sx_index_sync(tunnel_db_idx);
     }
 
     if (sdk_tunnel_ipv4_created) {
@@ -7079,6 +7521,7 @@ cleanup:
                            sdk_status));
         }
         g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv4_created = false;
+        mlnx_tunnel_sx_index_sync(tunnel_db_idx);
     }
 
     SX_LOG_EXIT();
@@ -7147,6 +7590,7 @@ static sai_status_t mlnx_remove_sdk_ipinip_tunnel(_In_ uint32_t tunnel_db_idx)
             }
 
             g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv6_created = false;
+            mlnx_tunnel_sx_index_sync(tunnel_db_idx);
         }
 
         if (g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv4_created) {
@@ -7186,6 +7630,7 @@ static sai_status_t mlnx_remove_sdk_ipinip_tunnel(_In_ uint32_t tunnel_db_idx)
                 goto cleanup;
             }
             g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv4_created = false;
+            mlnx_tunnel_sx_index_sync(tunnel_db_idx);
         }
     }
 
@@ -7571,7 +8016,7 @@ cleanup:
                 SX_LOG_ERR("tunnel db index: %d out of bounds:%d\n", tunnel_db_idx, MAX_TUNNEL_DB_SIZE);
                 status = SAI_STATUS_FAILURE;
             } else {
-                memset(&g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx], 0, sizeof(mlnx_tunnel_entry_t));
+                mlnx_tunnel_db_entry_release(tunnel_db_idx);
             }
         }
     }
@@ -7763,7 +8208,7 @@ static sai_status_t mlnx_remove_tunnel(_In_ const sai_object_id_t sai_tunnel_obj
                 sai_status = SAI_STATUS_FAILURE;
                 goto cleanup;
             }
-            g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].is_used = false;
+            mlnx_tunnel_db_entry_used_set(tunnel_db_idx, false);
             g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv4_created = false;
             g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].ipv6_created = false;
             g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx].sx_tunnel_id_ipv4 = 0;
@@ -8000,7 +8445,7 @@ static sai_status_t mlnx_remove_tunnel(_In_ const sai_object_id_t sai_tunnel_obj
         }
     }
 
-    memset(&g_sai_tunnel_db_ptr->tunnel_entry_db[tunnel_db_idx], 0, sizeof(mlnx_tunnel_entry_t));
+    mlnx_tunnel_db_entry_release(tunnel_db_idx);
 
     sai_status = SAI_STATUS_SUCCESS;
 
@@ -9358,6 +9803,7 @@ static sai_status_t mlnx_create_tunnel_map_entry(_Out_ sai_object_id_t      *sai
 
     memcpy(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], &mlnx_tunnel_map_entry,
            sizeof(mlnx_tunnel_map_entry_t));
+    mlnx_tunnel_map_entry_hash_add(tunnel_map_entry_idx);
 
     if (SAI_STATUS_SUCCESS !=
         (status =
@@ -9399,6 +9845,7 @@ cleanup:
         }
     }
     if (tunnel_map_entry_created) {
+        mlnx_tunnel_map_entry_hash_del(tunnel_map_entry_idx);
         memset(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], 0,
                sizeof(mlnx_tunnel_map_entry_t));
     }
@@ -9494,6 +9941,7 @@ static sai_status_t mlnx_remove_tunnel_map_entry(_In_ sai_object_id_t sai_tunnel
         }
     }
 
+    mlnx_tunnel_map_entry_hash_del(tunnel_map_entry_idx);
     memset(&g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx], 0, sizeof(mlnx_tunnel_map_entry_t));
 
     sai_status = SAI_STATUS_SUCCESS;
@@ -9513,13 +9961,12 @@ static sai_status_t mlnx_tunnel_get_bmtor_entry_idx(_In_ sai_object_id_t tunnel_
     sai_status_t             sai_status;
     sx_tunnel_id_t           sx_vxlan_tunnel;
     mlnx_tunnel_map_entry_t *curr_tunnel_map_entry;
-    uint32_t                 ii = 0;
+    sai_tunnel_map_type_t    tunnel_map_type;
+    uint32_t                 ii = MLNX_TUNNEL_MAP_ENTRY_INVALID;
+    uint32_t                 jj = 0;
+    uint32_t                 kk = 0;
     uint32_t                 curr_bmtor_bridge_db_idx = 0;
     uint32_t                 tunnel_idx = 0;
-    bool                     vrf_key_match = false;
-    bool                     vrf_value_match = false;
-    bool                     vni_key_match = false;
-    bool                     vni_value_match = false;
 
     SX_LOG_ENTER();
 
@@ -9545,22 +9992,16 @@ static sai_status_t mlnx_tunnel_get_bmtor_entry_idx(_In_ sai_object_id_t tunnel_
         SX_LOG_DBG("Failed to find tunnel idx from SAI tunnel oid %" PRIx64 "\n", tunnel_id);
     }
 
-    /* Get VR ID to VNI map */
-    for (ii = 0; ii < MLNX_TUNNEL_MAP_ENTRY_MAX; ii++) {
-        curr_tunnel_map_entry = &(g_sai_tunnel_db_ptr->tunnel_map_entry_db[ii]);
-        if (NULL == curr_tunnel_map_entry) {
-            SX_LOG_DBG("Tunnel map entry %d is empty\n", ii);
-            SX_LOG_EXIT();
-            return SAI_STATUS_FAILURE;
-        }
-        if (0 == vni) {
-            vrf_key_match = (SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI == curr_tunnel_map_entry->tunnel_map_type) &&
-                            (vrf == curr_tunnel_map_entry->vr_id_key);
-            vrf_value_match =
-                (SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID == curr_tunnel_map_entry->tunnel_map_type) &&
-                (vrf == curr_tunnel_map_entry->vr_id_value);
-            if (curr_tunnel_map_entry->in_use &&
-                (vrf_key_match || vrf_value_match)) {
+    /* Get VR ID to VNI map, the lowest index entry which matches as the scan of the entry DB used to */
+    if (0 == vni) {
+        /* VR ID to VNI entries with the VRF key and VNI to VR ID entries with the VRF value */
+        for (kk = 0; kk < 2; kk++) {
+            tunnel_map_type = (0 == kk) ? SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI :
+                              SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID;
+            for (jj = mlnx_tunnel_map_entry_hash_next(MLNX_TUNNEL_MAP_ENTRY_INVALID, tunnel_map_type, vrf, 0 == kk);
+                 MLNX_TUNNEL_MAP_ENTRY_INVALID != jj;
+                 jj = mlnx_tunnel_map_entry_hash_next(jj, tunnel_map_type, vrf, 0 == kk)) {
+                curr_tunnel_map_entry = &(g_sai_tunnel_db_ptr->tunnel_map_entry_db[jj]);
                 curr_bmtor_bridge_db_idx = curr_tunnel_map_entry->pair_per_vxlan_array[tunnel_idx].bmtor_bridge_db_idx;
                 if (MLNX_BMTOR_BRIDGE_MAX <= curr_bmtor_bridge_db_idx) {
                     SX_LOG_DBG("bmtor bridge db idx %d should be smaller than limit %d\n",
@@ -9569,27 +10010,25 @@ static sai_status_t mlnx_tunnel_get_bmtor_entry_idx(_In_ sai_object_id_t tunnel_
                     return SAI_STATUS_FAILURE;
                 }
 
-                if (g_sai_tunnel_db_ptr->bmtor_bridge_db[curr_bmtor_bridge_db_idx].is_default) {
-                    break;
+                if (g_sai_tunnel_db_ptr->bmtor_bridge_db[curr_bmtor_bridge_db_idx].is_default &&
+                    ((MLNX_TUNNEL_MAP_ENTRY_INVALID == ii) || (jj < ii))) {
+                    ii = jj;
                 }
             }
-        } else {
-            vni_key_match = (SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID == curr_tunnel_map_entry->tunnel_map_type) &&
-                            (vni == curr_tunnel_map_entry->vni_id_key);
-            vni_value_match =
-                (SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI == curr_tunnel_map_entry->tunnel_map_type) &&
-                (vni == curr_tunnel_map_entry->vni_id_value);
-            if (curr_tunnel_map_entry->in_use &&
-                (vni_key_match || vni_value_match)) {
-                break;
-            }
+        }
+    } else {
+        ii = mlnx_tunnel_map_entry_hash_find(SAI_TUNNEL_MAP_TYPE_VNI_TO_VIRTUAL_ROUTER_ID, vni, true);
+        jj = mlnx_tunnel_map_entry_hash_find(SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI, vni, false);
+        if ((MLNX_TUNNEL_MAP_ENTRY_INVALID == ii) || ((MLNX_TUNNEL_MAP_ENTRY_INVALID != jj) && (jj < ii))) {
+            ii = jj;
         }
     }
-    if (MLNX_TUNNEL_MAP_ENTRY_MAX == ii) {
+    if (MLNX_TUNNEL_MAP_ENTRY_INVALID == ii) {
         SX_LOG_DBG("Failed to find vr oid key %" PRIx64 " in SAI tunnel map entry db\n", vrf);
         SX_LOG_EXIT();
         return SAI_STATUS_FAILURE;
     }
+    curr_tunnel_map_entry = &(g_sai_tunnel_db_ptr->tunnel_map_entry_db[ii]);
 
     /* Get VNI to bridge */
     curr_bmtor_bridge_db_idx = curr_tunnel_map_entry->pair_per_vxlan_array[tunnel_idx].bmtor_bridge_db_idx;
@@ -9747,6 +10186,7 @@ sai_status_t mlnx_tunnel_bridge_counter_update(_In_ sai_object_id_t tunnel_id,
             SAI_TUNNEL_MAP_TYPE_VIRTUAL_ROUTER_ID_TO_VNI;
         g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx].vr_id_key = vrf;
         g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx].vni_id_value = vni;
+        mlnx_tunnel_map_entry_hash_add(tunnel_map_entry_idx);
     } else {
         memcpy(&bmtor_bridge_entry, &(g_sai_tunnel_db_ptr->bmtor_bridge_db[bmtor_bridge_db_idx]),
                sizeof(bmtor_bridge_entry));
@@ -9778,6 +10218,7 @@ sai_status_t mlnx_tunnel_bridge_counter_update(_In_ sai_object_id_t tunnel_id,
         g_sai_tunnel_db_ptr->bmtor_bridge_db[bmtor_bridge_db_idx].in_use
             = false;
         if (0 != vni) {
+            mlnx_tunnel_map_entry_hash_del(tunnel_map_entry_idx);
             g_sai_tunnel_db_ptr->tunnel_map_entry_db[tunnel_map_entry_idx].in_use = false;
         }
     }
@@ -1912,12 +1912,12 @@ static sai_status_t get_dispatch_attribs_handler(_In_ uint32_t
                                                  _In_ sai_object_type_t                   object_type,
                                                  _In_ const sai_vendor_attribute_entry_t *functionality_vendor_attr,
                                                  _In_ const sai_object_key_t             *key,
-                                                 _In_ const char                         *key_str)
+                                                 _In_ const char                         *key_str,
+                                                 _Inout_ vendor_cache_t                  *cache)
 {
     sai_status_t               status;
     sai_attr_id_t              attr_id;
     uint32_t                   ii, index;
-    vendor_cache_t             cache;
     const sai_attr_metadata_t *meta_data;
     const char                *short_attr_name;
     void                      *vendor_getter_arg;
@@ -1936,8 +1936,6 @@ static sai_status_t get_dispatch_attribs_handler(_In_ uint32_t
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    memset(&cache, 0, sizeof(cache));
-
     for (ii = 0; ii < attr_count; ii++) {
         attr_id = attr_list[ii].id;
 
@@ -1991,7 +1989,7 @@ static sai_status_t get_dispatch_attribs_handler(_In_ uint32_t
                short_attr_name,
                key_str);
 
-        status = functionality_vendor_attr[index].getter(key, &(attr_list[ii].value), ii, &cache,
+        status = functionality_vendor_attr[index].getter(key, &(attr_list[ii].value), ii, cache,
                                                          vendor_getter_arg);
         if (SAI_ERR(status)) {
             if (MLNX_SAI_STATUS_BUFFER_OVERFLOW_EMPTY_LIST == status) {
@@ -2074,9 +2072,9 @@ sai_status_t find_attrib_in_list(_In_ uint32_t                       attr_count,
     return SAI_STATUS_ITEM_NOT_FOUND;
 }
 
-sai_status_t sai_set_attribute(_In_ const sai_object_key_t *key,
-                               _In_ sai_object_type_t       object_type,
-                               _In_ const sai_attribute_t  *attr)
+static sai_status_t sai_set_attribute_impl(_In_ const sai_object_key_t *key,
+                                           _In_ sai_object_type_t       object_type,
+                                           _In_ const sai_attribute_t  *attr)
 {
     sai_status_t status;
     char         key_str[MAX_KEY_STR_LEN];
@@ -2125,13 +2123,14 @@ sai_status_t sai_set_attribute(_In_ const sai_object_key_t *key,
     return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t sai_get_attributes(_In_ const sai_object_key_t *key,
-                                _In_ sai_object_type_t       object_type,
-                                _In_ uint32_t                attr_count,
-                                _Inout_ sai_attribute_t     *attr_list)
+static sai_status_t sai_get_attributes_impl(_In_ const sai_object_key_t *key,
+                                            _In_ sai_object_type_t       object_type,
+                                            _In_ uint32_t                attr_count,
+                                            _Inout_ sai_attribute_t     *attr_list)
 {
-    sai_status_t status;
-    char         key_str[MAX_KEY_STR_LEN];
+    sai_status_t   status;
+    char           key_str[MAX_KEY_STR_LEN];
+    vendor_cache_t cache;
 
     if (!key) {
         SX_LOG_ERR("Key is NULL");
@@ -2156,6 +2155,7 @@ sai_status_t sai_get_attributes(_In_ const sai_object_key_t *key,
     const sai_vendor_attribute_entry_t *vendor_data = mlnx_obj_types_info[object_type]->vendor_data;
 
     key_to_str(key, object_type, key_str);
+    memset(&cache, 0, sizeof(cache));
 
 
     status = check_attribs_metadata(attr_count, attr_list, object_type, vendor_data, SAI_COMMON_API_GET);
@@ -2169,7 +2169,7 @@ sai_status_t sai_get_attributes(_In_ const sai_object_key_t *key,
         return status;
     }
 
-    status = get_dispatch_attribs_handler(attr_count, attr_list, object_type, vendor_data, key, key_str);
+    status = get_dispatch_attribs_handler(attr_count, attr_list, object_type, vendor_data, key, key_str, &cache);
     if (SAI_ERR(status)) {
         if (MLNX_SAI_STATUS_BUFFER_OVERFLOW_EMPTY_LIST == status) {
             status = SAI_STATUS_BUFFER_OVERFLOW;
@@ -2182,6 +2182,166 @@ sai_status_t sai_get_attributes(_In_ const sai_object_key_t *key,
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t sai_set_attribute(_In_ const sai_object_key_t *key,
+                               _In_ sai_object_type_t       object_type,
+                               _In_ const sai_attribute_t  *attr)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, object_type, MLNX_API_STATS_OP_SET,
+                                sai_set_attribute_impl(key, object_type, attr));
+}
+
+sai_status_t sai_get_attributes(_In_ const sai_object_key_t *key,
+                                _In_ sai_object_type_t       object_type,
+                                _In_ uint32_t                attr_count,
+                                _Inout_ sai_attribute_t     *attr_list)
+{
+    mlnx_api_stats_ctx_t stats_ctx;
+
+    return MLNX_API_STATS_TIMED(&stats_ctx, object_type, MLNX_API_STATS_OP_GET,
+                                sai_get_attributes_impl(key, object_type, attr_count, attr_list));
+}
+
+static bool sai_attr_ids_equal(_In_ uint32_t               attr_count_a,
+                               _In_ const sai_attribute_t *attr_list_a,
+                               _In_ uint32_t               attr_count_b,
+                               _In_ const sai_attribute_t *attr_list_b)
+{
+    uint32_t ii;
+
+    if (attr_count_a != attr_count_b) {
+        return false;
+    }
+
+    for (ii = 0; ii < attr_count_a; ii++) {
+        if (attr_list_a[ii].id != attr_list_b[ii].id) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Only the list values depend on the object, the rest of the GET checks depend on the attribute ids */
+static sai_status_t sai_attribs_list_values_on_get_check(_In_ uint32_t               attr_count,
+                                                         _In_ const sai_attribute_t *attr_list,
+                                                         _In_ sai_object_type_t      object_type)
+{
+    const sai_attr_metadata_t *meta_data;
+    sai_status_t               status;
+    uint32_t                   ii;
+
+    for (ii = 0; ii < attr_count; ii++) {
+        meta_data = mlnx_sai_attr_metadata_get_impl(object_type, attr_list[ii].id);
+        if (NULL == meta_data) {
+            return SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
+        }
+
+        status = sai_attribute_value_list_type_validate(meta_data, &attr_list[ii].value, SAI_COMMON_API_GET, ii);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Bulk version of sai_get_attributes.
+ * The metadata check runs once per distinct attribute id list (consecutive objects usually share it) and the key
+ * string is only built when the get handlers are going to log it.
+ * caches can be pre-filled by the caller (e.g. from an SDK table walk), the getters fall back to the per object
+ * SDK get for the entries that are not set.
+ */
+sai_status_t sai_bulk_get_attributes(_In_ sai_object_type_t       object_type,
+                                     _In_ uint32_t                object_count,
+                                     _In_ const sai_object_key_t *object_key,
+                                     _In_ const uint32_t         *attr_count,
+                                     _Inout_ sai_attribute_t    **attr_list,
+                                     _Inout_ vendor_cache_t      *caches,
+                                     _Out_ sai_status_t          *object_statuses)
+{
+    const sai_vendor_attribute_entry_t *vendor_data;
+    const sai_attribute_t              *checked_attr_list = NULL;
+    uint32_t                            checked_attr_count = 0, ii;
+    sai_status_t                        status;
+    char                                key_str[MAX_KEY_STR_LEN] = "-";
+    bool                                is_key_str_needed, failure = false;
+    mlnx_api_stats_ctx_t                stats_ctx;
+
+    assert(object_key);
+    assert(attr_count);
+    assert(attr_list);
+    assert(caches);
+    assert(object_statuses);
+
+    if ((object_type >= SAI_OBJECT_TYPE_MAX) || (object_type < 0)) {
+        SX_LOG_ERR("Unsupported object_type [%d]\n", object_type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!mlnx_obj_types_info[object_type] || !mlnx_obj_types_info[object_type]->vendor_data) {
+        SX_LOG_ERR("Missing vendor_data for %s\n", SAI_TYPE_STR(object_type));
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    vendor_data = mlnx_obj_types_info[object_type]->vendor_data;
+
+    is_key_str_needed = (LOG_VAR_NAME(__MODULE__) >= SX_VERBOSITY_LEVEL_NOTICE);
+
+    mlnx_api_stats_begin(&stats_ctx, object_type, MLNX_API_STATS_OP_BULK_GET);
+
+    for (ii = 0; ii < object_count; ii++) {
+        if ((attr_count[ii]) && (NULL == attr_list[ii])) {
+            SX_LOG_ERR("NULL attr list for object #%u\n", ii);
+            object_statuses[ii] = SAI_STATUS_INVALID_PARAMETER;
+            failure = true;
+            continue;
+        }
+
+        if (checked_attr_list &&
+            sai_attr_ids_equal(checked_attr_count, checked_attr_list, attr_count[ii], attr_list[ii])) {
+            status = sai_attribs_list_values_on_get_check(attr_count[ii], attr_list[ii], object_type);
+        } else {
+            status = check_attribs_metadata(attr_count[ii], attr_list[ii], object_type, vendor_data,
+                                            SAI_COMMON_API_GET);
+            if (SAI_OK(status)) {
+                checked_attr_list = attr_list[ii];
+                checked_attr_count = attr_count[ii];
+            }
+        }
+
+        if (SAI_ERR(status)) {
+            key_to_str(&object_key[ii], object_type, key_str);
+            SX_LOG_ERR("Failed attributes check, key: %s\n", key_str);
+            object_statuses[ii] = status;
+            failure = true;
+            continue;
+        }
+
+        if (is_key_str_needed) {
+            key_to_str(&object_key[ii], object_type, key_str);
+        }
+
+        status = get_dispatch_attribs_handler(attr_count[ii], attr_list[ii], object_type, vendor_data,
+                                              &object_key[ii], key_str, &caches[ii]);
+        if (MLNX_SAI_STATUS_BUFFER_OVERFLOW_EMPTY_LIST == status) {
+            status = SAI_STATUS_BUFFER_OVERFLOW;
+        }
+
+        object_statuses[ii] = status;
+        if (SAI_ERR(status)) {
+            failure = true;
+        }
+    }
+
+    status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    mlnx_api_stats_end(&stats_ctx, status);
+
+    return status;
+}
+
 sai_status_t mlnx_bulk_attrs_validate(_In_ uint32_t                 object_count,
                                       _In_ const uint32_t          *attr_count,
                                       _In_ const sai_attribute_t  **attr_list_for_create,
@@ -3803,6 +3963,153 @@ uint64_t time_ms_get(void)
     return tv.tv_sec * 1000 + tv.tv_usec / 1000;
 }
 
+/* Monotonic, for measuring durations */
+uint64_t time_us_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#define MLNX_BOOT_TRACE_SPANS_MAX      (256)
+#define MLNX_BOOT_TRACE_CATEGORIES_MAX (16)
+#define MLNX_BOOT_TRACE_FILE_NAME      "sai_boot_trace.json"
+
+typedef struct _mlnx_boot_trace_span_t {
+    const char *name;
+    const char *category;
+    uint64_t    start_us;
+    uint64_t    dur_us;
+} mlnx_boot_trace_span_t;
+
+typedef struct _mlnx_boot_trace_category_t {
+    const char *category;
+    uint32_t    count;
+    uint64_t    total_us;
+} mlnx_boot_trace_category_t;
+
+/* Boot runs on a single thread in create_switch, so the recorder is not locked.
+ * Names and categories must be string literals, only the pointers are stored. */
+static mlnx_boot_trace_span_t     boot_trace_spans[MLNX_BOOT_TRACE_SPANS_MAX];
+static mlnx_boot_trace_category_t boot_trace_categories[MLNX_BOOT_TRACE_CATEGORIES_MAX];
+static uint32_t                   boot_trace_spans_count;
+static uint32_t                   boot_trace_spans_dropped;
+static uint64_t                   boot_trace_origin_us;
+
+void mlnx_boot_trace_reset(void)
+{
+    memset(boot_trace_categories, 0, sizeof(boot_trace_categories));
+    boot_trace_spans_count = 0;
+    boot_trace_spans_dropped = 0;
+    boot_trace_origin_us = time_us_get();
+}
+
+static void mlnx_boot_trace_category_account(_In_ const char *category, _In_ uint64_t dur_us)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < MLNX_BOOT_TRACE_CATEGORIES_MAX; ii++) {
+        if (!boot_trace_categories[ii].category) {
+            boot_trace_categories[ii].category = category;
+        } else if (strcmp(boot_trace_categories[ii].category, category)) {
+            continue;
+        }
+
+        boot_trace_categories[ii].count++;
+        boot_trace_categories[ii].total_us += dur_us;
+        return;
+    }
+}
+
+void mlnx_boot_trace_add(_In_ const char *name, _In_ const char *category, _In_ uint64_t start_us,
+                         _In_ uint64_t end_us)
+{
+    mlnx_boot_trace_span_t *span;
+
+    assert(name);
+    assert(category);
+
+    if (end_us < start_us) {
+        end_us = start_us;
+    }
+
+    mlnx_boot_trace_category_account(category, end_us - start_us);
+
+    if (boot_trace_spans_count == MLNX_BOOT_TRACE_SPANS_MAX) {
+        boot_trace_spans_dropped++;
+        return;
+    }
+
+    span = &boot_trace_spans[boot_trace_spans_count++];
+    span->name = name;
+    span->category = category;
+    span->start_us = start_us;
+    span->dur_us = end_us - start_us;
+}
+
+/* Records a span from start_us till now, returns now so consecutive phases can be chained */
+uint64_t mlnx_boot_trace_mark(_In_ const char *name, _In_ const char *category, _In_ uint64_t start_us)
+{
+    uint64_t now_us = time_us_get();
+
+    mlnx_boot_trace_add(name, category, start_us, now_us);
+
+    return now_us;
+}
+
+/* Writes the recorded spans as Chrome trace event format ("X" complete events), loadable in
+ * chrome://tracing or Perfetto, and logs the accumulated time per category */
+sai_status_t mlnx_boot_trace_dump(_In_ const char *dir)
+{
+    char     file_name[SX_API_DUMP_PATH_LEN_LIMIT + sizeof(MLNX_BOOT_TRACE_FILE_NAME) + 1];
+    FILE    *file;
+    uint64_t start_us;
+    uint32_t ii;
+
+    assert(dir);
+
+    for (ii = 0; ii < MLNX_BOOT_TRACE_CATEGORIES_MAX && boot_trace_categories[ii].category; ii++) {
+        SX_LOG_NTC("Boot trace category %s: %u spans, %" PRIu64 " ms\n", boot_trace_categories[ii].category,
+                   boot_trace_categories[ii].count, boot_trace_categories[ii].total_us / 1000);
+    }
+
+    if (boot_trace_spans_dropped) {
+        SX_LOG_WRN("Boot trace dropped %u spans, max is %u\n", boot_trace_spans_dropped, MLNX_BOOT_TRACE_SPANS_MAX);
+    }
+
+    if (0 == dir[0]) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    snprintf(file_name, sizeof(file_name), "%s/%s", dir, MLNX_BOOT_TRACE_FILE_NAME);
+
+    file = fopen(file_name, "w");
+    if (NULL == file) {
+        SX_LOG_ERR("Error opening file %s with write permission\n", file_name);
+        return SAI_STATUS_FAILURE;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (ii = 0; ii < boot_trace_spans_count; ii++) {
+        start_us = boot_trace_spans[ii].start_us;
+        start_us = (start_us > boot_trace_origin_us) ? start_us - boot_trace_origin_us : 0;
+
+        fprintf(file,
+                "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%" PRIu64 ",\"dur\":%" PRIu64
+                ",\"pid\":1,\"tid\":1}\n",
+                ii ? "," : "", boot_trace_spans[ii].name, boot_trace_spans[ii].category, start_us,
+                boot_trace_spans[ii].dur_us);
+    }
+    fprintf(file, "]}\n");
+
+    fclose(file);
+
+    SX_LOG_NTC("Boot trace with %u spans written to %s\n", boot_trace_spans_count, file_name);
+
+    return SAI_STATUS_SUCCESS;
+}
+
 size_t oid_n_to_str(_In_ sai_object_id_t oid, _In_ size_t len, _Out_ char *str)
 {
     sai_object_key_t  key = { .key.object_id = oid };
@@ -3893,3 +4200,17 @@ bool u32_list_equal(_In_ const uint32_t *list1,
 
     return true;
 }
+
+uint32_t mlnx_fnv1a_hash(_In_ uint32_t hash, _In_ const void *data, _In_ size_t size)
+{
+    const uint8_t *bytes = data;
+    size_t         ii;
+
+    assert(data || !size);
+
+    for (ii = 0; ii < size; ii++) {
+        hash = (hash ^ bytes[ii]) * 16777619U;
+    }
+
+    return hash;
+}
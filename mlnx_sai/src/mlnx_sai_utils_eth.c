@@ -474,6 +474,66 @@ sai_status_t mlnx_translate_sdk_ip_prefix_to_sai(_In_ const sx_ip_prefix_t *sdk_
     return SAI_STATUS_SUCCESS;
 }
 
+/* SDK keeps each uint32 of the address in host order, so the uint32s are compared as numbers */
+static int mlnx_sdk_ip_words_cmp(_In_ const uint32_t *a, _In_ const uint32_t *b, _In_ uint32_t count)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < count; ii++) {
+        if (a[ii] != b[ii]) {
+            return (a[ii] < b[ii]) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Orders the SDK addresses by version, then numerically */
+int mlnx_sdk_ip_addr_cmp(_In_ const sx_ip_addr_t *a, _In_ const sx_ip_addr_t *b)
+{
+    assert(a && b);
+
+    if (a->version != b->version) {
+        return (a->version < b->version) ? -1 : 1;
+    }
+
+    if (SX_IP_VERSION_IPV4 == a->version) {
+        return mlnx_sdk_ip_words_cmp(&a->addr.ipv4.s_addr, &b->addr.ipv4.s_addr, 1);
+    }
+
+    return mlnx_sdk_ip_words_cmp((const uint32_t*)a->addr.ipv6.s6_addr32, (const uint32_t*)b->addr.ipv6.s6_addr32, 4);
+}
+
+/* Orders the SDK prefixes by version, then numerically by address and by mask */
+int mlnx_sdk_ip_prefix_cmp(_In_ const sx_ip_prefix_t *a, _In_ const sx_ip_prefix_t *b)
+{
+    int cmp;
+
+    assert(a && b);
+
+    if (a->version != b->version) {
+        return (a->version < b->version) ? -1 : 1;
+    }
+
+    if (SX_IP_VERSION_IPV4 == a->version) {
+        cmp = mlnx_sdk_ip_words_cmp(&a->prefix.ipv4.addr.s_addr, &b->prefix.ipv4.addr.s_addr, 1);
+        if (cmp) {
+            return cmp;
+        }
+
+        return mlnx_sdk_ip_words_cmp(&a->prefix.ipv4.mask.s_addr, &b->prefix.ipv4.mask.s_addr, 1);
+    }
+
+    cmp = mlnx_sdk_ip_words_cmp((const uint32_t*)a->prefix.ipv6.addr.s6_addr32,
+                                (const uint32_t*)b->prefix.ipv6.addr.s6_addr32, 4);
+    if (cmp) {
+        return cmp;
+    }
+
+    return mlnx_sdk_ip_words_cmp((const uint32_t*)a->prefix.ipv6.mask.s6_addr32,
+                                 (const uint32_t*)b->prefix.ipv6.mask.s6_addr32, 4);
+}
+
 sai_status_t mlnx_object_to_log_port(sai_object_id_t object_id, sx_port_log_id_t *port_id)
 {
     sai_status_t      status;
@@ -1661,7 +1661,7 @@ static sai_status_t mlnx_vlan_memeber_bulk_fdb_ctrl_apply(_In_ bool create)
             ports_count = 0;
             for (bport_index = 0; bport_index < MAX_BRIDGE_1Q_PORTS; bport_index++) {
                 if (mlnx_vlan_member_bulk_data.flood_ctrl_data.vlan_port_present[bport_index][vlan_id]) {
-                    sx_ports[ports_count] = g_sai_db_ptr->bridge_ports_db[bport_index].logical;
+                    sx_ports[ports_count] = mlnx_bridge_ports_db[bport_index].logical;
                     ports_count++;
                 }
             }
@@ -1690,7 +1690,7 @@ static sai_status_t mlnx_vlan_member_bulk_prio_tagging_state_set(uint32_t bport_
     sx_untagged_prio_state_t sx_prio_tagging_state;
 
     sx_prio_tagging_state = mlnx_vlan_member_bulk_data.prio_tag_data.ports[bport_index].prio_tagging;
-    sx_port = g_sai_db_ptr->bridge_ports_db[bport_index].logical;
+    sx_port = mlnx_bridge_ports_db[bport_index].logical;
 
     sx_status = sx_api_vlan_port_prio_tagged_set(gh_sdk, sx_port, sx_prio_tagging_state);
     if (SX_ERR(sx_status)) {
@@ -1777,14 +1777,14 @@ static sai_status_t mlnx_vlan_member_bulk_port_to_vlans_apply(_In_ uint32_t
             object_statuses_indexes[object_statuses_indexes_count] = object_index;
             object_statuses_indexes_count++;
 
-            mlnx_vlan_member_bulk_db_port_vlan_set(vlan_id, &g_sai_db_ptr->bridge_ports_db[port_index], create);
+            mlnx_vlan_member_bulk_db_port_vlan_set(vlan_id, &mlnx_bridge_ports_db[port_index], create);
             mlnx_vlan_member_bulk_fdb_ctrl_set(vlan_id, port_index, true);
         }
     }
 
     mlnx_vlan_member_bulk_data.port_vlans[port_index] = 0;
 
-    sx_port_log_id = g_sai_db_ptr->bridge_ports_db[port_index].logical;
+    sx_port_log_id = mlnx_bridge_ports_db[port_index].logical;
     sx_cmd = create ? SX_ACCESS_CMD_ADD : SX_ACCESS_CMD_DELETE;
 
     sx_status = sx_api_vlan_port_multi_vlan_set(gh_sdk, sx_cmd, sx_port_log_id, sx_port_vlans, vlan_count);
@@ -1801,7 +1801,7 @@ static sai_status_t mlnx_vlan_member_bulk_port_to_vlans_apply(_In_ uint32_t
 
         for (ii = 0; ii < vlan_count; ii++) {
             vlan_id = sx_port_vlans[ii].vid;
-            mlnx_vlan_member_bulk_db_port_vlan_set(vlan_id, &g_sai_db_ptr->bridge_ports_db[port_index], !create);
+            mlnx_vlan_member_bulk_db_port_vlan_set(vlan_id, &mlnx_bridge_ports_db[port_index], !create);
             mlnx_vlan_member_bulk_fdb_ctrl_set(vlan_id, port_index, false);
         }
     }
@@ -1833,7 +1833,7 @@ static sai_status_t mlnx_vlan_member_bulk_vlan_to_ports_apply(_In_ uint32_t
     for (port_index = 0; port_index < MAX_BRIDGE_1Q_PORTS; port_index++) {
         if (MLNX_VLAN_MEMBER_BULK_PAIR_IS_USED(mlnx_vlan_member_bulk_data.pairs[port_index][vlan_id])) {
             /* Fetch the data for sx call */
-            sx_vlan_ports[port_count].log_port = g_sai_db_ptr->bridge_ports_db[port_index].logical;
+            sx_vlan_ports[port_count].log_port = mlnx_bridge_ports_db[port_index].logical;
             sx_vlan_ports[port_count].is_untagged =
                 MLNX_VLAN_MEMBER_BULK_PAIR_TAGGING_GET(mlnx_vlan_member_bulk_data.pairs[port_index][vlan_id]);
             port_count++;
@@ -1852,7 +1852,7 @@ static sai_status_t mlnx_vlan_member_bulk_vlan_to_ports_apply(_In_ uint32_t
             object_statuses_indexes[object_statuses_indexes_count] = object_index;
             object_statuses_indexes_count++;
 
-            mlnx_vlan_member_bulk_db_port_vlan_set(vlan_id, &g_sai_db_ptr->bridge_ports_db[port_index], create);
+            mlnx_vlan_member_bulk_db_port_vlan_set(vlan_id, &mlnx_bridge_ports_db[port_index], create);
             mlnx_vlan_member_bulk_fdb_ctrl_set(vlan_id, port_index, true);
         }
     }
@@ -2477,6 +2477,66 @@ sai_status_t mlnx_vlan_oid_create(_In_ sai_vlan_id_t vlan_id, _Out_ sai_object_i
     return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is needed */
+sai_status_t mlnx_vlan_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    sai_object_key_t *key;
+    sai_status_t      status;
+    sai_vlan_id_t     vid;
+
+    assert(keys);
+
+    mlnx_vlan_id_foreach(vid) {
+        if (!mlnx_vlan_is_created(vid)) {
+            continue;
+        }
+
+        key = mlnx_object_key_list_next(keys);
+        if (!key) {
+            continue;
+        }
+
+        status = mlnx_vlan_oid_create(vid, &key->key.object_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+sai_status_t mlnx_vlan_member_key_list_get(_In_ sai_object_id_t switch_id, _Inout_ mlnx_object_key_list_t *keys)
+{
+    mlnx_bridge_port_t *port;
+    sai_object_key_t   *key;
+    sai_status_t        status;
+    sai_vlan_id_t       vid;
+    uint32_t            ii;
+
+    assert(keys);
+
+    mlnx_vlan_id_foreach(vid) {
+        if (!mlnx_vlan_is_created(vid)) {
+            continue;
+        }
+
+        mlnx_vlan_ports_foreach(vid, port, ii) {
+            key = mlnx_object_key_list_next(keys);
+            if (!key) {
+                continue;
+            }
+
+            status = mlnx_vlan_member_object_create(vid, port->index, &key->key.object_id);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 sx_mstp_inst_id_t mlnx_vlan_stp_id_get(sai_vlan_id_t vlan_id)
 {
     return (g_sai_db_ptr->vlans_db[vlan_id - SXD_VID_MIN].stp_id);
@@ -43,6 +43,24 @@ typedef enum _flow_color_type_t {
     FLOW_COLOR_RED
 } flow_color_type_t;
 
+/* TCs of a port or LAG using the WRED profile, bound with one SDK call per flow */
+typedef struct _mlnx_wred_bind_port_t {
+    sx_port_log_id_t        log_port;
+    sx_cos_traffic_class_t *tc_list;
+    uint32_t                tc_count;
+} mlnx_wred_bind_port_t;
+
+/* Snapshot of the ports using the WRED profile, the SDK calls are made on it without the DB lock */
+typedef struct _mlnx_wred_bind_batch_t {
+    mlnx_wred_bind_port_t  *ports;
+    sx_cos_traffic_class_t *tc_lists;
+    uint32_t                count;
+    uint64_t                start_us;
+    uint32_t                sdk_calls;
+    uint64_t                sdk_us;
+    uint64_t                max_sdk_call_us;
+} mlnx_wred_bind_batch_t;
+
 static sai_status_t mlnx_wred_attr_getter(_In_ const sai_object_key_t   *key,
                                           _Inout_ sai_attribute_value_t *value,
                                           _In_ uint32_t                  attr_index,
@@ -74,7 +92,8 @@ static sai_status_t mlnx_wred_ecn_enable_set(sx_port_log_id_t        port,
                                              sx_cos_traffic_class_t *tc_list,
                                              uint32_t                tc_count,
                                              bool                    red_enable,
-                                             bool                    ecn_enable);
+                                             bool                    ecn_enable,
+                                             mlnx_wred_bind_batch_t *batch);
 static const sai_vendor_attribute_entry_t wred_vendor_attribs[] = {
     { SAI_WRED_ATTR_GREEN_ENABLE,
       { true, false, true, true },
@@ -189,6 +208,7 @@ static sai_status_t mlnx_wred_db_create(sai_object_id_t *wred_id, mlnx_wred_prof
             }
             memcpy(&g_sai_qos_db_ptr->wred_db[ii], new_wred, sizeof(mlnx_wred_profile_t));
             g_sai_qos_db_ptr->wred_db[ii].in_use = true;
+            memset(&g_sai_qos_db_ptr->wred_refs[ii], 0, sizeof(g_sai_qos_db_ptr->wred_refs[ii]));
             sai_qos_db_sync();
             break;
         }
@@ -420,6 +440,213 @@ static sai_status_t mlnx_wred_get_tc_configured_list(mlnx_port_config_t     *por
     return status;
 }
 
+static mlnx_wred_refs_t * mlnx_wred_refs_get(_In_ sai_object_id_t wred_id)
+{
+    uint32_t wred_idx;
+
+    if (SAI_ERR(mlnx_object_to_type(wred_id, SAI_OBJECT_TYPE_WRED, &wred_idx, NULL)) ||
+        (wred_idx >= g_resource_limits.cos_redecn_profiles_max)) {
+        return NULL;
+    }
+
+    return &g_sai_qos_db_ptr->wred_refs[wred_idx];
+}
+
+static bool mlnx_wred_port_idx_uses(_In_ uint32_t port_idx, _In_ sai_object_id_t wred_id)
+{
+    const mlnx_qos_queue_config_t *queues = &g_sai_qos_db_ptr->queue_db[port_idx * MAX_QUEUES];
+    uint32_t                       ii;
+
+    for (ii = 0; ii < MAX_QUEUES; ii++) {
+        if (queues[ii].wred_id == wred_id) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Set the WRED profile of the queue and keep the ports of the profiles up to date.
+ * All the writes of queue wred_id go through here.
+ */
+void mlnx_wred_queue_wred_id_set(_Inout_ mlnx_qos_queue_config_t *queue_cfg, _In_ sai_object_id_t wred_id)
+{
+    sai_object_id_t   old_wred_id;
+    mlnx_wred_refs_t *refs;
+    uint32_t          port_idx;
+
+    assert(queue_cfg);
+
+    old_wred_id = queue_cfg->wred_id;
+    if (old_wred_id == wred_id) {
+        return;
+    }
+
+    port_idx = (uint32_t)(queue_cfg - g_sai_qos_db_ptr->queue_db) / MAX_QUEUES;
+
+    queue_cfg->wred_id = wred_id;
+
+    if (SAI_NULL_OBJECT_ID != old_wred_id) {
+        refs = mlnx_wred_refs_get(old_wred_id);
+        if (refs) {
+            if (refs->queues_count) {
+                refs->queues_count--;
+            }
+            if (!mlnx_wred_port_idx_uses(port_idx, old_wred_id)) {
+                array_bit_clear(refs->ports, port_idx);
+            }
+        }
+    }
+
+    if (SAI_NULL_OBJECT_ID != wred_id) {
+        refs = mlnx_wred_refs_get(wred_id);
+        if (refs) {
+            refs->queues_count++;
+            array_bit_set(refs->ports, port_idx);
+        }
+    }
+}
+
+/*
+ * Collect the ports and TCs the WRED profile is bound to, one entry per port.
+ *
+ * Notes: DB read lock is needed
+ */
+static sai_status_t mlnx_wred_bind_batch_get(_In_ sai_object_id_t          wred_id,
+                                             _Out_ mlnx_wred_bind_batch_t *batch)
+{
+    const mlnx_wred_refs_t *refs;
+    mlnx_wred_bind_port_t  *entry;
+    mlnx_port_config_t     *port;
+    uint32_t                ii, ports_count = 0;
+    sai_status_t            status;
+
+    memset(batch, 0, sizeof(*batch));
+    batch->start_us = time_us_get();
+
+    refs = mlnx_wred_refs_get(wred_id);
+    if (!refs || !refs->queues_count) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    for (ii = 0; ii < MAX_PORTS * 2; ii++) {
+        if (array_bit_test(refs->ports, ii)) {
+            ports_count++;
+        }
+    }
+
+    if (!ports_count) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    batch->ports = calloc(ports_count, sizeof(*batch->ports));
+    batch->tc_lists = calloc(ports_count * MAX_QUEUES, sizeof(*batch->tc_lists));
+    if (!batch->ports || !batch->tc_lists) {
+        SX_LOG_ERR("Failed to alloc memory for WRED bind batch of %u ports\n", ports_count);
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    for (ii = 0; ii < MAX_PORTS * 2; ii++) {
+        if (!array_bit_test(refs->ports, ii)) {
+            continue;
+        }
+
+        port = &mlnx_ports_db[ii];
+        if (!mlnx_port_is_profile_bind_target(port)) {
+            continue;
+        }
+
+        entry = &batch->ports[batch->count];
+        entry->tc_list = &batch->tc_lists[batch->count * MAX_QUEUES];
+        entry->tc_count = MAX_QUEUES;
+
+        status = mlnx_wred_get_tc_configured_list(port, wred_id, entry->tc_list, &entry->tc_count);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+
+        if (entry->tc_count > 0) {
+            entry->log_port = port->logical;
+            batch->count++;
+        }
+    }
+
+    status = SAI_STATUS_SUCCESS;
+
+out:
+    if (SAI_ERR(status)) {
+        free(batch->ports);
+        free(batch->tc_lists);
+        batch->ports = NULL;
+        batch->tc_lists = NULL;
+        batch->count = 0;
+    }
+    return status;
+}
+
+static sai_status_t mlnx_wred_bind_batch_lock_get(_In_ sai_object_id_t          wred_id,
+                                                  _Out_ mlnx_wred_bind_batch_t *batch)
+{
+    sai_status_t status;
+
+    sai_db_read_lock();
+    status = mlnx_wred_bind_batch_get(wred_id, batch);
+    sai_db_unlock();
+
+    return status;
+}
+
+static void mlnx_wred_bind_batch_call_done(_Inout_opt_ mlnx_wred_bind_batch_t *batch, _In_ uint64_t start_us)
+{
+    uint64_t call_us;
+
+    if (!batch) {
+        return;
+    }
+
+    call_us = time_us_get() - start_us;
+
+    batch->sdk_calls++;
+    batch->sdk_us += call_us;
+    batch->max_sdk_call_us = MAX(batch->max_sdk_call_us, call_us);
+}
+
+/* Record the timing of the re-bind to the profile refs and release the batch */
+static void mlnx_wred_bind_batch_done(_In_ sai_object_id_t wred_id, _Inout_ mlnx_wred_bind_batch_t *batch)
+{
+    mlnx_wred_refs_t *refs;
+    uint64_t          bind_us;
+
+    if (batch->sdk_calls) {
+        bind_us = time_us_get() - batch->start_us;
+
+        sai_db_write_lock();
+
+        refs = mlnx_wred_refs_get(wred_id);
+        if (refs) {
+            refs->binds++;
+            refs->last_bind_ports = batch->count;
+            refs->last_bind_sdk_calls = batch->sdk_calls;
+            refs->last_bind_us = bind_us;
+            refs->max_bind_us = MAX(refs->max_bind_us, bind_us);
+            refs->max_sdk_call_us = MAX(refs->max_sdk_call_us, batch->max_sdk_call_us);
+            refs->sdk_calls_total += batch->sdk_calls;
+            refs->sdk_us_total += batch->sdk_us;
+        }
+
+        sai_db_unlock();
+
+        SX_LOG_DBG("WRED %" PRIx64 " re-bind - %u ports, %u SDK calls, %" PRIu64 " us in SDK, %" PRIu64 " us total\n",
+                   wred_id, batch->count, batch->sdk_calls, batch->sdk_us, bind_us);
+    }
+
+    free(batch->ports);
+    free(batch->tc_lists);
+    memset(batch, 0, sizeof(*batch));
+}
+
 /*
  * Bind / unbind profile_id for / from specific port.
  *
@@ -430,6 +657,7 @@ static sai_status_t mlnx_wred_get_tc_configured_list(mlnx_port_config_t     *por
  *    [in] tc_count  - number of TCs in tc_list
  *    [in] flow_type - specify sx flow type
  *    [in] cmd - SX_ACCESS_CMD_BIND / SX_ACCESS_CMD_UNBIND
+ *    [in] batch - batch to account the SDK call time to, optional
  *
  * Return Values:
  *    SAI_STATUS_SUCCESS
@@ -441,11 +669,13 @@ static sai_status_t mlnx_wred_bind_sxwred_to_port(sx_port_log_id_t          port
                                                   sx_cos_traffic_class_t  * tc_list,
                                                   uint32_t                  tc_count,
                                                   sx_cos_redecn_flow_type_e flow_type,
-                                                  sx_access_cmd_t           cmd)
+                                                  sx_access_cmd_t           cmd,
+                                                  mlnx_wred_bind_batch_t   *batch)
 {
     sx_cos_redecn_bind_params_t bind_param;
     char                        buf[MAX_VALUE_STR_LEN] = {0};
     sx_status_t                 sx_status = SX_STATUS_SUCCESS;
+    uint64_t                    start_us = batch ? time_us_get() : 0;
 
     memset(&bind_param, 0, sizeof(bind_param));
     bind_param.tc_profile = profile_id;
@@ -453,6 +683,7 @@ static sai_status_t mlnx_wred_bind_sxwred_to_port(sx_port_log_id_t          port
     sx_status = sx_api_cos_redecn_profile_tc_bind_set(gh_sdk, port, cmd,
                                                       tc_list, tc_count,
                                                       flow_type, &bind_param);
+    mlnx_wred_bind_batch_call_done(batch, start_us);
     tc_list_to_str(tc_list, tc_count, buf);
     if (SX_STATUS_SUCCESS != sx_status) {
         SX_LOG_ERR("Failed to %s sx profile %d %s port 0%x tc list %s - %s\n",
@@ -467,10 +698,10 @@ static sai_status_t mlnx_wred_bind_sxwred_to_port(sx_port_log_id_t          port
 }
 
 /*
- * Bind / unbind profile_id for / from all ports where wred_id is set.
+ * Bind / unbind profile_id for / from all ports of the batch.
  *
  * Arguments:
- *    [in] wred_id - id of WRED profile
+ *    [in] batch - ports and TCs the WRED profile is set on
  *    [in] profile_id - sx profile id
  *    [in] flow_type - specify sx flow type
  *    [in] cmd - SX_ACCESS_CMD_BIND / SX_ACCESS_CMD_UNBIND
@@ -479,46 +710,28 @@ static sai_status_t mlnx_wred_bind_sxwred_to_port(sx_port_log_id_t          port
  *    SAI_STATUS_SUCCESS
  *    SAI_STATUS_FAILURE
  *
+ * Notes: DB lock is not needed, the batch is a snapshot
  */
-static sai_status_t mlnx_wred_bind_sxwred_to_all_port(sai_object_id_t           wred_id,
+static sai_status_t mlnx_wred_bind_sxwred_to_all_port(mlnx_wred_bind_batch_t   *batch,
                                                       sx_cos_redecn_profile_t   profile_id,
                                                       sx_cos_redecn_flow_type_e flow_type,
                                                       sx_access_cmd_t           cmd)
 {
-    uint32_t                ii = 0;
-    sx_cos_traffic_class_t *tc_list;
-    uint32_t                tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
-    sx_status_t             sx_status = SX_STATUS_SUCCESS;
-    mlnx_port_config_t     *port;
-
-    tc_list = calloc(tc_count, sizeof(sx_cos_traffic_class_t));
-    if (NULL == tc_list) {
-        SX_LOG_ERR("Failed to alloc memory for tc list\n");
-        return SAI_STATUS_NO_MEMORY;
-    }
+    const mlnx_wred_bind_port_t *entry;
+    uint32_t                     ii;
+    sai_status_t                 status = SAI_STATUS_SUCCESS;
 
+    for (ii = 0; ii < batch->count; ii++) {
+        entry = &batch->ports[ii];
 
-    mlnx_port_not_in_lag_foreach(port, ii) {
-        tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
-        if (SAI_STATUS_SUCCESS !=
-            mlnx_wred_get_tc_configured_list(port, wred_id, tc_list, &tc_count)) {
-            sx_status = SX_STATUS_ERROR;
+        status = mlnx_wred_bind_sxwred_to_port(entry->log_port, profile_id, entry->tc_list, entry->tc_count,
+                                               flow_type, cmd, batch);
+        if (SAI_ERR(status)) {
             break;
         }
-        if (tc_count > 0) {
-            sx_status = mlnx_wred_bind_sxwred_to_port(port->logical, profile_id,
-                                                      tc_list, tc_count, flow_type, cmd);
-            if (SX_STATUS_SUCCESS != sx_status) {
-                break;
-            }
-        }
     }
 
-
-    if (tc_list) {
-        free(tc_list);
-    }
-    return sdk_to_sai(sx_status);
+    return status;
 }
 
 /*
@@ -533,19 +746,9 @@ static sai_status_t mlnx_wred_bind_sxwred_to_all_port(sai_object_id_t
  */
 static bool mlnx_wred_check_in_use(sai_object_id_t wred_id)
 {
-    mlnx_port_config_t      *port;
-    mlnx_qos_queue_config_t *queue;
-    uint32_t                 ii, jj;
-
-    mlnx_port_foreach(port, ii) {
-        port_queues_foreach(port, queue, jj) {
-            if (queue->wred_id == wred_id) {
-                return true;
-            }
-        }
-    }
+    const mlnx_wred_refs_t *refs = mlnx_wred_refs_get(wred_id);
 
-    return false;
+    return refs && refs->queues_count;
 }
 
 /* Apply all sx profiles from sai profile to a specified port */
@@ -553,7 +756,8 @@ static sai_status_t mlnx_wred_apply_saiwred_to_port(mlnx_wred_profile_t    *wred
                                                     sx_port_log_id_t        port_id,
                                                     sx_cos_traffic_class_t *tc_list,
                                                     uint32_t                tc_count,
-                                                    sx_access_cmd_t         cmd)
+                                                    sx_access_cmd_t         cmd,
+                                                    mlnx_wred_bind_batch_t *batch)
 {
     sai_status_t status = SAI_STATUS_SUCCESS;
 
@@ -561,13 +765,13 @@ static sai_status_t mlnx_wred_apply_saiwred_to_port(mlnx_wred_profile_t    *wred
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_wred_bind_sxwred_to_port(port_id, wred_profile->green_profile_id,
                                                     tc_list, tc_count,
-                                                    SX_COS_REDECN_FLOW_TYPE_TCP_GREEN, cmd))) {
+                                                    SX_COS_REDECN_FLOW_TYPE_TCP_GREEN, cmd, batch))) {
             return status;
         }
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_wred_bind_sxwred_to_port(port_id, wred_profile->green_profile_id,
                                                     tc_list, tc_count,
-                                                    SX_COS_REDECN_FLOW_TYPE_NON_TCP_GREEN, cmd))) {
+                                                    SX_COS_REDECN_FLOW_TYPE_NON_TCP_GREEN, cmd, batch))) {
             return status;
         }
     }
@@ -575,13 +779,13 @@ static sai_status_t mlnx_wred_apply_saiwred_to_port(mlnx_wred_profile_t    *wred
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_wred_bind_sxwred_to_port(port_id, wred_profile->yellow_profile_id,
                                                     tc_list, tc_count,
-                                                    SX_COS_REDECN_FLOW_TYPE_TCP_YELLOW, cmd))) {
+                                                    SX_COS_REDECN_FLOW_TYPE_TCP_YELLOW, cmd, batch))) {
             return status;
         }
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_wred_bind_sxwred_to_port(port_id, wred_profile->yellow_profile_id,
                                                     tc_list, tc_count,
-                                                    SX_COS_REDECN_FLOW_TYPE_NON_TCP_YELLOW, cmd))) {
+                                                    SX_COS_REDECN_FLOW_TYPE_NON_TCP_YELLOW, cmd, batch))) {
             return status;
         }
     }
@@ -589,13 +793,13 @@ static sai_status_t mlnx_wred_apply_saiwred_to_port(mlnx_wred_profile_t    *wred
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_wred_bind_sxwred_to_port(port_id, wred_profile->red_profile_id,
                                                     tc_list, tc_count,
-                                                    SX_COS_REDECN_FLOW_TYPE_TCP_RED, cmd))) {
+                                                    SX_COS_REDECN_FLOW_TYPE_TCP_RED, cmd, batch))) {
             return status;
         }
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_wred_bind_sxwred_to_port(port_id, wred_profile->red_profile_id,
                                                     tc_list, tc_count,
-                                                    SX_COS_REDECN_FLOW_TYPE_NON_TCP_RED, cmd))) {
+                                                    SX_COS_REDECN_FLOW_TYPE_NON_TCP_RED, cmd, batch))) {
             return status;
         }
     }
@@ -604,63 +808,51 @@ static sai_status_t mlnx_wred_apply_saiwred_to_port(mlnx_wred_profile_t    *wred
 }
 
 /*
- * Bind / unbind sai profile to / from all ports where wred_id is set.
+ * Bind / unbind sai profile to / from all ports of the batch.
  *
  * Arguments:
  *    [in] wred_id - id of WRED profile
+ *    [in] batch   - ports and TCs the WRED profile is set on
  *    [in] cmd     - SX_ACCESS_CMD_BIND / SX_ACCESS_CMD_UNBIND
  *
  * Return Values:
  *    SAI_STATUS_SUCCESS
  *    SAI_STATUS_FAILURE
  *
+ * Notes: DB lock is not needed, the batch is a snapshot
  */
-static sai_status_t mlnx_wred_bind_saiwred_to_all_port(sai_object_id_t wred_id, sx_access_cmd_t cmd)
+static sai_status_t mlnx_wred_bind_saiwred_to_all_port(sai_object_id_t         wred_id,
+                                                       mlnx_wred_bind_batch_t *batch,
+                                                       sx_access_cmd_t         cmd)
 {
-    uint32_t                ii = 0;
-    mlnx_wred_profile_t     wred_profile;
-    sx_cos_traffic_class_t *tc_list;
-    uint32_t                tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
-    sai_status_t            status = SAI_STATUS_SUCCESS;
-    mlnx_port_config_t     *port;
+    const mlnx_wred_bind_port_t *entry;
+    mlnx_wred_profile_t          wred_profile;
+    uint32_t                     ii;
+    sai_status_t                 status = SAI_STATUS_SUCCESS;
 
     if (SAI_STATUS_SUCCESS != (status = mlnx_wred_db_get(wred_id, &wred_profile))) {
         return status;
     }
 
-    tc_list = calloc(tc_count, sizeof(sx_cos_traffic_class_t));
-    if (NULL == tc_list) {
-        SX_LOG_ERR("Failed to alloc memory for tc list\n");
-        return SAI_STATUS_NO_MEMORY;
-    }
+    for (ii = 0; ii < batch->count; ii++) {
+        entry = &batch->ports[ii];
 
-    mlnx_port_not_in_lag_foreach(port, ii) {
-        tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
-        if (SAI_STATUS_SUCCESS !=
-            mlnx_wred_get_tc_configured_list(port, wred_id, tc_list, &tc_count)) {
-            status = SAI_STATUS_FAILURE;
-            break;
-        }
-        if (tc_count > 0) {
-            if (cmd == SX_ACCESS_CMD_BIND) {
-                bool wred_enabled = wred_profile.wred_enabled;
-                bool ecn_enabled = wred_profile.ecn_enabled;
-
-                status = mlnx_wred_ecn_enable_set(port->logical, tc_list, tc_count, wred_enabled, ecn_enabled);
-                if (SAI_ERR(status)) {
-                    SX_LOG_ERR("Failed update WRED/ECN enabled on port oid %" PRIx64 "\n", port->saiport);
-                    break;
-                }
-            }
-
-            status = mlnx_wred_apply_saiwred_to_port(&wred_profile, port->logical, tc_list, tc_count, cmd);
+        if (cmd == SX_ACCESS_CMD_BIND) {
+            status = mlnx_wred_ecn_enable_set(entry->log_port, entry->tc_list, entry->tc_count,
+                                              wred_profile.wred_enabled, wred_profile.ecn_enabled, batch);
             if (SAI_ERR(status)) {
+                SX_LOG_ERR("Failed update WRED/ECN enabled on port 0x%x\n", entry->log_port);
                 break;
             }
         }
+
+        status = mlnx_wred_apply_saiwred_to_port(&wred_profile, entry->log_port, entry->tc_list, entry->tc_count,
+                                                 cmd, batch);
+        if (SAI_ERR(status)) {
+            break;
+        }
     }
 
-    free(tc_list);
     return status;
 }
 
@@ -669,11 +861,13 @@ static sai_status_t mlnx_wred_ecn_enable_set(sx_port_log_id_t        port,
                                              sx_cos_traffic_class_t *tc_list,
                                              uint32_t                tc_count,
                                              bool                    red_enable,
-                                             bool                    ecn_enable)
+                                             bool                    ecn_enable,
+                                             mlnx_wred_bind_batch_t *batch)
 {
     sx_status_t                   sx_status = SX_STATUS_SUCCESS;
     sx_cos_redecn_enable_params_t ecn_param;
     char                          buf[MAX_VALUE_STR_LEN] = {0};
+    uint64_t                      start_us;
 
     memset(&ecn_param, 0, sizeof(ecn_param));
 
@@ -685,7 +879,9 @@ static sai_status_t mlnx_wred_ecn_enable_set(sx_port_log_id_t        port,
     SX_LOG_INF("Set ecn_enabled (%d), red_enabled (%d) for port 0%x tc = %s\n",
                ecn_enable, red_enable, port, buf);
 
+    start_us = batch ? time_us_get() : 0;
     sx_status = sx_api_cos_redecn_tc_enable_set(gh_sdk, port, tc_list, tc_count, &ecn_param);
+    mlnx_wred_bind_batch_call_done(batch, start_us);
     if (SX_STATUS_SUCCESS != sx_status) {
         SX_LOG_ERR("Failed to set redecn tc enable params - %s\n", SX_STATUS_MSG(sx_status));
     }
@@ -743,7 +939,7 @@ sai_status_t mlnx_wred_apply_to_queue(_In_ mlnx_port_config_t *port,
 
         SX_LOG_DBG("Unbinding current wred %lx on port %x queue %d\n", curr_wred_id, port_id, tc);
 
-        status = mlnx_wred_apply_saiwred_to_port(&wred_profile, port_id, &tc, 1, SX_ACCESS_CMD_UNBIND);
+        status = mlnx_wred_apply_saiwred_to_port(&wred_profile, port_id, &tc, 1, SX_ACCESS_CMD_UNBIND, NULL);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to remove WRED profile from port 0%x tc %d\n", port_id, tc);
             return status;
@@ -756,25 +952,26 @@ sai_status_t mlnx_wred_apply_to_queue(_In_ mlnx_port_config_t *port,
             return status;
         }
 
-        status = mlnx_wred_ecn_enable_set(port_id, &tc, 1, wred_profile.wred_enabled, wred_profile.ecn_enabled);
+        status = mlnx_wred_ecn_enable_set(port_id, &tc, 1, wred_profile.wred_enabled, wred_profile.ecn_enabled,
+                                          NULL);
         if (SAI_ERR(status)) {
             return status;
         }
 
         SX_LOG_DBG("Binding wred %lx to port %x queue %d\n", wred_id, port_id, tc);
 
-        status = mlnx_wred_apply_saiwred_to_port(&wred_profile, port_id, &tc, 1, SX_ACCESS_CMD_BIND);
+        status = mlnx_wred_apply_saiwred_to_port(&wred_profile, port_id, &tc, 1, SX_ACCESS_CMD_BIND, NULL);
         if (SAI_ERR(status)) {
             return status;
         }
     } else {
-        status = mlnx_wred_ecn_enable_set(port_id, &tc, 1, false, false);
+        status = mlnx_wred_ecn_enable_set(port_id, &tc, 1, false, false, NULL);
         if (SAI_ERR(status)) {
             return status;
         }
     }
 
-    queue_cfg->wred_id = wred_id;
+    mlnx_wred_queue_wred_id_set(queue_cfg, wred_id);
 
     return SAI_STATUS_SUCCESS;
 }
@@ -820,7 +1017,7 @@ sai_status_t mlnx_wred_port_queue_db_clear(_In_ mlnx_port_config_t *port)
     uint32_t                 ii;
 
     port_queues_foreach(port, queue_cfg, ii) {
-        queue_cfg->wred_id = SAI_NULL_OBJECT_ID;
+        mlnx_wred_queue_wred_id_set(queue_cfg, SAI_NULL_OBJECT_ID);
     }
 
     return SAI_STATUS_SUCCESS;
@@ -830,7 +1027,7 @@ sai_status_t mlnx_wred_port_queue_db_clear(_In_ mlnx_port_config_t *port)
  * Remove SAI WRED profile.
  *
  * Arguments:
- *    [in] wred_id - id of WRED profile
+ *    [in] batch - ports and TCs the WRED profile is set on
  *    [in] profile_id - sx profile id
  *    [in] color - flow color type (green / yellow / red)
  *
@@ -839,7 +1036,7 @@ sai_status_t mlnx_wred_port_queue_db_clear(_In_ mlnx_port_config_t *port)
  *    SAI_STATUS_FAILURE
  *
  */
-static sai_status_t mlnx_wred_remove_profile(sai_object_id_t         wred_id,
+static sai_status_t mlnx_wred_remove_profile(mlnx_wred_bind_batch_t *batch,
                                              sx_cos_redecn_profile_t profile_id,
                                              flow_color_type_t       color)
 {
@@ -872,12 +1069,12 @@ static sai_status_t mlnx_wred_remove_profile(sai_object_id_t         wred_id,
 
     /* unbind this profile from all ports it's currently bind */
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, profile_id, flows[0],
+        (status = mlnx_wred_bind_sxwred_to_all_port(batch, profile_id, flows[0],
                                                     SX_ACCESS_CMD_UNBIND))) {
         return status;
     }
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, profile_id, flows[1],
+        (status = mlnx_wred_bind_sxwred_to_all_port(batch, profile_id, flows[1],
                                                     SX_ACCESS_CMD_UNBIND))) {
         return status;
     }
@@ -1071,6 +1268,7 @@ static sai_status_t mlnx_wred_attr_setter(_In_ const sai_object_key_t      *key,
     sai_object_id_t                    wred_id = key->key.object_id;
     sx_cos_redecn_profile_attributes_t redecn_attr;
     mlnx_wred_profile_t                wred_profile;
+    mlnx_wred_bind_batch_t             batch;
     sx_cos_redecn_profile_t           *profile = NULL;
     char                               key_str[MAX_KEY_STR_LEN] = {0};
     sx_status_t                        sx_status = SX_STATUS_SUCCESS;
@@ -1081,6 +1279,7 @@ static sai_status_t mlnx_wred_attr_setter(_In_ const sai_object_key_t      *key,
 
     memset(&redecn_attr, 0, sizeof(redecn_attr));
     memset(&wred_profile, 0, sizeof(wred_profile));
+    memset(&batch, 0, sizeof(batch));
 
     SX_LOG_ENTER();
 
@@ -1164,13 +1363,19 @@ static sai_status_t mlnx_wred_attr_setter(_In_ const sai_object_key_t      *key,
         break;
     }
 
+    /* Ports using the profile are collected under the lock, the SDK calls are made without it */
+    status = mlnx_wred_bind_batch_lock_get(wred_id, &batch);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
     if (!need_create_profile) {
         /* unbind from all ports */
-        status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[0], SX_ACCESS_CMD_UNBIND);
+        status = mlnx_wred_bind_sxwred_to_all_port(&batch, *profile, flows[0], SX_ACCESS_CMD_UNBIND);
         if (SAI_ERR(status)) {
             goto out;
         }
-        status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[1], SX_ACCESS_CMD_UNBIND);
+        status = mlnx_wred_bind_sxwred_to_all_port(&batch, *profile, flows[1], SX_ACCESS_CMD_UNBIND);
         if (SAI_ERR(status)) {
             goto out;
         }
@@ -1184,16 +1389,17 @@ static sai_status_t mlnx_wred_attr_setter(_In_ const sai_object_key_t      *key,
     }
 
     /* bind profile back to all ports */
-    status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[0], SX_ACCESS_CMD_BIND);
+    status = mlnx_wred_bind_sxwred_to_all_port(&batch, *profile, flows[0], SX_ACCESS_CMD_BIND);
     if (SAI_ERR(status)) {
         goto out;
     }
-    status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[1], SX_ACCESS_CMD_BIND);
+    status = mlnx_wred_bind_sxwred_to_all_port(&batch, *profile, flows[1], SX_ACCESS_CMD_BIND);
     if (SAI_ERR(status)) {
         goto out;
     }
 
 out:
+    mlnx_wred_bind_batch_done(wred_id, &batch);
     SX_LOG_EXIT();
     return status;
 }
@@ -1205,6 +1411,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
 {
     sai_object_id_t          wred_id = key->key.object_id;
     mlnx_wred_profile_t      wred_profile;
+    mlnx_wred_bind_batch_t   batch;
     sx_cos_redecn_profile_t *sx_profile_p = NULL;
     flow_color_type_t        color = FLOW_COLOR_GREEN;
     char                     key_str[MAX_KEY_STR_LEN] = {0};
@@ -1214,6 +1421,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
     bool                     need_create_profile = false;
 
     memset(&wred_profile, 0, sizeof(wred_profile));
+    memset(&batch, 0, sizeof(batch));
 
     SX_LOG_ENTER();
 
@@ -1332,6 +1540,11 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
         goto out;
     }
 
+    status = mlnx_wred_bind_batch_lock_get(wred_id, &batch);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
     if (need_create_profile) {
         status = mlnx_wred_redecn_create_default_profile(wred_id, &wred_profile, attr);
         if (SAI_ERR(status)) {
@@ -1339,7 +1552,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
             goto out;
         }
 
-        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, SX_ACCESS_CMD_BIND);
+        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, &batch, SX_ACCESS_CMD_BIND);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to set default profile for %s\n", key_str);
             goto out;
@@ -1347,7 +1560,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
     }
     /* Do re-bind WRED profiles only if ECN enabled */
     if (wred_profile.ecn_enabled && (wred_enabled != wred_profile.wred_enabled)) {
-        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, SX_ACCESS_CMD_UNBIND);
+        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, &batch, SX_ACCESS_CMD_UNBIND);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to set ecn for %s\n", key_str);
             goto out;
@@ -1360,7 +1573,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
             goto out;
         }
 
-        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, SX_ACCESS_CMD_BIND);
+        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, &batch, SX_ACCESS_CMD_BIND);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to set ecn for %s\n", key_str);
         }
@@ -1369,7 +1582,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
     }
 
     if ((sx_profile_p) && (SAI_INVALID_PROFILE_ID != *sx_profile_p)) {
-        status = mlnx_wred_remove_profile(wred_id, *sx_profile_p, color);
+        status = mlnx_wred_remove_profile(&batch, *sx_profile_p, color);
         if (SAI_OK(status)) {
             *sx_profile_p = SAI_INVALID_PROFILE_ID;
 
@@ -1389,6 +1602,7 @@ static sai_status_t mlnx_wred_attr_enable_set(_In_ const sai_object_key_t      *
     }
 
 out:
+    mlnx_wred_bind_batch_done(wred_id, &batch);
     SX_LOG_EXIT();
     return status;
 }
@@ -1598,6 +1812,7 @@ static sai_status_t mlnx_wred_ecn_set(_In_ const sai_object_key_t      *key,
     sx_cos_redecn_profile_t *disable_profiles[3];
     uint32_t                 disable_count = 0;
     mlnx_wred_profile_t      wred_profile;
+    mlnx_wred_bind_batch_t   batch;
     bool                     ecn_enable;
     sai_status_t             status = SAI_STATUS_SUCCESS;
     uint32_t                 ii;
@@ -1605,6 +1820,7 @@ static sai_status_t mlnx_wred_ecn_set(_In_ const sai_object_key_t      *key,
     ecn_enable = (SAI_ECN_MARK_MODE_NONE != value->s32) ? true : false;
 
     memset(&wred_profile, 0, sizeof(wred_profile));
+    memset(&batch, 0, sizeof(batch));
 
     SX_LOG_ENTER();
 
@@ -1759,9 +1975,14 @@ static sai_status_t mlnx_wred_ecn_set(_In_ const sai_object_key_t      *key,
         goto out;
     }
 
+    status = mlnx_wred_bind_batch_lock_get(wred_id, &batch);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
     /* Do re-bind WRED profiles only if ECN is really need to be updated */
     if (wred_profile.ecn_enabled != ecn_enable) {
-        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, SX_ACCESS_CMD_UNBIND);
+        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, &batch, SX_ACCESS_CMD_UNBIND);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to set ecn for %s\n", key_str);
             goto out;
@@ -1774,7 +1995,7 @@ static sai_status_t mlnx_wred_ecn_set(_In_ const sai_object_key_t      *key,
             goto out;
         }
 
-        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, SX_ACCESS_CMD_BIND);
+        status = mlnx_wred_bind_saiwred_to_all_port(wred_id, &batch, SX_ACCESS_CMD_BIND);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to set ecn for %s\n", key_str);
             goto out;
@@ -1795,7 +2016,7 @@ static sai_status_t mlnx_wred_ecn_set(_In_ const sai_object_key_t      *key,
             assert(false);
         }
 
-        status = mlnx_wred_remove_profile(wred_id, *sx_profile, color);
+        status = mlnx_wred_remove_profile(&batch, *sx_profile, color);
         if (SAI_ERR(status)) {
             goto out;
         }
@@ -1806,6 +2027,7 @@ static sai_status_t mlnx_wred_ecn_set(_In_ const sai_object_key_t      *key,
     }
 
 out:
+    mlnx_wred_bind_batch_done(wred_id, &batch);
     SX_LOG_EXIT();
     return status;
 }
@@ -2303,6 +2525,7 @@ static sai_status_t mlnx_remove_wred_profile(_In_ sai_object_id_t wred_id)
 {
     sx_cos_redecn_profile_attributes_t redecn_attr;
     mlnx_wred_profile_t                wred_profile;
+    mlnx_wred_bind_batch_t             batch;
     uint32_t                           wred = 0;
     sai_status_t                       status = SAI_STATUS_SUCCESS;
     char                               key_str[MAX_KEY_STR_LEN] = {0};
@@ -2331,8 +2554,11 @@ static sai_status_t mlnx_remove_wred_profile(_In_ sai_object_id_t wred_id)
         goto out;
     }
 
+    /* Not in use - nothing to unbind */
+    memset(&batch, 0, sizeof(batch));
+
     if (SAI_INVALID_PROFILE_ID != wred_profile.green_profile_id) {
-        status = mlnx_wred_remove_profile(wred_id, wred_profile.green_profile_id, FLOW_COLOR_GREEN);
+        status = mlnx_wred_remove_profile(&batch, wred_profile.green_profile_id, FLOW_COLOR_GREEN);
         if (SAI_STATUS_SUCCESS != status) {
             SX_LOG_ERR("Failed to remove redecn green profile \n");
             goto out;
@@ -2340,7 +2566,7 @@ static sai_status_t mlnx_remove_wred_profile(_In_ sai_object_id_t wred_id)
     }
 
     if (SAI_INVALID_PROFILE_ID != wred_profile.yellow_profile_id) {
-        status = mlnx_wred_remove_profile(wred_id, wred_profile.yellow_profile_id, FLOW_COLOR_YELLOW);
+        status = mlnx_wred_remove_profile(&batch, wred_profile.yellow_profile_id, FLOW_COLOR_YELLOW);
         if (SAI_STATUS_SUCCESS != status) {
             SX_LOG_ERR("Failed to remove redecn yellow profile \n");
             goto out;
@@ -2348,7 +2574,7 @@ static sai_status_t mlnx_remove_wred_profile(_In_ sai_object_id_t wred_id)
     }
 
     if (SAI_INVALID_PROFILE_ID != wred_profile.red_profile_id) {
-        status = mlnx_wred_remove_profile(wred_id, wred_profile.red_profile_id, FLOW_COLOR_RED);
+        status = mlnx_wred_remove_profile(&batch, wred_profile.red_profile_id, FLOW_COLOR_RED);
         if (SAI_STATUS_SUCCESS != status) {
             SX_LOG_ERR("Failed to remove redecn red profile \n");
             goto out;
@@ -0,0 +1,419 @@
+/*
+ *  Copyright (C) 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <sx/sdk/sx_api.h>
+#include <sx/sdk/sx_api_bridge.h>
+#include <sx/sdk/sx_api_mc_container.h>
+#include <sx/sdk/sx_api_router.h>
+
+#include <sdk/sx_api_stub.h>
+
+#define SX_API_STUB_BRIDGE_ID_BASE (4096)
+
+typedef struct sx_api_stub_route {
+    sx_router_id_t     vrid;
+    sx_ip_prefix_t     prefix;
+    sx_uc_route_data_t data;
+    /* Index + 1 of the next route in the bucket or in the free list, 0 for the end */
+    uint32_t next;
+} sx_api_stub_route_t;
+
+typedef struct sx_api_stub_route_table {
+    pthread_mutex_t      lock;
+    sx_api_stub_route_t *routes;
+    uint32_t            *buckets;
+    uint32_t             routes_max;
+    uint32_t             buckets_mask;
+    uint32_t             free_head;
+    uint32_t             count;
+} sx_api_stub_route_table_t;
+
+#define SX_API_STUB_CALL_NAME(name) #name,
+static const char * const sx_api_stub_call_names[SX_API_STUB_CALL_MAX] = {
+    SX_API_STUB_GENERIC_CALLS(SX_API_STUB_CALL_NAME)
+    SX_API_STUB_CUSTOM_CALLS(SX_API_STUB_CALL_NAME)
+};
+#undef SX_API_STUB_CALL_NAME
+
+static uint64_t                  sx_api_stub_calls[SX_API_STUB_CALL_MAX];
+static uint32_t                  sx_api_stub_latency_ns;
+static uint32_t                  sx_api_stub_bridge_id = SX_API_STUB_BRIDGE_ID_BASE;
+static uint32_t                  sx_api_stub_mc_container_id;
+static sx_api_stub_route_table_t sx_api_stub_route_table = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+static uint64_t sx_api_stub_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void sx_api_stub_route_table_reset(sx_api_stub_route_table_t *table)
+{
+    uint32_t ii;
+
+    memset(table->buckets, 0, ((size_t)table->buckets_mask + 1) * sizeof(*table->buckets));
+    for (ii = 0; ii < table->routes_max; ii++) {
+        table->routes[ii].next = (ii + 1 < table->routes_max) ? ii + 2 : 0;
+    }
+
+    table->free_head = 1;
+    table->count = 0;
+}
+
+int sx_api_stub_init(uint32_t latency_ns, uint32_t routes_max)
+{
+    sx_api_stub_route_table_t *table = &sx_api_stub_route_table;
+    uint32_t                   buckets = 1;
+
+    sx_api_stub_deinit();
+
+    if (!routes_max) {
+        routes_max = SX_API_STUB_ROUTES_DEF;
+    }
+
+    while (buckets < routes_max) {
+        buckets <<= 1;
+    }
+
+    table->routes = calloc(routes_max, sizeof(*table->routes));
+    table->buckets = calloc(buckets, sizeof(*table->buckets));
+    if (!table->routes || !table->buckets) {
+        sx_api_stub_deinit();
+        return SX_STATUS_NO_MEMORY;
+    }
+
+    table->routes_max = routes_max;
+    table->buckets_mask = buckets - 1;
+    sx_api_stub_route_table_reset(table);
+
+    sx_api_stub_latency_ns = latency_ns;
+    memset(sx_api_stub_calls, 0, sizeof(sx_api_stub_calls));
+
+    return SX_STATUS_SUCCESS;
+}
+
+void sx_api_stub_deinit(void)
+{
+    sx_api_stub_route_table_t *table = &sx_api_stub_route_table;
+
+    free(table->routes);
+    free(table->buckets);
+    table->routes = NULL;
+    table->buckets = NULL;
+    table->routes_max = 0;
+    table->count = 0;
+}
+
+int sx_api_stub_enter(sx_api_stub_call_t call)
+{
+    uint64_t end_ns;
+
+    __atomic_add_fetch(&sx_api_stub_calls[call], 1, __ATOMIC_RELAXED);
+
+    /* Busy wait, a sleep is too coarse for the latency of an RPC to the SDK */
+    if (sx_api_stub_latency_ns) {
+        end_ns = sx_api_stub_time_ns() + sx_api_stub_latency_ns;
+        while (sx_api_stub_time_ns() < end_ns) {
+        }
+    }
+
+    return SX_STATUS_SUCCESS;
+}
+
+uint64_t sx_api_stub_call_count_get(sx_api_stub_call_t call)
+{
+    return __atomic_load_n(&sx_api_stub_calls[call], __ATOMIC_RELAXED);
+}
+
+uint64_t sx_api_stub_calls_get(void)
+{
+    uint64_t calls = 0;
+    uint32_t ii;
+
+    for (ii = 0; ii < SX_API_STUB_CALL_MAX; ii++) {
+        calls += __atomic_load_n(&sx_api_stub_calls[ii], __ATOMIC_RELAXED);
+    }
+
+    return calls;
+}
+
+void sx_api_stub_calls_dump(FILE *file)
+{
+    uint64_t calls;
+    uint32_t ii;
+
+    for (ii = 0; ii < SX_API_STUB_CALL_MAX; ii++) {
+        calls = __atomic_load_n(&sx_api_stub_calls[ii], __ATOMIC_RELAXED);
+        if (calls) {
+            fprintf(file, "%-50s %12llu\n", sx_api_stub_call_names[ii], (unsigned long long)calls);
+        }
+    }
+}
+
+sx_status_t sx_api_open(sx_log_cb_t logging_cb, sx_api_handle_t *handle)
+{
+    sx_api_stub_enter(SX_API_STUB_CALL_sx_api_open);
+
+    if (!handle) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    *handle = 1;
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_close(sx_api_handle_t *handle)
+{
+    sx_api_stub_enter(SX_API_STUB_CALL_sx_api_close);
+
+    if (handle) {
+        *handle = 0;
+    }
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_bridge_set(const sx_api_handle_t handle, const sx_access_cmd_t cmd, sx_bridge_id_t *bridge_id_p)
+{
+    sx_api_stub_enter(SX_API_STUB_CALL_sx_api_bridge_set);
+
+    if (!bridge_id_p) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    if (SX_ACCESS_CMD_CREATE == cmd) {
+        *bridge_id_p = __atomic_add_fetch(&sx_api_stub_bridge_id, 1, __ATOMIC_RELAXED);
+    }
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_mc_container_set(const sx_api_handle_t               handle,
+                                    const sx_access_cmd_t               cmd,
+                                    sx_mc_container_id_t               *container_id_p,
+                                    const sx_mc_next_hop_t             *next_hop_list_p,
+                                    const uint32_t                      next_hop_cnt,
+                                    const sx_mc_container_attributes_t *container_attributes_p)
+{
+    sx_api_stub_enter(SX_API_STUB_CALL_sx_api_mc_container_set);
+
+    if (!container_id_p) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    if (SX_ACCESS_CMD_CREATE == cmd) {
+        *container_id_p = __atomic_add_fetch(&sx_api_stub_mc_container_id, 1, __ATOMIC_RELAXED);
+    }
+
+    return SX_STATUS_SUCCESS;
+}
+
+/* Only the prefix bits of the address version are compared, the rest of the union is not set by all the callers */
+static void sx_api_stub_route_key(const sx_ip_prefix_t *prefix, sx_ip_prefix_t *key)
+{
+    memset(key, 0, sizeof(*key));
+    key->version = prefix->version;
+    if (SX_IP_VERSION_IPV4 == prefix->version) {
+        key->prefix.ipv4 = prefix->prefix.ipv4;
+    } else {
+        key->prefix.ipv6 = prefix->prefix.ipv6;
+    }
+}
+
+static uint32_t sx_api_stub_route_hash(sx_router_id_t vrid, const sx_ip_prefix_t *key)
+{
+    const uint8_t *data = (const uint8_t*)key;
+    uint32_t       hash = 2166136261U ^ vrid;
+    size_t         ii;
+
+    for (ii = 0; ii < sizeof(*key); ii++) {
+        hash = (hash ^ data[ii]) * 16777619U;
+    }
+
+    return hash;
+}
+
+/* Returns the link to the route - the bucket head or the next of the previous route */
+static uint32_t* sx_api_stub_route_find(sx_router_id_t vrid, const sx_ip_prefix_t *key)
+{
+    sx_api_stub_route_table_t *table = &sx_api_stub_route_table;
+    sx_api_stub_route_t       *route;
+    uint32_t                  *link;
+
+    link = &table->buckets[sx_api_stub_route_hash(vrid, key) & table->buckets_mask];
+    while (*link) {
+        route = &table->routes[*link - 1];
+        if ((route->vrid == vrid) && (0 == memcmp(&route->prefix, key, sizeof(*key)))) {
+            break;
+        }
+        link = &route->next;
+    }
+
+    return link;
+}
+
+sx_status_t sx_api_router_uc_route_set(const sx_api_handle_t  handle,
+                                       const sx_access_cmd_t  cmd,
+                                       const sx_router_id_t   vrid,
+                                       sx_ip_prefix_t        *network_addr,
+                                       sx_uc_route_data_t    *uc_route_data_p)
+{
+    sx_api_stub_route_table_t *table = &sx_api_stub_route_table;
+    sx_api_stub_route_t       *route;
+    sx_ip_prefix_t             key;
+    sx_status_t                status = SX_STATUS_SUCCESS;
+    uint32_t                  *link, idx;
+
+    sx_api_stub_enter(SX_API_STUB_CALL_sx_api_router_uc_route_set);
+
+    if (!table->routes) {
+        return SX_STATUS_ERROR;
+    }
+
+    if (SX_ACCESS_CMD_DELETE_ALL == cmd) {
+        pthread_mutex_lock(&table->lock);
+        sx_api_stub_route_table_reset(table);
+        pthread_mutex_unlock(&table->lock);
+        return SX_STATUS_SUCCESS;
+    }
+
+    if (!network_addr) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    sx_api_stub_route_key(network_addr, &key);
+
+    pthread_mutex_lock(&table->lock);
+
+    link = sx_api_stub_route_find(vrid, &key);
+
+    switch (cmd) {
+    case SX_ACCESS_CMD_ADD:
+        if (*link) {
+            status = SX_STATUS_ENTRY_ALREADY_EXISTS;
+            break;
+        }
+        if (!uc_route_data_p) {
+            status = SX_STATUS_PARAM_NULL;
+            break;
+        }
+        if (!table->free_head) {
+            status = SX_STATUS_NO_RESOURCES;
+            break;
+        }
+        idx = table->free_head;
+        route = &table->routes[idx - 1];
+        table->free_head = route->next;
+        route->vrid = vrid;
+        route->prefix = key;
+        route->data = *uc_route_data_p;
+        route->next = 0;
+        *link = idx;
+        table->count++;
+        break;
+
+    case SX_ACCESS_CMD_SET:
+        if (!*link) {
+            status = SX_STATUS_ENTRY_NOT_FOUND;
+            break;
+        }
+        if (!uc_route_data_p) {
+            status = SX_STATUS_PARAM_NULL;
+            break;
+        }
+        table->routes[*link - 1].data = *uc_route_data_p;
+        break;
+
+    case SX_ACCESS_CMD_DELETE:
+        if (!*link) {
+            status = SX_STATUS_ENTRY_NOT_FOUND;
+            break;
+        }
+        idx = *link;
+        route = &table->routes[idx - 1];
+        *link = route->next;
+        route->next = table->free_head;
+        table->free_head = idx;
+        table->count--;
+        break;
+
+    default:
+        status = SX_STATUS_CMD_UNSUPPORTED;
+        break;
+    }
+
+    pthread_mutex_unlock(&table->lock);
+
+    return status;
+}
+
+/* Only the lookup of a single route (GET) is emulated, the table is not iterated */
+sx_status_t sx_api_router_uc_route_get(const sx_api_handle_t     handle,
+                                       const sx_access_cmd_t     cmd,
+                                       const sx_router_id_t      vrid,
+                                       const sx_ip_prefix_t     *network_addr,
+                                       sx_uc_route_key_filter_t *filter_p,
+                                       sx_uc_route_get_entry_t  *uc_route_get_entries_list_p,
+                                       uint32_t                 *uc_route_get_entries_cnt_p)
+{
+    sx_api_stub_route_table_t *table = &sx_api_stub_route_table;
+    const sx_api_stub_route_t *route;
+    sx_ip_prefix_t             key;
+    sx_status_t                status = SX_STATUS_SUCCESS;
+    uint32_t                  *link;
+
+    sx_api_stub_enter(SX_API_STUB_CALL_sx_api_router_uc_route_get);
+
+    if (!network_addr || !uc_route_get_entries_cnt_p) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    if ((SX_ACCESS_CMD_GET != cmd) || !table->routes) {
+        *uc_route_get_entries_cnt_p = 0;
+        return SX_STATUS_ENTRY_NOT_FOUND;
+    }
+
+    sx_api_stub_route_key(network_addr, &key);
+
+    pthread_mutex_lock(&table->lock);
+
+    link = sx_api_stub_route_find(vrid, &key);
+    if (!*link) {
+        status = SX_STATUS_ENTRY_NOT_FOUND;
+    } else if (*uc_route_get_entries_cnt_p && uc_route_get_entries_list_p) {
+        route = &table->routes[*link - 1];
+        memset(uc_route_get_entries_list_p, 0, sizeof(*uc_route_get_entries_list_p));
+        uc_route_get_entries_list_p->network_addr = *network_addr;
+        uc_route_get_entries_list_p->route_data = route->data;
+        *uc_route_get_entries_cnt_p = 1;
+    } else {
+        *uc_route_get_entries_cnt_p = 1;
+    }
+
+    pthread_mutex_unlock(&table->lock);
+
+    return status;
+}
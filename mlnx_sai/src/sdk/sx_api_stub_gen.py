@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+
+# Generates the generic calls of the stub SDK used by sai_bench (--enable-bench).
+# The prototypes are taken from the SDK headers so the stubs match the callers exactly, the list of
+# the calls is SX_API_STUB_GENERIC_CALLS of inc/sdk/sx_api_stub.h.
+# The get calls zero their non-const pointer arguments - SAI reads what a get call returns, a zeroed
+# output is an empty list / default value instead of the stack garbage of the caller.
+
+from __future__ import print_function
+
+import os
+import re
+import sys
+import argparse
+from collections import namedtuple
+
+Param = namedtuple("Param", "decl name is_out")
+Prototype = namedtuple("Prototype", "name params header")
+
+STUB_HEADER = "sdk/sx_api_stub.h"
+SDK_HEADERS_DIR = os.path.join("sx", "sdk")
+
+def _strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", text)
+
+def StubCalls(stub_header_text):
+    m = re.search(r"#define\s+SX_API_STUB_GENERIC_CALLS\(X\)(.*?)\n\s*\n", stub_header_text, re.S)
+    if not m:
+        raise ValueError("SX_API_STUB_GENERIC_CALLS is not found")
+    return re.findall(r"X\((\w+)\)", m.group(1))
+
+def _split_params(text):
+    params, depth, start = [], 0, 0
+    for ii, c in enumerate(text):
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            depth -= 1
+        elif c == "," and depth == 0:
+            params.append(text[start:ii])
+            start = ii + 1
+    params.append(text[start:])
+    return [" ".join(p.split()) for p in params if p.strip()]
+
+def ParseParam(decl):
+    # Function pointers are passed down, never written
+    if "(" in decl:
+        name = re.search(r"\(\s*\*\s*(\w+)\s*\)", decl)
+        return Param(decl, name.group(1) if name else None, False)
+    name = re.search(r"(\w+)\s*(\[[^\]]*\]\s*)*$", decl).group(1)
+    type_decl = decl[:decl.rfind(name)]
+    if "[" in decl[len(type_decl):]:
+        pointee = type_decl
+    elif "*" in type_decl:
+        pointee = type_decl[:type_decl.rfind("*")]
+    else:
+        return Param(decl, name, False)
+    tokens = re.findall(r"\w+|\*", pointee)
+    is_out = ("const" not in tokens) and (tokens != ["void"])
+    return Param(decl, name, is_out)
+
+def ParsePrototypes(text, header):
+    text = _strip_comments(text)
+    prototypes = {}
+    for m in re.finditer(r"\bsx_status_t\s+(sx_api_\w+)\s*\(", text):
+        depth, pos = 1, m.end()
+        while depth and pos < len(text):
+            depth += {"(": 1, ")": -1}.get(text[pos], 0)
+            pos += 1
+        if not re.match(r"\s*;", text[pos:]):
+            continue
+        params = [ParseParam(p) for p in _split_params(text[m.end():pos - 1])]
+        if len(params) == 1 and params[0].decl == "void":
+            params = []
+        prototypes[m.group(1)] = Prototype(m.group(1), params, header)
+    return prototypes
+
+def FindPrototypes(include_dirs):
+    prototypes = {}
+    for include_dir in include_dirs:
+        sdk_dir = os.path.join(include_dir, SDK_HEADERS_DIR)
+        if not os.path.isdir(sdk_dir):
+            continue
+        for file_name in sorted(os.listdir(sdk_dir)):
+            if not (file_name.startswith("sx_api") and file_name.endswith(".h")):
+                continue
+            with open(os.path.join(sdk_dir, file_name)) as f:
+                found = ParsePrototypes(f.read(), SDK_HEADERS_DIR.replace(os.sep, "/") + "/" + file_name)
+            for name, prototype in found.items():
+                prototypes.setdefault(name, prototype)
+    return prototypes
+
+def _is_get(name):
+    return name.endswith("_get") or "_get_" in name
+
+def GenerateCall(prototype):
+    decls = ",\n".join("    " + p.decl for p in prototype.params) or "    void"
+    lines = ["sx_status_t {}(\n{})".format(prototype.name, decls), "{"]
+    for p in prototype.params:
+        if p.name and not (_is_get(prototype.name) and p.is_out):
+            lines.append("    (void){};".format(p.name))
+    if _is_get(prototype.name):
+        for p in prototype.params:
+            if p.is_out:
+                lines.append("    if ({0}) {{\n        memset({0}, 0, sizeof(*{0}));\n    }}".format(p.name))
+    lines.append("    return (sx_status_t)sx_api_stub_enter(SX_API_STUB_CALL_{});".format(prototype.name))
+    lines.append("}")
+    return "\n".join(lines)
+
+def Generate(calls, prototypes):
+    missing = [name for name in calls if name not in prototypes]
+    if missing:
+        raise ValueError("No SDK prototype for " + ", ".join(missing))
+    headers = sorted(set(prototypes[name].header for name in calls))
+    out = ["/* Generated by sx_api_stub_gen.py from the SDK headers, do not edit */", "",
+           "#include <string.h>", ""]
+    out += ["#include <{}>".format(h) for h in headers]
+    out += ["", "#include <{}>".format(STUB_HEADER), ""]
+    for name in calls:
+        out += [GenerateCall(prototypes[name]), ""]
+    return "\n".join(out)
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Generate the generic calls of the stub SDK")
+    parser.add_argument("--stub-header", required=True, help="Path of inc/sdk/sx_api_stub.h")
+    parser.add_argument("--include", action="append", default=[], help="Include dir of the SDK headers")
+    parser.add_argument("--output", required=True, help="Generated C file")
+    args = parser.parse_args(argv)
+
+    with open(args.stub_header) as f:
+        calls = StubCalls(f.read())
+    try:
+        text = Generate(calls, FindPrototypes(args.include))
+    except ValueError as e:
+        print("sx_api_stub_gen: {}".format(e), file=sys.stderr)
+        return 1
+    with open(args.output, "w") as f:
+        f.write(text)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
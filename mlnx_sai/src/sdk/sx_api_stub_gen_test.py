@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+
+import sys
+from sx_api_stub_gen import *
+
+STUB_HEADER = """
+#define SX_API_STUB_GENERIC_CALLS(X)   \\
+    X(sx_api_port_mtu_get)             \\
+    X(sx_api_vlan_set)
+
+#define SX_API_STUB_CUSTOM_CALLS(X)\\
+    X(sx_api_open)
+"""
+
+SDK_HEADER = """
+/**
+ * sx_status_t sx_api_commented_get(void);
+ */
+sx_status_t sx_api_port_mtu_get(const sx_api_handle_t  handle,
+                                const sx_port_log_id_t log_port,
+                                sx_port_mtu_t         *max_mtu_size_p,
+                                sx_port_mtu_t * const  oper_mtu_size_p);
+
+sx_status_t sx_api_vlan_set(const sx_api_handle_t handle,
+                            const sx_access_cmd_t cmd,
+                            const sx_swid_t       swid,
+                            sx_vid_t             *vlan_list_p,   /* in/out */
+                            uint32_t             *data_cnt_p);
+
+sx_status_t sx_api_open(sx_log_cb_t logging_cb, sx_api_handle_t *handle);
+sx_status_t sx_api_cb_set(const sx_api_handle_t handle, void (*cb)(int a, int *b), const char *name, void *ctx,
+                          uint32_t list[]);
+static inline sx_status_t sx_api_inline_get(const sx_api_handle_t handle) { return 0; }
+"""
+
+def TestStubCalls():
+    return StubCalls(STUB_HEADER) == ["sx_api_port_mtu_get", "sx_api_vlan_set"]
+
+def TestParsePrototypes():
+    prototypes = ParsePrototypes(SDK_HEADER, "sx/sdk/sx_api_port.h")
+    mtu = prototypes["sx_api_port_mtu_get"]
+    cb = prototypes["sx_api_cb_set"]
+    return sorted(prototypes) == ["sx_api_cb_set", "sx_api_open", "sx_api_port_mtu_get", "sx_api_vlan_set"] and \
+        [(p.name, p.is_out) for p in mtu.params] == [("handle", False), ("log_port", False),
+                                                      ("max_mtu_size_p", True), ("oper_mtu_size_p", True)] and \
+        [(p.name, p.is_out) for p in cb.params] == [("handle", False), ("cb", False), ("name", False),
+                                                     ("ctx", False), ("list", True)] and \
+        mtu.header == "sx/sdk/sx_api_port.h"
+
+def TestGenerateGetZeroesOutputs():
+    text = Generate(["sx_api_port_mtu_get"], ParsePrototypes(SDK_HEADER, "sx/sdk/sx_api_port.h"))
+    return "#include <sx/sdk/sx_api_port.h>" in text and \
+        "    sx_port_mtu_t *max_mtu_size_p," in text and \
+        "memset(max_mtu_size_p, 0, sizeof(*max_mtu_size_p));" in text and \
+        "memset(oper_mtu_size_p, 0, sizeof(*oper_mtu_size_p));" in text and \
+        "(void)log_port;" in text and \
+        "return (sx_status_t)sx_api_stub_enter(SX_API_STUB_CALL_sx_api_port_mtu_get);" in text
+
+def TestGenerateSetKeepsInputs():
+    text = Generate(["sx_api_vlan_set"], ParsePrototypes(SDK_HEADER, "sx/sdk/sx_api_vlan.h"))
+    return "memset" not in text and "(void)vlan_list_p;" in text and "(void)data_cnt_p;" in text
+
+def TestGenerateMissing():
+    try:
+        Generate(["sx_api_port_mtu_get", "sx_api_missing_set"], ParsePrototypes(SDK_HEADER, "sx/sdk/sx_api_port.h"))
+    except ValueError as e:
+        return "sx_api_missing_set" in str(e)
+    return False
+
+if __name__ == "__main__":
+    tests = [TestStubCalls, TestParsePrototypes, TestGenerateGetZeroesOutputs, TestGenerateSetKeepsInputs,
+             TestGenerateMissing]
+    failed = [t.__name__ for t in tests if not t()]
+    for name in failed:
+        print("{} failed".format(name))
+    sys.exit(1 if failed else 0)
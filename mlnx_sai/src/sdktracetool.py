@@ -0,0 +1,244 @@
+#!/usr/bin/env python
+
+# Offline analysis of the SDK call trace written by the SAI library built with --enable-sdk-trace
+# and started with SAI_SDK_TRACE_FILE set in the profile. Runs on any host, no SDK is needed.
+
+from __future__ import print_function
+
+import sys
+import struct
+import argparse
+from collections import namedtuple
+
+TRACE_MAGIC = 0x45434152544b4453
+TRACE_VERSION = 1
+NO_CMD = 0xffffffff
+NO_OP = 0xff
+
+HDR_FMT = "<QIIIIIIIIIIIIIIQ"
+RECORD_FMT = "<QQIIIiIHHB7x"
+
+Record = namedtuple("Record", "seq start_us duration_us tid sai_call_seq status cmd call sai_object_type sai_op")
+
+class Trace(object):
+    def __init__(self, calls, object_types, ops, cmds, records):
+        self.calls = calls
+        self.object_types = object_types
+        self.ops = ops
+        self.cmds = cmds
+        self.records = records
+
+    def call_name(self, record):
+        return self.calls[record.call] if record.call < len(self.calls) else "call_{}".format(record.call)
+
+    def cmd_name(self, record):
+        if record.cmd == NO_CMD:
+            return "-"
+        if record.cmd < len(self.cmds) and self.cmds[record.cmd]:
+            return self.cmds[record.cmd]
+        return str(record.cmd)
+
+    def api_name(self, record):
+        if not record.sai_call_seq:
+            return "-"
+        ot = self.object_types[record.sai_object_type] if record.sai_object_type < len(self.object_types) \
+            else str(record.sai_object_type)
+        op = self.ops[record.sai_op] if record.sai_op < len(self.ops) else str(record.sai_op)
+        return "{} {}".format(ot, op)
+
+def _names(data, offset, count, name_len):
+    names = []
+    for i in range(count):
+        raw = data[offset + i * name_len:offset + (i + 1) * name_len]
+        names.append(raw.split(b"\0", 1)[0].decode("ascii", "replace"))
+    return names
+
+def ParseTrace(data):
+    hdr_size = struct.calcsize(HDR_FMT)
+    if len(data) < hdr_size:
+        raise ValueError("Trace is too short")
+
+    (magic, version, _, record_size, records_max, records_offset, name_len,
+     call_off, call_cnt, ot_off, ot_cnt, op_off, op_cnt, cmd_off, cmd_cnt, head) = struct.unpack_from(HDR_FMT, data)
+    if magic != TRACE_MAGIC:
+        raise ValueError("Not an SDK trace file")
+    if version != TRACE_VERSION:
+        raise ValueError("Unsupported trace version {}".format(version))
+    if record_size != struct.calcsize(RECORD_FMT):
+        raise ValueError("Unexpected record size {}".format(record_size))
+
+    records = []
+    first = head - records_max if head > records_max else 0
+    for seq in range(first, head):
+        offset = records_offset + (seq % records_max) * record_size
+        if offset + record_size > len(data):
+            break
+        record = Record(*struct.unpack_from(RECORD_FMT, data, offset))
+        # Skip the records which were being written when the trace was taken
+        if record.seq != seq + 1:
+            continue
+        records.append(record)
+
+    return Trace(_names(data, call_off, call_cnt, name_len), _names(data, ot_off, ot_cnt, name_len),
+                 _names(data, op_off, op_cnt, name_len), _names(data, cmd_off, cmd_cnt, name_len), records)
+
+def ReadTrace(path):
+    with open(path, "rb") as f:
+        return ParseTrace(f.read())
+
+# Per SDK call and cmd - [calls, errors, total us, max us]
+def CallStats(trace):
+    stats = {}
+    for r in trace.records:
+        s = stats.setdefault((trace.call_name(r), trace.cmd_name(r)), [0, 0, 0, 0])
+        s[0] += 1
+        s[1] += 1 if r.status else 0
+        s[2] += r.duration_us
+        s[3] = max(s[3], r.duration_us)
+    return stats
+
+def _threads(trace):
+    threads = {}
+    for r in trace.records:
+        threads.setdefault(r.tid, []).append(r)
+    return threads
+
+def _api_calls(records):
+    calls = []
+    for r in records:
+        if not r.sai_call_seq:
+            continue
+        if calls and calls[-1][0] == r.sai_call_seq:
+            calls[-1][1].append(r)
+        else:
+            calls.append((r.sai_call_seq, [r]))
+    return calls
+
+# Per SAI API - [API calls, SDK calls, SDK us]
+def ApiStats(trace):
+    stats = {}
+    for records in _threads(trace).values():
+        for _, calls in _api_calls(records):
+            s = stats.setdefault(trace.api_name(calls[0]), [0, 0, 0])
+            s[0] += 1
+            s[1] += len(calls)
+            s[2] += sum(r.duration_us for r in calls)
+    return stats
+
+def _family(name):
+    for suffix in ("_get", "_set"):
+        if name.endswith(suffix):
+            return name[:-len(suffix)], suffix[1:]
+    return name, None
+
+# Back to back calls of a thread within one SAI API call:
+#   "get+set"   - get followed by set of the same object kind (read-modify-write)
+#   "set+get"   - set followed by get of the same object kind (read back)
+#   "get+get"   - the same get with the same cmd repeated
+# Returns {(kind, family, api): count}
+def RedundantPairs(trace):
+    pairs = {}
+    for records in _threads(trace).values():
+        for prev, cur in zip(records, records[1:]):
+            if not cur.sai_call_seq or prev.sai_call_seq != cur.sai_call_seq:
+                continue
+            prev_family, prev_kind = _family(trace.call_name(prev))
+            cur_family, cur_kind = _family(trace.call_name(cur))
+            if prev_family != cur_family or not prev_kind or not cur_kind:
+                continue
+            if prev_kind == "set" and cur_kind == "set":
+                continue
+            if prev_kind == "get" and cur_kind == "get" and prev.cmd != cur.cmd:
+                continue
+            key = (prev_kind + "+" + cur_kind, prev_family, trace.api_name(cur))
+            pairs[key] = pairs.get(key, 0) + 1
+    return pairs
+
+# Consecutive SAI API calls of a thread with the same object type and op which all make the same
+# SDK call could issue it once with all the objects.
+# Returns {(api, call, cmd): [runs, SDK calls, SDK us, longest run]} for the runs of min_run or more
+def BatchingRuns(trace, min_run):
+    result = {}
+
+    def flush(run):
+        if len(run) < min_run:
+            return
+        per_call = {}
+        for calls in run:
+            for r in calls:
+                s = per_call.setdefault((trace.call_name(r), trace.cmd_name(r)), [set(), 0, 0])
+                s[0].add(r.sai_call_seq)
+                s[1] += 1
+                s[2] += r.duration_us
+        for (call, cmd), (api_calls, sdk_calls, sdk_us) in per_call.items():
+            if len(api_calls) < min_run:
+                continue
+            s = result.setdefault((trace.api_name(run[0][0]), call, cmd), [0, 0, 0, 0])
+            s[0] += 1
+            s[1] += sdk_calls
+            s[2] += sdk_us
+            s[3] = max(s[3], len(api_calls))
+
+    for records in _threads(trace).values():
+        run = []
+        for _, calls in _api_calls(records):
+            if run and trace.api_name(run[-1][0]) != trace.api_name(calls[0]):
+                flush(run)
+                run = []
+            run.append(calls)
+        flush(run)
+
+    return result
+
+def PrintTimeline(trace, out):
+    start = trace.records[0].start_us if trace.records else 0
+    for r in sorted(trace.records, key=lambda r: r.start_us):
+        print("{:>12} {:>7} {:>6} {:<32} {:<40} {:<20} {:>8} {}".format(
+            r.start_us - start, r.tid, r.sai_call_seq, trace.api_name(r), trace.call_name(r), trace.cmd_name(r),
+            r.duration_us, r.status), file=out)
+
+def PrintReport(trace, min_run, out):
+    print("Records: {}".format(len(trace.records)), file=out)
+
+    print("\nSDK calls", file=out)
+    print("{:<40} {:<20} {:>10} {:>8} {:>12} {:>10} {:>10}".format(
+        "Call", "Cmd", "Calls", "Errors", "Total us", "Avg us", "Max us"), file=out)
+    for (call, cmd), s in sorted(CallStats(trace).items(), key=lambda kv: -kv[1][2]):
+        print("{:<40} {:<20} {:>10} {:>8} {:>12} {:>10} {:>10}".format(
+            call, cmd, s[0], s[1], s[2], s[2] // s[0], s[3]), file=out)
+
+    print("\nSDK calls per SAI API call", file=out)
+    print("{:<40} {:>10} {:>10} {:>10} {:>12}".format("SAI API", "API calls", "SDK calls", "Per call", "SDK us"),
+          file=out)
+    for api, s in sorted(ApiStats(trace).items(), key=lambda kv: -kv[1][1]):
+        print("{:<40} {:>10} {:>10} {:>10.2f} {:>12}".format(api, s[0], s[1], float(s[1]) / s[0], s[2]), file=out)
+
+    print("\nRedundant back to back get/set pairs", file=out)
+    print("{:<8} {:<40} {:<40} {:>10}".format("Pair", "Object", "SAI API", "Count"), file=out)
+    for (kind, family, api), count in sorted(RedundantPairs(trace).items(), key=lambda kv: -kv[1]):
+        print("{:<8} {:<40} {:<40} {:>10}".format(kind, family, api, count), file=out)
+
+    print("\nBatching opportunities (runs of {} or more SAI API calls)".format(min_run), file=out)
+    print("{:<40} {:<40} {:<20} {:>6} {:>10} {:>12} {:>8}".format(
+        "SAI API", "Call", "Cmd", "Runs", "SDK calls", "SDK us", "Longest"), file=out)
+    for (api, call, cmd), s in sorted(BatchingRuns(trace, min_run).items(), key=lambda kv: -kv[1][1]):
+        print("{:<40} {:<40} {:<20} {:>6} {:>10} {:>12} {:>8}".format(api, call, cmd, s[0], s[1], s[2], s[3]),
+              file=out)
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Analyze SAI SDK call trace")
+    parser.add_argument("trace", help="trace file (SAI_SDK_TRACE_FILE)")
+    parser.add_argument("--timeline", action="store_true", help="print the recorded calls in order")
+    parser.add_argument("--min-run", type=int, default=8,
+                        help="minimal number of consecutive SAI API calls reported as batching opportunity")
+    args = parser.parse_args(argv)
+
+    trace = ReadTrace(args.trace)
+    if args.timeline:
+        PrintTimeline(trace, sys.stdout)
+    else:
+        PrintReport(trace, args.min_run, sys.stdout)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+
+import sys
+import struct
+from sdktracetool import *
+
+NAME_LEN = 48
+CALLS = ["sx_api_router_uc_route_set", "sx_api_router_neigh_get", "sx_api_router_neigh_set", "sx_api_port_state_get"]
+OBJECT_TYPES = ["SAI_OBJECT_TYPE_NULL", "SAI_OBJECT_TYPE_PORT", "SAI_OBJECT_TYPE_ROUTE_ENTRY"]
+OPS = ["create", "remove", "set", "get"]
+CMDS = ["NONE", "ADD"]
+
+ROUTE_SET, NEIGH_GET, NEIGH_SET, PORT_STATE_GET = range(4)
+PORT, ROUTE = 1, 2
+CREATE, GET = 0, 3
+ADD = 1
+
+def BuildTrace(records, records_max=None, head=None):
+    records_max = records_max or len(records)
+    head = len(records) if head is None else head
+    hdr_size = struct.calcsize(HDR_FMT)
+    record_size = struct.calcsize(RECORD_FMT)
+    tables = b""
+    offsets = []
+    for names in (CALLS, OBJECT_TYPES, OPS, CMDS):
+        offsets += [hdr_size + len(tables), len(names)]
+        for name in names:
+            tables += name.encode("ascii").ljust(NAME_LEN, b"\0")
+    records_offset = (hdr_size + len(tables) + 7) & ~7
+    data = bytearray(struct.pack(HDR_FMT, TRACE_MAGIC, TRACE_VERSION, hdr_size, record_size, records_max,
+                                 records_offset, NAME_LEN, *(offsets + [head])))
+    data += tables
+    data += b"\0" * (records_offset + records_max * record_size - len(data))
+    for seq, r in enumerate(records):
+        struct.pack_into(RECORD_FMT, data, records_offset + (seq % records_max) * record_size, seq + 1, *r)
+    return bytes(data)
+
+# start_us duration_us tid sai_call_seq status cmd call sai_object_type sai_op
+def Rec(call, cmd=NO_CMD, tid=1, sai_call_seq=0, ot=0, op=NO_OP, duration=10, status=0, start=0):
+    return (start, duration, tid, sai_call_seq, status, cmd, call, ot, op)
+
+def RouteCreates(count, tid=1, first_seq=1):
+    records = []
+    for i in range(count):
+        seq = first_seq + i
+        records.append(Rec(NEIGH_GET, ADD, tid, seq, ROUTE, CREATE))
+        records.append(Rec(ROUTE_SET, ADD, tid, seq, ROUTE, CREATE))
+    return records
+
+def TestParse():
+    trace = ParseTrace(BuildTrace(RouteCreates(2)))
+    return (len(trace.records) == 4) and (trace.call_name(trace.records[1]) == "sx_api_router_uc_route_set") and \
+        (trace.cmd_name(trace.records[1]) == "ADD") and \
+        (trace.api_name(trace.records[1]) == "SAI_OBJECT_TYPE_ROUTE_ENTRY create")
+
+def TestParseWrapped():
+    # 6 records written to a ring of 4, the 2 oldest are overwritten
+    trace = ParseTrace(BuildTrace(RouteCreates(3), records_max=4))
+    return [r.seq for r in trace.records] == [3, 4, 5, 6]
+
+def TestParseSkipsIncomplete():
+    records = RouteCreates(2)
+    # Head was advanced for a record which was not finished
+    trace = ParseTrace(BuildTrace(records, records_max=8, head=len(records) + 1))
+    return len(trace.records) == len(records)
+
+def TestCallStats():
+    records = RouteCreates(3) + [Rec(PORT_STATE_GET, status=1, duration=40)]
+    stats = CallStats(ParseTrace(BuildTrace(records)))
+    return (stats[("sx_api_router_uc_route_set", "ADD")] == [3, 0, 30, 10]) and \
+        (stats[("sx_api_port_state_get", "-")] == [1, 1, 40, 40])
+
+def TestApiStats():
+    stats = ApiStats(ParseTrace(BuildTrace(RouteCreates(3) + [Rec(PORT_STATE_GET)])))
+    return stats == {"SAI_OBJECT_TYPE_ROUTE_ENTRY create": [3, 6, 60]}
+
+def TestRedundantPairs():
+    records = [Rec(NEIGH_GET, ADD, sai_call_seq=1, ot=PORT, op=GET),
+               Rec(NEIGH_GET, ADD, sai_call_seq=1, ot=PORT, op=GET),
+               Rec(NEIGH_SET, ADD, sai_call_seq=1, ot=PORT, op=GET),
+               Rec(NEIGH_GET, ADD, sai_call_seq=1, ot=PORT, op=GET),
+               # Different API call - not a pair
+               Rec(NEIGH_SET, ADD, sai_call_seq=2, ot=PORT, op=GET)]
+    pairs = RedundantPairs(ParseTrace(BuildTrace(records)))
+    api = "SAI_OBJECT_TYPE_PORT get"
+    return pairs == {("get+get", "sx_api_router_neigh", api): 1, ("get+set", "sx_api_router_neigh", api): 1,
+                     ("set+get", "sx_api_router_neigh", api): 1}
+
+def TestBatchingRuns():
+    # Run of 4 route creates on thread 1 broken by a port get, run of 2 on thread 2
+    records = RouteCreates(4) + [Rec(PORT_STATE_GET, sai_call_seq=5, ot=PORT, op=GET)] + \
+        RouteCreates(2, first_seq=6) + RouteCreates(2, tid=2)
+    runs = BatchingRuns(ParseTrace(BuildTrace(records)), 2)
+    api = "SAI_OBJECT_TYPE_ROUTE_ENTRY create"
+    return (runs[(api, "sx_api_router_uc_route_set", "ADD")] == [3, 8, 80, 4]) and \
+        (runs[(api, "sx_api_router_neigh_get", "ADD")] == [3, 8, 80, 4]) and \
+        (len(runs) == 2) and (len(BatchingRuns(ParseTrace(BuildTrace(records)), 5)) == 0)
+
+if __name__ == "__main__":
+    tests = [TestParse, TestParseWrapped, TestParseSkipsIncomplete, TestCallStats, TestApiStats, TestRedundantPairs,
+             TestBatchingRuns]
+    failed = [t.__name__ for t in tests if not t()]
+    for name in failed:
+        print("{} failed".format(name))
+    sys.exit(1 if failed else 0)